@@ -0,0 +1,14 @@
+var iterations = 0;
+
+// Each pair of objects references the other, so refcounting alone never frees
+// them and only a mark-and-sweep collection can.
+function churn() {
+    for (var i = 0; i < 200; i++) {
+        var a = { label: "node " + i };
+        var b = { peer: a, values: [i, i * 2, i * 3] };
+        a.peer = b;
+    }
+    iterations++;
+    document.getElementById("counter").inner3ML = "Iterations: " + iterations;
+    setTimeout(churn, 50);
+}
@@ -0,0 +1,16 @@
+function changeBacklight(step) {
+    var level = settings.get("display.backlight");
+    level = Math.max(16, Math.min(255, level + step));
+    settings.set("display.backlight", level);
+}
+
+// Called with the new value whenever the backlight changes, whether from
+// this page or from native code.
+function showBacklight(key, value) {
+    document.getElementById("backlight").inner3ML = "Backlight: " + value;
+}
+
+function watchBacklight() {
+    settings.subscribe("display.*", showBacklight);
+    showBacklight("display.backlight", settings.get("display.backlight"));
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "duktape.h"
+#include <Arduino.h>
+
+// Bytes reserved for the JS pools. PSRAM is preferred when the board has it;
+// otherwise the (much smaller) internal region is used.
+#define JS_POOL_BYTES_SPIRAM (256 * 1024)
+#define JS_POOL_BYTES_INTERNAL (48 * 1024)
+#define JS_POOL_CLASS_COUNT 10
+
+namespace threeml {
+
+/// @brief Occupancy of a single block size class.
+struct js_pool_class_stats_t {
+    uint16_t block_size;
+    uint16_t blocks;
+    uint16_t used;
+    uint16_t peak;
+};
+
+/// @brief Aggregate statistics for the allocator backing duktape heaps.
+struct js_pool_stats_t {
+    bool in_spiram;
+    std::size_t region_bytes;
+    std::size_t bytes_in_use;  // Rounded up to block sizes, overflow excluded
+    std::size_t peak_bytes_in_use;
+    uint32_t allocations;
+    uint32_t overflow_allocations; // Served by the general heap
+    uint32_t overflow_live;
+    uint32_t failed_allocations;
+    js_pool_class_stats_t classes[JS_POOL_CLASS_COUNT];
+};
+
+/// @brief Reserves the pool region. Called before the first duktape heap is
+/// created; later calls do nothing.
+/// @return A boolean indicating if the region is available.
+bool js_pool_init();
+
+/// @brief `duk_alloc_function` serving requests from size-class pools,
+/// falling back to the general heap (PSRAM first) for large or overflowing
+/// requests.
+void *js_pool_alloc(void *udata, duk_size_t size);
+
+/// @brief `duk_realloc_function` counterpart of `js_pool_alloc`.
+void *js_pool_realloc(void *udata, void *ptr, duk_size_t size);
+
+/// @brief `duk_free_function` counterpart of `js_pool_alloc`.
+void js_pool_free(void *udata, void *ptr);
+
+/// @brief Gets a snapshot of the allocator's statistics.
+js_pool_stats_t js_pool_stats();
+
+/// @brief Prints the allocator's statistics in the style of the `memory`
+/// shell command.
+void print_js_pool_stats(Print &out);
+
+} // namespace threeml
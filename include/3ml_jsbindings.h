@@ -7,16 +7,34 @@
 
 namespace threeml {
 
+class JSExecutor;
+
 DOMNode *get_element_by_id(DOM *dom, std::string id);
 
 static duk_ret_t _js_get_element_by_id(duk_context *ctx);
 static duk_ret_t _js_set_inner_3ml(duk_context *ctx);
+static duk_ret_t _js_set_timeout(duk_context *ctx);
+static duk_ret_t _js_subscribe_setting(duk_context *ctx);
 
 void construct_element(DOM *dom, DOMNode *node, duk_context *ctx);
 
-void load_js_file(duk_context *ctx, const char *filename);
+/// @brief Reads a script from the filesystem and evaluates it.
+/// @return A boolean indicating if the script ran without error.
+bool load_js_file(duk_context *ctx, const char *filename);
+
+/// @brief Pushes the callback registered by `setTimeout` under a timer id and
+/// forgets it, so each timer fires at most once.
+/// @return Whether a callback was pushed.
+bool push_timer_callback(duk_context *ctx, uint32_t timer_id);
+
+/// @brief Pushes the callback registered by `settings.subscribe` under a
+/// subscriber id.
+/// @return Whether a callback was pushed.
+bool push_subscriber(duk_context *ctx, uint32_t id);
 
-void create_js_bindings(duk_context *ctx, DOM *dom);
+/// @brief Defines the page's globals: `document`, `setTimeout` and the
+/// `settings` object, extended with `settings.subscribe(pattern, callback)`.
+void create_js_bindings(duk_context *ctx, DOM *dom, JSExecutor *executor);
 void switch_dom(DOM *dom, duk_context *ctx);
 
-} // namespace threeml
\ No newline at end of file
+} // namespace threeml
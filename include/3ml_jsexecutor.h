@@ -0,0 +1,217 @@
+#pragma once
+
+#include "3ml_cleaner.h"
+#include "duktape.h"
+#include "settings.h"
+#include <Arduino.h>
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define JS_EVENT_QUEUE_DEPTH 16
+#define JS_RESERVED_QUEUE_SLOTS 2 // Kept free for page load/unload events
+#define JS_EXECUTOR_STACK_SIZE 32768
+#define JS_EXECUTOR_PRIORITY 1
+#define JS_EXECUTOR_CORE 0 // The draw task runs on core 1
+#define JS_DEFAULT_BUDGET_MS 50 // Overridden by the `js.budget_ms` setting
+// Voluntary GC is compiled out of duktape; if the page never goes idle, a
+// collection is forced after this long without one.
+#define JS_FORCED_GC_INTERVAL_MS 5000
+
+namespace threeml {
+
+/// @brief A batch entry describing a DOM mutation made by a script. Scripts
+/// never touch the live DOM; the renderer applies commits between frames.
+struct dom_commit_t {
+    uint32_t generation;
+    DOMNode *node;
+    std::vector<DOMNode *> children;
+};
+
+/// @brief Counters describing the health of the JS event loop. Only the
+/// executor writes them, apart from events_dropped, which is counted by
+/// whichever task posts the event.
+struct js_stats_t {
+    uint32_t events_handled;
+    std::atomic<uint32_t> events_dropped;
+    uint32_t events_stale;
+    uint32_t max_queue_depth;
+    uint32_t commits;
+    int64_t total_latency_us;
+    int64_t max_latency_us;
+    int64_t last_load_us; // Heap creation, script loading and onload
+    int64_t max_load_us;
+    int64_t heap_create_us; // duk_create_heap alone, for the last page
+    std::size_t empty_heap_bytes; // Pool bytes used by a fresh heap
+    uint32_t idle_collections; // Requested by the renderer between frames
+    uint32_t forced_collections;
+    int64_t total_gc_us;
+    int64_t max_gc_us;
+};
+
+/// @brief Per-page counters of handler invocations. A handler is slow if it
+/// used more than half of its budget, and aborted if it ran out.
+struct js_page_stats_t {
+    uint32_t invocations;
+    uint32_t slow;
+    uint32_t aborted;
+};
+
+/// @brief Runs all Javascript for the current page on a dedicated task. The
+/// renderer posts events into a queue and never waits for a script to finish;
+/// DOM mutations come back as batched commits via `take_commits`. Every script
+/// invocation runs under a time budget and is aborted if it overruns.
+class JSExecutor {
+  public:
+    enum class EventType : uint8_t {
+        LOAD,
+        UNLOAD,
+        CLICK,
+        SLIDER,
+        TIMER,
+        SETTING,
+        GC
+    };
+
+  private:
+    struct js_event_t {
+        EventType type;
+        uint32_t generation;
+        int64_t posted_at;
+        DOM *dom;
+        char *code; // Owned by the event; freed by the executor
+        double value;
+        uint32_t id; // Of the timer or settings subscriber
+    };
+
+    QueueHandle_t m_queue;
+    SemaphoreHandle_t m_dom_mutex;
+    SemaphoreHandle_t m_commit_mutex;
+    TaskHandle_t m_task;
+    duk_context *m_ctx;
+    DOM *m_dom;
+    uint32_t m_generation;
+    uint32_t m_next_timer_id;
+    uint32_t m_next_subscriber_id;
+    std::vector<uint32_t> m_subscriptions; // Held by the current page
+    std::string m_page;
+    std::vector<dom_commit_t> m_staged;
+    std::vector<dom_commit_t> m_committed;
+    js_stats_t m_stats;
+    settings::Setting<double> m_budget_ms;
+    int64_t m_invocation_start;
+    int64_t m_deadline_us; // 0 while no script is running
+    int64_t m_last_gc_us;
+    std::atomic<bool> m_gc_pending; // Set before posting, cleared by the executor
+    std::unordered_map<std::string, js_page_stats_t> m_page_stats;
+
+    static void task_entry(void *arg);
+    static void timer_cb(TimerHandle_t timer);
+
+    /// @brief Posts an event to the queue without blocking. Input events are
+    /// dropped if the queue is nearly full so that page lifecycle events always
+    /// have room.
+    /// @return Whether the event was queued.
+    bool post(js_event_t &event, bool lifecycle);
+
+    void handle(js_event_t &event);
+    void create_context(DOM *dom);
+    void destroy_context();
+
+    /// @brief Evaluates a snippet of handler code, logging any error along with
+    /// the page and handler that raised it.
+    void eval_handler(const char *code, const char *handler);
+
+    /// @brief Arms the execution timeout for one script invocation, using the
+    /// budget from the `js.budget_ms` setting.
+    void begin_invocation();
+
+    /// @brief Disarms the execution timeout and updates the page's counters.
+    /// @param handler The name of the handler, used in diagnostics.
+    /// @param failed Whether the invocation ended with an error.
+    void end_invocation(const char *handler, bool failed);
+
+    /// @brief Runs a full mark-and-sweep collection of the page's heap.
+    /// @param idle Whether the renderer asked for it, as opposed to it being
+    /// forced by `JS_FORCED_GC_INTERVAL_MS`.
+    void collect_garbage(bool idle);
+
+    /// @brief Moves all mutations staged by the last handler into the batch
+    /// visible to the renderer.
+    void flush_staged();
+
+  public:
+    JSExecutor();
+    JSExecutor(const JSExecutor &) = delete;
+    JSExecutor &operator=(const JSExecutor &) = delete;
+
+    /// @brief Creates the event queue and launches the executor task. Can be
+    /// called multiple times without issue.
+    /// @param dom_mutex The mutex guarding the renderer's DOM. Held by the
+    /// executor only while C++ bindings read the DOM, never while scripts run.
+    /// @return A boolean indicating if the executor is running.
+    bool start(SemaphoreHandle_t dom_mutex);
+
+    /// @brief Tears down the previous page: runs its onbeforeunload handler,
+    /// destroys its JS heap and frees its DOM.
+    /// @param dom The DOM of the page being unloaded. Ownership passes to the
+    /// executor.
+    /// @param onbeforeunload The page's onbeforeunload handler, or nullptr.
+    void post_unload(DOM *dom, const char *onbeforeunload);
+
+    /// @brief Builds a fresh JS heap for a page, loads its scripts and runs its
+    /// onload handler.
+    /// @param dom The DOM of the page being loaded.
+    /// @param generation The renderer's generation number for this page.
+    /// @param page The path of the page, used in diagnostics.
+    /// @param onload The page's onload handler, or nullptr.
+    void post_load(DOM *dom, uint32_t generation, const char *page,
+                   const char *onload);
+
+    /// @brief Queues an onclick handler.
+    void post_click(uint32_t generation, const char *code);
+
+    /// @brief Queues an oninput handler; `event.value` holds the new value.
+    void post_input(uint32_t generation, const char *code, double value);
+
+    /// @brief Queues a garbage collection. Called by the renderer when nothing
+    /// is animating and no input is pending, so that the collection does not
+    /// delay a frame or a handler. Does nothing if one is already queued, and
+    /// the collection is skipped if other events arrive first.
+    void request_gc(uint32_t generation);
+
+    /// @brief Stages a DOM mutation made by the running script. Only called on
+    /// the executor task.
+    void stage_commit(DOMNode *node, std::vector<DOMNode *> &&children);
+
+    /// @brief Takes every mutation committed since the last call.
+    /// @param out Receives the commits, in the order they were made.
+    /// @return Whether any commits were taken.
+    bool take_commits(std::vector<dom_commit_t> &out);
+
+    void lock_dom();
+    void unlock_dom();
+
+    /// @brief Registers a one-shot timer that queues a TIMER event.
+    /// @return The id of the timer, or 0 on failure.
+    uint32_t add_timer(uint32_t delay_ms);
+
+    /// @brief Subscribes the current page to a setting. Only called on the
+    /// executor task; the subscription ends when the page is unloaded.
+    /// @param pattern A key, or a prefix followed by `*`.
+    /// @return The id under which the page's callback is stashed.
+    uint32_t subscribe_setting(const char *pattern);
+
+    /// @brief Whether the running invocation has used up its time budget.
+    /// Polled by duktape through `DUK_USE_EXEC_TIMEOUT_CHECK`.
+    bool budget_exceeded() const;
+
+    const js_stats_t &stats() const;
+    std::size_t queue_depth() const;
+
+    /// @brief Prints the handler counters of every page visited since boot.
+    void print_page_stats(Print &out) const;
+};
+
+} // namespace threeml
@@ -2,14 +2,17 @@
 
 #include "3ml_cleaner.h"
 #include "3ml_jsbindings.h"
+#include "3ml_jsexecutor.h"
 #include "battery.h"
-#include "button.h"
 #include "display.h"
 #include "duktape.h"
+#include "input_events.h"
 #include "meta.h"
+#include "spsc_queue.h"
 #include "state.h"
 #include "usb_classes.h"
 #include <Arduino.h>
+#include <atomic>
 #include <stack>
 
 #define STATUS_BAR_HEIGHT 20 // Pixels
@@ -17,9 +20,23 @@
 #define SECONDARY_COLOR color_rgb(204, 88, 3)
 #define TEXT_COLOR color_rgb(255, 255, 255)
 #define BACKGROUND_COLOR color_rgb(31, 19, 0)
+#define IDLE_GC_DELAY_MS 500     // Quiet time after input before collecting
+#define IDLE_GC_INTERVAL_MS 1000 // Minimum time between idle collections
+#define RENDERER_INPUT_QUEUE_LENGTH 16 // Must be a power of two
 
 namespace threeml {
 
+/// @brief Frame timing counters, used to spot hitches caused by scripts. All
+/// but dropped_inputs belong to the draw task.
+struct frame_stats_t {
+    uint32_t frames;
+    int64_t last_frame_us;
+    int64_t max_frame_us;
+    uint32_t gc_requests;
+    // Button events that found the input queue full; counted on the input task
+    std::atomic<uint32_t> dropped_inputs;
+};
+
 class Renderer {
   private:
     struct selectable_node_t {
@@ -42,19 +59,22 @@ class Renderer {
     std::vector<selectable_node_t> m_selectable_nodes;
     std::size_t m_current_selected;
     long m_scroll_target; // signed to allow for simpler clamping code
-    Button m_up_button;
-    Button m_down_button;
+    // Button events, from the input task to the draw task
+    SpscQueue<InputEvent, RENDERER_INPUT_QUEUE_LENGTH> m_input;
     bool m_dom_rendered;
     bool m_initialized;
     std::stack<std::string> m_file_stack;
     std::size_t m_total_height;
     std::string m_title;
-    duk_context *m_js_ctx;
+    JSExecutor m_js;
+    uint32_t m_generation;
+    std::vector<dom_commit_t> m_commits;
     bool m_must_reload;
     std::string m_current_file;
     bool m_going_back;
-    bool m_callback_to_run;
-    std::string m_pending_callback;
+    TickType_t m_last_input;
+    TickType_t m_last_gc_request;
+    frame_stats_t m_frame_stats;
 
     /// @brief Clamps the value of m_scroll_target so that the screen doesn't
     /// show anything outside of the document, if possible.
@@ -80,6 +100,27 @@ class Renderer {
 
     void go_back();
 
+    /// @brief Queues a button event for the next frame. Called on the input
+    /// task, so it touches nothing but the queue.
+    /// @param event The event, which is ignored unless it is for one of the
+    /// scroll buttons.
+    void post_input(const InputEvent &event);
+
+    /// @brief Acts on the button events queued since the last frame. Steps
+    /// in a row are added up and applied together, so a backlog of repeats
+    /// costs one pass.
+    void handle_input();
+
+    /// @brief Applies the DOM mutations that scripts have committed since the
+    /// last frame. Must be called with the DOM locked.
+    /// @return Whether the DOM changed.
+    bool apply_commits();
+
+    /// @brief Asks the executor to collect garbage if nothing has happened on
+    /// screen for a while: no input, no scrolling and no script mutations.
+    /// @param dom_changed Whether scripts changed the DOM this frame.
+    void request_idle_gc(bool dom_changed);
+
     /// @brief Renders the status bar on the screen. Status bar is always at the
     /// top, is STATUS_BAR_HEIGHT pixels tall, and its background is
     /// ACCENT_COLOR.
@@ -141,9 +182,11 @@ class Renderer {
   public:
     Renderer(TFT_Parallel *display)
         : m_display(display), m_dom(nullptr), m_scroll_height(0),
-          m_current_selected(0), m_up_button(0), m_down_button(14),
-          m_dom_rendered(false), m_initialized(false), m_js_ctx(nullptr),
-          m_title("3ML"), m_total_height(0), m_scroll_target(0), m_file_stack(),
+          m_current_selected(0), m_input(),
+          m_dom_rendered(false), m_initialized(false), m_js(),
+          m_generation(0), m_commits(), m_must_reload(false),
+          m_going_back(false), m_last_input(0), m_last_gc_request(0),
+          m_frame_stats{}, m_title("3ML"), m_total_height(0), m_scroll_target(0), m_file_stack(),
           m_selectable_nodes(), m_dom_mutex(nullptr) {
         m_dom_mutex = xSemaphoreCreateMutex();
     }
@@ -155,8 +198,8 @@ class Renderer {
     // Calls the onbeforeunload event on the current DOM, if there is one.
     ~Renderer();
 
-    /// @brief Initializes the renderer by setting up the display, buttons and
-    /// Javascript context. Can be called multiple times without issue.
+    /// @brief Initializes the renderer by subscribing to button input and
+    /// setting up the Javascript executor. Can be called multiple times without issue.
     /// @return A boolean indicating if initialization was successful.
     bool init();
 
@@ -172,10 +215,19 @@ class Renderer {
     /// @return A boolean indicating if loading the file was successful.
     bool load_file(const char *path, bool add_to_stack = true);
 
-    /// @brief Loads a new DOM into the renderer, clearing the old one. Does not
-    /// free the old DOM, in case this method is used to reload the DOM after
-    /// modifying it.
+    /// @brief Loads a new DOM into the renderer, clearing the old one. The old
+    /// DOM is handed to the Javascript executor, which frees it after running
+    /// its onbeforeunload handler. Loading the current DOM again reloads its
+    /// scripts without running onload or freeing anything.
     /// @param dom The new DOM to load.
     void load_dom(DOM *dom);
+
+    /// @brief Gets the executor running this renderer's Javascript.
+    const JSExecutor &js_executor() const;
+
+    const frame_stats_t &frame_stats() const;
+
+    /// @brief Clears the worst-case frame time, e.g. before measuring a page.
+    void reset_frame_stats();
 };
 } // namespace threeml
\ No newline at end of file
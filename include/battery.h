@@ -1,24 +1,77 @@
 #pragma once
 #include <Arduino.h>
+#include <functional>
 
 #ifdef PRO_FEATURES
 #define BAT_ADC_PIN GPIO_NUM_4
 #endif
 
-#define BATTERY_FILTER_GAIN 0.3f
+#define BATTERY_FILTER_GAIN 0.3f      // Weight of the previous reading
+#define BATTERY_SAMPLE_INTERVAL_MS 1000
+#define BATTERY_OVERSAMPLE 16         // Conversions per reading
+#define BATTERY_TRIM 4                // Dropped from each end of a sorted burst
+#define BATTERY_HYSTERESIS 0.3f       // Percent past rounding before the shown level moves
+#define BATTERY_STACK_SIZE 2048
+#define BATTERY_PRIORITY 1
+#define BATTERY_MAX_SUBSCRIBERS 4
+#define BATTERY_LOW_PERCENT 10        // Shown levels at or below this are warned about
 
 namespace battery {
 
-/// @brief Get current battery voltage, if available. If not, return a default
-/// voltage of 3.7V. Filtered using an alpha filter with gain of
-/// BATTERY_FILTER_GAIN.
+/// @brief Called with the new percentage on the sampler task; must return
+/// quickly.
+typedef std::function<void(uint8_t percent)> subscriber_t;
+
+/// @brief Takes a first reading and starts the task that keeps the cached one
+/// up to date. Every BATTERY_SAMPLE_INTERVAL_MS it takes BATTERY_OVERSAMPLE
+/// conversions, averages the middle ones and filters the result with a gain
+/// of BATTERY_FILTER_GAIN. Does nothing if there is no battery to measure.
+/// @return A boolean indicating if the sampler is running.
+bool start();
+
+/// @brief Gets whether the sampler is running, so there is a measured
+/// level to show. False on boards with no battery to measure.
+/// @return A boolean indicating if readings are real.
+bool available();
+
+/// @brief Get the latest battery voltage, if available. If not, return a
+/// default voltage of 3.7V. This is the voltage at BAT_ADC_PIN, taken as the
+/// cell's. Never touches the ADC.
 /// @return The current battery voltage.
 float get_voltage();
-/// @brief Get the current estimated battery percentage. Returns 100% if the
-/// battery voltage is not available; otherwise, assumes that the battery's
-/// voltage-charge relationship is linear and that it is fully charged at 3.7V
-/// and empty at 3.2V. Clamps the result to the range 0% to 100%.
+
+/// @brief Get the current estimated battery percentage, by the discharge curve.
+/// Returns 100% if the battery voltage is not available. Never touches the
+/// ADC.
 /// @return The current estimated battery percentage.
 float get_level();
 
-} // namespace battery
\ No newline at end of file
+/// @brief Get the percentage as it should be shown. It only moves once the
+/// estimate is BATTERY_HYSTERESIS past rounding to another value, so noise
+/// can't make it flicker.
+/// @return The percentage to show, 0 to 100.
+uint8_t get_percent();
+
+/// @brief Calls `callback` whenever `get_percent` changes. Must be called
+/// before `start`.
+/// @return A boolean indicating if there was room for the subscriber.
+bool subscribe(subscriber_t callback);
+
+/// @brief Estimates the charge of a LiPo cell resting at `voltage`, by
+/// interpolating a table of its discharge curve.
+/// @param voltage The cell voltage.
+/// @return The estimated percentage, 0 to 100.
+float level_for_voltage(float voltage);
+
+/// @brief Counters describing the sampler.
+struct sampler_stats_t {
+    uint32_t readings;
+    uint32_t conversions;
+    uint32_t last_burst_us; // Time spent converting for the last reading
+    uint32_t spread_mv;     // Between the lowest and highest conversion kept
+    uint32_t notifications;
+};
+
+sampler_stats_t stats();
+
+} // namespace battery
@@ -1,73 +1,66 @@
 #pragma once
 
 #include <Arduino.h>
+#include <atomic>
 
-#include "virtual_callback.h"
+#include "input_events.h"
+#include "spsc_queue.h"
 
-#define DEBOUNCE_DURATION pdMS_TO_TICKS(10)
-#define LONG_PRESS_DURATION pdMS_TO_TICKS(500)
+#define BUTTON_EDGE_QUEUE_LENGTH 16     // Must be a power of two
 
-/// @brief Represents a physical (mechanical) button connected to a GPIO pin; performs debouncing.
+/// @brief Represents a physical (mechanical) button connected to a GPIO pin. Its interrupt only queues timestamped edges;
+/// the input task takes them and debounces them with a `KeyTracker`.
 class Button {
 public:
-    /// @brief The kinds of events understood by the `Button` class
-    enum class Event : size_t {
-        PRESS,   // Occurs at the moment the button is pressed down
-        RELEASE, // Occurs at the moment the button is released regardless of how long it was held down; immediately after duration-specific events
-        CLICK,   // Occurs at the moment the button is released if it was held down for less time than `LONG_PRESS_DURATION`
-        HOLD,    // Occurs at the moment the button is released if it was held down for longer than `LONG_PRESS_DURATION`
-        EnumSize // Needs to be the last element of the enum class; it will hold the enum's cardinality
+    /// @brief A change of the pin, as the interrupt saw it
+    struct Edge {
+        bool pressed;
+        int64_t timeUs;     // esp_timer_get_time() in the interrupt
     };
 
 private:
     const int pin;
-    bool state;
-    TickType_t pressTimestamp;
-    BaseCallback *callbacks[(size_t)Event::EnumSize];
-    TimerHandle_t debounceTimer;
+    SpscQueue<Edge, BUTTON_EDGE_QUEUE_LENGTH> edges;
+    std::atomic<bool> overflowed;
+    std::atomic<uint32_t> overflows;
+    TaskHandle_t consumer;
+    KeyTracker key;
 
     /// @brief An interrupt service routine shared by all `Button` instances; it will immediately be executed when a `Button` instance's pin changes state
     /// @param arg A pointer to the instance of `Button` that `ISR` should handle
     static void IRAM_ATTR ISR(void *arg);
 
-    /// @brief A timer callback function shared by all `Button` instances matching `TimerCallbackFunction_t`.
-    /// It will be invoked `DEBOUNCE_DURATION` ticks after `ISR`
-    /// @param timer 
-    static void DebounceCB(TimerHandle_t timer);
-
-    /// @brief A deferred callback invoker matching `PendedFunction_t`
-    /// @param instance A pointer to the instance of `Button` for which to invoke a callback
-    /// @param cbIdx An index into the target `Button` instance's `callbacks` array specifying which callback to invoke
-    static void cbInvoker(void *instance, uint32_t cbIdx);
-
-    /// @brief Check whether the state of a button has changed and invoke any relevant callbacks.
-    /// Callbacks will always be invoked by the FreeRTOS timer daemon task.
-    /// @param callTime The time in FreeRTOS ticks at which `poll` is being called
-    /// @param inISR Whether `poll` is being invoked from an interrupt context; if so, any requisite callbacks will be deferred to a task context using `cbInvoker` via `xTimerPendFunctionCallFromISR`.
-    /// @return Whether the button's state has changed since the previous invocation of `poll`
-    bool IRAM_ATTR poll(const TickType_t callTime, const bool inISR);
-
 public:
     /// @brief Create an object representing a button connected to a GPIO pin. `Button::attach()` must be called later to attach the `Button` handlers to the GPIO pin.
     /// @param pin The GPIO pin number to which the button is connected
-    Button(int pin);
+    /// @param repeats Whether holding the button down repeats it, as for scrolling
+    Button(int pin, bool repeats = false);
     ~Button();
 
     /// @brief Attach the `Button` object to its GPIO pin. This functionality is separate from the constructor because GPIO functions are not available until `void setup()` is invoked.
+    /// The calling task becomes the consumer: it is notified of every edge and is the only one that may `take` them or use `tracker`.
     void attach();
 
-    /// @brief Register a callback function to be executed when a particular `Button::Event` occurs
-    /// @tparam F The type of the callback function; it need only be an invocable object. This argument should be deduced automatically.
-    /// @param e The event upon which the callback function should be executed
-    /// @param callbackFn The callback function to execute
-    /// @return An lvalue reference to the same `Button` instance; calls to `Button::on` can be chained for nice formatting
-    template <typename F>
-    Button& on(Event e, F&& callbackFn) {
-        callbacks[(size_t)e] = new Callback<F>(std::forward<F>(callbackFn));
-        return *this;
-    }
+    /// @brief Take the oldest queued edge. If edges were lost to a full queue, the pin's current level is made up into one.
+    /// @param edge Where to write the edge
+    /// @return Whether there was an edge to take
+    bool take(Edge& edge);
+
+    /// @brief Reads the pin directly
+    /// @return Whether the button is held down right now, bounce and all
+    bool level() const;
 
-    /// @brief Gets whether the button is presed.
+    int getPin() const { return pin; }
+
+    KeyTracker& tracker() { return key; }
+
+    /// @brief Gets whether the button is pressed, once debounced.
     /// @return Whether the button is pressed.
     bool isPressed() const;
-};
\ No newline at end of file
+
+    /// @brief Gets how many edges were ignored as contact bounce
+    uint32_t bounces() const { return key.bounces(); }
+
+    /// @brief Gets how many edges were lost to a full queue
+    uint32_t lostEdges() const { return overflows.load(std::memory_order_relaxed); }
+};
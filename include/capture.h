@@ -0,0 +1,105 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FFat.h>
+#include <atomic>
+#include <string>
+#include <vector>
+#include "capture_format.h"
+#include "imu_pipeline.h"
+
+#define CAPTURE_BUFFER_SIZE 4096        // Bytes in each half of the double buffer
+#define CAPTURE_MAX_SECONDS 3600        // Record times are 32-bit microseconds
+#define CAPTURE_DEFAULT_PATH "/capture.mlc"
+#define CAPTURE_WRITER_STACK_SIZE 4096
+#define CAPTURE_WRITER_PRIORITY 2       // Above the tasks that produce records
+
+// Records IMU samples, touch pads and buttons to a capture file on FFat.
+// Producers fill one half of a double buffer while a writer task saves the
+// other, so file writes never hold them up. Not recording costs a load.
+class CaptureRecorder {
+public:
+    struct Stats {
+        bool recording;
+        std::string path;
+        uint32_t records;
+        uint32_t dropped;       // Both halves were full
+        uint32_t bytesWritten;
+        bool writeFailed;
+        int64_t elapsedUs;
+    };
+
+    CaptureRecorder();
+
+    // Starts recording for `seconds` into a new file at `path`
+    bool start(const char *path, uint32_t seconds);
+
+    // Ends the recording early; the writer saves what is buffered
+    void stop();
+
+    bool isRecording() const { return recording.load(std::memory_order_relaxed); }
+
+    void addOrientation(const OrientationSample& sample) {
+        if (isRecording())
+            appendOrientation(sample);
+    }
+
+    // Safe to call from interrupt handlers
+    void addInput(CaptureRecordType type, uint8_t id, bool pressed) {
+        if (isRecording())
+            appendInput(type, id, pressed);
+    }
+
+    Stats stats() const;
+
+private:
+    struct Buffer {
+        uint8_t *data;
+        size_t used;
+    };
+
+    void appendOrientation(const OrientationSample& sample);
+    void appendInput(CaptureRecordType type, uint8_t id, bool pressed);
+    void append(const uint8_t *record, size_t size);
+    bool writeBuffer(Buffer& buffer);
+    static void writerEntry(void *arg);
+
+    std::atomic<bool> recording;
+    std::atomic<bool> stopRequested;
+    mutable portMUX_TYPE lock;
+    Buffer buffers[2];
+    uint8_t active;             // The half producers append to
+    int64_t startTimeUs;
+    int64_t endTimeUs;
+    TaskHandle_t writer;
+    fs::File file;
+    std::string path;
+    uint32_t records;
+    uint32_t dropped;
+    uint32_t bytesWritten;
+    bool writeFailed;
+};
+
+extern CaptureRecorder captureRecorder;
+
+// Plays back the orientation records of a capture in real time, stamped as
+// if the sensor had just produced them. Other records are skipped.
+class ReplaySource : public OrientationSource {
+    CaptureReader reader;
+    CaptureRecord pending;
+    bool hasPending;
+    int64_t startUs;
+    std::atomic<bool> done;
+
+public:
+    ReplaySource(const uint8_t *data, size_t size);
+
+    bool begin() override;
+    size_t read(OrientationSample *out, size_t capacity, TickType_t timeout) override;
+
+    // Whether every sample has been read
+    bool finished() const { return done.load(std::memory_order_acquire); }
+};
+
+// Reads a whole capture file into `out`
+bool loadCapture(const char *path, std::vector<uint8_t>& out);
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Input captures are a header followed by records, all little-endian and
+// unpadded. Every record starts with its type and its time in microseconds
+// since the capture started; the payload depends on the type.
+//
+//   ORIENTATION  float roll, pitch, yaw (degrees), as the IMU reported them
+//   TOUCH        u8 pad, u8 pressed
+//   BUTTON       u8 GPIO pin, u8 pressed
+
+#define CAPTURE_MAGIC "MLCP"
+#define CAPTURE_VERSION 1
+
+enum class CaptureRecordType : uint8_t {
+    ORIENTATION = 1,
+    TOUCH = 2,
+    BUTTON = 3,
+};
+
+struct CaptureHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t reserved;
+    int64_t startTimeUs;    // esp_timer_get_time() when recording started
+} __attribute__((packed));
+
+struct CaptureRecordHeader {
+    CaptureRecordType type;
+    uint32_t timeUs;        // Since startTimeUs; captures are limited to an hour
+} __attribute__((packed));
+
+struct CaptureOrientation {
+    float roll;
+    float pitch;
+    float yaw;
+} __attribute__((packed));
+
+struct CaptureInput {
+    uint8_t id;
+    uint8_t pressed;
+} __attribute__((packed));
+
+// The largest record, header included
+#define CAPTURE_MAX_RECORD (sizeof(CaptureRecordHeader) + sizeof(CaptureOrientation))
+
+struct CaptureRecord {
+    CaptureRecordType type;
+    uint32_t timeUs;
+    CaptureOrientation orientation;     // ORIENTATION only
+    CaptureInput input;                 // TOUCH and BUTTON only
+};
+
+// Walks the records of a capture held in memory. Doesn't depend on the
+// device, so captures can be analyzed on a host too.
+class CaptureReader {
+    const uint8_t *data;
+    size_t size;
+    size_t pos;
+    bool ok;
+
+    bool take(void *out, size_t length) {
+        if (size - pos < length)
+            return false;
+        memcpy(out, data + pos, length);
+        pos += length;
+        return true;
+    }
+
+public:
+    CaptureReader(const uint8_t *data, size_t size)
+        : data(data)
+        , size(size)
+        , pos(0)
+        , ok(false)
+    {
+        CaptureHeader header;
+        ok = take(&header, sizeof(header)) && memcmp(header.magic, CAPTURE_MAGIC, 4) == 0 && header.version == CAPTURE_VERSION;
+    }
+
+    // Whether the header was recognized
+    bool valid() const { return ok; }
+
+    void rewind() { pos = sizeof(CaptureHeader); }
+
+    // Returns false at the end of the capture, or at a record of an unknown
+    // type or one cut short, since the rest can't be parsed
+    bool next(CaptureRecord& record) {
+        if (!ok)
+            return false;
+        CaptureRecordHeader header;
+        size_t start = pos;
+        if (!take(&header, sizeof(header)))
+            return false;
+        record.type = header.type;
+        record.timeUs = header.timeUs;
+        bool complete = false;
+        switch (header.type) {
+        case CaptureRecordType::ORIENTATION:
+            complete = take(&record.orientation, sizeof(record.orientation));
+            break;
+        case CaptureRecordType::TOUCH:
+        case CaptureRecordType::BUTTON:
+            complete = take(&record.input, sizeof(record.input));
+            break;
+        }
+        if (!complete) {
+            pos = start;
+            return false;
+        }
+        return true;
+    }
+};
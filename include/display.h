@@ -8,6 +8,7 @@
 #include "hal/lcd_types.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include "timeline.h"
 
 #define EXAMPLE_LCD_PIXEL_CLOCK_HZ (16 * 1000 * 1000)
 #define CONFIG_EXAMPLE_LCD_I80_BUS_WIDTH 8
@@ -76,6 +77,7 @@ public:
 
 static bool on_color_trans_done(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx) {
     TFT_Parallel::trans_done = true;
+    TIMELINE_INSTANT("dma done");
     return false;
 }
 
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Arduino.h>
+#include <BleMouse.h>
+#include "mouse_transport.h"
+#include "usb_classes.h"
+
+#define BLE_REPORT_INTERVAL_US 7500     // Shortest BLE connection interval
+#define USB_REPORT_INTERVAL_US (USB_MOUSE_POLL_MS * 1000)
+
+// Reports over Bluetooth. BleMouse sends button changes as reports of their
+// own and gives no sign of congestion, so reports are paced to one per
+// connection interval instead; more would only queue up in the stack.
+class BleTransport : public MouseTransport {
+    BleMouse& mouse;
+    uint8_t buttons;
+    int64_t lastSendUs;
+
+public:
+    explicit BleTransport(BleMouse& mouse);
+
+    const char *name() const override { return "ble"; }
+    bool begin() override;
+    bool connected() const override;
+    bool ready() const override;
+    bool send(const MouseReport& report) override;
+    uint32_t intervalUs() const override { return BLE_REPORT_INTERVAL_US; }
+};
+
+// Reports over the USB HID interface while plugged in
+class UsbTransport : public MouseTransport {
+public:
+    const char *name() const override { return "usb"; }
+    bool begin() override { return true; }     // With the other USB classes, in setup
+    bool connected() const override;
+    bool ready() const override;
+    bool send(const MouseReport& report) override;
+    uint32_t intervalUs() const override { return USB_REPORT_INTERVAL_US; }
+};
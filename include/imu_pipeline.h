@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "latency_histogram.h"
+#include "spsc_queue.h"
+
+#define IMU_QUEUE_LENGTH 64         // Samples; must be a power of two
+#define IMU_READ_BATCH 8            // Samples taken from the source per read
+#define IMU_READ_TIMEOUT_MS 20      // Read even without a data-ready signal, in case one was missed
+#define IMU_READER_PRIORITY 5       // Above every task that consumes samples
+#define IMU_READER_STACK_SIZE 4096
+
+// Rotation measurement structure
+struct Orientation
+{
+    float roll;
+    float pitch;
+    float yaw;
+};
+
+struct OrientationSample {
+    Orientation orientation;
+    int64_t sensorTime;     // esp_timer_get_time() when the sensor signalled the sample
+    int64_t readTime;       // When the reader task took it off the source; set by the pipeline
+};
+
+// Something that produces orientation samples: the BNO086, or a synthetic or
+// recorded source standing in for it. `begin` and `read` are only called
+// from the pipeline's reader task.
+class OrientationSource {
+public:
+    virtual ~OrientationSource() {}
+
+    virtual bool begin() = 0;
+
+    // Waits up to `timeout` for the sensor to signal new data, then reads
+    // every pending sample, at most `capacity`. Returns the number read.
+    virtual size_t read(OrientationSample *out, size_t capacity, TickType_t timeout) = 0;
+};
+
+// Moves samples from a source into a queue on a high-priority reader task,
+// so they are taken off the sensor as soon as it signals them regardless of
+// how busy the consumer is.
+class ImuPipeline {
+public:
+    struct Stats {
+        uint32_t reads;         // Calls into the source, including timeouts
+        uint32_t samples;       // Queued for the consumer
+        uint32_t dropped;       // Lost because the queue was full
+        uint32_t peakDepth;
+    };
+
+    explicit ImuPipeline(OrientationSource& source);
+
+    // Starts the reader task, which begins the source
+    bool start();
+    void stop();
+
+    // Consumer side; only one task may consume. Waits up to `timeout` for a
+    // sample and records its sensor-to-consumer latency.
+    bool pop(OrientationSample& sample, TickType_t timeout);
+
+    Stats stats() const;
+    const LatencyHistogram& latency() const { return consumerLatency; }
+    void resetStats();
+
+private:
+    static void readerEntry(void *arg);
+
+    OrientationSource& source;
+    SpscQueue<OrientationSample, IMU_QUEUE_LENGTH> queue;
+    TaskHandle_t reader;
+    std::atomic<TaskHandle_t> consumer;
+    std::atomic<uint32_t> reads;
+    std::atomic<uint32_t> samples;
+    std::atomic<uint32_t> dropped;
+    std::atomic<uint32_t> peakDepth;
+    LatencyHistogram consumerLatency;
+};
+
+// Moves the orientation in a slow circle at a fixed sample rate, for running
+// the pipeline without a sensor
+class SyntheticSource : public OrientationSource {
+    const uint32_t rateHz;
+    uint32_t sampleIndex;
+    TickType_t wakeTime;
+
+public:
+    explicit SyntheticSource(uint32_t rateHz);
+
+    bool begin() override;
+    size_t read(OrientationSample *out, size_t capacity, TickType_t timeout) override;
+};
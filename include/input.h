@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <functional>
+#include "button.h"
+#include "input_events.h"
+#include "touch_gestures.h"
+
+#define UP_BUTTON_PIN 0             // Scrolls up; held, goes back
+#define DOWN_BUTTON_PIN 14          // Scrolls down; held, follows the selection
+#define INPUT_MAX_BUTTONS 4
+#define INPUT_MAX_SUBSCRIBERS 8
+
+// Turns the edges that button and touch pad interrupts queue into input
+// events, and hands each one to every subscriber on the input task. Nothing
+// in between runs in the timer daemon.
+class InputHub {
+public:
+    // Runs on the input task, so it must not block. Consumers on other tasks
+    // should queue what they need and take it on their own.
+    typedef std::function<void(const InputEvent&)> Subscriber;
+
+    struct Stats {
+        uint32_t events[static_cast<size_t>(InputType::COUNT)];
+        uint32_t subscribers;
+    };
+
+    InputHub();
+
+    // Before `run`; the hub keeps a reference
+    bool addButton(Button& button);
+
+    // Before `run`, like buttons. Returns false when full.
+    bool subscribe(Subscriber subscriber);
+
+    // The input task's body; never returns. Set the touch pads up from the
+    // same task first, so it is their consumer.
+    void run();
+
+    Stats stats() const;
+
+    // Buttons as added, for diagnostics
+    size_t buttonCount() const { return buttons; }
+    const Button& button(size_t i) const { return *buttonList[i]; }
+
+    GestureDetector::Stats gestureStats() const { return gestures.stats(); }
+
+private:
+    void publish(const InputEvent& event);
+
+    Button *buttonList[INPUT_MAX_BUTTONS];
+    size_t buttons;
+    Subscriber subscriberList[INPUT_MAX_SUBSCRIBERS];
+    size_t subscribers;
+    std::atomic<uint32_t> counters[static_cast<size_t>(InputType::COUNT)];
+    GestureDetector gestures;
+};
+
+extern InputHub inputHub;
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define KEY_DEBOUNCE_US 10000           // Edges this soon after a change are contact bounce
+#define KEY_LONG_PRESS_US 500000        // Released after this, a press is a hold rather than a click
+#define KEY_REPEAT_ARM_US 300000        // A press this soon after a click can repeat
+#define KEY_REPEAT_DELAY_US 800000      // Held this long, such a press starts to repeat
+#define KEY_REPEAT_START_US 150000      // First gap between repeats
+#define KEY_REPEAT_MIN_US 30000         // Repeats speed up until this far apart
+#define KEY_MAX_EVENTS 2                // Most events one call reports
+
+enum class InputType : uint8_t {
+    BUTTON_PRESS,
+    BUTTON_RELEASE,     // Right after the CLICK or HOLD it ends, if any
+    BUTTON_CLICK,       // Released before KEY_LONG_PRESS_US
+    BUTTON_HOLD,        // Released after KEY_LONG_PRESS_US, without having repeated
+    BUTTON_REPEAT,      // `value` steps of a repeating key held after a click
+    TOUCH_PRESS,
+    TOUCH_RELEASE,
+    GESTURE,            // `value` is a `Gesture`
+    COUNT
+};
+
+// What the input task hands its subscribers
+struct InputEvent {
+    InputType type;
+    uint8_t id;         // GPIO pin for buttons, pad for touch and gestures
+    uint8_t value;
+    int64_t timeUs;     // esp_timer_get_time() of the edge behind it
+};
+
+const char *inputTypeName(InputType type);
+
+// Debounces the raw edges of one key and tells clicks, holds and repeats
+// apart. Doesn't depend on the device, so it can be fed made up edges.
+// A repeating key only repeats when pressed within KEY_REPEAT_ARM_US of a
+// click, then held; any other press is a hold however long it lasts.
+class KeyTracker {
+public:
+    KeyTracker(uint8_t id, bool repeats);
+
+    // Takes an edge and writes the events it causes to `out`, which has room
+    // for KEY_MAX_EVENTS. Returns how many were written.
+    size_t edge(bool pressed, int64_t timeUs, InputEvent *out);
+
+    // Settles a debounce with the key's level at `nowUs` and reports the
+    // repeats due by then, each run of them as a single event
+    size_t tick(bool pressed, int64_t nowUs, InputEvent *out);
+
+    // When `tick` next needs calling, or INT64_MAX
+    int64_t nextDeadline() const;
+
+    bool pressed() const { return state; }
+    uint32_t bounces() const { return ignored; }
+
+private:
+    size_t change(bool pressed, int64_t timeUs, InputEvent *out);
+
+    uint8_t id;
+    bool repeats;
+    bool state;             // Debounced
+    bool repeated;          // Since the last press
+    int64_t pressTimeUs;
+    int64_t armedUntilUs;   // A press before this may repeat, or INT64_MIN
+    int64_t settleUs;       // End of the current debounce, or INT64_MAX
+    int64_t nextRepeatUs;   // INT64_MAX while released or not repeating
+    int64_t repeatGapUs;
+    uint32_t ignored;       // Edges dropped as bounce
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "latency_histogram.h"
+
+// Where a sample is on its way from the sensor to the host. Every field is
+// esp_timer_get_time() in microseconds.
+struct InputTimestamps {
+    int64_t sensor;         // The sensor signalled the sample
+    int64_t read;           // The reader task took it off the sensor
+    int64_t dequeued;       // The consumer took it from the pipeline's queue
+    int64_t computed;       // Its pointer motion was worked out
+    int64_t submitted;      // The report carrying it was handed to the transport
+};
+
+enum class LatencyStage : uint8_t {
+    READ,           // sensor to read
+    QUEUE,          // read to dequeued
+    COMPUTE,        // dequeued to computed
+    SUBMIT,         // computed to submitted
+    TOTAL,          // sensor to submitted
+    COUNT
+};
+
+// Per-stage latency of samples that made it into a HID report, and the
+// motion that never went out
+class InputLatency {
+public:
+    struct Counts {
+        uint32_t reports;       // Sent with their timestamps recorded
+        uint32_t dropped;       // Not sent because the transport wasn't connected
+    };
+
+    InputLatency();
+
+    // Records a report handed to the transport
+    void record(const InputTimestamps& timestamps);
+    void countDropped() { dropped.fetch_add(1, std::memory_order_relaxed); }
+
+    const LatencyHistogram& stage(LatencyStage stage) const { return stages[static_cast<size_t>(stage)]; }
+    Counts counts() const;
+
+    void print(Print& out) const;
+    void reset();
+
+    static const char *stageName(LatencyStage stage);
+
+private:
+    LatencyHistogram stages[static_cast<size_t>(LatencyStage::COUNT)];
+    std::atomic<uint32_t> reports;
+    std::atomic<uint32_t> dropped;
+};
+
+extern InputLatency inputLatency;
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#define LATENCY_EXACT_BUCKETS 16    // Durations below this many microseconds get a bucket each
+#define LATENCY_BUCKETS 128         // Then four buckets per power of two, up to 2^32 us
+
+// Histogram of durations in microseconds, cheap enough to update on every
+// sample. Percentiles are reported as the upper bound of their bucket, so
+// they overestimate by at most a quarter above 16 us.
+class LatencyHistogram {
+    std::atomic<uint32_t> buckets[LATENCY_BUCKETS];
+    std::atomic<uint32_t> count;
+    std::atomic<uint32_t> maxUs;
+
+    static size_t bucketOf(uint32_t us) {
+        if (us < LATENCY_EXACT_BUCKETS)
+            return us;
+        uint32_t msb = 31 - __builtin_clz(us);
+        return LATENCY_EXACT_BUCKETS + (msb - 4) * 4 + ((us >> (msb - 2)) & 3);
+    }
+
+    static uint32_t upperBound(size_t bucket) {
+        if (bucket < LATENCY_EXACT_BUCKETS)
+            return bucket;
+        uint32_t msb = 4 + (bucket - LATENCY_EXACT_BUCKETS) / 4;
+        uint32_t step = 1u << (msb - 2);
+        return (1u << msb) + ((bucket - LATENCY_EXACT_BUCKETS) % 4 + 1) * step - 1;
+    }
+
+public:
+    LatencyHistogram() { reset(); }
+
+    // Negative durations (clocks read out of order) count as zero
+    void add(int64_t us) {
+        uint32_t value = us < 0 ? 0 : us > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(us);
+        buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        uint32_t seen = maxUs.load(std::memory_order_relaxed);
+        while (value > seen && !maxUs.compare_exchange_weak(seen, value, std::memory_order_relaxed))
+            ;
+    }
+
+    // `percent` in [0, 100]; returns 0 when nothing has been recorded
+    uint32_t percentile(float percent) const {
+        uint32_t total = count.load(std::memory_order_relaxed);
+        if (total == 0)
+            return 0;
+        uint32_t rank = static_cast<uint32_t>(total * percent / 100.f + 0.5f);
+        if (rank == 0)
+            rank = 1;
+        uint32_t seen = 0;
+        for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+            seen += buckets[i].load(std::memory_order_relaxed);
+            if (seen >= rank) {
+                uint32_t bound = upperBound(i);
+                return bound < max() ? bound : max();
+            }
+        }
+        return max();
+    }
+
+    uint32_t samples() const { return count.load(std::memory_order_relaxed); }
+    uint32_t max() const { return maxUs.load(std::memory_order_relaxed); }
+
+    // Not atomic as a whole; samples added meanwhile may be half counted
+    void reset() {
+        for (std::atomic<uint32_t>& bucket : buckets)
+            bucket.store(0, std::memory_order_relaxed);
+        count.store(0, std::memory_order_relaxed);
+        maxUs.store(0, std::memory_order_relaxed);
+    }
+};
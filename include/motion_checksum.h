@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+
+// A checksum of the pointer motion a replay produces, so a run of the
+// `replay` command on the device can be compared with one of
+// tools/motion/replay_test on a host. FNV-1a over each dx and then dy, as
+// four little-endian bytes each, in the order the samples came.
+
+#define MOTION_CHECKSUM_SEED 2166136261u
+
+inline uint32_t motionChecksum(uint32_t hash, int32_t dx, int32_t dy) {
+    for (int32_t value : {dx, dy}) {
+        uint32_t bits = static_cast<uint32_t>(value);
+        for (int i = 0; i < 4; ++i) {
+            hash ^= (bits >> (8 * i)) & 0xff;
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define MOTION_CURVE_SEGMENTS 16        // Uniform segments of the gain lookup table
+#define MOTION_CURVE_MAX_POINTS 8       // Points of a piecewise-linear curve
+#define MOTION_MIN_INTERVAL_US 1000     // Shorter sample intervals are treated as this
+#define MOTION_MAX_INTERVAL_US 100000   // Longer gaps restart tracking instead of jumping
+#define FILTER_SMOOTHING_STEPS 128      // Entries of the smoothing factor table, 1/16 apart
+
+// The engine's hot path works in Q16.16 fixed point: angles in degrees,
+// speeds in degrees per second, gains in pixels per degree
+typedef int32_t q16_t;
+#define Q16_ONE 65536
+
+inline q16_t toQ16(float value) { return static_cast<q16_t>(value * Q16_ONE); }
+inline float fromQ16(q16_t value) { return value / static_cast<float>(Q16_ONE); }
+
+// One point of an acceleration curve: the gain applied at an angular speed
+struct CurvePoint {
+    float speedDps;     // Degrees per second
+    float gain;         // Pixels per degree
+};
+
+// Gain as a function of angular speed, sampled into a lookup table with
+// power-of-two spacing so the hot path indexes it with a shift.
+// Between points the curve is linear; past the last one it is flat. Corners
+// are rounded off to the table spacing, 1/16 of the last point's speed
+// rounded up to a power of two.
+class MotionCurve {
+    q16_t gains[MOTION_CURVE_SEGMENTS + 1];
+    uint8_t shift;      // log2 of the speed covered by one segment
+
+public:
+    MotionCurve();
+
+    // Points must be sorted by speed. Returns false, keeping the previous
+    // curve, if there are none or too many.
+    bool setPoints(const CurvePoint *points, size_t count);
+
+    q16_t gainAt(q16_t speed) const {
+        uint32_t index = static_cast<uint32_t>(speed) >> shift;
+        if (index >= MOTION_CURVE_SEGMENTS)
+            return gains[MOTION_CURVE_SEGMENTS];
+        int32_t frac = speed & ((1 << shift) - 1);
+        return gains[index] + static_cast<q16_t>((static_cast<int64_t>(gains[index + 1] - gains[index]) * frac) >> shift);
+    }
+};
+
+enum class FilterKind : uint8_t {
+    NONE,
+    EMA,            // Fixed cutoff
+    ONE_EURO,       // Cutoff rises with speed
+};
+
+struct FilterConfig {
+    FilterKind kind;
+    float minCutoffHz;          // Cutoff at rest; the EMA's only parameter
+    float beta;                 // Hz of cutoff added per degree per second (One-Euro)
+    float derivativeCutoffHz;   // Smoothing of the speed the cutoff follows (One-Euro)
+};
+
+// Low-pass filters heading and pitch before they are turned into motion, to
+// steady the pointer against tremor. The One-Euro filter (Casiez et al.,
+// 2012) raises its cutoff with speed, so it smooths heavily at rest but lags
+// little in fast swipes. Each sample takes one 32-bit division and a lookup
+// per axis, whatever the input.
+class MotionFilter {
+    struct Axis {
+        q16_t value;    // Filtered angle
+        q16_t raw;      // Previous input
+        q16_t speed;    // Filtered degrees per second
+    };
+
+    FilterKind kind;
+    q16_t minCutoff;
+    q16_t beta;
+    q16_t derivativeCutoff;
+    // 1 - e^-r for r in [0, 8), the exact smoothing factor of a first-order
+    // low-pass for r = 2 pi cutoff interval
+    q16_t smoothing[FILTER_SMOOTHING_STEPS + 1];
+
+    bool primed;
+    int64_t lastTimeUs;
+    Axis yaw;
+    Axis pitch;
+
+    q16_t smoothingFactor(int64_t r) const {
+        uint64_t index = static_cast<uint64_t>(r) >> 12;
+        if (index >= FILTER_SMOOTHING_STEPS)
+            return Q16_ONE;
+        int32_t frac = r & 0xfff;
+        return smoothing[index] + ((smoothing[index + 1] - smoothing[index]) * frac >> 12);
+    }
+
+    void filterAxis(Axis& axis, q16_t raw, uint32_t twoPiInterval, uint32_t rateQ8, q16_t derivativeAlpha);
+
+public:
+    MotionFilter();
+
+    void configure(const FilterConfig& config);
+
+    // Filters a heading and pitch in degrees in place. Passes them through
+    // unchanged at the first sample and after gaps.
+    void update(q16_t& yaw, q16_t& pitch, int64_t timeUs);
+
+    void reset();
+};
+
+struct MotionConfig {
+    float deadZoneDps;      // Slower motion is ignored
+    bool invertX;
+    bool invertY;
+};
+
+struct MotionDelta {
+    int32_t dx;
+    int32_t dy;
+};
+
+// Turns changes in heading and pitch into pointer motion at the sensor
+// rate. Fractions of a pixel carry over to the next sample, so slow
+// movements add up instead of being rounded away.
+class MotionEngine {
+    MotionCurve curve;
+    MotionFilter filter;
+    q16_t deadZone;
+    bool invertX;
+    bool invertY;
+
+    bool tracking;
+    q16_t lastYaw;
+    q16_t lastPitch;
+    int64_t lastTimeUs;
+    q16_t remainderX;   // Pixels not yet reported, in [0, 1)
+    q16_t remainderY;
+
+public:
+    MotionEngine();
+
+    void configure(const MotionConfig& config);
+    bool setCurve(const CurvePoint *points, size_t count) { return curve.setPoints(points, count); }
+    void setFilter(const FilterConfig& config) { filter.configure(config); }
+
+    // Takes the orientation at `timeUs` and returns the pointer motion since
+    // the previous sample
+    MotionDelta update(float yawDeg, float pitchDeg, int64_t timeUs);
+
+    // Forgets the previous sample, the filter state and any fractional motion
+    void reset();
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "input_latency.h"
+#include "mouse_transport.h"
+#include "report_scheduler.h"
+#include "spsc_queue.h"
+
+#define MOUSE_MOTION_QUEUE_LENGTH 32    // Must be a power of two
+#define MOUSE_BUTTON_QUEUE_LENGTH 32    // Must be a power of two
+#define MOUSE_OUTPUT_PRIORITY 4         // Below the IMU reader, above the tasks feeding it
+#define MOUSE_OUTPUT_STACK_SIZE 4096
+
+// Owns a ReportScheduler on a task of its own, which sends the next report
+// as soon as the transport has a slot for it. Motion and button states come
+// in through a queue each, from a single producer task each. Both are
+// stamped from one sequence, so the task hands them to the scheduler in the
+// order they happened.
+class MouseOutput {
+public:
+    typedef MouseTransport& (*TransportSelector)();
+
+    explicit MouseOutput(TransportSelector select);
+
+    bool start();
+
+    // For the IMU task only. Motion that finds the queue full is carried
+    // into the next call rather than lost.
+    void addMotion(int32_t dx, int32_t dy, const InputTimestamps& timestamps);
+
+    // For the input task only. Every state is reported on its own, however
+    // many are waiting; none is ever merged away. If the queue is full this
+    // waits, a tick at a time, for the output task to make room.
+    void setButtons(uint8_t buttons);
+
+    // A snapshot; the counters belong to the output task
+    ReportScheduler::Stats stats() const { return scheduler.stats(); }
+
+    // Takes effect at the output task's next wakeup
+    void resetStats();
+
+private:
+    struct Motion {
+        int32_t dx;
+        int32_t dy;
+        InputTimestamps timestamps;
+        uint32_t seq;
+    };
+
+    struct ButtonState {
+        uint8_t buttons;
+        uint32_t seq;
+    };
+
+    static void taskEntry(void *arg);
+    void wake();
+
+    TransportSelector select;
+    ReportScheduler scheduler;
+    SpscQueue<Motion, MOUSE_MOTION_QUEUE_LENGTH> motion;
+    SpscQueue<ButtonState, MOUSE_BUTTON_QUEUE_LENGTH> buttons;
+    std::atomic<uint32_t> sequence;     // Stamps motion and button states alike
+    // Motion the queue had no room for; producer side. It is ordered by
+    // when it finally gets in.
+    int32_t carryX;
+    int32_t carryY;
+    std::atomic<bool> resetRequested;
+    TaskHandle_t task;
+};
+
+extern MouseOutput mouseOutput;
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// One HID mouse report: absolute button state and relative motion
+struct MouseReport {
+    uint8_t buttons;    // MOUSE_LEFT, MOUSE_RIGHT and MOUSE_MIDDLE bits
+    int8_t x;
+    int8_t y;
+    int8_t wheel;
+};
+
+// A link to the host that mouse reports go out over. Doesn't depend on the
+// device, so what schedules reports can be run against a simulated link.
+class MouseTransport {
+public:
+    virtual ~MouseTransport() {}
+
+    virtual const char *name() const = 0;
+    virtual bool begin() = 0;
+
+    // Whether a host is listening
+    virtual bool connected() const = 0;
+
+    // Whether a report sent now would be taken at once, rather than wait
+    // behind an earlier one or be dropped
+    virtual bool ready() const = 0;
+
+    // Returns false if the report wasn't accepted
+    virtual bool send(const MouseReport& report) = 0;
+
+    // How often the host takes a report, in microseconds
+    virtual uint32_t intervalUs() const = 0;
+};
+
+// Stands in for a USB-style transport off the device. The host polls every
+// interval on a clock the caller advances, and a report sent between polls
+// occupies the endpoint until the next one. tools/hid/report_test.cpp runs
+// the report scheduler against it on a host.
+class SimulatedTransport : public MouseTransport {
+public:
+    struct Sent {
+        int64_t timeUs;
+        MouseReport report;
+    };
+
+    explicit SimulatedTransport(uint32_t intervalUs)
+        : interval(intervalUs)
+        , now(0)
+        , busyUntil(0)
+        , isConnected(true)
+        , sent()
+    {}
+
+    const char *name() const override { return "simulated"; }
+    bool begin() override { return true; }
+    bool connected() const override { return isConnected; }
+    bool ready() const override { return isConnected && now >= busyUntil; }
+
+    bool send(const MouseReport& report) override {
+        if (!ready())
+            return false;
+        sent.push_back(Sent{now, report});
+        busyUntil = (now / interval + 1) * interval;
+        return true;
+    }
+
+    uint32_t intervalUs() const override { return interval; }
+
+    int64_t time() const { return now; }
+    void advance(int64_t us) { now += us; }
+    void setConnected(bool value) { isConnected = value; }
+
+    // Every report accepted so far, in order
+    const std::vector<Sent>& reports() const { return sent; }
+    void clear() { sent.clear(); }
+
+private:
+    uint32_t interval;
+    int64_t now;
+    int64_t busyUntil;
+    bool isConnected;
+    std::vector<Sent> sent;
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define PROFILE_HISTOGRAM_BUCKETS 33    // One per power of two of cycles, plus zero
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+
+/// @brief Times the rest of the enclosing block in CPU cycles and adds the duration to the statistics kept for `label`,
+/// which the `profile` shell command prints. Builds without PROFILING defined compile it to nothing.
+#ifdef PROFILING
+#define PROFILE_SCOPE(label)                                                                \
+    static Profiling::Accumulator PROFILE_CONCAT(profileAccumulator, __LINE__)(label);     \
+    Profiling::Scope PROFILE_CONCAT(profileScope, __LINE__)(PROFILE_CONCAT(profileAccumulator, __LINE__))
+#else
+#define PROFILE_SCOPE(label) do {} while (0)
+#endif
+
+namespace Profiling {
+
+/// @brief Durations recorded by one `PROFILE_SCOPE`. Accumulators link themselves into a global list when constructed.
+class Accumulator {
+    friend void printAndReset(Print& out);
+
+    const char *label;
+    Accumulator *next;
+    portMUX_TYPE lock;
+    uint32_t count;
+    uint32_t migrated;  // Scopes that ended on another core, whose cycle counts are unrelated
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t totalCycles;
+    uint32_t histogram[PROFILE_HISTOGRAM_BUCKETS];
+
+    void reset();
+
+public:
+    explicit Accumulator(const char *label);
+    Accumulator(const Accumulator&) = delete;
+    Accumulator& operator=(const Accumulator&) = delete;
+
+    void add(uint32_t cycles);
+    void addMigrated();
+};
+
+/// @brief Reads the cycle counter on construction and adds the elapsed cycles to an `Accumulator` on destruction.
+class Scope {
+    Accumulator& accumulator;
+    BaseType_t core;
+    uint32_t start;
+
+public:
+    explicit Scope(Accumulator& accumulator);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+};
+
+/// @brief Prints count, min, mean and max duration of every label along with its histogram, then clears them.
+void printAndReset(Print& out);
+
+};  // namespace Profiling
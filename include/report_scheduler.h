@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "mouse_transport.h"
+
+#define REPORT_SEGMENTS 16      // Button changes that can wait for a report, plus one
+
+// Collects pointer motion, wheel steps and button changes between transport
+// slots and turns them into as few HID reports as possible.
+// Motion is kept in segments, one per button state, so motion from before a
+// press is reported without the button held and motion after it with the
+// button held. Each button state gets at least one report of its own, even
+// if it lasted less than a slot. Deltas too large for a report's int8
+// fields are split across reports; nothing is rounded off or dropped.
+// Not thread-safe; meant to be owned by the task that talks to the transport.
+class ReportScheduler {
+public:
+    struct Stats {
+        uint32_t reports;
+        uint32_t merged;            // Motion updates that shared a report with an earlier one
+        uint32_t splits;            // Reports that left motion over for the next
+        uint32_t buttonOverflows;   // Button changes turned away until a report frees a segment
+    };
+
+    ReportScheduler();
+
+    void addMotion(int32_t dx, int32_t dy);
+    void addWheel(int32_t steps);
+
+    // Returns false, ignoring the change, if REPORT_SEGMENTS - 1 are waiting
+    bool setButtons(uint8_t buttons);
+
+    // Whether there is anything to report
+    bool pending() const;
+
+    // The report to send next. Only meaningful while `pending`.
+    MouseReport next() const;
+
+    // Removes what `report`, as returned by `next`, carried
+    void sent(const MouseReport& report);
+
+    // Sends the next report if there is one and the transport is ready.
+    // Returns whether a report went out.
+    bool flush(MouseTransport& transport);
+
+    // Forgets pending motion, wheel steps and button changes, as when no
+    // host is listening. Buttons move straight to their latest state, which
+    // counts as reported, so nothing is `pending` afterwards.
+    void discard();
+
+    Stats stats() const { return counters; }
+    void resetStats() { counters = Stats{0, 0, 0, 0}; }
+
+private:
+    struct Segment {
+        uint8_t buttons;
+        int32_t dx;
+        int32_t dy;
+        int32_t wheel;
+        uint32_t updates;   // Motion updates added since the last report
+    };
+
+    Segment& front() { return segments[head % REPORT_SEGMENTS]; }
+    const Segment& front() const { return segments[head % REPORT_SEGMENTS]; }
+    Segment& back() { return segments[(head + count - 1) % REPORT_SEGMENTS]; }
+    static bool moving(const Segment& segment) { return segment.dx || segment.dy || segment.wheel; }
+
+    Segment segments[REPORT_SEGMENTS];
+    size_t head;
+    size_t count;               // Never zero; the last segment collects new motion
+    uint8_t reportedButtons;    // As the host last saw them
+    Stats counters;
+};
@@ -2,18 +2,11 @@
 
 #include <Wire.h>
 #include "SparkFun_BNO08x_Arduino_Library.h"
+#include "imu_pipeline.h"
 
 #define BNO08X_ADDR 0x4A
 #define BNO08X_ADDR2 0x4B
-
-
-// Rotation measurement structure
-struct Orientation
-{
-    float roll;
-    float pitch;
-    float yaw;
-};
+#define IMU_POLL_INTERVAL_MS 5      // How often the sensor is read without an INT pin
 
 
 // Sensor interface
@@ -24,11 +17,33 @@ namespace BNO086 {
     // Initialize the sensor
     bool init(bool wireInitialized);
 
-    // Poll the sensor for new data
-    Orientation poll();
+    // Read every report the sensor hub has pending, passing rotation vectors
+    // to `out` stamped with `sensorTime`. Returns the number of samples read.
+    size_t poll(OrientationSample *out, size_t capacity, int64_t sensorTime);
 
 } // namespace BNO086
 
+// Reads the BNO086 whenever its INT line signals a pending report, or every
+// IMU_POLL_INTERVAL_MS when it has no INT pin to go by
+class BNO086Source : public OrientationSource {
+    int intPin;         // Negative when INT isn't wired to the ESP32
+    TaskHandle_t reader;
+    TickType_t pollWakeTime;
+    TickType_t lastReportTime;
+    bool morePending;   // The last read stopped at capacity, so don't wait for INT
+
+    static void IRAM_ATTR intISR(void *arg);
+
+public:
+    BNO086Source();
+
+    // Before `begin`. Timestamps are only as good as the polling without one.
+    void useIntPin(int pin) { intPin = pin; }
+
+    bool begin() override;
+    size_t read(OrientationSample *out, size_t capacity, TickType_t timeout) override;
+};
+
 template <typename T>
 T clamp(T lower, T sig, T upper) {
     return min(max(lower, sig), upper);
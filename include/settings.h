@@ -2,13 +2,24 @@
 
 #include "duktape.h"
 #include "meta.h"
+#include <Arduino.h>
+#include <atomic>
+#include <functional>
 #include <string>
-#include <unordered_map>
+
+#define SETTINGS_LOG_PATH "/settings.log"
+#define SETTINGS_TMP_PATH "/settings.tmp" // Compaction output
+#define SETTINGS_QUIET_MS 250       // Writes are flushed once this quiet...
+#define SETTINGS_MAX_DELAY_MS 2000  // ...but never later than this
+#define SETTINGS_COMPACT_MIN_BYTES 4096
+#define SETTINGS_WRITER_STACK_SIZE 4096
+#define SETTINGS_WRITER_PRIORITY 1
+#define SETTINGS_NOTIFY_DELAY_MS 34 // One frame; changes within it coalesce
 
 namespace settings {
 
-enum class SettingType { STRING, NUMBER, BOOLEAN, UNSET };
-struct Setting {
+enum class SettingType : uint8_t { STRING, NUMBER, BOOLEAN, UNSET };
+struct SettingValue {
     SettingType type;
     union {
         std::string *string;
@@ -16,11 +27,16 @@ struct Setting {
         bool boolean;
     };
 
-    Setting() : type(SettingType::UNSET) {}
-    Setting(std::string *string) : type(SettingType::STRING), string(string) {}
-    Setting(double number) : type(SettingType::NUMBER), number(number) {}
-    Setting(bool boolean) : type(SettingType::BOOLEAN), boolean(boolean) {}
-    ~Setting() {
+    SettingValue() : type(SettingType::UNSET) {}
+    SettingValue(std::string *string)
+        : type(SettingType::STRING), string(string) {}
+    SettingValue(double number) : type(SettingType::NUMBER), number(number) {}
+    SettingValue(bool boolean) : type(SettingType::BOOLEAN), boolean(boolean) {}
+    SettingValue(const SettingValue &other);
+    // Replacing a string with a string keeps the same std::string, so pointers
+    // returned by get_string stay valid.
+    SettingValue &operator=(const SettingValue &other);
+    ~SettingValue() {
         if (type == SettingType::STRING) {
             delete string;
         }
@@ -29,18 +45,158 @@ struct Setting {
 
 enum class SettingError { NOT_FOUND, INVALID_TYPE };
 
-static std::unordered_map<std::string, Setting> _settings;
+namespace detail {
+
+/// @brief The storage behind one key. Entries are never removed, so handles
+/// can point at them for the lifetime of the program.
+struct entry_t {
+    const std::string *key;
+    SettingValue value;
+    SettingType type; // Fixed by registering a handle; UNSET accepts any type
+    bool dirty;       // Waiting to be written to flash
+    bool notify;      // Waiting to be delivered to subscribers
+    // Odd while the value is being written. Lets handles read numbers and
+    // booleans without taking the store's mutex.
+    std::atomic<uint32_t> version;
+
+    entry_t()
+        : key(nullptr), value(), type(SettingType::UNSET), dirty(false),
+          notify(false), version(0) {}
+};
+
+template <typename T>
+T read_scalar(const entry_t *entry, T SettingValue::*field) {
+    while (true) {
+        uint32_t before = entry->version.load(std::memory_order_acquire);
+        T value = entry->value.*field;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((before & 1) == 0 &&
+            entry->version.load(std::memory_order_relaxed) == before) {
+            return value;
+        }
+    }
+}
+
+bool write(entry_t *entry, const SettingValue &value);
+std::string read_string(const entry_t *entry);
+
+} // namespace detail
+
+/// @brief A typed handle to a registered setting. Reading a number or boolean
+/// is a couple of loads, with no hashing, locking or allocation, so handles
+/// are meant to be kept and read in hot loops. Handles are cheap to copy.
+template <typename T> class Setting {
+    detail::entry_t *m_entry;
+
+  public:
+    explicit Setting(detail::entry_t *entry = nullptr) : m_entry(entry) {}
+
+    T get() const;
+    operator T() const { return get(); }
+
+    /// @brief Changes the value and schedules it to be saved.
+    void set(const T &value) const;
+
+    const std::string &key() const { return *m_entry->key; }
+};
+
+template <> inline double Setting<double>::get() const {
+    return detail::read_scalar(m_entry, &SettingValue::number);
+}
+
+template <> inline bool Setting<bool>::get() const {
+    return detail::read_scalar(m_entry, &SettingValue::boolean);
+}
+
+template <> inline std::string Setting<std::string>::get() const {
+    return detail::read_string(m_entry);
+}
+
+template <> inline void Setting<double>::set(const double &value) const {
+    detail::write(m_entry, SettingValue(value));
+}
+
+template <> inline void Setting<bool>::set(const bool &value) const {
+    detail::write(m_entry, SettingValue(value));
+}
+
+template <>
+inline void Setting<std::string>::set(const std::string &value) const {
+    detail::write(m_entry, SettingValue(new std::string(value)));
+}
+
+/// @brief Registers a number setting, fixing its type. Keeps the stored value
+/// if there is one of the right type, and otherwise uses the default (which
+/// is not saved until it is changed).
+Setting<double> number(const std::string &key, double default_value);
+Setting<bool> boolean(const std::string &key, bool default_value);
+Setting<std::string> string(const std::string &key,
+                            const std::string &default_value);
+
+/// @brief Counters describing the cost of persisting settings.
+struct store_stats_t {
+    int64_t load_us;
+    std::size_t load_bytes;
+    uint32_t records_loaded;
+    uint32_t updates;          // Calls to set, from C++ or JS
+    std::size_t update_bytes;  // What writing every update would have cost
+    uint32_t flushes;
+    uint32_t records_written;
+    std::size_t bytes_written; // Appends and compactions
+    uint32_t compactions;
+    std::size_t log_bytes;
+    std::size_t live_bytes;    // What the log would be after a compaction
+    uint32_t write_errors;
+    uint32_t changes_delivered; // Changes passed to subscribers
+    uint32_t changes_coalesced; // Changes folded into an undelivered one
+};
+
+typedef std::function<void(const std::string &key)> subscriber_t;
+
+/// @brief Calls `callback` whenever a matching setting changes. A pattern
+/// ending in `*` matches every key starting with the rest of it. Changes are
+/// delivered on the timer service task, SETTINGS_NOTIFY_DELAY_MS after the
+/// first one, and several changes to a key in that time are delivered once;
+/// callbacks should read the new value through a handle and return quickly.
+/// @return An id for `unsubscribe`.
+uint32_t subscribe(const std::string &pattern, subscriber_t callback);
+
+/// @brief Removes a subscription. A delivery already in progress may still
+/// call it once.
+void unsubscribe(uint32_t id);
+
+/// @brief Loads the store from flash with a single sequential read and starts
+/// the task that persists changes. Must be called after the filesystem is
+/// mounted; settings set before that are kept and written out later.
+/// @return A boolean indicating if the log could be read or created.
+bool init();
+
+/// @brief Writes every pending change to flash immediately, e.g. before a
+/// reboot. Normally changes are coalesced and written in the background.
+void flush();
+
+// Keyed access, for one-off reads and writes. Code that reads a setting
+// repeatedly should register a handle instead. Setting a value of the wrong
+// type for a registered key does nothing.
+void set(const std::string &key, const std::string &value);
+void set(const std::string &key, double value);
+void set(const std::string &key, bool value);
+meta::result_t<std::string *, SettingError>
+get_string(const std::string &key);
+meta::result_t<double, SettingError> get_number(const std::string &key);
+meta::result_t<bool, SettingError> get_boolean(const std::string &key);
+
+store_stats_t stats();
 
-static duk_ret_t _change_setting(duk_context *ctx);
-static duk_ret_t _get_setting(duk_context *ctx);
+/// @brief Prints every setting along with its value.
+void print(Print &out);
 
-void set(std::string key, std::string value);
-void set(std::string key, double value);
-void set(std::string key, bool value);
-meta::result_t<std::string *, SettingError> get_string(std::string key);
-meta::result_t<double, SettingError> get_number(std::string key);
-meta::result_t<bool, SettingError> get_boolean(std::string key);
+/// @brief Pushes the value of a setting onto a duktape stack, or undefined.
+void push_js_value(duk_context *ctx, const std::string &key);
 
+/// @brief Defines the global `settings` object: `settings.get(key)`,
+/// `settings.set(key, value)` and `settings.handle(key)`, which returns an
+/// object with `get()` and `set(value)` bound to the key's storage.
 void create_js_hooks(duk_context *ctx);
 
-} // namespace settings
\ No newline at end of file
+} // namespace settings
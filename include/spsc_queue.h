@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Lock-free queue for exactly one producer and one consumer, which may be an
+// interrupt handler. Holds up to `N` items; `N` must be a power of two.
+template <typename T, size_t N>
+class SpscQueue {
+    static_assert((N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+    T slots[N];
+    std::atomic<uint32_t> head;     // Items ever pushed; written by the producer
+    std::atomic<uint32_t> tail;     // Items ever popped; written by the consumer
+
+public:
+    SpscQueue()
+        : head(0)
+        , tail(0)
+    {}
+
+    // Producer side. Returns false, leaving the queue untouched, when it is full
+    bool push(const T& item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == N)
+            return false;
+        slots[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when the queue is empty
+    bool pop(T& item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == t)
+            return false;
+        item = slots[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Like `pop`, but leaves the item at the front
+    bool peek(T& item) const {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == t)
+            return false;
+        item = slots[t & (N - 1)];
+        return true;
+    }
+
+    // Exact from either side; a snapshot from anywhere else
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t capacity() { return N; }
+};
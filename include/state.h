@@ -7,10 +7,24 @@
 
 #include "virtual_callback.h"
 
+#define SHELL_QUEUE_DEPTH 4         // Commands waiting behind the running one
+#define SHELL_ARG_ARENA_SIZE 256    // Bytes for the arguments of one command
+#define SHELL_MAX_ARGS 16
+#define SHELL_EVAL_STACK_SIZE 10000
+
 namespace Shell {
 
 typedef void (*Command)(const std::vector<const char*>&);
 
+struct Stats {
+    uint32_t commands;
+    uint32_t dropped;           // Queue full or arguments too long
+    int64_t lastLatencyUs;      // From pressing enter to the command starting
+    int64_t maxLatencyUs;
+    int64_t totalLatencyUs;
+};
+
+// Starts the evaluator task, which runs queued commands one at a time
 void init();
 
 void serialDataCB();
@@ -22,19 +36,40 @@ void registerCmd(const char* name, Command cmd);
 
 const std::unordered_map<std::string, Command>& registry();
 
+Stats stats();
+
 };  // namespace Shell
 
+#define TASK_LOG_SIZE 1024      // Bytes kept per task; must be a power of two
+#define TASK_LOG_MAX_TASKS 16   // Tasks beyond this are not logged
+
+static_assert((TASK_LOG_SIZE & (TASK_LOG_SIZE - 1)) == 0,
+              "TASK_LOG_SIZE must be a power of two");
+
+// Per-task logs, kept in fixed rings that are allocated statically and claimed
+// by task name. Each ring has a single writer (its task), which never blocks
+// or allocates; once full, the oldest lines are overwritten. Lines are
+// timestamped as they are written. Tasks sharing a name share a ring, and a
+// restarted task continues the log of its predecessor.
 class TaskLog : public Print {
-    static std::unordered_map<TaskHandle_t, std::string> taskLogRegistry;
-    TaskHandle_t task;
+public:
+    struct Ring;
+
+private:
+    Ring *ring; // nullptr if every ring was claimed by another task
+
 public:
     TaskLog();
-    TaskLog(TaskHandle_t task);
 
     size_t write(const uint8_t c);
     size_t write(const uint8_t *buffer, size_t size);
-    
-    const std::string& get();
+
+    // Prints the log of the named task without blocking its writer.
+    // Returns false if the task has never logged anything.
+    static bool dump(const char *taskName, Print &out);
+
+    // Prints the size and number of overwritten bytes of every log.
+    static void printSummary(Print &out);
 };
 
 template <class T, typename = typename std::enable_if<std::is_base_of<Print, T>::value, void>::type>
@@ -51,10 +86,21 @@ public:
     ~Warn() { T::print("\e[0m"); }
 };
 
+#define TASK_PRINT_BUFFER_SIZE 256
+
+// Output shown while a task is being monitored. Each message is collected in
+// the object and queued in one piece when it is destroyed, together with the
+// escapes that move it above the prompt and redraw the prompt after it.
 class TaskPrint : public Print {
     static std::unordered_map<TaskHandle_t, bool> taskMonitorRegistry;
+    bool enabled;
+    size_t length;
+    char buffer[TASK_PRINT_BUFFER_SIZE];
+
+    void flushBuffer();
 public:
     TaskPrint();
+    TaskPrint(TaskPrint &&other);   // The moved-from object prints nothing
     ~TaskPrint();
     bool isEnabled() const;
     size_t write(const uint8_t c);
@@ -64,4 +110,4 @@ public:
     static bool enable(TaskHandle_t task);
     static void disable(TaskHandle_t task);
     static bool isEnabled(TaskHandle_t task);
-};
\ No newline at end of file
+};
@@ -6,6 +6,46 @@
 
 typedef void* ParameterPtr;
 
+#define TASK_STACK_REGISTRY_SIZE 24
+
+// Stack depths of the tasks we create, by task name, so diagnostics can compare
+// a task's high-water mark against its allocation (FreeRTOS doesn't keep it).
+struct TaskStackInfo {
+    const char *name;
+    configSTACK_DEPTH_TYPE depth;
+};
+
+inline TaskStackInfo *taskStackRegistry() {
+    static TaskStackInfo registry[TASK_STACK_REGISTRY_SIZE];
+    return registry;
+}
+
+// Tasks started again, like the IMU reader for every `test imu` or
+// `replay`, update their entry rather than take another. Any task may call
+// this, so entries are claimed under a lock.
+inline void registerTaskStack(const char *name, configSTACK_DEPTH_TYPE depth) {
+    static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    TaskStackInfo *registry = taskStackRegistry();
+    portENTER_CRITICAL(&lock);
+    for (size_t i = 0; i < TASK_STACK_REGISTRY_SIZE; ++i) {
+        if (!registry[i].name || strcmp(registry[i].name, name) == 0) {
+            registry[i] = TaskStackInfo{name, depth};
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+// Returns 0 for tasks that were never registered
+inline configSTACK_DEPTH_TYPE taskStackDepth(const char *name) {
+    TaskStackInfo *registry = taskStackRegistry();
+    for (size_t i = 0; i < TASK_STACK_REGISTRY_SIZE && registry[i].name; ++i) {
+        if (strcmp(registry[i].name, name) == 0)
+            return registry[i].depth;
+    }
+    return 0;
+}
+
 template <typename F>
 struct TaskContainer {
     TaskHandle_t handle;
@@ -36,7 +76,9 @@ struct TaskContainer {
         , priority(priority)
         , isRunning(false)
         , params(nullptr)
-    {}
+    {
+        registerTaskStack(name, stackDepth);
+    }
     ~TaskContainer() {
         if (handle)
             vTaskDelete(handle);
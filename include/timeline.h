@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+#define TIMELINE_EVENTS_PER_CORE 512 // Must be a power of two
+
+static_assert((TIMELINE_EVENTS_PER_CORE & (TIMELINE_EVENTS_PER_CORE - 1)) == 0,
+              "TIMELINE_EVENTS_PER_CORE must be a power of two");
+
+#define TIMELINE_CONCAT_(a, b) a##b
+#define TIMELINE_CONCAT(a, b) TIMELINE_CONCAT_(a, b)
+
+/// @brief Marks the start and end of a span on the calling task's track.
+/// Names must outlive the recording, so pass string literals.
+#define TIMELINE_BEGIN(name) timeline::record(name, 'B')
+#define TIMELINE_END(name) timeline::record(name, 'E')
+
+/// @brief Marks a point in time; safe to use in interrupt handlers.
+#define TIMELINE_INSTANT(name) timeline::record(name, 'i')
+
+/// @brief Records a span covering the rest of the enclosing block.
+#define TIMELINE_SCOPE(name)                                                   \
+    timeline::scope_t TIMELINE_CONCAT(timeline_scope_, __LINE__)(name)
+
+/// @brief A timeline of begin/end/instant events for profiling frames and
+/// input handling, exported in the Chrome `trace_event` format. Events are
+/// stamped with the CPU cycle counter and written into a ring per core, so
+/// writers never wait on each other. When not recording, an event costs a
+/// load and a branch.
+namespace timeline {
+
+namespace detail {
+
+extern std::atomic<bool> recording;
+
+/// @brief Appends an event to the current core's ring.
+void write(const char *name, char phase);
+
+} // namespace detail
+
+inline void record(const char *name, char phase) {
+    if (detail::recording.load(std::memory_order_relaxed)) {
+        detail::write(name, phase);
+    }
+}
+
+struct scope_t {
+    const char *name;
+
+    explicit scope_t(const char *name) : name(name) { record(name, 'B'); }
+    ~scope_t() { record(name, 'E'); }
+    scope_t(const scope_t &) = delete;
+    scope_t &operator=(const scope_t &) = delete;
+};
+
+/// @brief Clears the rings and starts recording. The rings are allocated on
+/// the first call.
+/// @return Whether the rings could be allocated.
+bool start();
+
+/// @brief Stops recording, keeping the events for `dump`.
+void stop();
+
+bool is_recording();
+
+/// @brief Prints whether the timeline is recording and how many events each
+/// core's ring has seen.
+void print_stats(Print &out);
+
+/// @brief Prints the recorded events as a Chrome `trace_event` JSON object,
+/// which chrome://tracing and Perfetto can open.
+void dump(Print &out);
+
+} // namespace timeline
@@ -2,26 +2,46 @@
 
 #include <Arduino.h>
 #include "driver/touch_pad.h"
+#include "spsc_queue.h"
+
+#define TOUCH_EDGE_QUEUE_LENGTH 32  // Must be a power of two
 
 namespace TouchPads {
 
-static void IRAM_ATTR ISR(void *arg);
+// A pad starting or ending a touch, as the interrupt saw it
+struct Edge {
+    uint8_t pad;
+    bool pressed;
+    int64_t timeUs;     // esp_timer_get_time() in the interrupt
+};
+
+struct Stats {
+    uint32_t edges;
+    uint32_t overflows;     // Edges lost to a full queue; `take` makes them up
+};
+
+void IRAM_ATTR ISR(void *arg);
 
-static class Status {
-    uint32_t bits;
+class Status {
+    volatile uint32_t bits;
 public:
     friend void ISR(void *arg);
     uint32_t getBits() const;
     bool operator[] (size_t i) const;
-} status;
+};
 
-static void IRAM_ATTR ISR(void *arg) {
-    (void) arg;
-    status.bits = touch_pad_get_status();
+extern Status status;
+
+namespace detail {
+extern TaskHandle_t consumer;
 }
 
+// Sets up the pads to interrupt on every touch and release. The calling
+// task becomes the consumer: it is notified whenever edges are queued and
+// is the only one that may `take` them.
 template <touch_pad_t... CHANNELS>
 void init(uint32_t threshold) {
+    detail::consumer = xTaskGetCurrentTaskHandle();
     touch_pad_init();
     esp_err_t configDummy[sizeof...(CHANNELS)] = {touch_pad_config(CHANNELS)...};
     esp_err_t threshDummy[sizeof...(CHANNELS)] = {touch_pad_set_thresh(CHANNELS, threshold)...};
@@ -44,6 +64,13 @@ void init(uint32_t threshold) {
     touch_pad_fsm_start();
 }
 
+// Consumer side. Returns false once every queued edge has been taken. If
+// the queue overflowed, edges are made up from the current pad states so
+// the consumer never misses the latest state of a pad.
+bool take(Edge& edge);
+
+Stats stats();
+
 void deinit();
 
-};  // end namespace TouchPads
\ No newline at end of file
+};  // end namespace TouchPads
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define GESTURE_MAX_PADS 16             // Pads numbered below this are tracked
+#define GESTURE_CLICK_MAX_US 300000     // Held longer than this, a touch becomes a drag
+#define GESTURE_DOUBLE_CLICK_US 400000  // Longest gap between the clicks of a double click
+#define GESTURE_MAX_EVENTS 2            // Most events one call reports
+
+enum class Gesture : uint8_t {
+    CLICK,          // A short touch
+    DOUBLE_CLICK,   // A click soon after another, reported in place of a second CLICK
+    DRAG_START,     // A touch held past a click
+    DRAG_END,
+};
+
+struct GestureEvent {
+    Gesture gesture;
+    uint8_t pad;
+    int64_t timeUs;
+};
+
+// Tells clicks, double clicks and drags apart from the press and release
+// edges of touch pads. Doesn't depend on the device, so it can be fed
+// recorded or made up edges.
+class GestureDetector {
+public:
+    struct Stats {
+        uint32_t clicks;
+        uint32_t doubleClicks;
+        uint32_t drags;
+    };
+
+    GestureDetector();
+
+    // Takes an edge and writes the gestures it completes to `out`, which has
+    // room for GESTURE_MAX_EVENTS. Returns how many were written.
+    size_t edge(uint8_t pad, bool pressed, int64_t timeUs, GestureEvent *out);
+
+    // Reports drags that began by `nowUs`, at most GESTURE_MAX_EVENTS at a
+    // time; call again while `nextDeadline` has passed
+    size_t tick(int64_t nowUs, GestureEvent *out);
+
+    // When `tick` next has something to report, or INT64_MAX
+    int64_t nextDeadline() const;
+
+    Stats stats() const { return counters; }
+
+private:
+    struct Pad {
+        bool pressed;
+        bool dragging;
+        int64_t pressTimeUs;
+        int64_t lastClickUs;    // Release of a click a second one could pair with, or -1
+    };
+
+    Pad pads[GESTURE_MAX_PADS];
+    Stats counters;
+};
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "state.h"
+#include <Arduino.h>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+#define TRACE_RING_SIZE 2048   // Bytes per task; must be a power of two
+#define TRACE_MAX_TASKS 8      // Tasks beyond this are not traced
+#define TRACE_MAX_RECORD 96    // Header included
+#define TRACE_MAX_STRING 32    // Longer `%s` arguments are truncated
+
+static_assert((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0,
+              "TRACE_RING_SIZE must be a power of two");
+
+/// @brief Logs a printf-style message from a hot path. Builds with
+/// BINARY_TRACE defined record the address of the format string, a timestamp
+/// and the raw arguments into a per-task ring, leaving the formatting to
+/// tools/trace/decode.py; other builds print to the monitor as TaskPrint
+/// does. The format must be a string literal, and is checked like printf's.
+/// Not for use in interrupt handlers.
+#ifdef BINARY_TRACE
+#define TRACE(fmt, ...)                                                        \
+    do {                                                                       \
+        if (false)                                                             \
+            printf(fmt, ##__VA_ARGS__);                                        \
+        trace::record("" fmt, ##__VA_ARGS__);                                  \
+    } while (0)
+#else
+#define TRACE(fmt, ...) TaskPrint().printf(fmt, ##__VA_ARGS__)
+#endif
+
+namespace trace {
+
+namespace detail {
+
+// A record is the format string's address, the low 32 bits of
+// esp_timer_get_time(), the payload length and the payload. Integers take 4
+// bytes (8 if they are 64-bit), floating point values are narrowed to
+// floats, and strings are a length byte followed by their characters.
+struct header_t {
+    uint32_t format;
+    uint32_t timestamp;
+    uint8_t length;
+} __attribute__((packed));
+
+struct encoder_t {
+    uint8_t *pos;
+    uint8_t *end;
+    bool overflow;
+
+    void put(const void *data, std::size_t size) {
+        if (end - pos < (std::ptrdiff_t)size) {
+            overflow = true;
+            return;
+        }
+        memcpy(pos, data, size);
+        pos += size;
+    }
+};
+
+template <typename T>
+typename std::enable_if<(std::is_integral<T>::value ||
+                         std::is_enum<T>::value) &&
+                        sizeof(T) <= 4>::type
+encode(encoder_t &out, T value) {
+    uint32_t word = static_cast<uint32_t>(value);
+    out.put(&word, sizeof(word));
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && sizeof(T) == 8>::type
+encode(encoder_t &out, T value) {
+    out.put(&value, sizeof(value));
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value>::type
+encode(encoder_t &out, T value) {
+    float narrow = static_cast<float>(value);
+    out.put(&narrow, sizeof(narrow));
+}
+
+inline void encode(encoder_t &out, const char *value) {
+    uint8_t length = 0;
+    while (value && length < TRACE_MAX_STRING && value[length]) {
+        ++length;
+    }
+    out.put(&length, 1);
+    out.put(value, length);
+}
+
+inline void encode(encoder_t &out, char *value) {
+    encode(out, static_cast<const char *>(value));
+}
+
+template <typename T> void encode(encoder_t &out, T *value) {
+    uint32_t address = reinterpret_cast<uintptr_t>(value);
+    out.put(&address, sizeof(address));
+}
+
+/// @brief Copies a finished record into the calling task's ring, or counts
+/// it as dropped if the ring is full.
+void commit(const uint8_t *record, std::size_t size);
+
+} // namespace detail
+
+template <typename... Ts> void record(const char *format, Ts... args) {
+    uint8_t buffer[TRACE_MAX_RECORD];
+    detail::encoder_t out{buffer + sizeof(detail::header_t),
+                          buffer + sizeof(buffer), false};
+    int expand[] = {0, (detail::encode(out, args), 0)...};
+    (void)expand;
+    if (out.overflow) {
+        // Truncating the payload would desynchronize the decoder
+        detail::commit(nullptr, 0);
+        return;
+    }
+    detail::header_t header{
+        static_cast<uint32_t>(reinterpret_cast<uintptr_t>(format)),
+        static_cast<uint32_t>(esp_timer_get_time()),
+        static_cast<uint8_t>(out.pos - buffer - sizeof(detail::header_t))};
+    memcpy(buffer, &header, sizeof(header));
+    detail::commit(buffer, out.pos - buffer);
+}
+
+/// @brief Prints the records and drops of every task's ring.
+void print_stats(Print &out);
+
+/// @brief Drains every ring, printing the records as base64 between
+/// `--- trace begin ---` and `--- trace end ---` lines for decode.py.
+void dump(Print &out);
+
+} // namespace trace
@@ -1,14 +1,91 @@
 #pragma once
 
+#include <initializer_list>
 #include <vector>
 
 #include "flashdisk.h"
 #include "cdcusb.h"
+#include "hidusb.h"
+
+#define SERIAL_OUT_BUFFER_SIZE 4096
+#define SERIAL_OUT_CHUNK_SIZE 512   // Largest single write to the CDC stack
+#define SERIAL_OUT_WAIT_MS 100      // How long `write` waits for room
+#define SERIAL_WRITER_STACK_SIZE 2048
+#define SERIAL_WRITER_PRIORITY 1
+#define USB_MOUSE_REPORT_ID 2
+#define USB_MOUSE_POLL_MS 1         // bInterval of the HID endpoint
+
+// CDC serial whose output is queued and sent in large chunks by a writer
+// task. Writers never touch the USB stack: `write` waits a short while for
+// room in the queue and then drops the rest, and `enqueue` can be told not to
+// wait at all.
+class BufferedCDC : public CDCusb {
+public:
+    struct Chunk {
+        const void *data;
+        size_t size;
+    };
+
+    struct Stats {
+        uint32_t bytesQueued;
+        uint32_t bytesSent;
+        uint32_t bytesDropped;  // Queue full
+        uint32_t usbWrites;
+        uint32_t peakFill;
+        int64_t since;          // When the counters were last reset
+    };
+
+    BufferedCDC();
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+
+    // Queues the chunks back to back, so output from other tasks can't land
+    // between them. Returns false and queues nothing if they don't fit.
+    bool enqueue(std::initializer_list<Chunk> chunks, bool wait);
+
+    // Launches the writer task. Output queued before this is kept.
+    bool startWriter();
+
+    Stats stats();
+    void resetStats();
+
+private:
+    portMUX_TYPE lock;
+    uint8_t ring[SERIAL_OUT_BUFFER_SIZE];
+    uint32_t head;  // Total bytes queued
+    uint32_t tail;  // Total bytes taken by the writer
+    Stats counters;
+
+    static void writerTask(void *arg);
+    size_t take(uint8_t *out, size_t max);
+};
+
+#if CFG_TUD_HID
+
+// HID mouse the host polls every USB_MOUSE_POLL_MS, rather than every 10 ms
+// as HIDmouse asks for. A report carries buttons, motion and wheel at once,
+// and is refused rather than skipped while the previous one is unsent.
+class FastHIDMouse : public HIDusb {
+public:
+    FastHIDMouse();
+    bool begin(char *str = nullptr) override;
+
+    // Whether the endpoint is free for another report
+    bool ready() const;
+    bool report(uint8_t buttons, int8_t x, int8_t y, int8_t wheel);
+};
+
+bool initHID();
+
+extern FastHIDMouse USBMouse;
+
+#endif
 
 bool initMSC();
 bool initSerial();
 void initUSB();
 
 extern FlashUSB USBStorage;
-extern CDCusb USBSerial;
-extern volatile bool usbMounted;
\ No newline at end of file
+extern BufferedCDC USBSerial;
+extern volatile bool usbMounted;
@@ -2893,6 +2893,29 @@ typedef struct duk_hthread duk_context;
 #error __FAST_MATH__ defined, refusing to compile
 #endif
 
+/*
+ *  Forced options
+ */
+
+#undef DUK_USE_BUFFEROBJECT_SUPPORT
+#undef DUK_USE_BYTECODE_DUMP_SUPPORT
+#undef DUK_USE_CBOR_BUILTIN
+#undef DUK_USE_CBOR_SUPPORT
+#undef DUK_USE_COROUTINE_SUPPORT
+#undef DUK_USE_ENCODING_BUILTINS
+#undef DUK_USE_ES6_PROXY
+#undef DUK_USE_HSTRING_ARRIDX
+#define DUK_USE_INTERRUPT_COUNTER
+#undef DUK_USE_JC
+#undef DUK_USE_JX
+#undef DUK_USE_PERFORMANCE_BUILTIN
+#undef DUK_USE_REFLECT_BUILTIN
+#undef DUK_USE_ROM_GLOBAL_CLONE
+#define DUK_USE_ROM_GLOBAL_INHERIT
+#define DUK_USE_ROM_OBJECTS
+#define DUK_USE_ROM_STRINGS
+#undef DUK_USE_VOLUNTARY_GC
+
 /*
  *  Autogenerated defaults
  */
@@ -2908,18 +2931,13 @@ typedef struct duk_hthread duk_context;
 #define DUK_USE_BASE64_FASTPATH
 #define DUK_USE_BASE64_SUPPORT
 #define DUK_USE_BOOLEAN_BUILTIN
-#define DUK_USE_BUFFEROBJECT_SUPPORT
 #undef DUK_USE_BUFLEN16
-#define DUK_USE_BYTECODE_DUMP_SUPPORT
 #define DUK_USE_CACHE_ACTIVATION
 #define DUK_USE_CACHE_CATCHER
 #define DUK_USE_CALLSTACK_LIMIT 10000
-#define DUK_USE_CBOR_BUILTIN
 #define DUK_USE_CBOR_DEC_RECLIMIT 1000
 #define DUK_USE_CBOR_ENC_RECLIMIT 1000
-#define DUK_USE_CBOR_SUPPORT
 #define DUK_USE_COMPILER_RECLIMIT 2500
-#define DUK_USE_COROUTINE_SUPPORT
 #undef DUK_USE_CPP_EXCEPTIONS
 #undef DUK_USE_DATAPTR16
 #undef DUK_USE_DATAPTR_DEC16
@@ -2942,13 +2960,11 @@ typedef struct duk_hthread duk_context;
 #undef DUK_USE_DEBUG_WRITE
 #define DUK_USE_DOUBLE_LINKED_HEAP
 #define DUK_USE_DUKTAPE_BUILTIN
-#define DUK_USE_ENCODING_BUILTINS
 #define DUK_USE_ERRCREATE
 #define DUK_USE_ERRTHROW
 #define DUK_USE_ES6
 #define DUK_USE_ES6_OBJECT_PROTO_PROPERTY
 #define DUK_USE_ES6_OBJECT_SETPROTOTYPEOF
-#define DUK_USE_ES6_PROXY
 #define DUK_USE_ES6_REGEXP_SYNTAX
 #define DUK_USE_ES6_UNICODE_ESCAPE
 #define DUK_USE_ES7
@@ -2997,16 +3013,13 @@ typedef struct duk_hthread duk_context;
 #define DUK_USE_HOBJECT_ENTRY_MINGROW_DIVISOR 8
 #define DUK_USE_HOBJECT_HASH_PART
 #define DUK_USE_HOBJECT_HASH_PROP_LIMIT 8
-#define DUK_USE_HSTRING_ARRIDX
 #define DUK_USE_HSTRING_CLEN
 #undef DUK_USE_HSTRING_EXTDATA
 #define DUK_USE_HSTRING_LAZY_CLEN
 #define DUK_USE_HTML_COMMENTS
 #define DUK_USE_IDCHAR_FASTPATH
 #undef DUK_USE_INJECT_HEAP_ALLOC_ERROR
-#undef DUK_USE_INTERRUPT_COUNTER
 #undef DUK_USE_INTERRUPT_DEBUG_FIXUP
-#define DUK_USE_JC
 #define DUK_USE_JSON_BUILTIN
 #define DUK_USE_JSON_DECNUMBER_FASTPATH
 #define DUK_USE_JSON_DECSTRING_FASTPATH
@@ -3016,7 +3029,6 @@ typedef struct duk_hthread duk_context;
 #define DUK_USE_JSON_QUOTESTRING_FASTPATH
 #undef DUK_USE_JSON_STRINGIFY_FASTPATH
 #define DUK_USE_JSON_SUPPORT
-#define DUK_USE_JX
 #define DUK_USE_LEXER_SLIDING_WINDOW
 #undef DUK_USE_LIGHTFUNC_BUILTINS
 #define DUK_USE_LITCACHE_SIZE 256
@@ -3037,24 +3049,18 @@ typedef struct duk_hthread duk_context;
 #undef DUK_USE_OBJSIZES16
 #undef DUK_USE_PARANOID_ERRORS
 #define DUK_USE_PC2LINE
-#define DUK_USE_PERFORMANCE_BUILTIN
 #undef DUK_USE_PREFER_SIZE
 #undef DUK_USE_PROMISE_BUILTIN
 #define DUK_USE_PROVIDE_DEFAULT_ALLOC_FUNCTIONS
 #undef DUK_USE_REFCOUNT16
 #define DUK_USE_REFCOUNT32
 #define DUK_USE_REFERENCE_COUNTING
-#define DUK_USE_REFLECT_BUILTIN
 #define DUK_USE_REGEXP_CANON_BITMAP
 #undef DUK_USE_REGEXP_CANON_WORKAROUND
 #define DUK_USE_REGEXP_COMPILER_RECLIMIT 10000
 #define DUK_USE_REGEXP_EXECUTOR_RECLIMIT 10000
 #define DUK_USE_REGEXP_SUPPORT
-#undef DUK_USE_ROM_GLOBAL_CLONE
-#undef DUK_USE_ROM_GLOBAL_INHERIT
-#undef DUK_USE_ROM_OBJECTS
 #define DUK_USE_ROM_PTRCOMP_FIRST 63488L
-#undef DUK_USE_ROM_STRINGS
 #define DUK_USE_SECTION_B
 #undef DUK_USE_SELF_TESTS
 #define DUK_USE_SHEBANG_COMMENTS
@@ -3086,9 +3092,22 @@ typedef struct duk_hthread duk_context;
 #undef DUK_USE_VALSTACK_UNSAFE
 #define DUK_USE_VERBOSE_ERRORS
 #define DUK_USE_VERBOSE_EXECUTOR_ERRORS
-#define DUK_USE_VOLUNTARY_GC
 #define DUK_USE_ZERO_BUFFER_DATA
 
+/*
+ *  Fixups
+ */
+
+/* Mouseless: abort scripts that overrun their time budget, see
+ * threeml::JSExecutor.  Implemented in src/3ml_jsexecutor.cpp.
+ */
+#if defined(__cplusplus)
+extern "C"
+#endif
+int duk_exec_timeout_check(void *udata);
+#undef DUK_USE_EXEC_TIMEOUT_CHECK
+#define DUK_USE_EXEC_TIMEOUT_CHECK(udata) duk_exec_timeout_check((udata))
+
 /*
  *  You may add overriding #define/#undef directives below for
  *  customization.  You of course cannot un-#include or un-typedef
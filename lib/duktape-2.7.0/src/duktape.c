@@ -1582,7 +1582,520 @@ DUK_INTERNAL_DECL void duk_tval_assert_valid(duk_tval *tv);
 #define DUK_BUILTINS_H_INCLUDED
 
 #if defined(DUK_USE_ROM_STRINGS)
-#error ROM support not enabled, rerun configure.py with --rom-support
+#define DUK_STRIDX_UC_UNDEFINED                                       0                              /* 'Undefined' */
+#define DUK_HEAP_STRING_UC_UNDEFINED(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_UNDEFINED)
+#define DUK_HTHREAD_STRING_UC_UNDEFINED(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_UNDEFINED)
+#define DUK_STRIDX_UC_NULL                                            1                              /* 'Null' */
+#define DUK_HEAP_STRING_UC_NULL(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_NULL)
+#define DUK_HTHREAD_STRING_UC_NULL(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_NULL)
+#define DUK_STRIDX_UC_SYMBOL                                          2                              /* 'Symbol' */
+#define DUK_HEAP_STRING_UC_SYMBOL(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_SYMBOL)
+#define DUK_HTHREAD_STRING_UC_SYMBOL(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_SYMBOL)
+#define DUK_STRIDX_UC_ARGUMENTS                                       3                              /* 'Arguments' */
+#define DUK_HEAP_STRING_UC_ARGUMENTS(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_ARGUMENTS)
+#define DUK_HTHREAD_STRING_UC_ARGUMENTS(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_ARGUMENTS)
+#define DUK_STRIDX_UC_OBJECT                                          4                              /* 'Object' */
+#define DUK_HEAP_STRING_UC_OBJECT(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_OBJECT)
+#define DUK_HTHREAD_STRING_UC_OBJECT(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_OBJECT)
+#define DUK_STRIDX_UC_FUNCTION                                        5                              /* 'Function' */
+#define DUK_HEAP_STRING_UC_FUNCTION(heap)                             DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_FUNCTION)
+#define DUK_HTHREAD_STRING_UC_FUNCTION(thr)                           DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_FUNCTION)
+#define DUK_STRIDX_UC_ARRAY                                           6                              /* 'Array' */
+#define DUK_HEAP_STRING_UC_ARRAY(heap)                                DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_ARRAY)
+#define DUK_HTHREAD_STRING_UC_ARRAY(thr)                              DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_ARRAY)
+#define DUK_STRIDX_UC_STRING                                          7                              /* 'String' */
+#define DUK_HEAP_STRING_UC_STRING(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_STRING)
+#define DUK_HTHREAD_STRING_UC_STRING(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_STRING)
+#define DUK_STRIDX_UC_BOOLEAN                                         8                              /* 'Boolean' */
+#define DUK_HEAP_STRING_UC_BOOLEAN(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_BOOLEAN)
+#define DUK_HTHREAD_STRING_UC_BOOLEAN(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_BOOLEAN)
+#define DUK_STRIDX_UC_NUMBER                                          9                              /* 'Number' */
+#define DUK_HEAP_STRING_UC_NUMBER(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_NUMBER)
+#define DUK_HTHREAD_STRING_UC_NUMBER(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_NUMBER)
+#define DUK_STRIDX_UC_DATE                                            10                             /* 'Date' */
+#define DUK_HEAP_STRING_UC_DATE(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_DATE)
+#define DUK_HTHREAD_STRING_UC_DATE(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_DATE)
+#define DUK_STRIDX_REG_EXP                                            11                             /* 'RegExp' */
+#define DUK_HEAP_STRING_REG_EXP(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_REG_EXP)
+#define DUK_HTHREAD_STRING_REG_EXP(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_REG_EXP)
+#define DUK_STRIDX_UC_ERROR                                           12                             /* 'Error' */
+#define DUK_HEAP_STRING_UC_ERROR(heap)                                DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_ERROR)
+#define DUK_HTHREAD_STRING_UC_ERROR(thr)                              DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_ERROR)
+#define DUK_STRIDX_MATH                                               13                             /* 'Math' */
+#define DUK_HEAP_STRING_MATH(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_MATH)
+#define DUK_HTHREAD_STRING_MATH(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_MATH)
+#define DUK_STRIDX_JSON                                               14                             /* 'JSON' */
+#define DUK_HEAP_STRING_JSON(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_JSON)
+#define DUK_HTHREAD_STRING_JSON(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_JSON)
+#define DUK_STRIDX_EMPTY_STRING                                       15                             /* '' */
+#define DUK_HEAP_STRING_EMPTY_STRING(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_EMPTY_STRING)
+#define DUK_HTHREAD_STRING_EMPTY_STRING(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_EMPTY_STRING)
+#define DUK_STRIDX_ARRAY_BUFFER                                       16                             /* 'ArrayBuffer' */
+#define DUK_HEAP_STRING_ARRAY_BUFFER(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_ARRAY_BUFFER)
+#define DUK_HTHREAD_STRING_ARRAY_BUFFER(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_ARRAY_BUFFER)
+#define DUK_STRIDX_DATA_VIEW                                          17                             /* 'DataView' */
+#define DUK_HEAP_STRING_DATA_VIEW(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_DATA_VIEW)
+#define DUK_HTHREAD_STRING_DATA_VIEW(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_DATA_VIEW)
+#define DUK_STRIDX_INT8_ARRAY                                         18                             /* 'Int8Array' */
+#define DUK_HEAP_STRING_INT8_ARRAY(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT8_ARRAY)
+#define DUK_HTHREAD_STRING_INT8_ARRAY(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT8_ARRAY)
+#define DUK_STRIDX_UINT8_ARRAY                                        19                             /* 'Uint8Array' */
+#define DUK_HEAP_STRING_UINT8_ARRAY(heap)                             DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UINT8_ARRAY)
+#define DUK_HTHREAD_STRING_UINT8_ARRAY(thr)                           DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UINT8_ARRAY)
+#define DUK_STRIDX_UINT8_CLAMPED_ARRAY                                20                             /* 'Uint8ClampedArray' */
+#define DUK_HEAP_STRING_UINT8_CLAMPED_ARRAY(heap)                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UINT8_CLAMPED_ARRAY)
+#define DUK_HTHREAD_STRING_UINT8_CLAMPED_ARRAY(thr)                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UINT8_CLAMPED_ARRAY)
+#define DUK_STRIDX_INT16_ARRAY                                        21                             /* 'Int16Array' */
+#define DUK_HEAP_STRING_INT16_ARRAY(heap)                             DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT16_ARRAY)
+#define DUK_HTHREAD_STRING_INT16_ARRAY(thr)                           DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT16_ARRAY)
+#define DUK_STRIDX_UINT16_ARRAY                                       22                             /* 'Uint16Array' */
+#define DUK_HEAP_STRING_UINT16_ARRAY(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UINT16_ARRAY)
+#define DUK_HTHREAD_STRING_UINT16_ARRAY(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UINT16_ARRAY)
+#define DUK_STRIDX_INT32_ARRAY                                        23                             /* 'Int32Array' */
+#define DUK_HEAP_STRING_INT32_ARRAY(heap)                             DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT32_ARRAY)
+#define DUK_HTHREAD_STRING_INT32_ARRAY(thr)                           DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT32_ARRAY)
+#define DUK_STRIDX_UINT32_ARRAY                                       24                             /* 'Uint32Array' */
+#define DUK_HEAP_STRING_UINT32_ARRAY(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UINT32_ARRAY)
+#define DUK_HTHREAD_STRING_UINT32_ARRAY(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UINT32_ARRAY)
+#define DUK_STRIDX_FLOAT32_ARRAY                                      25                             /* 'Float32Array' */
+#define DUK_HEAP_STRING_FLOAT32_ARRAY(heap)                           DUK_HEAP_GET_STRING((heap),DUK_STRIDX_FLOAT32_ARRAY)
+#define DUK_HTHREAD_STRING_FLOAT32_ARRAY(thr)                         DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_FLOAT32_ARRAY)
+#define DUK_STRIDX_FLOAT64_ARRAY                                      26                             /* 'Float64Array' */
+#define DUK_HEAP_STRING_FLOAT64_ARRAY(heap)                           DUK_HEAP_GET_STRING((heap),DUK_STRIDX_FLOAT64_ARRAY)
+#define DUK_HTHREAD_STRING_FLOAT64_ARRAY(thr)                         DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_FLOAT64_ARRAY)
+#define DUK_STRIDX_GLOBAL                                             27                             /* 'global' */
+#define DUK_HEAP_STRING_GLOBAL(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_GLOBAL)
+#define DUK_HTHREAD_STRING_GLOBAL(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_GLOBAL)
+#define DUK_STRIDX_OBJ_ENV                                            28                             /* 'ObjEnv' */
+#define DUK_HEAP_STRING_OBJ_ENV(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_OBJ_ENV)
+#define DUK_HTHREAD_STRING_OBJ_ENV(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_OBJ_ENV)
+#define DUK_STRIDX_DEC_ENV                                            29                             /* 'DecEnv' */
+#define DUK_HEAP_STRING_DEC_ENV(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_DEC_ENV)
+#define DUK_HTHREAD_STRING_DEC_ENV(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_DEC_ENV)
+#define DUK_STRIDX_UC_BUFFER                                          30                             /* 'Buffer' */
+#define DUK_HEAP_STRING_UC_BUFFER(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_BUFFER)
+#define DUK_HTHREAD_STRING_UC_BUFFER(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_BUFFER)
+#define DUK_STRIDX_UC_POINTER                                         31                             /* 'Pointer' */
+#define DUK_HEAP_STRING_UC_POINTER(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_POINTER)
+#define DUK_HTHREAD_STRING_UC_POINTER(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_POINTER)
+#define DUK_STRIDX_UC_THREAD                                          32                             /* 'Thread' */
+#define DUK_HEAP_STRING_UC_THREAD(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_THREAD)
+#define DUK_HTHREAD_STRING_UC_THREAD(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_UC_THREAD)
+#define DUK_STRIDX_EVAL                                               33                             /* 'eval' */
+#define DUK_HEAP_STRING_EVAL(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_EVAL)
+#define DUK_HTHREAD_STRING_EVAL(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_EVAL)
+#define DUK_STRIDX_VALUE                                              34                             /* 'value' */
+#define DUK_HEAP_STRING_VALUE(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_VALUE)
+#define DUK_HTHREAD_STRING_VALUE(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_VALUE)
+#define DUK_STRIDX_WRITABLE                                           35                             /* 'writable' */
+#define DUK_HEAP_STRING_WRITABLE(heap)                                DUK_HEAP_GET_STRING((heap),DUK_STRIDX_WRITABLE)
+#define DUK_HTHREAD_STRING_WRITABLE(thr)                              DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_WRITABLE)
+#define DUK_STRIDX_CONFIGURABLE                                       36                             /* 'configurable' */
+#define DUK_HEAP_STRING_CONFIGURABLE(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_CONFIGURABLE)
+#define DUK_HTHREAD_STRING_CONFIGURABLE(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_CONFIGURABLE)
+#define DUK_STRIDX_ENUMERABLE                                         37                             /* 'enumerable' */
+#define DUK_HEAP_STRING_ENUMERABLE(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_ENUMERABLE)
+#define DUK_HTHREAD_STRING_ENUMERABLE(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_ENUMERABLE)
+#define DUK_STRIDX_JOIN                                               38                             /* 'join' */
+#define DUK_HEAP_STRING_JOIN(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_JOIN)
+#define DUK_HTHREAD_STRING_JOIN(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_JOIN)
+#define DUK_STRIDX_TO_LOCALE_STRING                                   39                             /* 'toLocaleString' */
+#define DUK_HEAP_STRING_TO_LOCALE_STRING(heap)                        DUK_HEAP_GET_STRING((heap),DUK_STRIDX_TO_LOCALE_STRING)
+#define DUK_HTHREAD_STRING_TO_LOCALE_STRING(thr)                      DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_TO_LOCALE_STRING)
+#define DUK_STRIDX_VALUE_OF                                           40                             /* 'valueOf' */
+#define DUK_HEAP_STRING_VALUE_OF(heap)                                DUK_HEAP_GET_STRING((heap),DUK_STRIDX_VALUE_OF)
+#define DUK_HTHREAD_STRING_VALUE_OF(thr)                              DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_VALUE_OF)
+#define DUK_STRIDX_TO_UTC_STRING                                      41                             /* 'toUTCString' */
+#define DUK_HEAP_STRING_TO_UTC_STRING(heap)                           DUK_HEAP_GET_STRING((heap),DUK_STRIDX_TO_UTC_STRING)
+#define DUK_HTHREAD_STRING_TO_UTC_STRING(thr)                         DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_TO_UTC_STRING)
+#define DUK_STRIDX_TO_ISO_STRING                                      42                             /* 'toISOString' */
+#define DUK_HEAP_STRING_TO_ISO_STRING(heap)                           DUK_HEAP_GET_STRING((heap),DUK_STRIDX_TO_ISO_STRING)
+#define DUK_HTHREAD_STRING_TO_ISO_STRING(thr)                         DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_TO_ISO_STRING)
+#define DUK_STRIDX_TO_GMT_STRING                                      43                             /* 'toGMTString' */
+#define DUK_HEAP_STRING_TO_GMT_STRING(heap)                           DUK_HEAP_GET_STRING((heap),DUK_STRIDX_TO_GMT_STRING)
+#define DUK_HTHREAD_STRING_TO_GMT_STRING(thr)                         DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_TO_GMT_STRING)
+#define DUK_STRIDX_SOURCE                                             44                             /* 'source' */
+#define DUK_HEAP_STRING_SOURCE(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_SOURCE)
+#define DUK_HTHREAD_STRING_SOURCE(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_SOURCE)
+#define DUK_STRIDX_IGNORE_CASE                                        45                             /* 'ignoreCase' */
+#define DUK_HEAP_STRING_IGNORE_CASE(heap)                             DUK_HEAP_GET_STRING((heap),DUK_STRIDX_IGNORE_CASE)
+#define DUK_HTHREAD_STRING_IGNORE_CASE(thr)                           DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_IGNORE_CASE)
+#define DUK_STRIDX_MULTILINE                                          46                             /* 'multiline' */
+#define DUK_HEAP_STRING_MULTILINE(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_MULTILINE)
+#define DUK_HTHREAD_STRING_MULTILINE(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_MULTILINE)
+#define DUK_STRIDX_LAST_INDEX                                         47                             /* 'lastIndex' */
+#define DUK_HEAP_STRING_LAST_INDEX(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LAST_INDEX)
+#define DUK_HTHREAD_STRING_LAST_INDEX(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LAST_INDEX)
+#define DUK_STRIDX_FLAGS                                              48                             /* 'flags' */
+#define DUK_HEAP_STRING_FLAGS(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_FLAGS)
+#define DUK_HTHREAD_STRING_FLAGS(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_FLAGS)
+#define DUK_STRIDX_INDEX                                              49                             /* 'index' */
+#define DUK_HEAP_STRING_INDEX(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INDEX)
+#define DUK_HTHREAD_STRING_INDEX(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INDEX)
+#define DUK_STRIDX_PROTOTYPE                                          50                             /* 'prototype' */
+#define DUK_HEAP_STRING_PROTOTYPE(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_PROTOTYPE)
+#define DUK_HTHREAD_STRING_PROTOTYPE(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_PROTOTYPE)
+#define DUK_STRIDX_CONSTRUCTOR                                        51                             /* 'constructor' */
+#define DUK_HEAP_STRING_CONSTRUCTOR(heap)                             DUK_HEAP_GET_STRING((heap),DUK_STRIDX_CONSTRUCTOR)
+#define DUK_HTHREAD_STRING_CONSTRUCTOR(thr)                           DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_CONSTRUCTOR)
+#define DUK_STRIDX_MESSAGE                                            52                             /* 'message' */
+#define DUK_HEAP_STRING_MESSAGE(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_MESSAGE)
+#define DUK_HTHREAD_STRING_MESSAGE(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_MESSAGE)
+#define DUK_STRIDX_LC_BOOLEAN                                         53                             /* 'boolean' */
+#define DUK_HEAP_STRING_LC_BOOLEAN(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_BOOLEAN)
+#define DUK_HTHREAD_STRING_LC_BOOLEAN(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_BOOLEAN)
+#define DUK_STRIDX_LC_NUMBER                                          54                             /* 'number' */
+#define DUK_HEAP_STRING_LC_NUMBER(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_NUMBER)
+#define DUK_HTHREAD_STRING_LC_NUMBER(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_NUMBER)
+#define DUK_STRIDX_LC_STRING                                          55                             /* 'string' */
+#define DUK_HEAP_STRING_LC_STRING(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_STRING)
+#define DUK_HTHREAD_STRING_LC_STRING(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_STRING)
+#define DUK_STRIDX_LC_SYMBOL                                          56                             /* 'symbol' */
+#define DUK_HEAP_STRING_LC_SYMBOL(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_SYMBOL)
+#define DUK_HTHREAD_STRING_LC_SYMBOL(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_SYMBOL)
+#define DUK_STRIDX_LC_OBJECT                                          57                             /* 'object' */
+#define DUK_HEAP_STRING_LC_OBJECT(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_OBJECT)
+#define DUK_HTHREAD_STRING_LC_OBJECT(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_OBJECT)
+#define DUK_STRIDX_LC_UNDEFINED                                       58                             /* 'undefined' */
+#define DUK_HEAP_STRING_LC_UNDEFINED(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_UNDEFINED)
+#define DUK_HTHREAD_STRING_LC_UNDEFINED(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_UNDEFINED)
+#define DUK_STRIDX_NAN                                                59                             /* 'NaN' */
+#define DUK_HEAP_STRING_NAN(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_NAN)
+#define DUK_HTHREAD_STRING_NAN(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_NAN)
+#define DUK_STRIDX_INFINITY                                           60                             /* 'Infinity' */
+#define DUK_HEAP_STRING_INFINITY(heap)                                DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INFINITY)
+#define DUK_HTHREAD_STRING_INFINITY(thr)                              DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INFINITY)
+#define DUK_STRIDX_MINUS_INFINITY                                     61                             /* '-Infinity' */
+#define DUK_HEAP_STRING_MINUS_INFINITY(heap)                          DUK_HEAP_GET_STRING((heap),DUK_STRIDX_MINUS_INFINITY)
+#define DUK_HTHREAD_STRING_MINUS_INFINITY(thr)                        DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_MINUS_INFINITY)
+#define DUK_STRIDX_MINUS_ZERO                                         62                             /* '-0' */
+#define DUK_HEAP_STRING_MINUS_ZERO(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_MINUS_ZERO)
+#define DUK_HTHREAD_STRING_MINUS_ZERO(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_MINUS_ZERO)
+#define DUK_STRIDX_COMMA                                              63                             /* ',' */
+#define DUK_HEAP_STRING_COMMA(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_COMMA)
+#define DUK_HTHREAD_STRING_COMMA(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_COMMA)
+#define DUK_STRIDX_NEWLINE_4SPACE                                     64                             /* '\n    ' */
+#define DUK_HEAP_STRING_NEWLINE_4SPACE(heap)                          DUK_HEAP_GET_STRING((heap),DUK_STRIDX_NEWLINE_4SPACE)
+#define DUK_HTHREAD_STRING_NEWLINE_4SPACE(thr)                        DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_NEWLINE_4SPACE)
+#define DUK_STRIDX_BRACKETED_ELLIPSIS                                 65                             /* '[...]' */
+#define DUK_HEAP_STRING_BRACKETED_ELLIPSIS(heap)                      DUK_HEAP_GET_STRING((heap),DUK_STRIDX_BRACKETED_ELLIPSIS)
+#define DUK_HTHREAD_STRING_BRACKETED_ELLIPSIS(thr)                    DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_BRACKETED_ELLIPSIS)
+#define DUK_STRIDX_INVALID_DATE                                       66                             /* 'Invalid Date' */
+#define DUK_HEAP_STRING_INVALID_DATE(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INVALID_DATE)
+#define DUK_HTHREAD_STRING_INVALID_DATE(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INVALID_DATE)
+#define DUK_STRIDX_LC_ARGUMENTS                                       67                             /* 'arguments' */
+#define DUK_HEAP_STRING_LC_ARGUMENTS(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_ARGUMENTS)
+#define DUK_HTHREAD_STRING_LC_ARGUMENTS(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_ARGUMENTS)
+#define DUK_STRIDX_CALLEE                                             68                             /* 'callee' */
+#define DUK_HEAP_STRING_CALLEE(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_CALLEE)
+#define DUK_HTHREAD_STRING_CALLEE(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_CALLEE)
+#define DUK_STRIDX_CALLER                                             69                             /* 'caller' */
+#define DUK_HEAP_STRING_CALLER(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_CALLER)
+#define DUK_HTHREAD_STRING_CALLER(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_CALLER)
+#define DUK_STRIDX_APPLY                                              70                             /* 'apply' */
+#define DUK_HEAP_STRING_APPLY(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_APPLY)
+#define DUK_HTHREAD_STRING_APPLY(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_APPLY)
+#define DUK_STRIDX_CONSTRUCT                                          71                             /* 'construct' */
+#define DUK_HEAP_STRING_CONSTRUCT(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_CONSTRUCT)
+#define DUK_HTHREAD_STRING_CONSTRUCT(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_CONSTRUCT)
+#define DUK_STRIDX_DELETE_PROPERTY                                    72                             /* 'deleteProperty' */
+#define DUK_HEAP_STRING_DELETE_PROPERTY(heap)                         DUK_HEAP_GET_STRING((heap),DUK_STRIDX_DELETE_PROPERTY)
+#define DUK_HTHREAD_STRING_DELETE_PROPERTY(thr)                       DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_DELETE_PROPERTY)
+#define DUK_STRIDX_GET                                                73                             /* 'get' */
+#define DUK_HEAP_STRING_GET(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_GET)
+#define DUK_HTHREAD_STRING_GET(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_GET)
+#define DUK_STRIDX_HAS                                                74                             /* 'has' */
+#define DUK_HEAP_STRING_HAS(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_HAS)
+#define DUK_HTHREAD_STRING_HAS(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_HAS)
+#define DUK_STRIDX_OWN_KEYS                                           75                             /* 'ownKeys' */
+#define DUK_HEAP_STRING_OWN_KEYS(heap)                                DUK_HEAP_GET_STRING((heap),DUK_STRIDX_OWN_KEYS)
+#define DUK_HTHREAD_STRING_OWN_KEYS(thr)                              DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_OWN_KEYS)
+#define DUK_STRIDX_WELLKNOWN_SYMBOL_TO_PRIMITIVE                      76                             /* '\x81Symbol.toPrimitive\xff' */
+#define DUK_HEAP_STRING_WELLKNOWN_SYMBOL_TO_PRIMITIVE(heap)           DUK_HEAP_GET_STRING((heap),DUK_STRIDX_WELLKNOWN_SYMBOL_TO_PRIMITIVE)
+#define DUK_HTHREAD_STRING_WELLKNOWN_SYMBOL_TO_PRIMITIVE(thr)         DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_WELLKNOWN_SYMBOL_TO_PRIMITIVE)
+#define DUK_STRIDX_WELLKNOWN_SYMBOL_HAS_INSTANCE                      77                             /* '\x81Symbol.hasInstance\xff' */
+#define DUK_HEAP_STRING_WELLKNOWN_SYMBOL_HAS_INSTANCE(heap)           DUK_HEAP_GET_STRING((heap),DUK_STRIDX_WELLKNOWN_SYMBOL_HAS_INSTANCE)
+#define DUK_HTHREAD_STRING_WELLKNOWN_SYMBOL_HAS_INSTANCE(thr)         DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_WELLKNOWN_SYMBOL_HAS_INSTANCE)
+#define DUK_STRIDX_WELLKNOWN_SYMBOL_TO_STRING_TAG                     78                             /* '\x81Symbol.toStringTag\xff' */
+#define DUK_HEAP_STRING_WELLKNOWN_SYMBOL_TO_STRING_TAG(heap)          DUK_HEAP_GET_STRING((heap),DUK_STRIDX_WELLKNOWN_SYMBOL_TO_STRING_TAG)
+#define DUK_HTHREAD_STRING_WELLKNOWN_SYMBOL_TO_STRING_TAG(thr)        DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_WELLKNOWN_SYMBOL_TO_STRING_TAG)
+#define DUK_STRIDX_WELLKNOWN_SYMBOL_IS_CONCAT_SPREADABLE              79                             /* '\x81Symbol.isConcatSpreadable\xff' */
+#define DUK_HEAP_STRING_WELLKNOWN_SYMBOL_IS_CONCAT_SPREADABLE(heap)   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_WELLKNOWN_SYMBOL_IS_CONCAT_SPREADABLE)
+#define DUK_HTHREAD_STRING_WELLKNOWN_SYMBOL_IS_CONCAT_SPREADABLE(thr)  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_WELLKNOWN_SYMBOL_IS_CONCAT_SPREADABLE)
+#define DUK_STRIDX_SET_PROTOTYPE_OF                                   80                             /* 'setPrototypeOf' */
+#define DUK_HEAP_STRING_SET_PROTOTYPE_OF(heap)                        DUK_HEAP_GET_STRING((heap),DUK_STRIDX_SET_PROTOTYPE_OF)
+#define DUK_HTHREAD_STRING_SET_PROTOTYPE_OF(thr)                      DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_SET_PROTOTYPE_OF)
+#define DUK_STRIDX___PROTO__                                          81                             /* '__proto__' */
+#define DUK_HEAP_STRING___PROTO__(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX___PROTO__)
+#define DUK_HTHREAD_STRING___PROTO__(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX___PROTO__)
+#define DUK_STRIDX_TO_STRING                                          82                             /* 'toString' */
+#define DUK_HEAP_STRING_TO_STRING(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_TO_STRING)
+#define DUK_HTHREAD_STRING_TO_STRING(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_TO_STRING)
+#define DUK_STRIDX_TO_JSON                                            83                             /* 'toJSON' */
+#define DUK_HEAP_STRING_TO_JSON(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_TO_JSON)
+#define DUK_HTHREAD_STRING_TO_JSON(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_TO_JSON)
+#define DUK_STRIDX_TYPE                                               84                             /* 'type' */
+#define DUK_HEAP_STRING_TYPE(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_TYPE)
+#define DUK_HTHREAD_STRING_TYPE(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_TYPE)
+#define DUK_STRIDX_DATA                                               85                             /* 'data' */
+#define DUK_HEAP_STRING_DATA(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_DATA)
+#define DUK_HTHREAD_STRING_DATA(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_DATA)
+#define DUK_STRIDX_LC_BUFFER                                          86                             /* 'buffer' */
+#define DUK_HEAP_STRING_LC_BUFFER(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_BUFFER)
+#define DUK_HTHREAD_STRING_LC_BUFFER(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_BUFFER)
+#define DUK_STRIDX_LENGTH                                             87                             /* 'length' */
+#define DUK_HEAP_STRING_LENGTH(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LENGTH)
+#define DUK_HTHREAD_STRING_LENGTH(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LENGTH)
+#define DUK_STRIDX_SET                                                88                             /* 'set' */
+#define DUK_HEAP_STRING_SET(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_SET)
+#define DUK_HTHREAD_STRING_SET(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_SET)
+#define DUK_STRIDX_STACK                                              89                             /* 'stack' */
+#define DUK_HEAP_STRING_STACK(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_STACK)
+#define DUK_HTHREAD_STRING_STACK(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_STACK)
+#define DUK_STRIDX_PC                                                 90                             /* 'pc' */
+#define DUK_HEAP_STRING_PC(heap)                                      DUK_HEAP_GET_STRING((heap),DUK_STRIDX_PC)
+#define DUK_HTHREAD_STRING_PC(thr)                                    DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_PC)
+#define DUK_STRIDX_LINE_NUMBER                                        91                             /* 'lineNumber' */
+#define DUK_HEAP_STRING_LINE_NUMBER(heap)                             DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LINE_NUMBER)
+#define DUK_HTHREAD_STRING_LINE_NUMBER(thr)                           DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LINE_NUMBER)
+#define DUK_STRIDX_INT_TRACEDATA                                      92                             /* '\x82Tracedata' */
+#define DUK_HEAP_STRING_INT_TRACEDATA(heap)                           DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_TRACEDATA)
+#define DUK_HTHREAD_STRING_INT_TRACEDATA(thr)                         DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_TRACEDATA)
+#define DUK_STRIDX_NAME                                               93                             /* 'name' */
+#define DUK_HEAP_STRING_NAME(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_NAME)
+#define DUK_HTHREAD_STRING_NAME(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_NAME)
+#define DUK_STRIDX_FILE_NAME                                          94                             /* 'fileName' */
+#define DUK_HEAP_STRING_FILE_NAME(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_FILE_NAME)
+#define DUK_HTHREAD_STRING_FILE_NAME(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_FILE_NAME)
+#define DUK_STRIDX_LC_POINTER                                         95                             /* 'pointer' */
+#define DUK_HEAP_STRING_LC_POINTER(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_POINTER)
+#define DUK_HTHREAD_STRING_LC_POINTER(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_POINTER)
+#define DUK_STRIDX_INT_TARGET                                         96                             /* '\x82Target' */
+#define DUK_HEAP_STRING_INT_TARGET(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_TARGET)
+#define DUK_HTHREAD_STRING_INT_TARGET(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_TARGET)
+#define DUK_STRIDX_INT_NEXT                                           97                             /* '\x82Next' */
+#define DUK_HEAP_STRING_INT_NEXT(heap)                                DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_NEXT)
+#define DUK_HTHREAD_STRING_INT_NEXT(thr)                              DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_NEXT)
+#define DUK_STRIDX_INT_BYTECODE                                       98                             /* '\x82Bytecode' */
+#define DUK_HEAP_STRING_INT_BYTECODE(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_BYTECODE)
+#define DUK_HTHREAD_STRING_INT_BYTECODE(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_BYTECODE)
+#define DUK_STRIDX_INT_FORMALS                                        99                             /* '\x82Formals' */
+#define DUK_HEAP_STRING_INT_FORMALS(heap)                             DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_FORMALS)
+#define DUK_HTHREAD_STRING_INT_FORMALS(thr)                           DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_FORMALS)
+#define DUK_STRIDX_INT_VARMAP                                         100                            /* '\x82Varmap' */
+#define DUK_HEAP_STRING_INT_VARMAP(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_VARMAP)
+#define DUK_HTHREAD_STRING_INT_VARMAP(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_VARMAP)
+#define DUK_STRIDX_INT_SOURCE                                         101                            /* '\x82Source' */
+#define DUK_HEAP_STRING_INT_SOURCE(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_SOURCE)
+#define DUK_HTHREAD_STRING_INT_SOURCE(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_SOURCE)
+#define DUK_STRIDX_INT_PC2LINE                                        102                            /* '\x82Pc2line' */
+#define DUK_HEAP_STRING_INT_PC2LINE(heap)                             DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_PC2LINE)
+#define DUK_HTHREAD_STRING_INT_PC2LINE(thr)                           DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_PC2LINE)
+#define DUK_STRIDX_INT_MAP                                            103                            /* '\x82Map' */
+#define DUK_HEAP_STRING_INT_MAP(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_MAP)
+#define DUK_HTHREAD_STRING_INT_MAP(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_MAP)
+#define DUK_STRIDX_INT_VARENV                                         104                            /* '\x82Varenv' */
+#define DUK_HEAP_STRING_INT_VARENV(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_VARENV)
+#define DUK_HTHREAD_STRING_INT_VARENV(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_VARENV)
+#define DUK_STRIDX_INT_FINALIZER                                      105                            /* '\x82Finalizer' */
+#define DUK_HEAP_STRING_INT_FINALIZER(heap)                           DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_FINALIZER)
+#define DUK_HTHREAD_STRING_INT_FINALIZER(thr)                         DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_FINALIZER)
+#define DUK_STRIDX_INT_VALUE                                          106                            /* '\x82Value' */
+#define DUK_HEAP_STRING_INT_VALUE(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INT_VALUE)
+#define DUK_HTHREAD_STRING_INT_VALUE(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INT_VALUE)
+#define DUK_STRIDX_COMPILE                                            107                            /* 'compile' */
+#define DUK_HEAP_STRING_COMPILE(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_COMPILE)
+#define DUK_HTHREAD_STRING_COMPILE(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_COMPILE)
+#define DUK_STRIDX_INPUT                                              108                            /* 'input' */
+#define DUK_HEAP_STRING_INPUT(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INPUT)
+#define DUK_HTHREAD_STRING_INPUT(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INPUT)
+#define DUK_STRIDX_ERR_CREATE                                         109                            /* 'errCreate' */
+#define DUK_HEAP_STRING_ERR_CREATE(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_ERR_CREATE)
+#define DUK_HTHREAD_STRING_ERR_CREATE(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_ERR_CREATE)
+#define DUK_STRIDX_ERR_THROW                                          110                            /* 'errThrow' */
+#define DUK_HEAP_STRING_ERR_THROW(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_ERR_THROW)
+#define DUK_HTHREAD_STRING_ERR_THROW(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_ERR_THROW)
+#define DUK_STRIDX_ENV                                                111                            /* 'env' */
+#define DUK_HEAP_STRING_ENV(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_ENV)
+#define DUK_HTHREAD_STRING_ENV(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_ENV)
+#define DUK_STRIDX_HEX                                                112                            /* 'hex' */
+#define DUK_HEAP_STRING_HEX(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_HEX)
+#define DUK_HTHREAD_STRING_HEX(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_HEX)
+#define DUK_STRIDX_BASE64                                             113                            /* 'base64' */
+#define DUK_HEAP_STRING_BASE64(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_BASE64)
+#define DUK_HTHREAD_STRING_BASE64(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_BASE64)
+#define DUK_STRIDX_JX                                                 114                            /* 'jx' */
+#define DUK_HEAP_STRING_JX(heap)                                      DUK_HEAP_GET_STRING((heap),DUK_STRIDX_JX)
+#define DUK_HTHREAD_STRING_JX(thr)                                    DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_JX)
+#define DUK_STRIDX_JC                                                 115                            /* 'jc' */
+#define DUK_HEAP_STRING_JC(heap)                                      DUK_HEAP_GET_STRING((heap),DUK_STRIDX_JC)
+#define DUK_HTHREAD_STRING_JC(thr)                                    DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_JC)
+#define DUK_STRIDX_JSON_EXT_UNDEFINED                                 116                            /* '{"_undef":true}' */
+#define DUK_HEAP_STRING_JSON_EXT_UNDEFINED(heap)                      DUK_HEAP_GET_STRING((heap),DUK_STRIDX_JSON_EXT_UNDEFINED)
+#define DUK_HTHREAD_STRING_JSON_EXT_UNDEFINED(thr)                    DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_JSON_EXT_UNDEFINED)
+#define DUK_STRIDX_JSON_EXT_NAN                                       117                            /* '{"_nan":true}' */
+#define DUK_HEAP_STRING_JSON_EXT_NAN(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_JSON_EXT_NAN)
+#define DUK_HTHREAD_STRING_JSON_EXT_NAN(thr)                          DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_JSON_EXT_NAN)
+#define DUK_STRIDX_JSON_EXT_POSINF                                    118                            /* '{"_inf":true}' */
+#define DUK_HEAP_STRING_JSON_EXT_POSINF(heap)                         DUK_HEAP_GET_STRING((heap),DUK_STRIDX_JSON_EXT_POSINF)
+#define DUK_HTHREAD_STRING_JSON_EXT_POSINF(thr)                       DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_JSON_EXT_POSINF)
+#define DUK_STRIDX_JSON_EXT_NEGINF                                    119                            /* '{"_ninf":true}' */
+#define DUK_HEAP_STRING_JSON_EXT_NEGINF(heap)                         DUK_HEAP_GET_STRING((heap),DUK_STRIDX_JSON_EXT_NEGINF)
+#define DUK_HTHREAD_STRING_JSON_EXT_NEGINF(thr)                       DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_JSON_EXT_NEGINF)
+#define DUK_STRIDX_JSON_EXT_FUNCTION1                                 120                            /* '{"_func":true}' */
+#define DUK_HEAP_STRING_JSON_EXT_FUNCTION1(heap)                      DUK_HEAP_GET_STRING((heap),DUK_STRIDX_JSON_EXT_FUNCTION1)
+#define DUK_HTHREAD_STRING_JSON_EXT_FUNCTION1(thr)                    DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_JSON_EXT_FUNCTION1)
+#define DUK_STRIDX_JSON_EXT_FUNCTION2                                 121                            /* '{_func:true}' */
+#define DUK_HEAP_STRING_JSON_EXT_FUNCTION2(heap)                      DUK_HEAP_GET_STRING((heap),DUK_STRIDX_JSON_EXT_FUNCTION2)
+#define DUK_HTHREAD_STRING_JSON_EXT_FUNCTION2(thr)                    DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_JSON_EXT_FUNCTION2)
+#define DUK_STRIDX_BREAK                                              122                            /* 'break' */
+#define DUK_HEAP_STRING_BREAK(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_BREAK)
+#define DUK_HTHREAD_STRING_BREAK(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_BREAK)
+#define DUK_STRIDX_CASE                                               123                            /* 'case' */
+#define DUK_HEAP_STRING_CASE(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_CASE)
+#define DUK_HTHREAD_STRING_CASE(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_CASE)
+#define DUK_STRIDX_CATCH                                              124                            /* 'catch' */
+#define DUK_HEAP_STRING_CATCH(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_CATCH)
+#define DUK_HTHREAD_STRING_CATCH(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_CATCH)
+#define DUK_STRIDX_CONTINUE                                           125                            /* 'continue' */
+#define DUK_HEAP_STRING_CONTINUE(heap)                                DUK_HEAP_GET_STRING((heap),DUK_STRIDX_CONTINUE)
+#define DUK_HTHREAD_STRING_CONTINUE(thr)                              DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_CONTINUE)
+#define DUK_STRIDX_DEBUGGER                                           126                            /* 'debugger' */
+#define DUK_HEAP_STRING_DEBUGGER(heap)                                DUK_HEAP_GET_STRING((heap),DUK_STRIDX_DEBUGGER)
+#define DUK_HTHREAD_STRING_DEBUGGER(thr)                              DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_DEBUGGER)
+#define DUK_STRIDX_DEFAULT                                            127                            /* 'default' */
+#define DUK_HEAP_STRING_DEFAULT(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_DEFAULT)
+#define DUK_HTHREAD_STRING_DEFAULT(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_DEFAULT)
+#define DUK_STRIDX_DELETE                                             128                            /* 'delete' */
+#define DUK_HEAP_STRING_DELETE(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_DELETE)
+#define DUK_HTHREAD_STRING_DELETE(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_DELETE)
+#define DUK_STRIDX_DO                                                 129                            /* 'do' */
+#define DUK_HEAP_STRING_DO(heap)                                      DUK_HEAP_GET_STRING((heap),DUK_STRIDX_DO)
+#define DUK_HTHREAD_STRING_DO(thr)                                    DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_DO)
+#define DUK_STRIDX_ELSE                                               130                            /* 'else' */
+#define DUK_HEAP_STRING_ELSE(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_ELSE)
+#define DUK_HTHREAD_STRING_ELSE(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_ELSE)
+#define DUK_STRIDX_FINALLY                                            131                            /* 'finally' */
+#define DUK_HEAP_STRING_FINALLY(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_FINALLY)
+#define DUK_HTHREAD_STRING_FINALLY(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_FINALLY)
+#define DUK_STRIDX_FOR                                                132                            /* 'for' */
+#define DUK_HEAP_STRING_FOR(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_FOR)
+#define DUK_HTHREAD_STRING_FOR(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_FOR)
+#define DUK_STRIDX_LC_FUNCTION                                        133                            /* 'function' */
+#define DUK_HEAP_STRING_LC_FUNCTION(heap)                             DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_FUNCTION)
+#define DUK_HTHREAD_STRING_LC_FUNCTION(thr)                           DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_FUNCTION)
+#define DUK_STRIDX_IF                                                 134                            /* 'if' */
+#define DUK_HEAP_STRING_IF(heap)                                      DUK_HEAP_GET_STRING((heap),DUK_STRIDX_IF)
+#define DUK_HTHREAD_STRING_IF(thr)                                    DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_IF)
+#define DUK_STRIDX_IN                                                 135                            /* 'in' */
+#define DUK_HEAP_STRING_IN(heap)                                      DUK_HEAP_GET_STRING((heap),DUK_STRIDX_IN)
+#define DUK_HTHREAD_STRING_IN(thr)                                    DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_IN)
+#define DUK_STRIDX_INSTANCEOF                                         136                            /* 'instanceof' */
+#define DUK_HEAP_STRING_INSTANCEOF(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INSTANCEOF)
+#define DUK_HTHREAD_STRING_INSTANCEOF(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INSTANCEOF)
+#define DUK_STRIDX_NEW                                                137                            /* 'new' */
+#define DUK_HEAP_STRING_NEW(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_NEW)
+#define DUK_HTHREAD_STRING_NEW(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_NEW)
+#define DUK_STRIDX_RETURN                                             138                            /* 'return' */
+#define DUK_HEAP_STRING_RETURN(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_RETURN)
+#define DUK_HTHREAD_STRING_RETURN(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_RETURN)
+#define DUK_STRIDX_SWITCH                                             139                            /* 'switch' */
+#define DUK_HEAP_STRING_SWITCH(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_SWITCH)
+#define DUK_HTHREAD_STRING_SWITCH(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_SWITCH)
+#define DUK_STRIDX_THIS                                               140                            /* 'this' */
+#define DUK_HEAP_STRING_THIS(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_THIS)
+#define DUK_HTHREAD_STRING_THIS(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_THIS)
+#define DUK_STRIDX_THROW                                              141                            /* 'throw' */
+#define DUK_HEAP_STRING_THROW(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_THROW)
+#define DUK_HTHREAD_STRING_THROW(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_THROW)
+#define DUK_STRIDX_TRY                                                142                            /* 'try' */
+#define DUK_HEAP_STRING_TRY(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_TRY)
+#define DUK_HTHREAD_STRING_TRY(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_TRY)
+#define DUK_STRIDX_TYPEOF                                             143                            /* 'typeof' */
+#define DUK_HEAP_STRING_TYPEOF(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_TYPEOF)
+#define DUK_HTHREAD_STRING_TYPEOF(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_TYPEOF)
+#define DUK_STRIDX_VAR                                                144                            /* 'var' */
+#define DUK_HEAP_STRING_VAR(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_VAR)
+#define DUK_HTHREAD_STRING_VAR(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_VAR)
+#define DUK_STRIDX_CONST                                              145                            /* 'const' */
+#define DUK_HEAP_STRING_CONST(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_CONST)
+#define DUK_HTHREAD_STRING_CONST(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_CONST)
+#define DUK_STRIDX_VOID                                               146                            /* 'void' */
+#define DUK_HEAP_STRING_VOID(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_VOID)
+#define DUK_HTHREAD_STRING_VOID(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_VOID)
+#define DUK_STRIDX_WHILE                                              147                            /* 'while' */
+#define DUK_HEAP_STRING_WHILE(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_WHILE)
+#define DUK_HTHREAD_STRING_WHILE(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_WHILE)
+#define DUK_STRIDX_WITH                                               148                            /* 'with' */
+#define DUK_HEAP_STRING_WITH(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_WITH)
+#define DUK_HTHREAD_STRING_WITH(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_WITH)
+#define DUK_STRIDX_CLASS                                              149                            /* 'class' */
+#define DUK_HEAP_STRING_CLASS(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_CLASS)
+#define DUK_HTHREAD_STRING_CLASS(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_CLASS)
+#define DUK_STRIDX_ENUM                                               150                            /* 'enum' */
+#define DUK_HEAP_STRING_ENUM(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_ENUM)
+#define DUK_HTHREAD_STRING_ENUM(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_ENUM)
+#define DUK_STRIDX_EXPORT                                             151                            /* 'export' */
+#define DUK_HEAP_STRING_EXPORT(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_EXPORT)
+#define DUK_HTHREAD_STRING_EXPORT(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_EXPORT)
+#define DUK_STRIDX_EXTENDS                                            152                            /* 'extends' */
+#define DUK_HEAP_STRING_EXTENDS(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_EXTENDS)
+#define DUK_HTHREAD_STRING_EXTENDS(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_EXTENDS)
+#define DUK_STRIDX_IMPORT                                             153                            /* 'import' */
+#define DUK_HEAP_STRING_IMPORT(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_IMPORT)
+#define DUK_HTHREAD_STRING_IMPORT(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_IMPORT)
+#define DUK_STRIDX_SUPER                                              154                            /* 'super' */
+#define DUK_HEAP_STRING_SUPER(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_SUPER)
+#define DUK_HTHREAD_STRING_SUPER(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_SUPER)
+#define DUK_STRIDX_LC_NULL                                            155                            /* 'null' */
+#define DUK_HEAP_STRING_LC_NULL(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LC_NULL)
+#define DUK_HTHREAD_STRING_LC_NULL(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LC_NULL)
+#define DUK_STRIDX_TRUE                                               156                            /* 'true' */
+#define DUK_HEAP_STRING_TRUE(heap)                                    DUK_HEAP_GET_STRING((heap),DUK_STRIDX_TRUE)
+#define DUK_HTHREAD_STRING_TRUE(thr)                                  DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_TRUE)
+#define DUK_STRIDX_FALSE                                              157                            /* 'false' */
+#define DUK_HEAP_STRING_FALSE(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_FALSE)
+#define DUK_HTHREAD_STRING_FALSE(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_FALSE)
+#define DUK_STRIDX_IMPLEMENTS                                         158                            /* 'implements' */
+#define DUK_HEAP_STRING_IMPLEMENTS(heap)                              DUK_HEAP_GET_STRING((heap),DUK_STRIDX_IMPLEMENTS)
+#define DUK_HTHREAD_STRING_IMPLEMENTS(thr)                            DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_IMPLEMENTS)
+#define DUK_STRIDX_INTERFACE                                          159                            /* 'interface' */
+#define DUK_HEAP_STRING_INTERFACE(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_INTERFACE)
+#define DUK_HTHREAD_STRING_INTERFACE(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_INTERFACE)
+#define DUK_STRIDX_LET                                                160                            /* 'let' */
+#define DUK_HEAP_STRING_LET(heap)                                     DUK_HEAP_GET_STRING((heap),DUK_STRIDX_LET)
+#define DUK_HTHREAD_STRING_LET(thr)                                   DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_LET)
+#define DUK_STRIDX_PACKAGE                                            161                            /* 'package' */
+#define DUK_HEAP_STRING_PACKAGE(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_PACKAGE)
+#define DUK_HTHREAD_STRING_PACKAGE(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_PACKAGE)
+#define DUK_STRIDX_PRIVATE                                            162                            /* 'private' */
+#define DUK_HEAP_STRING_PRIVATE(heap)                                 DUK_HEAP_GET_STRING((heap),DUK_STRIDX_PRIVATE)
+#define DUK_HTHREAD_STRING_PRIVATE(thr)                               DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_PRIVATE)
+#define DUK_STRIDX_PROTECTED                                          163                            /* 'protected' */
+#define DUK_HEAP_STRING_PROTECTED(heap)                               DUK_HEAP_GET_STRING((heap),DUK_STRIDX_PROTECTED)
+#define DUK_HTHREAD_STRING_PROTECTED(thr)                             DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_PROTECTED)
+#define DUK_STRIDX_PUBLIC                                             164                            /* 'public' */
+#define DUK_HEAP_STRING_PUBLIC(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_PUBLIC)
+#define DUK_HTHREAD_STRING_PUBLIC(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_PUBLIC)
+#define DUK_STRIDX_STATIC                                             165                            /* 'static' */
+#define DUK_HEAP_STRING_STATIC(heap)                                  DUK_HEAP_GET_STRING((heap),DUK_STRIDX_STATIC)
+#define DUK_HTHREAD_STRING_STATIC(thr)                                DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_STATIC)
+#define DUK_STRIDX_YIELD                                              166                            /* 'yield' */
+#define DUK_HEAP_STRING_YIELD(heap)                                   DUK_HEAP_GET_STRING((heap),DUK_STRIDX_YIELD)
+#define DUK_HTHREAD_STRING_YIELD(thr)                                 DUK_HTHREAD_GET_STRING((thr),DUK_STRIDX_YIELD)
+
+#define DUK_HEAP_NUM_STRINGS                                          167
+#define DUK_STRIDX_START_RESERVED                                     122
+#define DUK_STRIDX_START_STRICT_RESERVED                              158
+#define DUK_STRIDX_END_RESERVED                                       167                            /* exclusive endpoint */
+
+/* To convert a heap stridx to a token number, subtract
+ * DUK_STRIDX_START_RESERVED and add DUK_TOK_START_RESERVED.
+ */
+#if !defined(DUK_SINGLE_FILE)
+DUK_INTERNAL_DECL const duk_hstring * const duk_rom_strings_lookup[256];
+DUK_INTERNAL_DECL const duk_hstring * const duk_rom_strings_stridx[167];
+#endif
 #else  /* DUK_USE_ROM_STRINGS */
 #define DUK_STRIDX_UC_UNDEFINED                                       0                              /* 'Undefined' */
 #define DUK_HEAP_STRING_UC_UNDEFINED(heap)                            DUK_HEAP_GET_STRING((heap),DUK_STRIDX_UC_UNDEFINED)
@@ -2091,18 +2604,212 @@ DUK_INTERNAL_DECL void duk_tval_assert_valid(duk_tval *tv);
 #define DUK_STRIDX_START_STRICT_RESERVED                              158
 #define DUK_STRIDX_END_RESERVED                                       167                            /* exclusive endpoint */
 
-/* To convert a heap stridx to a token number, subtract
- * DUK_STRIDX_START_RESERVED and add DUK_TOK_START_RESERVED.
- */
+/* To convert a heap stridx to a token number, subtract
+ * DUK_STRIDX_START_RESERVED and add DUK_TOK_START_RESERVED.
+ */
+#if !defined(DUK_SINGLE_FILE)
+DUK_INTERNAL_DECL const duk_uint8_t duk_strings_data[972];
+#endif  /* !DUK_SINGLE_FILE */
+#define DUK_STRDATA_MAX_STRLEN                                        27
+#define DUK_STRDATA_DATA_LENGTH                                       972
+#endif  /* DUK_USE_ROM_STRINGS */
+
+#if defined(DUK_USE_ROM_OBJECTS)
+#if !defined(DUK_USE_ROM_PTRCOMP_FIRST)
+#error missing DUK_USE_ROM_PTRCOMP_FIRST define
+#endif
+#if (DUK_USE_ROM_PTRCOMP_FIRST != 63488L)
+#error DUK_USE_ROM_PTRCOMP_FIRST must match ROMPTR_FIRST in genbuiltins.py (63488), update manually and re-dist
+#endif
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_function_constructor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_function_prototype(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_constructor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_constructor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_boolean_constructor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_number_constructor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_constructor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_regexp_constructor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_constructor_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_type_error_thrower(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_parse_int(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_parse_float(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_pointer_constructor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_symbol_constructor_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_eval(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_is_nan(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_is_finite(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_decode_uri(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_decode_uri_component(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_encode_uri(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_encode_uri_component(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_escape(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_unescape(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_getprototype_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_setprototype_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_get_own_property_descriptor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_keys_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_assign(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_create(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_define_property(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_define_properties(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_seal_freeze_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_prevent_extensions(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_is_sealed_frozen_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_is_extensible(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor_is(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_prototype_to_string(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_prototype_to_locale_string(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_prototype_value_of(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_prototype_has_own_property(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_prototype_is_prototype_of(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_prototype_property_is_enumerable(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_prototype_defineaccessor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_object_prototype_lookupaccessor(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_function_prototype_to_string(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_function_prototype_apply(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_function_prototype_call(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_function_prototype_bind(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_function_prototype_hasinstance(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_native_function_length(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_native_function_name(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_constructor_is_array(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_to_string(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_join_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_concat(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_pop(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_push(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_reverse(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_shift(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_slice(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_sort(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_splice(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_unshift(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_indexof_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_iter_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_array_prototype_reduce_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_constructor_from_char_code(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_constructor_from_code_point(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_to_string(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_char_at(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_char_code_at(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_concat(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_indexof_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_locale_compare(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_match(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_replace(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_search(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_slice(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_split(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_substring(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_caseconv_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_trim(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_repeat(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_startswith_endswith(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_includes(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_string_prototype_substr(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_boolean_prototype_tostring_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_number_check_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_number_prototype_to_string(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_number_prototype_to_locale_string(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_number_prototype_value_of(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_number_prototype_to_fixed(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_number_prototype_to_exponential(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_number_prototype_to_precision(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_constructor_parse(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_constructor_utc(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_constructor_now(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_prototype_tostring_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_prototype_to_json(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_prototype_value_of(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_prototype_get_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_prototype_get_timezone_offset(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_prototype_set_time(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_prototype_set_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_date_prototype_toprimitive(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_regexp_prototype_exec(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_regexp_prototype_test(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_regexp_prototype_tostring(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_regexp_prototype_flags(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_regexp_prototype_shared_getter(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_stack_getter(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_stack_setter(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_filename_getter(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_filename_setter(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_linenumber_getter(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_linenumber_setter(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_to_string(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_math_object_onearg_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_math_object_twoarg_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_math_object_clz32(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_math_object_hypot(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_math_object_imul(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_math_object_max(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_math_object_min(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_math_object_random(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_math_object_sign(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_json_object_parse(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_json_object_stringify(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_info(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_act(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_gc(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_fin(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_enc(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_dec(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_compact(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_pointer_prototype_tostring_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_symbol_key_for(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_symbol_tostring_shared(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_symbol_toprimitive(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_typedarray_bytelength_getter(duk_context *ctx);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_typedarray_byteoffset_getter(duk_context *ctx);
+#define DUK_BIDX_GLOBAL                                               0
+#define DUK_BIDX_GLOBAL_ENV                                           1
+#define DUK_BIDX_OBJECT_CONSTRUCTOR                                   2
+#define DUK_BIDX_OBJECT_PROTOTYPE                                     3
+#define DUK_BIDX_FUNCTION_CONSTRUCTOR                                 4
+#define DUK_BIDX_FUNCTION_PROTOTYPE                                   5
+#define DUK_BIDX_NATIVE_FUNCTION_PROTOTYPE                            6
+#define DUK_BIDX_ARRAY_CONSTRUCTOR                                    7
+#define DUK_BIDX_ARRAY_PROTOTYPE                                      8
+#define DUK_BIDX_STRING_CONSTRUCTOR                                   9
+#define DUK_BIDX_STRING_PROTOTYPE                                     10
+#define DUK_BIDX_BOOLEAN_CONSTRUCTOR                                  11
+#define DUK_BIDX_BOOLEAN_PROTOTYPE                                    12
+#define DUK_BIDX_NUMBER_CONSTRUCTOR                                   13
+#define DUK_BIDX_NUMBER_PROTOTYPE                                     14
+#define DUK_BIDX_DATE_CONSTRUCTOR                                     15
+#define DUK_BIDX_DATE_PROTOTYPE                                       16
+#define DUK_BIDX_REGEXP_CONSTRUCTOR                                   17
+#define DUK_BIDX_REGEXP_PROTOTYPE                                     18
+#define DUK_BIDX_ERROR_CONSTRUCTOR                                    19
+#define DUK_BIDX_ERROR_PROTOTYPE                                      20
+#define DUK_BIDX_EVAL_ERROR_CONSTRUCTOR                               21
+#define DUK_BIDX_EVAL_ERROR_PROTOTYPE                                 22
+#define DUK_BIDX_RANGE_ERROR_CONSTRUCTOR                              23
+#define DUK_BIDX_RANGE_ERROR_PROTOTYPE                                24
+#define DUK_BIDX_REFERENCE_ERROR_CONSTRUCTOR                          25
+#define DUK_BIDX_REFERENCE_ERROR_PROTOTYPE                            26
+#define DUK_BIDX_SYNTAX_ERROR_CONSTRUCTOR                             27
+#define DUK_BIDX_SYNTAX_ERROR_PROTOTYPE                               28
+#define DUK_BIDX_TYPE_ERROR_CONSTRUCTOR                               29
+#define DUK_BIDX_TYPE_ERROR_PROTOTYPE                                 30
+#define DUK_BIDX_URI_ERROR_CONSTRUCTOR                                31
+#define DUK_BIDX_URI_ERROR_PROTOTYPE                                  32
+#define DUK_BIDX_TYPE_ERROR_THROWER                                   33
+#define DUK_BIDX_DUKTAPE                                              34
+#define DUK_BIDX_THREAD_PROTOTYPE                                     35
+#define DUK_BIDX_POINTER_PROTOTYPE                                    36
+#define DUK_BIDX_DOUBLE_ERROR                                         37
+#define DUK_BIDX_SYMBOL_PROTOTYPE                                     38
+#define DUK_BIDX_UINT8ARRAY_PROTOTYPE                                 39
+#define DUK_NUM_BUILTINS                                              40
+#define DUK_NUM_BIDX_BUILTINS                                         40
+#define DUK_NUM_ALL_BUILTINS                                          261
+
 #if !defined(DUK_SINGLE_FILE)
-DUK_INTERNAL_DECL const duk_uint8_t duk_strings_data[972];
-#endif  /* !DUK_SINGLE_FILE */
-#define DUK_STRDATA_MAX_STRLEN                                        27
-#define DUK_STRDATA_DATA_LENGTH                                       972
-#endif  /* DUK_USE_ROM_STRINGS */
-
-#if defined(DUK_USE_ROM_OBJECTS)
-#error RAM support not enabled, rerun configure.py with --ram-support
+DUK_INTERNAL_DECL const duk_hobject * const duk_rom_builtins_bidx[40];
+#endif
 #else  /* DUK_USE_ROM_OBJECTS */
 DUK_INTERNAL_DECL duk_ret_t duk_bi_object_constructor(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_function_constructor(duk_context *ctx);
@@ -2117,16 +2824,8 @@ DUK_INTERNAL_DECL duk_ret_t duk_bi_error_constructor_shared(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_type_error_thrower(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_parse_int(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_parse_float(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_thread_constructor(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_pointer_constructor(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_proxy_constructor(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_symbol_constructor_shared(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_arraybuffer_constructor(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_dataview_constructor(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_typedarray_constructor(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_nodejs_buffer_constructor(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_textencoder_constructor(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_textdecoder_constructor(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_eval(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_is_nan(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_global_object_is_finite(duk_context *ctx);
@@ -2248,48 +2947,14 @@ DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_fin(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_enc(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_dec(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_duktape_object_compact(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_thread_yield(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_thread_resume(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_thread_current(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_pointer_prototype_tostring_shared(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_reflect_apply(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_reflect_construct(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_reflect_object_delete_property(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_reflect_object_get(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_reflect_object_has(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_reflect_object_set(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_symbol_key_for(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_symbol_tostring_shared(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_symbol_toprimitive(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_arraybuffer_isview(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_typedarray_bytelength_getter(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_buffer_slice_shared(duk_context *ctx);
 DUK_INTERNAL_DECL duk_ret_t duk_bi_typedarray_byteoffset_getter(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_typedarray_buffer_getter(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_buffer_readfield(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_buffer_writefield(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_typedarray_set(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_uint8array_allocplain(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_uint8array_plainof(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_nodejs_buffer_concat(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_nodejs_buffer_is_encoding(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_nodejs_buffer_is_buffer(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_nodejs_buffer_byte_length(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_buffer_compare_shared(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_nodejs_buffer_tostring(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_nodejs_buffer_tojson(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_nodejs_buffer_fill(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_nodejs_buffer_copy(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_nodejs_buffer_write(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_cbor_encode(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_cbor_decode(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_textencoder_prototype_encoding_getter(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_textencoder_prototype_encode(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_textdecoder_prototype_shared_getter(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_textdecoder_prototype_decode(duk_context *ctx);
-DUK_INTERNAL_DECL duk_ret_t duk_bi_performance_now(duk_context *ctx);
 #if !defined(DUK_SINGLE_FILE)
-DUK_INTERNAL_DECL const duk_c_function duk_bi_native_functions[185];
+DUK_INTERNAL_DECL const duk_c_function duk_bi_native_functions[143];
 #endif  /* !DUK_SINGLE_FILE */
 #define DUK_BIDX_GLOBAL                                               0
 #define DUK_BIDX_GLOBAL_ENV                                           1
@@ -2330,36 +2995,25 @@ DUK_INTERNAL_DECL const duk_c_function duk_bi_native_functions[185];
 #define DUK_BIDX_POINTER_PROTOTYPE                                    36
 #define DUK_BIDX_DOUBLE_ERROR                                         37
 #define DUK_BIDX_SYMBOL_PROTOTYPE                                     38
-#define DUK_BIDX_ARRAYBUFFER_PROTOTYPE                                39
-#define DUK_BIDX_DATAVIEW_PROTOTYPE                                   40
-#define DUK_BIDX_INT8ARRAY_PROTOTYPE                                  41
-#define DUK_BIDX_UINT8ARRAY_PROTOTYPE                                 42
-#define DUK_BIDX_UINT8CLAMPEDARRAY_PROTOTYPE                          43
-#define DUK_BIDX_INT16ARRAY_PROTOTYPE                                 44
-#define DUK_BIDX_UINT16ARRAY_PROTOTYPE                                45
-#define DUK_BIDX_INT32ARRAY_PROTOTYPE                                 46
-#define DUK_BIDX_UINT32ARRAY_PROTOTYPE                                47
-#define DUK_BIDX_FLOAT32ARRAY_PROTOTYPE                               48
-#define DUK_BIDX_FLOAT64ARRAY_PROTOTYPE                               49
-#define DUK_BIDX_NODEJS_BUFFER_PROTOTYPE                              50
-#define DUK_NUM_BUILTINS                                              51
-#define DUK_NUM_BIDX_BUILTINS                                         51
-#define DUK_NUM_ALL_BUILTINS                                          80
+#define DUK_BIDX_UINT8ARRAY_PROTOTYPE                                 39
+#define DUK_NUM_BUILTINS                                              40
+#define DUK_NUM_BIDX_BUILTINS                                         40
+#define DUK_NUM_ALL_BUILTINS                                          47
 #if defined(DUK_USE_DOUBLE_LE)
 #if !defined(DUK_SINGLE_FILE)
-DUK_INTERNAL_DECL const duk_uint8_t duk_builtins_data[4281];
+DUK_INTERNAL_DECL const duk_uint8_t duk_builtins_data[2590];
 #endif  /* !DUK_SINGLE_FILE */
-#define DUK_BUILTINS_DATA_LENGTH                                      4281
+#define DUK_BUILTINS_DATA_LENGTH                                      2590
 #elif defined(DUK_USE_DOUBLE_BE)
 #if !defined(DUK_SINGLE_FILE)
-DUK_INTERNAL_DECL const duk_uint8_t duk_builtins_data[4281];
+DUK_INTERNAL_DECL const duk_uint8_t duk_builtins_data[2590];
 #endif  /* !DUK_SINGLE_FILE */
-#define DUK_BUILTINS_DATA_LENGTH                                      4281
+#define DUK_BUILTINS_DATA_LENGTH                                      2590
 #elif defined(DUK_USE_DOUBLE_ME)
 #if !defined(DUK_SINGLE_FILE)
-DUK_INTERNAL_DECL const duk_uint8_t duk_builtins_data[4281];
+DUK_INTERNAL_DECL const duk_uint8_t duk_builtins_data[2590];
 #endif  /* !DUK_SINGLE_FILE */
-#define DUK_BUILTINS_DATA_LENGTH                                      4281
+#define DUK_BUILTINS_DATA_LENGTH                                      2590
 #else
 #error invalid endianness defines
 #endif
@@ -11657,7 +12311,4292 @@ DUK_INTERNAL void duk_debug_log(const char *fmt, ...) {
 #endif
 
 #if defined(DUK_USE_ROM_STRINGS)
-#error ROM support not enabled, rerun configure.py with --rom-support
+typedef struct duk_romstr_0 duk_romstr_0; struct duk_romstr_0 { duk_hstring hdr; duk_uint8_t data[1]; };
+typedef struct duk_romstr_1 duk_romstr_1; struct duk_romstr_1 { duk_hstring hdr; duk_uint8_t data[2]; };
+typedef struct duk_romstr_2 duk_romstr_2; struct duk_romstr_2 { duk_hstring hdr; duk_uint8_t data[3]; };
+typedef struct duk_romstr_3 duk_romstr_3; struct duk_romstr_3 { duk_hstring hdr; duk_uint8_t data[4]; };
+typedef struct duk_romstr_4 duk_romstr_4; struct duk_romstr_4 { duk_hstring hdr; duk_uint8_t data[5]; };
+typedef struct duk_romstr_5 duk_romstr_5; struct duk_romstr_5 { duk_hstring hdr; duk_uint8_t data[6]; };
+typedef struct duk_romstr_6 duk_romstr_6; struct duk_romstr_6 { duk_hstring hdr; duk_uint8_t data[7]; };
+typedef struct duk_romstr_7 duk_romstr_7; struct duk_romstr_7 { duk_hstring hdr; duk_uint8_t data[8]; };
+typedef struct duk_romstr_8 duk_romstr_8; struct duk_romstr_8 { duk_hstring hdr; duk_uint8_t data[9]; };
+typedef struct duk_romstr_9 duk_romstr_9; struct duk_romstr_9 { duk_hstring hdr; duk_uint8_t data[10]; };
+typedef struct duk_romstr_10 duk_romstr_10; struct duk_romstr_10 { duk_hstring hdr; duk_uint8_t data[11]; };
+typedef struct duk_romstr_11 duk_romstr_11; struct duk_romstr_11 { duk_hstring hdr; duk_uint8_t data[12]; };
+typedef struct duk_romstr_12 duk_romstr_12; struct duk_romstr_12 { duk_hstring hdr; duk_uint8_t data[13]; };
+typedef struct duk_romstr_13 duk_romstr_13; struct duk_romstr_13 { duk_hstring hdr; duk_uint8_t data[14]; };
+typedef struct duk_romstr_14 duk_romstr_14; struct duk_romstr_14 { duk_hstring hdr; duk_uint8_t data[15]; };
+typedef struct duk_romstr_15 duk_romstr_15; struct duk_romstr_15 { duk_hstring hdr; duk_uint8_t data[16]; };
+typedef struct duk_romstr_16 duk_romstr_16; struct duk_romstr_16 { duk_hstring hdr; duk_uint8_t data[17]; };
+typedef struct duk_romstr_17 duk_romstr_17; struct duk_romstr_17 { duk_hstring hdr; duk_uint8_t data[18]; };
+typedef struct duk_romstr_18 duk_romstr_18; struct duk_romstr_18 { duk_hstring hdr; duk_uint8_t data[19]; };
+typedef struct duk_romstr_19 duk_romstr_19; struct duk_romstr_19 { duk_hstring hdr; duk_uint8_t data[20]; };
+typedef struct duk_romstr_20 duk_romstr_20; struct duk_romstr_20 { duk_hstring hdr; duk_uint8_t data[21]; };
+typedef struct duk_romstr_21 duk_romstr_21; struct duk_romstr_21 { duk_hstring hdr; duk_uint8_t data[22]; };
+typedef struct duk_romstr_23 duk_romstr_23; struct duk_romstr_23 { duk_hstring hdr; duk_uint8_t data[24]; };
+typedef struct duk_romstr_24 duk_romstr_24; struct duk_romstr_24 { duk_hstring hdr; duk_uint8_t data[25]; };
+typedef struct duk_romstr_27 duk_romstr_27; struct duk_romstr_27 { duk_hstring hdr; duk_uint8_t data[28]; };
+
+/* When unaligned access possible, 32-bit values are fetched using host order.
+ * When unaligned access not possible, always simulate little endian order.
+ * See: src-input/duk_util_hashbytes.c:duk_util_hashbytes().
+ */
+#if defined(DUK_USE_STRHASH_DENSE)
+#if defined(DUK_USE_HASHBYTES_UNALIGNED_U32_ACCESS)
+#if defined(DUK_USE_INTEGER_BE)
+#define DUK__STRHASH16(hash16le,hash16be,hash16sparse) (hash16be)
+#define DUK__STRHASH32(hash32le,hash32be,hash32sparse) (hash32be)
+#else
+#define DUK__STRHASH16(hash16le,hash16be,hash16sparse) (hash16le)
+#define DUK__STRHASH32(hash32le,hash32be,hash32sparse) (hash32le)
+#endif
+#else
+#define DUK__STRHASH16(hash16le,hash16be,hash16sparse) (hash16le)
+#define DUK__STRHASH32(hash32le,hash32be,hash32sparse) (hash32le)
+#endif
+#else  /* DUK_USE_STRHASH_DENSE */
+#define DUK__STRHASH16(hash16le,hash16be,hash16sparse) (hash16sparse)
+#define DUK__STRHASH32(hash32le,hash32be,hash32sparse) (hash32sparse)
+#endif  /* DUK_USE_STRHASH_DENSE */
+#if defined(DUK_USE_HEAPPTR16)
+#if !defined(DUK_USE_REFCOUNT16)
+#error currently assumes DUK_USE_HEAPPTR16 and DUK_USE_REFCOUNT16 are both defined
+#endif
+#if defined(DUK_USE_HSTRING_CLEN)
+#define DUK__STRINIT(heaphdr_flags,refcount,hash32,hash16,blen,clen,next) \
+	{ { (heaphdr_flags) | ((hash16) << 16), DUK__REFCINIT((refcount)), (blen), (duk_hstring *) DUK_LOSE_CONST((next)) }, (clen) }
+#else  /* DUK_USE_HSTRING_CLEN */
+#define DUK__STRINIT(heaphdr_flags,refcount,hash32,hash16,blen,clen,next) \
+	{ { (heaphdr_flags) | ((hash16) << 16), DUK__REFCINIT((refcount)), (blen), (duk_hstring *) DUK_LOSE_CONST((next)) } }
+#endif  /* DUK_USE_HSTRING_CLEN */
+#else  /* DUK_USE_HEAPPTR16 */
+#define DUK__STRINIT(heaphdr_flags,refcount,hash32,hash16,blen,clen,next) \
+	{ { (heaphdr_flags), DUK__REFCINIT((refcount)), (duk_hstring *) DUK_LOSE_CONST((next)) }, (hash32), (blen), (clen) }
+#endif  /* DUK_USE_HEAPPTR16 */
+
+DUK_INTERNAL const duk_romstr_9 duk_str_389 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD|DUK_HSTRING_FLAG_STRICT_RESERVED_WORD,1,DUK__STRHASH32(197266702UL,1183782924UL,2104652775UL),DUK__STRHASH16(3342U,6156U,29671U),9,9,NULL),{112,114,111,116,101,99,116,101,100,0}};
+DUK_INTERNAL const duk_romstr_0 duk_str_187 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1412466156UL,1412466156UL,2882343476UL),DUK__STRHASH16(34284U,34284U,4660U),0,0,&duk_str_389),{0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_143 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1707050563UL,3561619845UL,3254968851UL),DUK__STRHASH16(34371U,389U,57875U),9,9,&duk_str_187),{112,114,111,116,111,116,121,112,101,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_431 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(561261619UL,2884887068UL,3961898425UL),DUK__STRHASH16(11315U,57884U,50617U),10,10,NULL),{98,121,116,101,79,102,102,115,101,116,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_317 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(1393687012UL,3608063230UL,2081800523UL),DUK__STRHASH16(63972U,44286U,49483U),8,7,&duk_str_431),{130U,80,99,50,108,105,110,101,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_314 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(1232930634UL,1190813UL,3141994898UL),DUK__STRHASH16(1866U,11165U,2450U),8,7,&duk_str_317),{130U,70,111,114,109,97,108,115,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_242 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2331545119UL,2596578771UL,755349387UL),DUK__STRHASH16(36383U,42451U,46987U),9,9,&duk_str_314),{114,101,97,100,73,110,116,66,69,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_241 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1777669243UL,2762011992UL,1738016853UL),DUK__STRHASH16(5243U,62808U,2133U),9,9,&duk_str_242),{114,101,97,100,73,110,116,76,69,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_225 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2286844894UL,3029288270UL,1144809649UL),DUK__STRHASH16(31710U,17742U,26801U),9,9,&duk_str_241),{114,101,97,100,85,73,110,116,56,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_217 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1237260005UL,3681017037UL,3777106068UL),DUK__STRHASH16(5861U,56525U,4244U),10,10,&duk_str_225),{98,121,116,101,76,101,110,103,116,104,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_293 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(662047054UL,1136882799UL,2989032078UL),DUK__STRHASH16(2382U,29807U,654U),9,9,NULL),{115,101,116,85,105,110,116,51,50,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_291 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1908335861UL,300811907UL,2878807248UL),DUK__STRHASH16(58613U,1667U,7376U),9,9,&duk_str_293),{115,101,116,85,105,110,116,49,54,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_173 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(860812360UL,3807056881UL,3004855676UL),DUK__STRHASH16(62536U,5105U,30076U),9,9,&duk_str_291),{115,116,114,105,110,103,105,102,121,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_75 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3016975909UL,2640703096UL,4270044222UL),DUK__STRHASH16(26149U,61048U,46142U),9,9,&duk_str_173),{115,117,98,115,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_67 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2713304030UL,3693227436UL,423876940UL),DUK__STRHASH16(48094U,11692U,55628U),10,10,&duk_str_75),{99,104,97,114,67,111,100,101,65,116,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_16 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3352586712UL,810669518UL,3509896176UL),DUK__STRHASH16(27096U,54734U,50160U),11,11,&duk_str_67),{83,121,110,116,97,120,69,114,114,111,114,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_271 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1667248884UL,2113060067UL,1672958115UL),DUK__STRHASH16(13044U,48355U,20643U),11,11,NULL),{85,105,110,116,51,50,65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_269 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3702402517UL,1650870789UL,1827127845UL),DUK__STRHASH16(11733U,18949U,49701U),11,11,&duk_str_271),{85,105,110,116,49,54,65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_179 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(792221586UL,3676357606UL,3181226671UL),DUK__STRHASH16(22418U,50150U,43695U),9,9,&duk_str_269),{117,110,100,101,102,105,110,101,100,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_43 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2807519460UL,3346073385UL,3409736094UL),DUK__STRHASH16(22756U,1833U,29086U),10,10,&duk_str_179),{101,110,117,109,101,114,97,98,108,101,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_273 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2103723530UL,2144879841UL,1341460919UL),DUK__STRHASH16(17930U,17633U,4535U),12,12,NULL),{70,108,111,97,116,54,52,65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_272 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3838988639UL,2858262916UL,2936086098UL),DUK__STRHASH16(20831U,41348U,7762U),12,12,&duk_str_273),{70,108,111,97,116,51,50,65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_393 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1557694947UL,3709280790UL,954433063UL),DUK__STRHASH16(35299U,8726U,32295U),10,10,NULL),{103,108,111,98,97,108,84,104,105,115,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_287 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2262507067UL,243877675UL,151098718UL),DUK__STRHASH16(7739U,18219U,38238U),10,10,&duk_str_393),{103,101,116,70,108,111,97,116,54,52,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_286 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2799942581UL,1062982693UL,2742493209UL),DUK__STRHASH16(48053U,54309U,8217U),10,10,&duk_str_287),{103,101,116,70,108,111,97,116,51,50,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_244 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2560927918UL,1916121618UL,1164368523UL),DUK__STRHASH16(43182U,45586U,55947U),9,9,&duk_str_286),{119,114,105,116,101,73,110,116,56,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_110 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(851188597UL,2636766858UL,2242280909UL),DUK__STRHASH16(7029U,56970U,32205U),10,10,&duk_str_244),{103,101,116,83,101,99,111,110,100,115,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_108 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2934126965UL,519122073UL,1803104067UL),DUK__STRHASH16(14709U,11417U,12099U),10,10,&duk_str_110),{103,101,116,77,105,110,117,116,101,115,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_103 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3298204950UL,28671179UL,1537343048UL),DUK__STRHASH16(40214U,31947U,65096U),10,10,&duk_str_108),{103,101,116,85,84,67,68,97,116,101,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_384 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD|DUK_HSTRING_FLAG_STRICT_RESERVED_WORD,1,DUK__STRHASH32(1562988960UL,184744157UL,3808979484UL),DUK__STRHASH16(20896U,63709U,27164U),10,10,NULL),{105,109,112,108,101,109,101,110,116,115,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_362 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(3283439639UL,3211170527UL,2178750344UL),DUK__STRHASH16(20503U,37599U,6024U),10,10,&duk_str_384),{105,110,115,116,97,110,99,101,111,102,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_215 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(565579021UL,584286518UL,300028993UL),DUK__STRHASH16(3341U,33078U,5185U),10,10,&duk_str_362),{105,115,69,110,99,111,100,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_191 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3198042749UL,2565279696UL,2694360541UL),DUK__STRHASH16(17021U,4048U,44509U),12,12,&duk_str_215),{73,110,118,97,108,105,100,32,68,97,116,101,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_138 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(693462375UL,3552705173UL,3953638814UL),DUK__STRHASH16(25959U,64149U,48542U),10,10,&duk_str_191),{105,103,110,111,114,101,67,97,115,101,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_306 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4067904304UL,2053871364UL,1903449903UL),DUK__STRHASH16(19248U,38660U,22319U),10,10,NULL),{108,105,110,101,78,117,109,98,101,114,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_23 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3223548931UL,3235415788UL,3992634223UL),DUK__STRHASH16(29699U,34540U,50031U),10,10,NULL),{112,97,114,115,101,70,108,111,97,116,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_313 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(2459755290UL,1311314264UL,2227831982UL),DUK__STRHASH16(58138U,4440U,1198U),9,8,NULL),{130U,66,121,116,101,99,111,100,101,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_240 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(933218138UL,3687419170UL,1376485761UL),DUK__STRHASH16(51034U,36130U,33153U),10,10,&duk_str_313),{114,101,97,100,85,73,110,116,66,69,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_239 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4145546578UL,3346435303UL,3739741067UL),DUK__STRHASH16(1362U,36071U,60299U),10,10,&duk_str_240),{114,101,97,100,85,73,110,116,76,69,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_404 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3092317236UL,3632412728UL,4071432571UL),DUK__STRHASH16(1076U,14392U,8571U),10,10,NULL),{115,116,97,114,116,115,87,105,116,104,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_402 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(215384131UL,709647757UL,384811129UL),DUK__STRHASH16(32835U,23949U,49273U),11,11,&duk_str_404),{99,111,100,101,80,111,105,110,116,65,116,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_295 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1409960457UL,1563896301UL,151098730UL),DUK__STRHASH16(18953U,10733U,38250U),10,10,&duk_str_402),{115,101,116,70,108,111,97,116,54,52,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_294 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1046076705UL,46417909UL,2742493221UL),DUK__STRHASH16(56609U,18421U,8229U),10,10,&duk_str_295),{115,101,116,70,108,111,97,116,51,50,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_144 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2760532194UL,3969048958UL,1150673189UL),DUK__STRHASH16(24802U,57726U,57637U),11,11,&duk_str_294),{99,111,110,115,116,114,117,99,116,111,114,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_125 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(634664374UL,2186563182UL,1537343060UL),DUK__STRHASH16(13750U,20078U,65108U),10,10,&duk_str_144),{115,101,116,85,84,67,68,97,116,101,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_120 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3561854946UL,944095927UL,1803104079UL),DUK__STRHASH16(38882U,49847U,12111U),10,10,&duk_str_125),{115,101,116,77,105,110,117,116,101,115,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_118 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1367544367UL,2548241954UL,2242280921UL),DUK__STRHASH16(4655U,5666U,32217U),10,10,&duk_str_120),{115,101,116,83,101,99,111,110,100,115,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_260 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2286471509UL,3949154732UL,1396044635UL),DUK__STRHASH16(51541U,20908U,62299U),10,10,NULL),{119,114,105,116,101,73,110,116,66,69,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_259 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(520230391UL,1947935413UL,3759299941UL),DUK__STRHASH16(5623U,8885U,23909U),10,10,&duk_str_260),{119,114,105,116,101,73,110,116,76,69,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_243 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3300013147UL,2501992119UL,1363331393UL),DUK__STRHASH16(13403U,24247U,51521U),10,10,&duk_str_259),{119,114,105,116,101,85,73,110,116,56,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_107 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3428277533UL,3869430622UL,1706174108UL),DUK__STRHASH16(23837U,54110U,9884U),11,11,&duk_str_243),{103,101,116,85,84,67,72,111,117,114,115,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_101 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3968190607UL,2492940490UL,71800785UL),DUK__STRHASH16(51343U,16586U,38865U),11,11,&duk_str_107),{103,101,116,85,84,67,77,111,110,116,104,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_98 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3311596328UL,754690186UL,995323555UL),DUK__STRHASH16(62248U,43146U,28323U),11,11,&duk_str_101),{103,101,116,70,117,108,108,89,101,97,114,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_425 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1777992519UL,3730657024UL,1875571696UL),DUK__STRHASH16(839U,20224U,62448U),11,11,NULL),{104,97,115,73,110,115,116,97,110,99,101,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_69 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(804783288UL,483724156UL,73695904UL),DUK__STRHASH16(1208U,2940U,33440U),11,11,NULL),{108,97,115,116,73,110,100,101,120,79,102,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_321 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(4279833030UL,1903930684UL,1343591140UL),DUK__STRHASH16(4550U,44348U,37604U),10,9,NULL),{130U,70,105,110,97,108,105,122,101,114,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_307 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(3514125081UL,1509589781UL,992260297UL),DUK__STRHASH16(19225U,33557U,45257U),10,9,&duk_str_321),{130U,84,114,97,99,101,100,97,116,97,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_236 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3632561646UL,2464738884UL,1707449976UL),DUK__STRHASH16(32238U,60996U,40568U),11,11,&duk_str_307),{114,101,97,100,70,108,111,97,116,66,69,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_235 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(697377290UL,2126879006UL,2385463746UL),DUK__STRHASH16(8714U,39198U,18882U),11,11,&duk_str_236),{114,101,97,100,70,108,111,97,116,76,69,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_234 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(814928914UL,1255303595UL,1872758354UL),DUK__STRHASH16(54290U,27051U,1618U),11,11,&duk_str_235),{114,101,97,100,73,110,116,51,50,66,69,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_233 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4289972424UL,250680762UL,2550772124UL),DUK__STRHASH16(51400U,5562U,45468U),11,11,&duk_str_234),{114,101,97,100,73,110,116,51,50,76,69,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_230 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3423610680UL,1071038574UL,1762533524UL),DUK__STRHASH16(10040U,49262U,8340U),11,11,&duk_str_233),{114,101,97,100,73,110,116,49,54,66,69,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_229 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2989431539UL,1104737704UL,2440547294UL),DUK__STRHASH16(6899U,62888U,52190U),11,11,&duk_str_230),{114,101,97,100,73,110,116,49,54,76,69,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_64 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1732560860UL,3051514935UL,746750421UL),DUK__STRHASH16(51164U,27703U,33237U),11,11,&duk_str_229),{114,101,100,117,99,101,82,105,103,104,116,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_128 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2771326177UL,3349761890UL,995323567UL),DUK__STRHASH16(5345U,20322U,28335U),11,11,NULL),{115,101,116,70,117,108,108,89,101,97,114,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_127 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3611972313UL,3619001950UL,71800797UL),DUK__STRHASH16(21209U,38494U,38877U),11,11,&duk_str_128),{115,101,116,85,84,67,77,111,110,116,104,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_123 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2947452871UL,3437117200UL,1706174120UL),DUK__STRHASH16(36807U,16144U,9896U),11,11,&duk_str_127),{115,101,116,85,84,67,72,111,117,114,115,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_42 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1425221482UL,4235577650UL,1890360393UL),DUK__STRHASH16(10090U,51506U,40009U),12,12,&duk_str_123),{99,111,110,102,105,103,117,114,97,98,108,101,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_430 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3198735033UL,3850032332UL,1116023957UL),DUK__STRHASH16(53945U,54476U,11413U),11,11,NULL),{116,111,83,116,114,105,110,103,84,97,103,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_429 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4247488054UL,222258254UL,2718183163UL),DUK__STRHASH16(34358U,25678U,12027U),11,11,&duk_str_430),{116,111,80,114,105,109,105,116,105,118,101,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_134 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1709933862UL,2145337969UL,3295637441UL),DUK__STRHASH16(34086U,17009U,28609U),11,11,&duk_str_429),{116,111,71,77,84,83,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_131 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3316297339UL,2483226437UL,3289925636UL),DUK__STRHASH16(44667U,1861U,18436U),11,11,&duk_str_134),{116,111,73,83,79,83,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_130 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(732098026UL,3199723435UL,3275743589UL),DUK__STRHASH16(60906U,59307U,57701U),11,11,&duk_str_131),{116,111,85,84,67,83,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_88 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4081509028UL,3398147158UL,840878382UL),DUK__STRHASH16(58020U,40022U,51502U),11,11,&duk_str_130),{116,111,80,114,101,99,105,115,105,111,110,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_78 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4023359363UL,2649306829UL,1544010314UL),DUK__STRHASH16(38787U,14029U,47690U),11,11,&duk_str_88),{116,111,85,112,112,101,114,67,97,115,101,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_76 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(582580540UL,537829822UL,1552266023UL),DUK__STRHASH16(31036U,41406U,45863U),11,11,&duk_str_78),{116,111,76,111,119,101,114,67,97,115,101,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_65 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3414670887UL,3979469959UL,3487020165UL),DUK__STRHASH16(48679U,58503U,46213U),12,12,NULL),{102,114,111,109,67,104,97,114,67,111,100,101,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_258 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2290378983UL,1116848255UL,3297485873UL),DUK__STRHASH16(26855U,49279U,42033U),11,11,NULL),{119,114,105,116,101,85,73,110,116,66,69,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_257 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(254930047UL,4138807552UL,3975499643UL),DUK__STRHASH16(60543U,12544U,20347U),11,11,&duk_str_258),{119,114,105,116,101,85,73,110,116,76,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_205 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(158925106UL,1211058672UL,3793763623UL),DUK__STRHASH16(306U,18928U,15655U),12,12,NULL),{105,115,69,120,116,101,110,115,105,98,108,101,0}};
+DUK_INTERNAL const duk_romstr_27 duk_str_211 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL,1,DUK__STRHASH32(3868796950UL,1032889278UL,2544672602UL),DUK__STRHASH16(10262U,41918U,40794U),27,26,NULL),{129U,83,121,109,98,111,108,46,105,115,67,111,110,99,97,116,83,112,114,101,97,100,97,98,108,101,255U,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_238 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(727703731UL,140959853UL,3396394230UL),DUK__STRHASH16(57523U,57453U,56566U),12,12,NULL),{114,101,97,100,68,111,117,98,108,101,66,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_237 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1115526658UL,1535528283UL,1044864UL),DUK__STRHASH16(38402U,19803U,61824U),12,12,&duk_str_238),{114,101,97,100,68,111,117,98,108,101,76,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_232 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3020894776UL,2959906260UL,922333536UL),DUK__STRHASH16(12856U,38356U,45408U),12,12,&duk_str_237),{114,101,97,100,85,73,110,116,51,50,66,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_231 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(579090427UL,2742920815UL,1821951466UL),DUK__STRHASH16(14331U,42607U,50666U),12,12,&duk_str_232),{114,101,97,100,85,73,110,116,51,50,76,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_228 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(885616646UL,1744841910UL,1579881442UL),DUK__STRHASH16(28678U,11446U,5090U),12,12,&duk_str_231),{114,101,97,100,85,73,110,116,49,54,66,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_227 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3249360159UL,2276997207UL,2479499372UL),DUK__STRHASH16(19743U,14423U,10348U),12,12,&duk_str_228),{114,101,97,100,85,73,110,116,49,54,76,69,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_15 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(30196866UL,3321056474UL,1069070387UL),DUK__STRHASH16(50306U,19674U,47155U),14,14,&duk_str_227),{82,101,102,101,114,101,110,99,101,69,114,114,111,114,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_303 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(376200579UL,4104425699UL,1720294138UL),DUK__STRHASH16(23939U,37091U,39674U),14,14,NULL),{84,104,114,111,119,84,121,112,101,69,114,114,111,114,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_92 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1195760971UL,3542660914UL,1354832385UL),DUK__STRHASH16(56651U,46898U,6657U),12,12,&duk_str_303),{116,111,84,105,109,101,83,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_91 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1513336927UL,1118326464UL,1362828912UL),DUK__STRHASH16(45151U,20160U,7792U),12,12,&duk_str_92),{116,111,68,97,116,101,83,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_401 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2270048328UL,696747319UL,2416416402UL),DUK__STRHASH16(12360U,34103U,38546U),13,13,NULL),{102,114,111,109,67,111,100,101,80,111,105,110,116,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_254 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3020887007UL,2143800153UL,4076650528UL),DUK__STRHASH16(5087U,52057U,49184U),12,12,NULL),{119,114,105,116,101,70,108,111,97,116,66,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_253 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2593669871UL,1652204086UL,681301162UL),DUK__STRHASH16(17135U,41526U,54442U),12,12,&duk_str_254),{119,114,105,116,101,70,108,111,97,116,76,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_252 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1686992005UL,984775281UL,941892410UL),DUK__STRHASH16(29829U,31345U,9018U),12,12,&duk_str_253),{119,114,105,116,101,73,110,116,51,50,66,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_251 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1606095374UL,3079393929UL,1841510340UL),DUK__STRHASH16(4622U,53897U,14276U),12,12,&duk_str_252),{119,114,105,116,101,73,110,116,51,50,76,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_248 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(170577915UL,563959175UL,1599440316UL),DUK__STRHASH16(53243U,21895U,34236U),12,12,&duk_str_251),{119,114,105,116,101,73,110,116,49,54,66,69,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_247 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(279620505UL,3460131590UL,2499058246UL),DUK__STRHASH16(43929U,27398U,39494U),12,12,&duk_str_248),{119,114,105,116,101,73,110,116,49,54,76,69,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_111 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(630267704UL,3699156700UL,353917748UL),DUK__STRHASH16(7992U,42716U,23348U),13,13,&duk_str_247),{103,101,116,85,84,67,83,101,99,111,110,100,115,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_109 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3843700586UL,1257558739UL,1660559594UL),DUK__STRHASH16(14186U,53971U,8426U),13,13,&duk_str_111),{103,101,116,85,84,67,77,105,110,117,116,101,115,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_411 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1127921844UL,2264981981UL,2183320802UL),DUK__STRHASH16(47284U,57821U,54498U),13,13,NULL),{105,115,83,97,102,101,73,110,116,101,103,101,114,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_45 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(943093972UL,2396396922UL,390523136UL),DUK__STRHASH16(30932U,7546U,59648U),13,13,&duk_str_411),{105,115,80,114,111,116,111,116,121,112,101,79,102,0}};
+DUK_INTERNAL const duk_romstr_12 duk_str_347 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3962562745UL,1104131929UL,2095466005UL),DUK__STRHASH16(59577U,46937U,17941U),12,12,NULL),{123,95,102,117,110,99,58,116,114,117,101,125,0}};
+DUK_INTERNAL const duk_romstr_1 duk_str_188 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3223368712UL,3223368712UL,628054273UL),DUK__STRHASH16(46088U,46088U,22785U),1,1,NULL),{44,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_70 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3816321035UL,1222420392UL,4066196496UL),DUK__STRHASH16(28683U,42920U,15376U),13,13,&duk_str_188),{108,111,99,97,108,101,67,111,109,112,97,114,101,0}};
+DUK_INTERNAL const duk_romstr_1 duk_str_184 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_ARRIDX,1,DUK__STRHASH32(3398115540UL,3398115540UL,628054277UL),DUK__STRHASH16(8404U,8404U,22789U),1,1,NULL),{48,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_121 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2515908991UL,390967824UL,1660559606UL),DUK__STRHASH16(47487U,45584U,8438U),13,13,NULL),{115,101,116,85,84,67,77,105,110,117,116,101,115,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_119 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2569996356UL,651176233UL,353917760UL),DUK__STRHASH16(2116U,10537U,23360U),13,13,&duk_str_121),{115,101,116,85,84,67,83,101,99,111,110,100,115,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_200 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1142411252UL,3605588417UL,3002054290UL),DUK__STRHASH16(53236U,59841U,46738U),14,14,NULL),{100,101,108,101,116,101,80,114,111,112,101,114,116,121,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_199 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3281910591UL,2398657451UL,2995075978UL),DUK__STRHASH16(64319U,39851U,15242U),14,14,&duk_str_200),{100,101,102,105,110,101,80,114,111,112,101,114,116,121,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_87 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3756047705UL,1976764245UL,1484235715UL),DUK__STRHASH16(48473U,1877U,41923U),13,13,&duk_str_199),{116,111,69,120,112,111,110,101,110,116,105,97,108,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_256 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2018157290UL,888323447UL,1407797894UL),DUK__STRHASH16(41706U,48503U,19078U),13,13,NULL),{119,114,105,116,101,68,111,117,98,108,101,66,69,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_255 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1288201583UL,1475162778UL,1030418512UL),DUK__STRHASH16(25967U,12954U,61520U),13,13,&duk_str_256),{119,114,105,116,101,68,111,117,98,108,101,76,69,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_250 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3528452533UL,2317120322UL,1368173616UL),DUK__STRHASH16(59829U,29506U,44080U),13,13,&duk_str_255),{119,114,105,116,101,85,73,110,116,51,50,66,69,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_249 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(47348846UL,3716797334UL,990794234UL),DUK__STRHASH16(31854U,54166U,20986U),13,13,&duk_str_250),{119,114,105,116,101,85,73,110,116,51,50,76,69,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_246 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4226574025UL,326825074UL,1592418034UL),DUK__STRHASH16(26313U,62578U,24306U),13,13,&duk_str_249),{119,114,105,116,101,85,73,110,116,49,54,66,69,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_245 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1620448464UL,341379516UL,1215038652UL),DUK__STRHASH16(5328U,2492U,1212U),13,13,&duk_str_246),{119,114,105,116,101,85,73,110,116,49,54,76,69,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_203 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3499531773UL,978822639UL,2741730021UL),DUK__STRHASH16(40445U,42479U,31461U),14,14,&duk_str_245),{103,101,116,80,114,111,116,111,116,121,112,101,79,102,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_99 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2069077061UL,223744703UL,1999675306UL),DUK__STRHASH16(40005U,4799U,40874U),14,14,&duk_str_203),{103,101,116,85,84,67,70,117,108,108,89,101,97,114,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_44 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1742965717UL,401872423UL,3357047471UL),DUK__STRHASH16(35797U,5671U,31407U),14,14,NULL),{104,97,115,79,119,110,80,114,111,112,101,114,116,121,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_344 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3952233068UL,698870183UL,3057614571UL),DUK__STRHASH16(19052U,59815U,32491U),13,13,NULL),{123,34,95,105,110,102,34,58,116,114,117,101,125,0}};
+DUK_INTERNAL const duk_romstr_13 duk_str_343 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2398936302UL,27614038UL,3355460427UL),DUK__STRHASH16(56558U,23382U,17227U),13,13,&duk_str_344),{123,34,95,110,97,110,34,58,116,114,117,101,125,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_185 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1622985423UL,1622985423UL,3545923089UL),DUK__STRHASH16(51919U,51919U,32273U),2,2,&duk_str_343),{43,48,0}};
+DUK_INTERNAL const duk_romstr_16 duk_str_409 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2056819741UL,1175814280UL,3358718387UL),DUK__STRHASH16(37917U,32904U,63923U),16,16,NULL),{77,73,78,95,83,65,70,69,95,73,78,84,69,71,69,82,0}};
+DUK_INTERNAL const duk_romstr_16 duk_str_408 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2871135043UL,168931049UL,3358729013UL),DUK__STRHASH16(2883U,44777U,9013U),16,16,&duk_str_409),{77,65,88,95,83,65,70,69,95,73,78,84,69,71,69,82,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_186 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1044949436UL,1044949436UL,3545923091UL),DUK__STRHASH16(43452U,43452U,32275U),2,2,&duk_str_408),{45,48,0}};
+DUK_INTERNAL const duk_romstr_17 duk_str_415 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2042634903UL,4022426539UL,1635432571UL),DUK__STRHASH16(8855U,23467U,47227U),17,17,NULL),{66,89,84,69,83,95,80,69,82,95,69,76,69,77,69,78,84,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_212 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2255031053UL,1195915184UL,2741730033UL),DUK__STRHASH16(2829U,14256U,31473U),14,14,NULL),{115,101,116,80,114,111,116,111,116,121,112,101,79,102,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_129 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4033353287UL,1410604286UL,1999675318UL),DUK__STRHASH16(5703U,7422U,40886U),14,14,&duk_str_212),{115,101,116,85,84,67,70,117,108,108,89,101,97,114,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_93 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2343332063UL,3085527210UL,1835650084UL),DUK__STRHASH16(26847U,26794U,52260U),14,14,NULL),{116,111,76,111,99,97,108,101,83,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_1 duk_str_146 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2861356678UL,2861356678UL,628054298UL),DUK__STRHASH16(54918U,54918U,22810U),1,1,NULL),{69,0}};
+DUK_INTERNAL const duk_romstr_15 duk_str_112 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(283774107UL,1623177289UL,3802293281UL),DUK__STRHASH16(3227U,47177U,25633U),15,15,NULL),{103,101,116,77,105,108,108,105,115,101,99,111,110,100,115,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_189 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(855636228UL,3524551584UL,2238333275UL),DUK__STRHASH16(63748U,25504U,16731U),5,5,NULL),{10,32,32,32,32,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_346 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1237298978UL,1583745429UL,996542715UL),DUK__STRHASH16(44834U,2453U,2299U),14,14,NULL),{123,34,95,102,117,110,99,34,58,116,114,117,101,125,0}};
+DUK_INTERNAL const duk_romstr_14 duk_str_345 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1808293941UL,2634075558UL,562035770UL),DUK__STRHASH16(24629U,52646U,64570U),14,14,&duk_str_346),{123,34,95,110,105,110,102,34,58,116,114,117,101,125,0}};
+DUK_INTERNAL const duk_romstr_17 duk_str_84 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(588023310UL,1330912540UL,1164454785UL),DUK__STRHASH16(34318U,7452U,11137U),17,17,NULL),{78,69,71,65,84,73,86,69,95,73,78,70,73,78,73,84,89,0}};
+DUK_INTERNAL const duk_romstr_16 duk_str_400 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4222153801UL,3879499048UL,4132346769UL),DUK__STRHASH16(62537U,29992U,39825U),16,16,NULL),{95,95,108,111,111,107,117,112,83,101,116,116,101,114,95,95,0}};
+DUK_INTERNAL const duk_romstr_16 duk_str_399 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(162250613UL,546431058UL,2155433861UL),DUK__STRHASH16(49013U,57426U,20357U),16,16,&duk_str_400),{95,95,108,111,111,107,117,112,71,101,116,116,101,114,95,95,0}};
+DUK_INTERNAL const duk_romstr_16 duk_str_398 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(693866099UL,4228173478UL,2941255938UL),DUK__STRHASH16(36467U,52902U,258U),16,16,&duk_str_399),{95,95,100,101,102,105,110,101,83,101,116,116,101,114,95,95,0}};
+DUK_INTERNAL const duk_romstr_16 duk_str_397 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(131149741UL,2064393385UL,964343030UL),DUK__STRHASH16(12205U,9385U,46326U),16,16,&duk_str_398),{95,95,100,101,102,105,110,101,71,101,116,116,101,114,95,95,0}};
+DUK_INTERNAL const duk_romstr_17 duk_str_85 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1734836810UL,4172541862UL,1164755681UL),DUK__STRHASH16(33354U,61350U,49889U),17,17,NULL),{80,79,83,73,84,73,86,69,95,73,78,70,73,78,73,84,89,0}};
+DUK_INTERNAL const duk_romstr_15 duk_str_116 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(871046581UL,2399760886UL,3802293293UL),DUK__STRHASH16(7605U,29174U,25645U),15,15,NULL),{115,101,116,77,105,108,108,105,115,101,99,111,110,100,115,0}};
+DUK_INTERNAL const duk_romstr_16 duk_str_34 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(545499208UL,4251214976UL,2976996636UL),DUK__STRHASH16(43080U,25728U,23836U),16,16,NULL),{100,101,102,105,110,101,80,114,111,112,101,114,116,105,101,115,0}};
+DUK_INTERNAL const duk_romstr_17 duk_str_267 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1617773150UL,3507185887UL,1492303890UL),DUK__STRHASH16(16990U,26847U,49170U),17,17,NULL),{85,105,110,116,56,67,108,97,109,112,101,100,65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_15 duk_str_342 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1357540074UL,3968903891UL,2638988354UL),DUK__STRHASH16(27370U,43731U,50242U),15,15,NULL),{123,34,95,117,110,100,101,102,34,58,116,114,117,101,125,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_151 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2905660666UL,2905660666UL,3545923951UL),DUK__STRHASH16(56570U,56570U,33135U),2,2,NULL),{80,73,0}};
+DUK_INTERNAL const duk_romstr_17 duk_str_114 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2251031596UL,4225082715UL,979904247UL),DUK__STRHASH16(1068U,42331U,9975U),17,17,NULL),{103,101,116,84,105,109,101,122,111,110,101,79,102,102,115,101,116,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_148 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1863960922UL,1863960922UL,1051384291UL),DUK__STRHASH16(51546U,51546U,55779U),3,3,NULL),{76,78,50,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_180 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3047432250UL,3047432250UL,1051415412UL),DUK__STRHASH16(8250U,8250U,21364U),3,3,NULL),{78,97,78,0}};
+DUK_INTERNAL const duk_romstr_17 duk_str_207 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(137254069UL,1246357989UL,4213335033UL),DUK__STRHASH16(21685U,59877U,25593U),17,17,NULL),{112,114,101,118,101,110,116,69,120,116,101,110,115,105,111,110,115,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_412 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2813037198UL,2813037198UL,1051413733UL),DUK__STRHASH16(35470U,35470U,19685U),3,3,NULL),{82,79,77,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_355 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(3123272545UL,3123272545UL,3545925225UL),DUK__STRHASH16(23393U,23393U,34409U),2,2,NULL),{100,111,0}};
+DUK_INTERNAL const duk_romstr_17 duk_str_79 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3006459199UL,4106602246UL,782183072UL),DUK__STRHASH16(60735U,50950U,10912U),17,17,&duk_str_355),{116,111,76,111,99,97,108,101,85,112,112,101,114,67,97,115,101,0}};
+DUK_INTERNAL const duk_romstr_17 duk_str_77 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1919163265UL,976120092UL,3082655037UL),DUK__STRHASH16(7041U,26908U,38205U),17,17,&duk_str_79),{116,111,76,111,99,97,108,101,76,111,119,101,114,67,97,115,101,0}};
+DUK_INTERNAL const duk_romstr_18 duk_str_27 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3496288899UL,3494195190UL,1754048525UL),DUK__STRHASH16(8835U,12278U,43021U),18,18,&duk_str_77),{100,101,99,111,100,101,85,82,73,67,111,109,112,111,110,101,110,116,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_10 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(738902241UL,1071796178UL,329516718UL),DUK__STRHASH16(49377U,20434U,1710U),4,4,&duk_str_27),{68,97,116,101,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_89 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1831095069UL,1831095069UL,1051403011UL),DUK__STRHASH16(19229U,19229U,8963U),3,3,NULL),{85,84,67,0}};
+DUK_INTERNAL const duk_romstr_18 duk_str_29 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1289907430UL,3074685406UL,1754048823UL),DUK__STRHASH16(27878U,63966U,43319U),18,18,&duk_str_89),{101,110,99,111,100,101,85,82,73,67,111,109,112,111,110,101,110,116,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_331 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1403063156UL,1403063156UL,3545924832UL),DUK__STRHASH16(2932U,2932U,34016U),2,2,NULL),{103,99,0}};
+DUK_INTERNAL const duk_romstr_18 duk_str_113 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2840146720UL,3515527046UL,3101117912UL),DUK__STRHASH16(13088U,44934U,19928U),18,18,&duk_str_331),{103,101,116,85,84,67,77,105,108,108,105,115,101,99,111,110,100,115,0}};
+DUK_INTERNAL const duk_romstr_18 duk_str_426 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3855156571UL,3830085294UL,4054791469UL),DUK__STRHASH16(1371U,30382U,13613U),18,18,NULL),{105,115,67,111,110,99,97,116,83,112,114,101,97,100,97,98,108,101,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_396 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3828391773UL,3828391773UL,3545925362UL),DUK__STRHASH16(40797U,40797U,34546U),2,2,&duk_str_426),{105,115,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_361 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(730606357UL,730606357UL,3545925197UL),DUK__STRHASH16(11029U,11029U,34381U),2,2,&duk_str_396),{105,110,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_360 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(633115286UL,633115286UL,3545924933UL),DUK__STRHASH16(37526U,37526U,34117U),2,2,&duk_str_361),{105,102,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_339 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(876531567UL,876531567UL,3545924835UL),DUK__STRHASH16(53103U,53103U,34019U),2,2,NULL),{106,99,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_338 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3559091260UL,3559091260UL,3545925528UL),DUK__STRHASH16(27708U,27708U,34712U),2,2,&duk_str_339),{106,120,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_20 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1510892914UL,2470436748UL,328649418UL),DUK__STRHASH16(25970U,57228U,51914U),4,4,&duk_str_338),{74,83,79,78,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_147 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1225129207UL,1016565694UL,327538475UL),DUK__STRHASH16(64759U,36798U,55083U),4,4,NULL),{76,78,49,48,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_19 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3869033340UL,2773693957UL,329624538UL),DUK__STRHASH16(50044U,13829U,43994U),4,4,NULL),{77,97,116,104,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_1 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1181763142UL,2049870408UL,329760235UL),DUK__STRHASH16(17990U,35400U,48619U),4,4,NULL),{78,117,108,108,0}};
+DUK_INTERNAL const duk_romstr_2 duk_str_305 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1027834373UL,1027834373UL,3545924841UL),DUK__STRHASH16(33285U,33285U,34025U),2,2,NULL),{112,99,0}};
+DUK_INTERNAL const duk_romstr_17 duk_str_428 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL,1,DUK__STRHASH32(3868826617UL,2533256589UL,3272831987UL),DUK__STRHASH16(39929U,28045U,29683U),17,16,NULL),{129U,83,121,109,98,111,108,46,105,116,101,114,97,116,111,114,255U,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_330 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2818999944UL,2818999944UL,1051456879UL),DUK__STRHASH16(34440U,34440U,62831U),3,3,&duk_str_428),{97,99,116,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_154 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(608994653UL,608994653UL,1051455757UL),DUK__STRHASH16(34141U,34141U,61709U),3,3,&duk_str_330),{97,98,115,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_6 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(757033290UL,3919703092UL,2346308208UL),DUK__STRHASH16(26954U,60468U,53872U),5,5,&duk_str_154),{65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_160 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(541326813UL,541326813UL,1051456188UL),DUK__STRHASH16(64989U,64989U,62140U),3,3,NULL),{99,111,115,0}};
+DUK_INTERNAL const duk_romstr_18 duk_str_117 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(263767011UL,3621288757UL,3101117924UL),DUK__STRHASH16(50147U,31541U,19940U),18,18,&duk_str_160),{115,101,116,85,84,67,77,105,108,108,105,115,101,99,111,110,100,115,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_334 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4099934481UL,4099934481UL,1051438435UL),DUK__STRHASH16(2321U,2321U,44387U),3,3,NULL),{100,101,99,0}};
+DUK_INTERNAL const duk_romstr_18 duk_str_95 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(49075221UL,4102866192UL,2892594783UL),DUK__STRHASH16(54293U,50448U,32351U),18,18,&duk_str_334),{116,111,76,111,99,97,108,101,84,105,109,101,83,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_18 duk_str_94 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1978491836UL,584631773UL,3923171854UL),DUK__STRHASH16(25532U,50653U,55822U),18,18,&duk_str_95),{116,111,76,111,99,97,108,101,68,97,116,101,83,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_333 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1060487034UL,1060487034UL,1051438733UL),DUK__STRHASH16(49018U,49018U,44685U),3,3,NULL),{101,110,99,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_327 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1777788885UL,1777788885UL,1051459424UL),DUK__STRHASH16(59349U,59349U,65376U),3,3,&duk_str_333),{101,110,118,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_161 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(700070489UL,700070489UL,1051453220UL),DUK__STRHASH16(14937U,14937U,59172U),3,3,&duk_str_327),{101,120,112,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_12 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1654204915UL,1531262805UL,2338509883UL),DUK__STRHASH16(10739U,14165U,54331U),5,5,&duk_str_161),{69,114,114,111,114,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_358 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(725379510UL,725379510UL,1051455102UL),DUK__STRHASH16(27062U,27062U,61054U),3,3,NULL),{102,111,114,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_332 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2471659162UL,2471659162UL,1051450548UL),DUK__STRHASH16(34458U,34458U,56500U),3,3,&duk_str_358),{102,105,110,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_201 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3267695225UL,3267695225UL,1051456951UL),DUK__STRHASH16(4729U,4729U,62903U),3,3,NULL),{103,101,116,0}};
+DUK_INTERNAL const duk_romstr_19 duk_str_32 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2287731935UL,4062044003UL,118513204UL),DUK__STRHASH16(1247U,57187U,24116U),19,19,&duk_str_201),{103,101,116,79,119,110,80,114,111,112,101,114,116,121,78,97,109,101,115,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_336 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1868647178UL,1868647178UL,1051461308UL),DUK__STRHASH16(19210U,19210U,1724U),3,3,NULL),{104,101,120,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_204 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(909464933UL,909464933UL,1051455731UL),DUK__STRHASH16(21861U,21861U,61683U),3,3,&duk_str_336),{104,97,115,0}};
+DUK_INTERNAL const duk_romstr_20 duk_str_432 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1054242403UL,1928575853UL,4228099480UL),DUK__STRHASH16(30307U,47981U,44440U),20,20,NULL),{91,83,121,109,98,111,108,46,116,111,80,114,105,109,105,116,105,118,101,93,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_386 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD|DUK_HSTRING_FLAG_STRICT_RESERVED_WORD,1,DUK__STRHASH32(187410131UL,187410131UL,1051456956UL),DUK__STRHASH16(42707U,42707U,62908U),3,3,NULL),{108,101,116,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_163 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1972035020UL,1972035020UL,1051443129UL),DUK__STRHASH16(56780U,56780U,49081U),3,3,&duk_str_386),{108,111,103,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_149 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1885224060UL,535056975UL,2282903306UL),DUK__STRHASH16(15484U,21071U,22282U),5,5,&duk_str_163),{76,79,71,50,69,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_165 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3169901484UL,3169901484UL,1051450555UL),DUK__STRHASH16(56236U,56236U,56507U),3,3,NULL),{109,105,110,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_164 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3584735298UL,3584735298UL,1051461181UL),DUK__STRHASH16(47170U,47170U,1597U),3,3,&duk_str_165),{109,97,120,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_61 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2503321277UL,2503321277UL,1051452469UL),DUK__STRHASH16(42685U,42685U,58421U),3,3,&duk_str_164),{109,97,112,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_363 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(3381927406UL,3381927406UL,1051460225UL),DUK__STRHASH16(7662U,7662U,641U),3,3,NULL),{110,101,119,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_90 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2089356671UL,2089356671UL,1051460555UL),DUK__STRHASH16(3455U,3455U,971U),3,3,&duk_str_363),{110,111,119,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_195 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2735584836UL,3336391497UL,2347131507UL),DUK__STRHASH16(46660U,19273U,25203U),5,5,NULL),{80,114,111,120,121,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_166 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3536179370UL,3536179370UL,1051460557UL),DUK__STRHASH16(53418U,53418U,973U),3,3,&duk_str_195),{112,111,119,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_51 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(866302271UL,866302271UL,1051452934UL),DUK__STRHASH16(47423U,47423U,58886U),3,3,&duk_str_166),{112,111,112,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_157 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1586093918UL,3501758516UL,329820116UL),DUK__STRHASH16(57182U,38964U,42964U),4,4,NULL),{97,116,97,110,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_156 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3527943321UL,4276419609UL,329828795UL),DUK__STRHASH16(9369U,64537U,51643U),4,4,&duk_str_157),{97,115,105,110,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_155 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3545900922UL,4084315295UL,330014486UL),DUK__STRHASH16(10106U,46239U,40726U),4,4,&duk_str_156),{97,99,111,115,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_300 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3459139742UL,222205129UL,1140580908UL),DUK__STRHASH16(18590U,38089U,57900U),6,6,NULL),{66,117,102,102,101,114,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_48 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1961084617UL,2591690071UL,329474541UL),DUK__STRHASH16(50889U,3415U,25069U),4,4,&duk_str_300),{98,105,110,100,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_416 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(194990221UL,650737349UL,330053659UL),DUK__STRHASH16(20621U,30405U,14363U),4,4,NULL),{99,98,114,116,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_349 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(3304145429UL,2903093777UL,329515660UL),DUK__STRHASH16(16917U,45585U,652U),4,4,&duk_str_416),{99,97,115,101,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_278 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3807772888UL,3807772888UL,1051456963UL),DUK__STRHASH16(216U,216U,62915U),3,3,&duk_str_349),{115,101,116,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_224 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1497549049UL,2194208722UL,330231595UL),DUK__STRHASH16(51449U,63442U,61227U),4,4,&duk_str_278),{99,111,112,121,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_169 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2066177538UL,2066177538UL,1051450561UL),DUK__STRHASH16(24066U,24066U,56513U),3,3,&duk_str_224),{115,105,110,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_159 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1313776787UL,1864647490UL,329756461UL),DUK__STRHASH16(42131U,17218U,44845U),4,4,&duk_str_169),{99,101,105,108,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_153 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2492188403UL,1554650809UL,2261604717UL),DUK__STRHASH16(50931U,5817U,22893U),5,5,&duk_str_159),{83,81,82,84,50,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_47 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2998190876UL,4013469248UL,329759596UL),DUK__STRHASH16(49948U,44608U,47980U),4,4,&duk_str_153),{99,97,108,108,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_368 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(557672352UL,557672352UL,1051462838UL),DUK__STRHASH16(26528U,26528U,3254U),3,3,NULL),{116,114,121,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_299 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2264726153UL,1821051683UL,1306606055UL),DUK__STRHASH16(64137U,2851U,14823U),6,6,&duk_str_368),{68,101,99,69,110,118,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_262 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3515673942UL,3518635492UL,329373002UL),DUK__STRHASH16(60758U,7652U,54602U),4,4,&duk_str_299),{100,97,116,97,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_171 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(214769304UL,214769304UL,1051450298UL),DUK__STRHASH16(7832U,7832U,56250U),3,3,&duk_str_262),{116,97,110,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_376 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(3017842623UL,782626684UL,329805765UL),DUK__STRHASH16(40895U,61308U,28613U),4,4,NULL),{101,110,117,109,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_356 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(791120384UL,2840973113UL,329516025UL),DUK__STRHASH16(35328U,53049U,1017U),4,4,&duk_str_376),{101,108,115,101,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_135 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(461512884UL,3743159910UL,329429301UL),DUK__STRHASH16(8372U,5734U,45365U),4,4,&duk_str_356),{101,120,101,99,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_21 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_EVAL_OR_ARGUMENTS,1,DUK__STRHASH32(3890160985UL,2151931867UL,329748312UL),DUK__STRHASH16(9561U,57307U,36696U),4,4,&duk_str_135),{101,118,97,108,0}};
+DUK_INTERNAL const duk_romstr_3 duk_str_370 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(2270143826UL,2270143826UL,1051454656UL),DUK__STRHASH16(42322U,42322U,60608U),3,3,NULL),{118,97,114,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_221 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3951544765UL,1709855126UL,329759863UL),DUK__STRHASH16(51645U,20886U,48247U),4,4,&duk_str_370),{102,105,108,108,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_419 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2833149752UL,2389609116UL,329769799UL),DUK__STRHASH16(28472U,35484U,58183U),4,4,NULL),{105,109,117,108,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_329 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2294215097UL,2075153781UL,329861308UL),DUK__STRHASH16(61881U,21877U,18620U),4,4,&duk_str_419),{105,110,102,111,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_50 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(200204621UL,468976472UL,329828672UL),DUK__STRHASH16(57677U,856U,51520U),4,4,NULL),{106,111,105,110,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_190 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3636968358UL,3769181390UL,2311193363UL),DUK__STRHASH16(48038U,9422U,787U),5,5,NULL),{91,46,46,46,93,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_39 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(172604479UL,4116139116UL,330025452UL),DUK__STRHASH16(48191U,19564U,51692U),4,4,&duk_str_190),{107,101,121,115,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_420 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2899437110UL,3568824467UL,327670276UL),DUK__STRHASH16(58934U,61587U,55812U),4,4,NULL),{108,111,103,50,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_150 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3841232568UL,3624959894UL,3609662042UL),DUK__STRHASH16(36536U,32662U,4698U),6,6,&duk_str_420),{76,79,71,49,48,69,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_381 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(2705321625UL,614361735UL,329760267UL),DUK__STRHASH16(61081U,27271U,48651U),4,4,NULL),{110,117,108,108,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_308 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4253865887UL,3686899522UL,329509137UL),DUK__STRHASH16(55199U,40770U,59665U),4,4,&duk_str_381),{110,97,109,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_9 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3623880019UL,366777697UL,1140444795UL),DUK__STRHASH16(1363U,38241U,52859U),6,6,&duk_str_308),{78,117,109,98,101,114,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_298 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2253594425UL,3052600797UL,1306613590UL),DUK__STRHASH16(7993U,64989U,22358U),6,6,NULL),{79,98,106,69,110,118,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_4 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2926852205UL,1162978632UL,1216447657UL),DUK__STRHASH16(14445U,42312U,33961U),6,6,&duk_str_298),{79,98,106,101,99,116,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_52 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3225391145UL,3701133914UL,329624144UL),DUK__STRHASH16(36905U,53850U,43600U),4,4,NULL),{112,117,115,104,0}};
+DUK_INTERNAL const duk_romstr_20 duk_str_46 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3099652383UL,1675620611UL,3160748321UL),DUK__STRHASH16(61727U,61699U,12577U),20,20,&duk_str_52),{112,114,111,112,101,114,116,121,73,115,69,110,117,109,101,114,97,98,108,101,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_197 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(651831253UL,3494630001UL,2346701303UL),DUK__STRHASH16(10197U,53873U,53751U),5,5,NULL),{97,112,112,108,121,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_158 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1968704189UL,4273039298UL,2262556583UL),DUK__STRHASH16(2749U,26562U,57255U),5,5,&duk_str_197),{97,116,97,110,50,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_348 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(47000129UL,504870900UL,2329691190UL),DUK__STRHASH16(10817U,47092U,17462U),5,5,NULL),{98,114,101,97,107,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_11 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3475204289UL,2282007690UL,1083657277UL),DUK__STRHASH16(26817U,44170U,19517U),6,6,&duk_str_348),{82,101,103,69,120,112,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_8 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2083721228UL,2845346038UL,1919780179UL),DUK__STRHASH16(4108U,35062U,34131U),7,7,&duk_str_11),{66,111,111,108,101,97,110,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_422 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3319275297UL,444822060UL,329826305UL),DUK__STRHASH16(7969U,29228U,49153U),4,4,NULL),{115,105,103,110,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_417 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4276429065UL,2338107787UL,2260463263UL),DUK__STRHASH16(8457U,45451U,61087U),5,5,&duk_str_422),{99,108,122,51,50,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_375 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(1876214828UL,3360451539UL,2339820871UL),DUK__STRHASH16(50220U,27603U,54599U),5,5,&duk_str_417),{99,108,97,115,115,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_371 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(3129697511UL,3029869292UL,2341021048UL),DUK__STRHASH16(25831U,8940U,9592U),5,5,&duk_str_375),{99,111,110,115,116,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_350 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(4290803054UL,2376614575UL,2326221076UL),DUK__STRHASH16(30062U,17071U,20756U),5,5,&duk_str_371),{99,97,116,99,104,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_170 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2177028471UL,2653555291UL,330054170UL),DUK__STRHASH16(53623U,2651U,14874U),4,4,&duk_str_350),{115,113,114,116,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_59 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2082968595UL,1698250319UL,329509604UL),DUK__STRHASH16(37907U,15951U,60132U),4,4,&duk_str_170),{115,111,109,101,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_55 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(894922085UL,40319561UL,330054104UL),DUK__STRHASH16(28005U,14921U,14808U),4,4,&duk_str_59),{115,111,114,116,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_35 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1794194578UL,635785440UL,329747765UL),DUK__STRHASH16(15506U,20704U,36149U),4,4,&duk_str_55),{115,101,97,108,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_7 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(19403116UL,403348896UL,720885737UL),DUK__STRHASH16(4460U,40352U,55273U),6,6,&duk_str_35),{83,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_2 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(431510079UL,2340357526UL,917491784UL),DUK__STRHASH16(21055U,1430U,53320U),6,6,&duk_str_7),{83,121,109,98,111,108,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_382 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(85400631UL,258897050UL,329518416UL),DUK__STRHASH16(7223U,29850U,3408U),4,4,NULL),{116,114,117,101,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_366 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(1364158608UL,1932947460UL,330008136UL),DUK__STRHASH16(26768U,28676U,34376U),4,4,&duk_str_382),{116,104,105,115,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_302 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3792343462UL,838935468UL,587918442UL),DUK__STRHASH16(37286U,9132U,60522U),6,6,&duk_str_366),{84,104,114,101,97,100,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_296 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2871462594UL,3404979165UL,3764040897UL),DUK__STRHASH16(2754U,56285U,46273U),7,7,&duk_str_302),{68,117,107,116,97,112,101,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_261 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2024191233UL,3290223085UL,329513202UL),DUK__STRHASH16(46337U,53741U,63730U),4,4,&duk_str_296),{116,121,112,101,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_136 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3110966321UL,3397037813UL,330054864UL),DUK__STRHASH16(37937U,44789U,15568U),4,4,&duk_str_261),{116,101,115,116,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_80 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3039762537UL,565880497UL,329792844UL),DUK__STRHASH16(6249U,42673U,15692U),4,4,&duk_str_136),{116,114,105,109,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_407 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3738573516UL,2764633730UL,2807103725UL),DUK__STRHASH16(6860U,63106U,237U),7,7,NULL),{69,80,83,73,76,79,78,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_58 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2914217730UL,3785013128UL,2346905148UL),DUK__STRHASH16(28418U,46984U,60988U),5,5,&duk_str_407),{101,118,101,114,121,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_383 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(3012973183UL,2459871597UL,2323229596UL),DUK__STRHASH16(21119U,43373U,43932U),5,5,NULL),{102,97,108,115,101,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_372 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(1917708566UL,2286724628UL,329469314UL),DUK__STRHASH16(59670U,42516U,19842U),4,4,&duk_str_383),{118,111,105,100,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_162 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2527699521UL,1725135504UL,2338506451UL),DUK__STRHASH16(41537U,31376U,50899U),5,5,&duk_str_372),{102,108,111,111,114,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_141 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3901695151UL,2271366028UL,2339389630UL),DUK__STRHASH16(9391U,19340U,16574U),5,5,&duk_str_162),{102,108,97,103,115,0}};
+DUK_INTERNAL const duk_romstr_21 duk_str_395 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2169042781UL,506461819UL,3248174979UL),DUK__STRHASH16(63325U,65147U,14211U),21,21,NULL),{103,101,116,79,119,110,80,114,111,112,101,114,116,121,83,121,109,98,111,108,115,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_374 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(1832681615UL,1751795899UL,329624844UL),DUK__STRHASH16(32911U,18619U,44300U),4,4,&duk_str_395),{119,105,116,104,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_418 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2780306651UL,2290521051UL,2340879813UL),DUK__STRHASH16(7387U,37851U,64965U),5,5,NULL),{104,121,112,111,116,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_324 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3301904957UL,1329752111UL,2341095073UL),DUK__STRHASH16(4669U,26671U,18081U),5,5,NULL),{105,110,112,117,116,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_142 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2339458915UL,1630746729UL,2345250697UL),DUK__STRHASH16(20323U,14441U,44937U),5,5,&duk_str_324),{105,110,100,101,120,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_24 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2801659803UL,3382746871UL,2295274474UL),DUK__STRHASH16(61339U,40695U,7146U),5,5,&duk_str_142),{105,115,78,97,78,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_182 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1184038984UL,3186314824UL,2930507698UL),DUK__STRHASH16(72U,20040U,65458U),9,9,NULL),{43,73,110,102,105,110,105,116,121,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_421 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3502286534UL,1399465003UL,2257998964UL),DUK__STRHASH16(42694U,9259U,21620U),5,5,NULL),{108,111,103,49,48,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_183 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2011958633UL,1621239426UL,2930507700UL),DUK__STRHASH16(3433U,9858U,65460U),9,9,NULL),{45,73,110,102,105,110,105,116,121,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_71 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1804843453UL,1337864210UL,2326221086UL),DUK__STRHASH16(47549U,12306U,20766U),5,5,&duk_str_183),{109,97,116,99,104,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_301 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(670274993UL,1590637187UL,2965080500UL),DUK__STRHASH16(38321U,12931U,35252U),7,7,NULL),{80,111,105,110,116,101,114,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_172 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2259109290UL,438708040UL,2323236140UL),DUK__STRHASH16(17834U,10056U,50476U),5,5,&duk_str_301),{112,97,114,115,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_394 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1198695458UL,1363799427UL,986533111UL),DUK__STRHASH16(42018U,60803U,19703U),6,6,NULL),{97,115,115,105,103,110,0}};
+DUK_INTERNAL const duk_romstr_20 duk_str_210 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL,1,DUK__STRHASH32(3984292527UL,236441551UL,1540947642UL),DUK__STRHASH16(31407U,53199U,65210U),20,19,&duk_str_394),{129U,83,121,109,98,111,108,46,116,111,83,116,114,105,110,103,84,97,103,255U,0}};
+DUK_INTERNAL const duk_romstr_20 duk_str_209 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL,1,DUK__STRHASH32(84070874UL,1313389060UL,573698325UL),DUK__STRHASH16(53722U,47620U,61717U),20,19,&duk_str_210),{129U,83,121,109,98,111,108,46,104,97,115,73,110,115,116,97,110,99,101,255U,0}};
+DUK_INTERNAL const duk_romstr_20 duk_str_208 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL,1,DUK__STRHASH32(1903595127UL,3909815637UL,751765280UL),DUK__STRHASH16(36471U,3413U,1824U),20,19,&duk_str_209),{129U,83,121,109,98,111,108,46,116,111,80,114,105,109,105,116,105,118,101,255U,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_337 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1205622601UL,2398746562UL,2953393143UL),DUK__STRHASH16(22345U,63426U,13303U),6,6,NULL),{98,97,115,101,54,52,0}};
+DUK_INTERNAL const duk_romstr_4 duk_str_318 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(2080824835UL,761411049UL,329890736UL),DUK__STRHASH16(56835U,13801U,48048U),4,3,&duk_str_337),{130U,77,97,112,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_276 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(549363737UL,163367249UL,1140580940UL),DUK__STRHASH16(40985U,51537U,57932U),6,6,&duk_str_318),{98,117,102,102,101,114,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_196 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(841348957UL,2583903953UL,1156914072UL),DUK__STRHASH16(63325U,16081U,7064U),7,7,&duk_str_276),{82,101,102,108,101,99,116,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_168 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1566527766UL,3390971413UL,2321874265UL),DUK__STRHASH16(20758U,7701U,64857U),5,5,&duk_str_196),{114,111,117,110,100,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_380 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(1173025803UL,104182211UL,2338148480UL),DUK__STRHASH16(62475U,45507U,20608U),5,5,NULL),{115,117,112,101,114,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_304 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1369723621UL,1040862897UL,2329758791UL),DUK__STRHASH16(21221U,20145U,19527U),5,5,&duk_str_380),{115,116,97,99,107,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_275 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2418878870UL,2647066223UL,2322651713UL),DUK__STRHASH16(10646U,1647U,55873U),5,5,&duk_str_304),{115,108,105,99,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_214 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4275014866UL,223503462UL,1214008746UL),DUK__STRHASH16(36050U,25702U,19882U),6,6,&duk_str_275),{99,111,110,99,97,116,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_194 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(742408678UL,3846207327UL,1140802437UL),DUK__STRHASH16(16870U,30559U,17285U),6,6,&duk_str_214),{99,97,108,108,101,114,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_193 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1789457951UL,1575331592UL,632042328UL),DUK__STRHASH16(63007U,42760U,13144U),6,6,&duk_str_194),{99,97,108,108,101,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_152 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3811849941UL,3550506944UL,1600279647UL),DUK__STRHASH16(14037U,28608U,21599U),7,7,&duk_str_193),{83,81,82,84,49,95,50,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_74 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3809725247UL,2781355165UL,2340659549UL),DUK__STRHASH16(52031U,7325U,41309U),5,5,&duk_str_152),{115,112,108,105,116,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_66 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2447872298UL,2070098914UL,1176583941UL),DUK__STRHASH16(37162U,13282U,16133U),6,6,&duk_str_74),{99,104,97,114,65,116,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_54 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2828453577UL,708369887UL,2340548207UL),DUK__STRHASH16(50889U,56799U,61039U),5,5,&duk_str_66),{115,104,105,102,116,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_33 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(550655739UL,885721379UL,649428774UL),DUK__STRHASH16(22267U,2339U,32550U),6,6,&duk_str_54),{99,114,101,97,116,101,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_423 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1461394485UL,3664548799UL,2320688445UL),DUK__STRHASH16(7221U,37823U,58685U),5,5,NULL),{116,114,117,110,99,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_367 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(1494895325UL,411738788UL,2344439205UL),DUK__STRHASH16(19165U,41636U,19877U),5,5,&duk_str_423),{116,104,114,111,119,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_354 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(4060421955UL,981769244UL,649579717UL),DUK__STRHASH16(8003U,39964U,52421U),6,6,&duk_str_367),{100,101,108,101,116,101,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_264 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(344361125UL,668211799UL,1651936081UL),DUK__STRHASH16(34981U,6743U,35665U),8,8,&duk_str_354),{68,97,116,97,86,105,101,119,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_377 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(2288974067UL,4240874784UL,1234603124UL),DUK__STRHASH16(63731U,40224U,35956U),6,6,NULL),{101,120,112,111,114,116,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_222 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2749412326UL,168977043UL,1187854301UL),DUK__STRHASH16(46054U,25235U,14301U),6,6,&duk_str_377),{101,113,117,97,108,115,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_30 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4173117222UL,2451187944UL,644682947UL),DUK__STRHASH16(46886U,10472U,5315U),6,6,&duk_str_222),{101,115,99,97,112,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_62 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1205747102UL,4038884309UL,1141090200UL),DUK__STRHASH16(15774U,31701U,42904U),6,6,NULL),{102,105,108,116,101,114,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_40 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2841251338UL,905847431UL,2323301486UL),DUK__STRHASH16(3594U,8839U,50286U),5,5,&duk_str_62),{118,97,108,117,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_36 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1693497782UL,2085986727UL,656688051UL),DUK__STRHASH16(47542U,41383U,17331U),6,6,&duk_str_40),{102,114,101,101,122,101,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_5 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4224281425UL,3746999273UL,403460066UL),DUK__STRHASH16(27473U,44009U,20450U),8,8,&duk_str_36),{70,117,110,99,116,105,111,110,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_373 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(3583586610UL,1636649653UL,2322975018UL),DUK__STRHASH16(12594U,19125U,51498U),5,5,NULL),{119,104,105,108,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_297 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(945930017UL,740748367UL,900890659UL),DUK__STRHASH16(48929U,60495U,32803U),6,6,&duk_str_373),{103,108,111,98,97,108,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_220 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(221820928UL,1074119803UL,2323262844UL),DUK__STRHASH16(47104U,50299U,11644U),5,5,&duk_str_297),{119,114,105,116,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_104 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2309877730UL,1407630452UL,1408577872UL),DUK__STRHASH16(61410U,48244U,12624U),6,6,&duk_str_220),{103,101,116,68,97,121,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_392 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD|DUK_HSTRING_FLAG_STRICT_RESERVED_WORD,1,DUK__STRHASH32(2900168426UL,1114536006UL,2321784776UL),DUK__STRHASH16(3818U,30790U,40904U),5,5,NULL),{121,105,101,108,100,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_379 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(4116976206UL,1592441752UL,1234602765UL),DUK__STRHASH16(4686U,48024U,35597U),6,6,&duk_str_392),{105,109,112,111,114,116,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_274 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(923298846UL,3488256432UL,1336348233UL),DUK__STRHASH16(27678U,37296U,3657U),6,6,&duk_str_379),{105,115,86,105,101,119,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_181 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3266709366UL,4088236490UL,3210361254UL),DUK__STRHASH16(1910U,35274U,14758U),8,8,&duk_str_274),{73,110,102,105,110,105,116,121,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_424 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1194077119UL,1664748644UL,1151310338UL),DUK__STRHASH16(11199U,3172U,39426U),6,6,NULL),{107,101,121,70,111,114,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_277 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3855658906UL,829598462UL,767059956UL),DUK__STRHASH16(44954U,43774U,26612U),6,6,NULL),{108,101,110,103,116,104,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_175 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1569711728UL,32902878UL,1140444827UL),DUK__STRHASH16(58992U,3806U,52891U),6,6,NULL),{110,117,109,98,101,114,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_178 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3183963060UL,1260306980UL,1216447689UL),DUK__STRHASH16(27572U,49700U,33993U),6,6,NULL),{111,98,106,101,99,116,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_390 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD|DUK_HSTRING_FLAG_STRICT_RESERVED_WORD,1,DUK__STRHASH32(2373472436UL,2216525266UL,558505009UL),DUK__STRHASH16(20660U,32210U,7217U),6,6,NULL),{112,117,98,108,105,99,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_3 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1417393097UL,3075756933UL,1609998099UL),DUK__STRHASH16(46025U,21381U,40723U),9,9,NULL),{65,114,103,117,109,101,110,116,115,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_403 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2336614639UL,2263325565UL,1214082483UL),DUK__STRHASH16(59631U,39805U,28083U),6,6,NULL),{114,101,112,101,97,116,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_364 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(310614063UL,2863134192UL,1000010130UL),DUK__STRHASH16(38959U,62960U,61842U),6,6,&duk_str_403),{114,101,116,117,114,110,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_340 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(102796462UL,3573723317UL,641860899UL),DUK__STRHASH16(36014U,45237U,1315U),6,6,&duk_str_364),{114,101,115,117,109,101,0}};
+DUK_INTERNAL const duk_romstr_5 duk_str_312 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(1413393228UL,1373021094UL,2341189874UL),DUK__STRHASH16(43852U,41894U,47346U),5,4,&duk_str_340),{130U,78,101,120,116,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_174 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1563496393UL,1173032344UL,1919780211UL),DUK__STRHASH16(4041U,3480U,34163U),7,7,&duk_str_312),{98,111,111,108,101,97,110,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_167 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1486835625UL,2795613526UL,956699379UL),DUK__STRHASH16(20393U,44374U,4851U),6,6,&duk_str_174),{114,97,110,100,111,109,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_63 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3178953263UL,1609486954UL,629985354UL),DUK__STRHASH16(64047U,53866U,53322U),6,6,&duk_str_167),{114,101,100,117,99,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_391 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD|DUK_HSTRING_FLAG_STRICT_RESERVED_WORD,1,DUK__STRHASH32(394127729UL,2244769452UL,558791386UL),DUK__STRHASH16(59761U,30380U,31450U),6,6,NULL),{115,116,97,116,105,99,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_365 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(838529004UL,36451688UL,747361636UL),DUK__STRHASH16(61420U,13672U,54628U),6,6,&duk_str_391),{115,119,105,116,99,104,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_341 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1088435000UL,1165049328UL,1587632630UL),DUK__STRHASH16(13112U,15856U,23030U),7,7,&duk_str_365),{99,117,114,114,101,110,116,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_335 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3876293832UL,2655145216UL,1152322106UL),DUK__STRHASH16(36040U,19712U,2618U),7,7,&duk_str_341),{99,111,109,112,97,99,116,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_323 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1342461832UL,329449922UL,3616844956UL),DUK__STRHASH16(22408U,450U,44188U),7,7,&duk_str_335),{99,111,109,112,105,108,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_223 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3115368412UL,1587994524UL,3842169946UL),DUK__STRHASH16(49116U,57244U,56410U),7,7,&duk_str_323),{99,111,109,112,97,114,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_177 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2158683537UL,2566511662UL,917491816UL),DUK__STRHASH16(58769U,56366U,53352U),6,6,&duk_str_223),{115,121,109,98,111,108,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_176 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(551529389UL,3342675640UL,720885769UL),DUK__STRHASH16(43949U,11960U,55305U),6,6,&duk_str_177),{115,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_137 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3970117586UL,3804766507UL,629896387UL),DUK__STRHASH16(12242U,8491U,29891U),6,6,&duk_str_176),{115,111,117,114,99,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_81 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2425464437UL,4001228834UL,1158832597UL),DUK__STRHASH16(42613U,59426U,25045U),6,6,&duk_str_137),{115,117,98,115,116,114,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_73 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2757276597UL,2273171682UL,747280456UL),DUK__STRHASH16(46005U,55522U,38984U),6,6,&duk_str_81),{115,101,97,114,99,104,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_56 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(452277379UL,4132005065UL,629563186UL),DUK__STRHASH16(13443U,25801U,24370U),6,6,&duk_str_73),{115,112,108,105,99,101,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_369 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(90564439UL,637276705UL,682790537UL),DUK__STRHASH16(59223U,4641U,36489U),6,6,NULL),{116,121,112,101,111,102,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_353 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(3375969083UL,821720468UL,1527712056UL),DUK__STRHASH16(13115U,30100U,2360U),7,7,&duk_str_369),{100,101,102,97,117,108,116,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_219 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1482485780UL,962744793UL,3999870351UL),DUK__STRHASH16(61460U,20953U,11663U),6,6,&duk_str_353),{116,111,74,83,79,78,0}};
+DUK_INTERNAL const duk_romstr_23 duk_str_414 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(157661616UL,703490016UL,1474254675UL),DUK__STRHASH16(47536U,26592U,22355U),23,23,NULL),{101,114,114,111,114,32,105,110,32,101,114,114,111,114,32,104,97,110,100,108,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_378 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(2469669363UL,2936855705UL,4209986414UL),DUK__STRHASH16(10739U,56473U,19310U),7,7,&duk_str_414),{101,120,116,101,110,100,115,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_18 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(798880927UL,878124386UL,3722234582UL),DUK__STRHASH16(62623U,7522U,51926U),8,8,&duk_str_378),{85,82,73,69,114,114,111,114,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_13 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4001072769UL,4262523408UL,2643733583UL),DUK__STRHASH16(34433U,61968U,11343U),9,9,&duk_str_18),{69,118,97,108,69,114,114,111,114,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_357 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(3225221184UL,1754535310UL,3679420162UL),DUK__STRHASH16(63552U,5518U,32514U),7,7,NULL),{102,105,110,97,108,108,121,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_60 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1489780632UL,3830267613UL,2833035819UL),DUK__STRHASH16(16280U,16093U,45611U),7,7,&duk_str_357),{102,111,114,69,97,99,104,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_280 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(875747934UL,1594617952UL,1652979702UL),DUK__STRHASH16(55902U,61536U,30710U),7,7,NULL),{103,101,116,73,110,116,56,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_132 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3171831768UL,4004818998UL,2790007108UL),DUK__STRHASH16(20440U,45110U,8516U),7,7,&duk_str_280),{103,101,116,89,101,97,114,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_102 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1632110851UL,1438080171UL,3918866801UL),DUK__STRHASH16(2307U,23723U,10609U),7,7,&duk_str_132),{103,101,116,68,97,116,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_97 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4248215377UL,4042325565UL,3654981410UL),DUK__STRHASH16(40785U,65085U,38690U),7,7,&duk_str_102),{103,101,116,84,105,109,101,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_265 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(926225533UL,3948313279UL,3774679327UL),DUK__STRHASH16(5245U,31423U,2335U),9,9,NULL),{73,110,116,56,65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_68 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3849109906UL,1069858348UL,3790770208UL),DUK__STRHASH16(49554U,48684U,36896U),7,7,&duk_str_265),{105,110,100,101,120,79,102,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_49 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3507461788UL,3319621501UL,3256608622UL),DUK__STRHASH16(40604U,26493U,59246U),7,7,&duk_str_68),{105,115,65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_145 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1854737628UL,3716370110UL,3411794648UL),DUK__STRHASH16(3292U,20158U,56024U),7,7,NULL),{109,101,115,115,97,103,101,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_83 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3180921360UL,3233762145UL,1186926045UL),DUK__STRHASH16(528U,19297U,3549U),9,9,&duk_str_145),{77,73,78,95,86,65,76,85,69,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_82 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2275219831UL,3782805079UL,1186936671UL),DUK__STRHASH16(6519U,1623U,14175U),9,9,&duk_str_83),{77,65,88,95,86,65,76,85,69,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_206 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1327494865UL,836162638UL,725248163UL),DUK__STRHASH16(63185U,54350U,26787U),7,7,NULL),{111,119,110,75,101,121,115,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_388 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD|DUK_HSTRING_FLAG_STRICT_RESERVED_WORD,1,DUK__STRHASH32(3853751499UL,3005192959UL,3920652110UL),DUK__STRHASH16(38091U,39679U,26446U),7,7,NULL),{112,114,105,118,97,116,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_387 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD|DUK_HSTRING_FLAG_STRICT_RESERVED_WORD,1,DUK__STRHASH32(3265972225UL,2788446309UL,3411489599UL),DUK__STRHASH16(51201U,20581U,13119U),7,7,&duk_str_388),{112,97,99,107,97,103,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_310 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3504350743UL,1307332917UL,2965080532UL),DUK__STRHASH16(9751U,20789U,35284U),7,7,&duk_str_387),{112,111,105,110,116,101,114,0}};
+DUK_INTERNAL const duk_romstr_6 duk_str_322 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(333936206UL,915078426UL,651004753UL),DUK__STRHASH16(30286U,64794U,35665U),6,5,NULL),{130U,86,97,108,117,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_72 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3726147194UL,3393549026UL,3254998255UL),DUK__STRHASH16(32378U,29410U,21743U),7,7,&duk_str_322),{114,101,112,108,97,99,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_53 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2846604905UL,4063046797UL,3901080175UL),DUK__STRHASH16(48745U,11405U,49775U),7,7,&duk_str_72),{114,101,118,101,114,115,101,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_351 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(1407985422UL,2126873555UL,2726645729UL),DUK__STRHASH16(9998U,33747U,20449U),8,8,NULL),{99,111,110,116,105,110,117,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_288 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2694311694UL,3992231128UL,1652979714UL),DUK__STRHASH16(61198U,40152U,30722U),7,7,&duk_str_351),{115,101,116,73,110,116,56,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_133 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(925420463UL,1875961882UL,2790007120UL),DUK__STRHASH16(52143U,59418U,8528U),7,7,&duk_str_288),{115,101,116,89,101,97,114,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_124 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1915654891UL,2631267274UL,3918866813UL),DUK__STRHASH16(37611U,62410U,10621U),7,7,&duk_str_133),{115,101,116,68,97,116,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_115 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(813317927UL,827392457UL,3654981422UL),DUK__STRHASH16(16167U,457U,38702U),7,7,&duk_str_124),{115,101,116,84,105,109,101,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_352 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(1956879870UL,2526504053UL,3250675169UL),DUK__STRHASH16(40446U,25717U,24033U),8,8,NULL),{100,101,98,117,103,103,101,114,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_86 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1661302925UL,3536588893UL,2068924038UL),DUK__STRHASH16(30861U,4189U,18054U),7,7,&duk_str_352),{116,111,70,105,120,101,100,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_17 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(792571712UL,3347523401UL,2643498473UL),DUK__STRHASH16(44864U,10057U,38377U),9,9,&duk_str_86),{84,121,112,101,69,114,114,111,114,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_405 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1772811948UL,1921897329UL,224417410UL),DUK__STRHASH16(63148U,54129U,22146U),8,8,NULL),{101,110,100,115,87,105,116,104,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_326 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(4190319440UL,1425787949UL,2054810233UL),DUK__STRHASH16(13136U,52269U,60025U),8,8,&duk_str_405),{101,114,114,84,104,114,111,119,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_57 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1324208499UL,569965385UL,1278934676UL),DUK__STRHASH16(53619U,64329U,65172U),7,7,&duk_str_326),{117,110,115,104,105,102,116,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_0 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(470404358UL,3157553277UL,3181226639UL),DUK__STRHASH16(52486U,28797U,43663U),9,9,&duk_str_57),{85,110,100,101,102,105,110,101,100,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_359 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD,1,DUK__STRHASH32(2087223547UL,1498829533UL,403460098UL),DUK__STRHASH16(33019U,21213U,20482U),8,8,NULL),{102,117,110,99,116,105,111,110,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_328 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3552953039UL,4232052332UL,2472673913UL),DUK__STRHASH16(49871U,65132U,633U),7,7,&duk_str_359),{118,101,114,115,105,111,110,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_309 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(320715438UL,2661239141UL,443515165UL),DUK__STRHASH16(47790U,18789U,33053U),8,8,&duk_str_328),{102,105,108,101,78,97,109,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_96 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(238800051UL,2623429097UL,3768820997UL),DUK__STRHASH16(52403U,23017U,42245U),7,7,&duk_str_309),{118,97,108,117,101,79,102,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_284 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(401505897UL,594055583UL,3341168524UL),DUK__STRHASH16(32361U,37279U,12172U),8,8,NULL),{103,101,116,73,110,116,51,50,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_282 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(494970734UL,1146770941UL,3728279950UL),DUK__STRHASH16(42862U,22013U,2446U),8,8,&duk_str_284),{103,101,116,73,110,116,49,54,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_281 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3449739636UL,1563297460UL,3454517268UL),DUK__STRHASH16(55668U,1716U,49172U),8,8,&duk_str_282),{103,101,116,85,105,110,116,56,0}};
+DUK_INTERNAL const duk_romstr_24 duk_str_202 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1295928772UL,2744963672UL,2032203300UL),DUK__STRHASH16(19908U,53848U,63012U),24,24,&duk_str_281),{103,101,116,79,119,110,80,114,111,112,101,114,116,121,68,101,115,99,114,105,112,116,111,114,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_106 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2953163108UL,108103780UL,3084444909UL),DUK__STRHASH16(45412U,34916U,58605U),8,8,&duk_str_202),{103,101,116,72,111,117,114,115,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_100 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1589630702UL,3089911113UL,447208002UL),DUK__STRHASH16(55022U,19785U,55874U),8,8,&duk_str_106),{103,101,116,77,111,110,116,104,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_427 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(970810941UL,2129816815UL,3781993510UL),DUK__STRHASH16(26173U,27887U,42022U),8,8,NULL),{105,116,101,114,97,116,111,114,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_406 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2333317358UL,3393107446UL,2818319859UL),DUK__STRHASH16(39150U,46582U,9715U),8,8,&duk_str_427),{105,110,99,108,117,100,101,115,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_270 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3948100121UL,3935072966UL,2238368045UL),DUK__STRHASH16(14873U,29382U,51501U),10,10,&duk_str_406),{73,110,116,51,50,65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_268 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2794750693UL,3023380852UL,2243039855UL),DUK__STRHASH16(33509U,8564U,4719U),10,10,&duk_str_270),{73,110,116,49,54,65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_216 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3316717783UL,416370083UL,3210319474UL),DUK__STRHASH16(6359U,19875U,38514U),8,8,&duk_str_268),{105,115,66,117,102,102,101,114,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_38 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(912749822UL,1503702125UL,1033549804UL),DUK__STRHASH16(29950U,44141U,47084U),8,8,&duk_str_216),{105,115,70,114,111,122,101,110,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_37 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2757086093UL,1510652378UL,3780898214UL),DUK__STRHASH16(52109U,47578U,60838U),8,8,&duk_str_38),{105,115,83,101,97,108,101,100,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_25 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2133145432UL,1717584813UL,1244991671UL),DUK__STRHASH16(14168U,17325U,4279U),8,8,&duk_str_37),{105,115,70,105,110,105,116,101,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_213 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3535613640UL,249286524UL,1425121933UL),DUK__STRHASH16(11976U,53116U,41613U),9,9,NULL),{95,95,112,114,111,116,111,95,95,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_22 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1227313845UL,1116247373UL,150036834UL),DUK__STRHASH16(21173U,38221U,24930U),8,8,NULL),{112,97,114,115,101,73,110,116,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_263 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1727598758UL,3258143095UL,310154552UL),DUK__STRHASH16(4262U,20855U,38200U),11,11,NULL),{65,114,114,97,121,66,117,102,102,101,114,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_192 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_EVAL_OR_ARGUMENTS,1,DUK__STRHASH32(4148211330UL,2795676742UL,1609998131UL),DUK__STRHASH16(44674U,42054U,40755U),9,9,&duk_str_263),{97,114,103,117,109,101,110,116,115,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_320 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(3244824786UL,1199315251UL,3346296731UL),DUK__STRHASH16(6354U,6451U,28571U),7,6,NULL),{130U,67,97,108,108,101,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_319 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(1757085406UL,4046449083UL,4170549063UL),DUK__STRHASH16(65246U,59835U,34631U),7,6,&duk_str_320),{130U,86,97,114,101,110,118,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_316 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(773643592UL,2621281199UL,3275480678UL),DUK__STRHASH16(56648U,37807U,56934U),7,6,&duk_str_319),{130U,83,111,117,114,99,101,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_315 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(1103256674UL,3224472937UL,217435804UL),DUK__STRHASH16(23650U,36201U,52892U),7,6,&duk_str_316),{130U,86,97,114,109,97,112,0}};
+DUK_INTERNAL const duk_romstr_7 duk_str_311 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_SYMBOL|DUK_HSTRING_FLAG_HIDDEN,1,DUK__STRHASH32(1226828991UL,1448064742UL,1237766364UL),DUK__STRHASH16(60607U,46822U,53468U),7,6,&duk_str_315),{130U,84,97,114,103,101,116,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_226 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(286267686UL,1708472973UL,3417086171UL),DUK__STRHASH16(6438U,14989U,39131U),8,8,&duk_str_311),{114,101,97,100,73,110,116,56,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_14 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3158508024UL,3226397496UL,3573214229UL),DUK__STRHASH16(504U,60216U,60437U),10,10,&duk_str_226),{82,97,110,103,101,69,114,114,111,114,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_292 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1719364768UL,1204856684UL,3341168536UL),DUK__STRHASH16(27808U,42860U,12184U),8,8,NULL),{115,101,116,73,110,116,51,50,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_290 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(966664481UL,1096964367UL,3728279962UL),DUK__STRHASH16(8481U,22799U,2458U),8,8,&duk_str_292),{115,101,116,73,110,116,49,54,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_289 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1941436233UL,4219244970UL,3454517280UL),DUK__STRHASH16(63305U,37290U,49184U),8,8,&duk_str_290),{115,101,116,85,105,110,116,56,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_279 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(989701661UL,715248977UL,503976965UL),DUK__STRHASH16(42525U,54609U,5125U),8,8,&duk_str_289),{115,117,98,97,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_198 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3501870231UL,3184075219UL,1572624098UL),DUK__STRHASH16(19607U,8659U,22242U),9,9,&duk_str_279),{99,111,110,115,116,114,117,99,116,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_126 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2921498608UL,4365354UL,447208014UL),DUK__STRHASH16(34800U,39978U,55886U),8,8,&duk_str_198),{115,101,116,77,111,110,116,104,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_122 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1554108722UL,2521627439UL,3084444921UL),DUK__STRHASH16(53554U,64303U,58617U),8,8,&duk_str_126),{115,101,116,72,111,117,114,115,0}};
+DUK_INTERNAL const duk_romstr_11 duk_str_413 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1058710163UL,592362816UL,2778729252UL),DUK__STRHASH16(41619U,48448U,2852U),11,11,NULL),{68,111,117,98,108,101,69,114,114,111,114,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_218 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2116796820UL,3872951504UL,1428811510UL),DUK__STRHASH16(49556U,36048U,61174U),8,8,&duk_str_413),{116,111,83,116,114,105,110,103,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_26 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1996970041UL,3564861332UL,1572316881UL),DUK__STRHASH16(22585U,30612U,42705U),9,9,&duk_str_218),{100,101,99,111,100,101,85,82,73,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_325 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(988779190UL,3682930389UL,414357946UL),DUK__STRHASH16(37558U,3797U,39354U),9,9,NULL),{101,114,114,67,114,101,97,116,101,0}};
+DUK_INTERNAL const duk_romstr_10 duk_str_266 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(246437439UL,2569400676UL,2247812789UL),DUK__STRHASH16(22079U,61796U,59061U),10,10,&duk_str_325),{85,105,110,116,56,65,114,114,97,121,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_31 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1860594076UL,3566856246UL,48351792UL),DUK__STRHASH16(27036U,59446U,51760U),8,8,&duk_str_266),{117,110,101,115,99,97,112,101,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_28 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(368721219UL,2069964340UL,1572317179UL),DUK__STRHASH16(15683U,9780U,43003U),9,9,&duk_str_31),{101,110,99,111,100,101,85,82,73,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_285 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3548633169UL,4208244276UL,2989032066UL),DUK__STRHASH16(55377U,46644U,642U),9,9,NULL),{103,101,116,85,105,110,116,51,50,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_283 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1620421565UL,637982242UL,2878807236UL),DUK__STRHASH16(43965U,54818U,7364U),9,9,&duk_str_285),{103,101,116,85,105,110,116,49,54,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_105 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1152587819UL,1447498291UL,2680905831UL),DUK__STRHASH16(6187U,4659U,24679U),9,9,&duk_str_283),{103,101,116,85,84,67,68,97,121,0}};
+DUK_INTERNAL const duk_romstr_8 duk_str_41 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(3659081426UL,2240571932UL,3509218486UL),DUK__STRHASH16(9938U,27164U,27830U),8,8,&duk_str_105),{119,114,105,116,97,98,108,101,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_410 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(2411168734UL,478252649UL,4181811495UL),DUK__STRHASH16(33758U,36457U,24871U),9,9,NULL),{105,115,73,110,116,101,103,101,114,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_385 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII|DUK_HSTRING_FLAG_RESERVED_WORD|DUK_HSTRING_FLAG_STRICT_RESERVED_WORD,1,DUK__STRHASH32(2624120330UL,2005312595UL,1790659662UL),DUK__STRHASH16(58890U,42067U,19534U),9,9,&duk_str_410),{105,110,116,101,114,102,97,99,101,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_140 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(98166244UL,1859536895UL,3744832393UL),DUK__STRHASH16(58852U,18431U,39817U),9,9,NULL),{108,97,115,116,73,110,100,101,120,0}};
+DUK_INTERNAL const duk_romstr_9 duk_str_139 = {DUK__STRINIT(DUK_HTYPE_STRING|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HSTRING_FLAG_PINNED_LITERAL|DUK_HSTRING_FLAG_ASCII,1,DUK__STRHASH32(1057937397UL,3438872098UL,113608656UL),DUK__STRHASH16(55285U,1570U,34768U),9,9,NULL),{109,117,108,116,105,108,105,110,101,0}};
+
+DUK_INTERNAL const duk_hstring * const duk_rom_strings_lookup[256] = {
+	(const duk_hstring *) &duk_str_143,
+	NULL,
+	(const duk_hstring *) &duk_str_217,
+	(const duk_hstring *) &duk_str_16,
+	NULL,
+	(const duk_hstring *) &duk_str_43,
+	(const duk_hstring *) &duk_str_272,
+	(const duk_hstring *) &duk_str_103,
+	NULL,
+	(const duk_hstring *) &duk_str_138,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_306,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_23,
+	NULL,
+	(const duk_hstring *) &duk_str_239,
+	(const duk_hstring *) &duk_str_118,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_98,
+	(const duk_hstring *) &duk_str_425,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_69,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_64,
+	(const duk_hstring *) &duk_str_42,
+	(const duk_hstring *) &duk_str_76,
+	NULL,
+	(const duk_hstring *) &duk_str_65,
+	(const duk_hstring *) &duk_str_257,
+	NULL,
+	(const duk_hstring *) &duk_str_205,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_211,
+	(const duk_hstring *) &duk_str_15,
+	NULL,
+	(const duk_hstring *) &duk_str_91,
+	NULL,
+	(const duk_hstring *) &duk_str_401,
+	(const duk_hstring *) &duk_str_109,
+	NULL,
+	(const duk_hstring *) &duk_str_45,
+	NULL,
+	(const duk_hstring *) &duk_str_347,
+	(const duk_hstring *) &duk_str_70,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_184,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_119,
+	(const duk_hstring *) &duk_str_87,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_99,
+	(const duk_hstring *) &duk_str_44,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_185,
+	NULL,
+	(const duk_hstring *) &duk_str_186,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_415,
+	(const duk_hstring *) &duk_str_129,
+	(const duk_hstring *) &duk_str_93,
+	(const duk_hstring *) &duk_str_146,
+	NULL,
+	(const duk_hstring *) &duk_str_112,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_189,
+	(const duk_hstring *) &duk_str_345,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_84,
+	(const duk_hstring *) &duk_str_397,
+	(const duk_hstring *) &duk_str_85,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_116,
+	(const duk_hstring *) &duk_str_34,
+	(const duk_hstring *) &duk_str_267,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_342,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_151,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_114,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_148,
+	NULL,
+	(const duk_hstring *) &duk_str_180,
+	NULL,
+	(const duk_hstring *) &duk_str_207,
+	NULL,
+	(const duk_hstring *) &duk_str_412,
+	NULL,
+	(const duk_hstring *) &duk_str_10,
+	(const duk_hstring *) &duk_str_29,
+	NULL,
+	(const duk_hstring *) &duk_str_113,
+	NULL,
+	(const duk_hstring *) &duk_str_360,
+	(const duk_hstring *) &duk_str_20,
+	NULL,
+	(const duk_hstring *) &duk_str_147,
+	(const duk_hstring *) &duk_str_19,
+	(const duk_hstring *) &duk_str_1,
+	NULL,
+	(const duk_hstring *) &duk_str_305,
+	(const duk_hstring *) &duk_str_6,
+	NULL,
+	(const duk_hstring *) &duk_str_117,
+	(const duk_hstring *) &duk_str_94,
+	(const duk_hstring *) &duk_str_12,
+	(const duk_hstring *) &duk_str_332,
+	(const duk_hstring *) &duk_str_32,
+	(const duk_hstring *) &duk_str_204,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_432,
+	(const duk_hstring *) &duk_str_149,
+	(const duk_hstring *) &duk_str_61,
+	(const duk_hstring *) &duk_str_90,
+	NULL,
+	(const duk_hstring *) &duk_str_51,
+	(const duk_hstring *) &duk_str_155,
+	(const duk_hstring *) &duk_str_48,
+	(const duk_hstring *) &duk_str_47,
+	(const duk_hstring *) &duk_str_171,
+	(const duk_hstring *) &duk_str_21,
+	(const duk_hstring *) &duk_str_221,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_329,
+	(const duk_hstring *) &duk_str_50,
+	(const duk_hstring *) &duk_str_39,
+	(const duk_hstring *) &duk_str_150,
+	NULL,
+	(const duk_hstring *) &duk_str_9,
+	(const duk_hstring *) &duk_str_4,
+	(const duk_hstring *) &duk_str_46,
+	(const duk_hstring *) &duk_str_158,
+	(const duk_hstring *) &duk_str_8,
+	(const duk_hstring *) &duk_str_2,
+	(const duk_hstring *) &duk_str_80,
+	(const duk_hstring *) &duk_str_58,
+	(const duk_hstring *) &duk_str_141,
+	(const duk_hstring *) &duk_str_374,
+	(const duk_hstring *) &duk_str_418,
+	(const duk_hstring *) &duk_str_24,
+	NULL,
+	(const duk_hstring *) &duk_str_182,
+	(const duk_hstring *) &duk_str_421,
+	(const duk_hstring *) &duk_str_71,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_172,
+	(const duk_hstring *) &duk_str_208,
+	(const duk_hstring *) &duk_str_168,
+	(const duk_hstring *) &duk_str_33,
+	(const duk_hstring *) &duk_str_264,
+	(const duk_hstring *) &duk_str_30,
+	(const duk_hstring *) &duk_str_5,
+	(const duk_hstring *) &duk_str_104,
+	NULL,
+	(const duk_hstring *) &duk_str_181,
+	NULL,
+	(const duk_hstring *) &duk_str_424,
+	(const duk_hstring *) &duk_str_277,
+	NULL,
+	(const duk_hstring *) &duk_str_175,
+	(const duk_hstring *) &duk_str_178,
+	(const duk_hstring *) &duk_str_390,
+	(const duk_hstring *) &duk_str_3,
+	(const duk_hstring *) &duk_str_63,
+	(const duk_hstring *) &duk_str_56,
+	(const duk_hstring *) &duk_str_219,
+	(const duk_hstring *) &duk_str_13,
+	(const duk_hstring *) &duk_str_60,
+	(const duk_hstring *) &duk_str_97,
+	NULL,
+	(const duk_hstring *) &duk_str_49,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_82,
+	NULL,
+	(const duk_hstring *) &duk_str_206,
+	(const duk_hstring *) &duk_str_310,
+	NULL,
+	(const duk_hstring *) &duk_str_53,
+	(const duk_hstring *) &duk_str_115,
+	(const duk_hstring *) &duk_str_17,
+	(const duk_hstring *) &duk_str_0,
+	(const duk_hstring *) &duk_str_96,
+	(const duk_hstring *) &duk_str_100,
+	NULL,
+	(const duk_hstring *) &duk_str_25,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_213,
+	(const duk_hstring *) &duk_str_22,
+	(const duk_hstring *) &duk_str_192,
+	(const duk_hstring *) &duk_str_14,
+	(const duk_hstring *) &duk_str_122,
+	(const duk_hstring *) &duk_str_26,
+	(const duk_hstring *) &duk_str_28,
+	NULL,
+	(const duk_hstring *) &duk_str_41,
+	NULL,
+	(const duk_hstring *) &duk_str_385,
+	NULL,
+	NULL,
+	(const duk_hstring *) &duk_str_140,
+	(const duk_hstring *) &duk_str_139,
+	NULL,
+	NULL,
+};
+
+DUK_INTERNAL const duk_hstring * const duk_rom_strings_stridx[167] = {
+	(const duk_hstring *) &duk_str_0,
+	(const duk_hstring *) &duk_str_1,
+	(const duk_hstring *) &duk_str_2,
+	(const duk_hstring *) &duk_str_3,
+	(const duk_hstring *) &duk_str_4,
+	(const duk_hstring *) &duk_str_5,
+	(const duk_hstring *) &duk_str_6,
+	(const duk_hstring *) &duk_str_7,
+	(const duk_hstring *) &duk_str_8,
+	(const duk_hstring *) &duk_str_9,
+	(const duk_hstring *) &duk_str_10,
+	(const duk_hstring *) &duk_str_11,
+	(const duk_hstring *) &duk_str_12,
+	(const duk_hstring *) &duk_str_19,
+	(const duk_hstring *) &duk_str_20,
+	(const duk_hstring *) &duk_str_187,
+	(const duk_hstring *) &duk_str_263,
+	(const duk_hstring *) &duk_str_264,
+	(const duk_hstring *) &duk_str_265,
+	(const duk_hstring *) &duk_str_266,
+	(const duk_hstring *) &duk_str_267,
+	(const duk_hstring *) &duk_str_268,
+	(const duk_hstring *) &duk_str_269,
+	(const duk_hstring *) &duk_str_270,
+	(const duk_hstring *) &duk_str_271,
+	(const duk_hstring *) &duk_str_272,
+	(const duk_hstring *) &duk_str_273,
+	(const duk_hstring *) &duk_str_297,
+	(const duk_hstring *) &duk_str_298,
+	(const duk_hstring *) &duk_str_299,
+	(const duk_hstring *) &duk_str_300,
+	(const duk_hstring *) &duk_str_301,
+	(const duk_hstring *) &duk_str_302,
+	(const duk_hstring *) &duk_str_21,
+	(const duk_hstring *) &duk_str_40,
+	(const duk_hstring *) &duk_str_41,
+	(const duk_hstring *) &duk_str_42,
+	(const duk_hstring *) &duk_str_43,
+	(const duk_hstring *) &duk_str_50,
+	(const duk_hstring *) &duk_str_93,
+	(const duk_hstring *) &duk_str_96,
+	(const duk_hstring *) &duk_str_130,
+	(const duk_hstring *) &duk_str_131,
+	(const duk_hstring *) &duk_str_134,
+	(const duk_hstring *) &duk_str_137,
+	(const duk_hstring *) &duk_str_138,
+	(const duk_hstring *) &duk_str_139,
+	(const duk_hstring *) &duk_str_140,
+	(const duk_hstring *) &duk_str_141,
+	(const duk_hstring *) &duk_str_142,
+	(const duk_hstring *) &duk_str_143,
+	(const duk_hstring *) &duk_str_144,
+	(const duk_hstring *) &duk_str_145,
+	(const duk_hstring *) &duk_str_174,
+	(const duk_hstring *) &duk_str_175,
+	(const duk_hstring *) &duk_str_176,
+	(const duk_hstring *) &duk_str_177,
+	(const duk_hstring *) &duk_str_178,
+	(const duk_hstring *) &duk_str_179,
+	(const duk_hstring *) &duk_str_180,
+	(const duk_hstring *) &duk_str_181,
+	(const duk_hstring *) &duk_str_183,
+	(const duk_hstring *) &duk_str_186,
+	(const duk_hstring *) &duk_str_188,
+	(const duk_hstring *) &duk_str_189,
+	(const duk_hstring *) &duk_str_190,
+	(const duk_hstring *) &duk_str_191,
+	(const duk_hstring *) &duk_str_192,
+	(const duk_hstring *) &duk_str_193,
+	(const duk_hstring *) &duk_str_194,
+	(const duk_hstring *) &duk_str_197,
+	(const duk_hstring *) &duk_str_198,
+	(const duk_hstring *) &duk_str_200,
+	(const duk_hstring *) &duk_str_201,
+	(const duk_hstring *) &duk_str_204,
+	(const duk_hstring *) &duk_str_206,
+	(const duk_hstring *) &duk_str_208,
+	(const duk_hstring *) &duk_str_209,
+	(const duk_hstring *) &duk_str_210,
+	(const duk_hstring *) &duk_str_211,
+	(const duk_hstring *) &duk_str_212,
+	(const duk_hstring *) &duk_str_213,
+	(const duk_hstring *) &duk_str_218,
+	(const duk_hstring *) &duk_str_219,
+	(const duk_hstring *) &duk_str_261,
+	(const duk_hstring *) &duk_str_262,
+	(const duk_hstring *) &duk_str_276,
+	(const duk_hstring *) &duk_str_277,
+	(const duk_hstring *) &duk_str_278,
+	(const duk_hstring *) &duk_str_304,
+	(const duk_hstring *) &duk_str_305,
+	(const duk_hstring *) &duk_str_306,
+	(const duk_hstring *) &duk_str_307,
+	(const duk_hstring *) &duk_str_308,
+	(const duk_hstring *) &duk_str_309,
+	(const duk_hstring *) &duk_str_310,
+	(const duk_hstring *) &duk_str_311,
+	(const duk_hstring *) &duk_str_312,
+	(const duk_hstring *) &duk_str_313,
+	(const duk_hstring *) &duk_str_314,
+	(const duk_hstring *) &duk_str_315,
+	(const duk_hstring *) &duk_str_316,
+	(const duk_hstring *) &duk_str_317,
+	(const duk_hstring *) &duk_str_318,
+	(const duk_hstring *) &duk_str_319,
+	(const duk_hstring *) &duk_str_321,
+	(const duk_hstring *) &duk_str_322,
+	(const duk_hstring *) &duk_str_323,
+	(const duk_hstring *) &duk_str_324,
+	(const duk_hstring *) &duk_str_325,
+	(const duk_hstring *) &duk_str_326,
+	(const duk_hstring *) &duk_str_327,
+	(const duk_hstring *) &duk_str_336,
+	(const duk_hstring *) &duk_str_337,
+	(const duk_hstring *) &duk_str_338,
+	(const duk_hstring *) &duk_str_339,
+	(const duk_hstring *) &duk_str_342,
+	(const duk_hstring *) &duk_str_343,
+	(const duk_hstring *) &duk_str_344,
+	(const duk_hstring *) &duk_str_345,
+	(const duk_hstring *) &duk_str_346,
+	(const duk_hstring *) &duk_str_347,
+	(const duk_hstring *) &duk_str_348,
+	(const duk_hstring *) &duk_str_349,
+	(const duk_hstring *) &duk_str_350,
+	(const duk_hstring *) &duk_str_351,
+	(const duk_hstring *) &duk_str_352,
+	(const duk_hstring *) &duk_str_353,
+	(const duk_hstring *) &duk_str_354,
+	(const duk_hstring *) &duk_str_355,
+	(const duk_hstring *) &duk_str_356,
+	(const duk_hstring *) &duk_str_357,
+	(const duk_hstring *) &duk_str_358,
+	(const duk_hstring *) &duk_str_359,
+	(const duk_hstring *) &duk_str_360,
+	(const duk_hstring *) &duk_str_361,
+	(const duk_hstring *) &duk_str_362,
+	(const duk_hstring *) &duk_str_363,
+	(const duk_hstring *) &duk_str_364,
+	(const duk_hstring *) &duk_str_365,
+	(const duk_hstring *) &duk_str_366,
+	(const duk_hstring *) &duk_str_367,
+	(const duk_hstring *) &duk_str_368,
+	(const duk_hstring *) &duk_str_369,
+	(const duk_hstring *) &duk_str_370,
+	(const duk_hstring *) &duk_str_371,
+	(const duk_hstring *) &duk_str_372,
+	(const duk_hstring *) &duk_str_373,
+	(const duk_hstring *) &duk_str_374,
+	(const duk_hstring *) &duk_str_375,
+	(const duk_hstring *) &duk_str_376,
+	(const duk_hstring *) &duk_str_377,
+	(const duk_hstring *) &duk_str_378,
+	(const duk_hstring *) &duk_str_379,
+	(const duk_hstring *) &duk_str_380,
+	(const duk_hstring *) &duk_str_381,
+	(const duk_hstring *) &duk_str_382,
+	(const duk_hstring *) &duk_str_383,
+	(const duk_hstring *) &duk_str_384,
+	(const duk_hstring *) &duk_str_385,
+	(const duk_hstring *) &duk_str_386,
+	(const duk_hstring *) &duk_str_387,
+	(const duk_hstring *) &duk_str_388,
+	(const duk_hstring *) &duk_str_389,
+	(const duk_hstring *) &duk_str_390,
+	(const duk_hstring *) &duk_str_391,
+	(const duk_hstring *) &duk_str_392,
+};
+typedef struct duk_romobj duk_romobj; struct duk_romobj { duk_hobject hdr; };
+typedef struct duk_romarr duk_romarr; struct duk_romarr { duk_harray hdr; };
+typedef struct duk_romfun duk_romfun; struct duk_romfun { duk_hnatfunc hdr; };
+typedef struct duk_romobjenv duk_romobjenv; struct duk_romobjenv { duk_hobjenv hdr; };
+#if defined(DUK_USE_HEAPPTR16)
+#if !defined(DUK_USE_REFCOUNT16) || defined(DUK_USE_HOBJECT_HASH_PART)
+#error currently assumes DUK_USE_HEAPPTR16 and DUK_USE_REFCOUNT16 are both defined and DUK_USE_HOBJECT_HASH_PART is undefined
+#endif
+#define DUK__ROMOBJ_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize) \
+	{ { { (heaphdr_flags), DUK__REFCINIT((refcount)), 0, 0, (props_enc16) }, (iproto_enc16), (esize), (enext), (asize) } }
+#define DUK__ROMARR_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize,length) \
+	{ { { { (heaphdr_flags), DUK__REFCINIT((refcount)), 0, 0, (props_enc16) }, (iproto_enc16), (esize), (enext), (asize) }, (length), 0 /*length_nonwritable*/ } }
+#define DUK__ROMFUN_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize,nativefunc,nargs,magic) \
+	{ { { { (heaphdr_flags), DUK__REFCINIT((refcount)), 0, 0, (props_enc16) }, (iproto_enc16), (esize), (enext), (asize) }, (nativefunc), (duk_int16_t) (nargs), (duk_int16_t) (magic) } }
+#define DUK__ROMOBJENV_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize,target,has_this) \
+	{ { { { (heaphdr_flags), DUK__REFCINIT((refcount)), 0, 0, (props_enc16) }, (iproto_enc16), (esize), (enext), (asize) }, (duk_hobject *) DUK_LOSE_CONST(target), (has_this) } }
+#else  /* DUK_USE_HEAPPTR16 */
+#define DUK__ROMOBJ_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize) \
+	{ { { (heaphdr_flags), DUK__REFCINIT((refcount)), NULL, NULL }, (duk_uint8_t *) DUK_LOSE_CONST(props), (duk_hobject *) DUK_LOSE_CONST(iproto), (esize), (enext), (asize), (hsize) } }
+#define DUK__ROMARR_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize,length) \
+	{ { { { (heaphdr_flags), DUK__REFCINIT((refcount)), NULL, NULL }, (duk_uint8_t *) DUK_LOSE_CONST(props), (duk_hobject *) DUK_LOSE_CONST(iproto), (esize), (enext), (asize), (hsize) }, (length), 0 /*length_nonwritable*/ } }
+#define DUK__ROMFUN_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize,nativefunc,nargs,magic) \
+	{ { { { (heaphdr_flags), DUK__REFCINIT((refcount)), NULL, NULL }, (duk_uint8_t *) DUK_LOSE_CONST(props), (duk_hobject *) DUK_LOSE_CONST(iproto), (esize), (enext), (asize), (hsize) }, (nativefunc), (duk_int16_t) (nargs), (duk_int16_t) (magic) } }
+#define DUK__ROMOBJENV_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize,target,has_this) \
+	{ { { { (heaphdr_flags), DUK__REFCINIT((refcount)), NULL, NULL }, (duk_uint8_t *) DUK_LOSE_CONST(props), (duk_hobject *) DUK_LOSE_CONST(iproto), (esize), (enext), (asize), (hsize) }, (duk_hobject *) DUK_LOSE_CONST(target), (has_this) } }
+#endif  /* DUK_USE_HEAPPTR16 */
+typedef void (*duk_rom_funcptr)(void);
+#if defined(DUK_USE_PACKED_TVAL)
+typedef struct duk_rom_tval_undefined duk_rom_tval_undefined;
+typedef struct duk_rom_tval_null duk_rom_tval_null;
+typedef struct duk_rom_tval_lightfunc duk_rom_tval_lightfunc;
+typedef struct duk_rom_tval_boolean duk_rom_tval_boolean;
+typedef struct duk_rom_tval_number duk_rom_tval_number;
+typedef struct duk_rom_tval_object duk_rom_tval_object;
+typedef struct duk_rom_tval_string duk_rom_tval_string;
+typedef struct duk_rom_tval_accessor duk_rom_tval_accessor;
+struct duk_rom_tval_number { duk_uint8_t bytes[8]; };
+struct duk_rom_tval_accessor { const duk_hobject *get; const duk_hobject *set; };
+#if defined(DUK_USE_DOUBLE_LE)
+struct duk_rom_tval_object { const void *ptr; duk_uint32_t hiword; };
+struct duk_rom_tval_string { const void *ptr; duk_uint32_t hiword; };
+struct duk_rom_tval_undefined { const void *ptr; duk_uint32_t hiword; };
+struct duk_rom_tval_null { const void *ptr; duk_uint32_t hiword; };
+struct duk_rom_tval_lightfunc { duk_rom_funcptr ptr; duk_uint32_t hiword; };
+struct duk_rom_tval_boolean { duk_uint32_t dummy; duk_uint32_t hiword; };
+#elif defined(DUK_USE_DOUBLE_BE)
+struct duk_rom_tval_object { duk_uint32_t hiword; const void *ptr; };
+struct duk_rom_tval_string { duk_uint32_t hiword; const void *ptr; };
+struct duk_rom_tval_undefined { duk_uint32_t hiword; const void *ptr; };
+struct duk_rom_tval_null { duk_uint32_t hiword; const void *ptr; };
+struct duk_rom_tval_lightfunc { duk_uint32_t hiword; duk_rom_funcptr ptr; };
+struct duk_rom_tval_boolean { duk_uint32_t hiword; duk_uint32_t dummy; };
+#elif defined(DUK_USE_DOUBLE_ME)
+struct duk_rom_tval_object { duk_uint32_t hiword; const void *ptr; };
+struct duk_rom_tval_string { duk_uint32_t hiword; const void *ptr; };
+struct duk_rom_tval_undefined { duk_uint32_t hiword; const void *ptr; };
+struct duk_rom_tval_null { duk_uint32_t hiword; const void *ptr; };
+struct duk_rom_tval_lightfunc { duk_uint32_t hiword; duk_rom_funcptr ptr; };
+struct duk_rom_tval_boolean { duk_uint32_t hiword; duk_uint32_t dummy; };
+#else
+#error invalid endianness defines
+#endif
+#else  /* DUK_USE_PACKED_TVAL */
+#if defined(DUK_UINTPTR_MAX)
+#if (DUK_UINTPTR_MAX <= 0xffffffffUL)
+#error ROM initializer with unpacked duk_tval does not currently work on 32-bit targets
+#endif
+#endif
+typedef struct duk_rom_tval_undefined duk_rom_tval_undefined;
+struct duk_rom_tval_undefined { duk_small_uint_t tag; duk_small_uint_t extra; duk_uint8_t bytes[8]; };
+typedef struct duk_rom_tval_null duk_rom_tval_null;
+struct duk_rom_tval_null { duk_small_uint_t tag; duk_small_uint_t extra; duk_uint8_t bytes[8]; };
+typedef struct duk_rom_tval_boolean duk_rom_tval_boolean;
+struct duk_rom_tval_boolean { duk_small_uint_t tag; duk_small_uint_t extra; duk_uint32_t val; duk_uint32_t unused; };
+typedef struct duk_rom_tval_number duk_rom_tval_number;
+struct duk_rom_tval_number { duk_small_uint_t tag; duk_small_uint_t extra; duk_uint8_t bytes[8]; };
+typedef struct duk_rom_tval_object duk_rom_tval_object;
+struct duk_rom_tval_object { duk_small_uint_t tag; duk_small_uint_t extra; const duk_heaphdr *val; };
+typedef struct duk_rom_tval_string duk_rom_tval_string;
+struct duk_rom_tval_string { duk_small_uint_t tag; duk_small_uint_t extra; const duk_heaphdr *val; };
+typedef struct duk_rom_tval_lightfunc duk_rom_tval_lightfunc;
+struct duk_rom_tval_lightfunc { duk_small_uint_t tag; duk_small_uint_t extra; duk_rom_funcptr ptr; };
+typedef struct duk_rom_tval_accessor duk_rom_tval_accessor;
+struct duk_rom_tval_accessor { const duk_hobject *get; const duk_hobject *set; };
+#endif  /* DUK_USE_PACKED_TVAL */
+
+#if defined(DUK_USE_DOUBLE_LE)
+#define DUK__DBLBYTES(a,b,c,d,e,f,g,h) { (h), (g), (f), (e), (d), (c), (b), (a) }
+#elif defined(DUK_USE_DOUBLE_BE)
+#define DUK__DBLBYTES(a,b,c,d,e,f,g,h) { (a), (b), (c), (d), (e), (f), (g), (h) }
+#elif defined(DUK_USE_DOUBLE_ME)
+#define DUK__DBLBYTES(a,b,c,d,e,f,g,h) { (d), (c), (b), (a), (h), (g), (f), (e) }
+#else
+#error invalid endianness defines
+#endif
+
+#if defined(DUK_USE_PACKED_TVAL)
+#define DUK__TVAL_NUMBER(hostbytes) { hostbytes }
+#if defined(DUK_USE_DOUBLE_LE)
+#define DUK__TVAL_UNDEFINED() { (const void *) NULL, (DUK_TAG_UNDEFINED << 16) }
+#define DUK__TVAL_NULL() { (const void *) NULL, (DUK_TAG_NULL << 16) }
+#define DUK__TVAL_LIGHTFUNC(func,flags) { (duk_rom_funcptr) (func), (DUK_TAG_LIGHTFUNC << 16) + (flags) }
+#define DUK__TVAL_BOOLEAN(bval) { 0, (DUK_TAG_BOOLEAN << 16) + (bval) }
+#define DUK__TVAL_OBJECT(ptr) { (const void *) (ptr), (DUK_TAG_OBJECT << 16) }
+#define DUK__TVAL_STRING(ptr) { (const void *) (ptr), (DUK_TAG_STRING << 16) }
+#elif defined(DUK_USE_DOUBLE_BE)
+#define DUK__TVAL_UNDEFINED() { (DUK_TAG_UNDEFINED << 16), (const void *) NULL }
+#define DUK__TVAL_NULL() { (DUK_TAG_NULL << 16), (const void *) NULL }
+#define DUK__TVAL_LIGHTFUNC(func,flags) { (DUK_TAG_LIGHTFUNC << 16) + (flags), (duk_rom_funcptr) (func) }
+#define DUK__TVAL_BOOLEAN(bval) { (DUK_TAG_BOOLEAN << 16) + (bval), 0 }
+#define DUK__TVAL_OBJECT(ptr) { (DUK_TAG_OBJECT << 16), (const void *) (ptr) }
+#define DUK__TVAL_STRING(ptr) { (DUK_TAG_STRING << 16), (const void *) (ptr) }
+#elif defined(DUK_USE_DOUBLE_ME)
+#define DUK__TVAL_UNDEFINED() { (DUK_TAG_UNDEFINED << 16), (const void *) NULL }
+#define DUK__TVAL_NULL() { (DUK_TAG_NULL << 16), (const void *) NULL }
+#define DUK__TVAL_LIGHTFUNC(func,flags) { (DUK_TAG_LIGHTFUNC << 16) + (flags), (duk_rom_funcptr) (func) }
+#define DUK__TVAL_BOOLEAN(bval) { (DUK_TAG_BOOLEAN << 16) + (bval), 0 }
+#define DUK__TVAL_OBJECT(ptr) { (DUK_TAG_OBJECT << 16), (const void *) (ptr) }
+#define DUK__TVAL_STRING(ptr) { (DUK_TAG_STRING << 16), (const void *) (ptr) }
+#else
+#error invalid endianness defines
+#endif
+#else  /* DUK_USE_PACKED_TVAL */
+#define DUK__TVAL_NUMBER(hostbytes) { DUK_TAG_NUMBER, 0, hostbytes }
+#define DUK__TVAL_UNDEFINED() { DUK_TAG_UNDEFINED, 0, {0,0,0,0,0,0,0,0} }
+#define DUK__TVAL_NULL() { DUK_TAG_NULL, 0, {0,0,0,0,0,0,0,0} }
+#define DUK__TVAL_BOOLEAN(bval) { DUK_TAG_BOOLEAN, 0, (bval), 0 }
+#define DUK__TVAL_OBJECT(ptr) { DUK_TAG_OBJECT, 0, (const duk_heaphdr *) (ptr) }
+#define DUK__TVAL_STRING(ptr) { DUK_TAG_STRING, 0, (const duk_heaphdr *) (ptr) }
+#define DUK__TVAL_LIGHTFUNC(func,flags) { DUK_TAG_LIGHTFUNC, (flags), (duk_rom_funcptr) (func) }
+#endif  /* DUK_USE_PACKED_TVAL */
+#define DUK__TVAL_ACCESSOR(getter,setter) { (const duk_hobject *) (getter), (const duk_hobject *) (setter) }
+#if defined(DUK_USE_HOBJECT_LAYOUT_1)
+typedef struct duk_romprops_0 duk_romprops_0; struct duk_romprops_0 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; const duk_hstring *key27; const duk_hstring *key28; const duk_hstring *key29; const duk_hstring *key30; const duk_hstring *key31; const duk_hstring *key32; const duk_hstring *key33; duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_number val2; duk_rom_tval_undefined val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; duk_rom_tval_object val27; duk_rom_tval_object val28; duk_rom_tval_object val29; duk_rom_tval_object val30; duk_rom_tval_object val31; duk_rom_tval_object val32; duk_rom_tval_object val33; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; duk_uint8_t flags27; duk_uint8_t flags28; duk_uint8_t flags29; duk_uint8_t flags30; duk_uint8_t flags31; duk_uint8_t flags32; duk_uint8_t flags33; };
+typedef struct duk_romprops_2 duk_romprops_2; struct duk_romprops_2 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; };
+typedef struct duk_romprops_3 duk_romprops_3; struct duk_romprops_3 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; duk_rom_tval_object val0; duk_rom_tval_accessor val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; };
+typedef struct duk_romprops_4 duk_romprops_4; struct duk_romprops_4 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_5 duk_romprops_5; struct duk_romprops_5 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; };
+typedef struct duk_romprops_6 duk_romprops_6; struct duk_romprops_6 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_accessor val0; duk_rom_tval_accessor val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_7 duk_romprops_7; struct duk_romprops_7 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; };
+typedef struct duk_romprops_8 duk_romprops_8; struct duk_romprops_8 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; duk_rom_tval_object val0; duk_rom_tval_object val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; };
+typedef struct duk_romprops_9 duk_romprops_9; struct duk_romprops_9 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; };
+typedef struct duk_romprops_10 duk_romprops_10; struct duk_romprops_10 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; };
+typedef struct duk_romprops_11 duk_romprops_11; struct duk_romprops_11 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_12 duk_romprops_12; struct duk_romprops_12 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; duk_rom_tval_object val0; duk_rom_tval_boolean val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; };
+typedef struct duk_romprops_13 duk_romprops_13; struct duk_romprops_13 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_number val3; duk_rom_tval_number val4; duk_rom_tval_number val5; duk_rom_tval_number val6; duk_rom_tval_number val7; duk_rom_tval_number val8; duk_rom_tval_number val9; duk_rom_tval_number val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; };
+typedef struct duk_romprops_14 duk_romprops_14; struct duk_romprops_14 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; };
+typedef struct duk_romprops_15 duk_romprops_15; struct duk_romprops_15 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; };
+typedef struct duk_romprops_16 duk_romprops_16; struct duk_romprops_16 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; const duk_hstring *key27; const duk_hstring *key28; const duk_hstring *key29; const duk_hstring *key30; const duk_hstring *key31; const duk_hstring *key32; const duk_hstring *key33; const duk_hstring *key34; const duk_hstring *key35; const duk_hstring *key36; const duk_hstring *key37; const duk_hstring *key38; const duk_hstring *key39; const duk_hstring *key40; const duk_hstring *key41; const duk_hstring *key42; const duk_hstring *key43; const duk_hstring *key44; const duk_hstring *key45; const duk_hstring *key46; const duk_hstring *key47; const duk_hstring *key48; duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; duk_rom_tval_object val27; duk_rom_tval_object val28; duk_rom_tval_object val29; duk_rom_tval_object val30; duk_rom_tval_object val31; duk_rom_tval_object val32; duk_rom_tval_object val33; duk_rom_tval_object val34; duk_rom_tval_object val35; duk_rom_tval_object val36; duk_rom_tval_object val37; duk_rom_tval_object val38; duk_rom_tval_object val39; duk_rom_tval_object val40; duk_rom_tval_object val41; duk_rom_tval_object val42; duk_rom_tval_object val43; duk_rom_tval_object val44; duk_rom_tval_object val45; duk_rom_tval_object val46; duk_rom_tval_object val47; duk_rom_tval_object val48; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; duk_uint8_t flags27; duk_uint8_t flags28; duk_uint8_t flags29; duk_uint8_t flags30; duk_uint8_t flags31; duk_uint8_t flags32; duk_uint8_t flags33; duk_uint8_t flags34; duk_uint8_t flags35; duk_uint8_t flags36; duk_uint8_t flags37; duk_uint8_t flags38; duk_uint8_t flags39; duk_uint8_t flags40; duk_uint8_t flags41; duk_uint8_t flags42; duk_uint8_t flags43; duk_uint8_t flags44; duk_uint8_t flags45; duk_uint8_t flags46; duk_uint8_t flags47; duk_uint8_t flags48; };
+typedef struct duk_romprops_17 duk_romprops_17; struct duk_romprops_17 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_18 duk_romprops_18; struct duk_romprops_18 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_accessor val5; duk_rom_tval_accessor val6; duk_rom_tval_accessor val7; duk_rom_tval_accessor val8; duk_rom_tval_accessor val9; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; };
+typedef struct duk_romprops_19 duk_romprops_19; struct duk_romprops_19 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_20 duk_romprops_20; struct duk_romprops_20 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; duk_rom_tval_accessor val3; duk_rom_tval_accessor val4; duk_rom_tval_accessor val5; duk_rom_tval_object val6; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; };
+typedef struct duk_romprops_21 duk_romprops_21; struct duk_romprops_21 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_22 duk_romprops_22; struct duk_romprops_22 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_23 duk_romprops_23; struct duk_romprops_23 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_24 duk_romprops_24; struct duk_romprops_24 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_25 duk_romprops_25; struct duk_romprops_25 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_26 duk_romprops_26; struct duk_romprops_26 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_27 duk_romprops_27; struct duk_romprops_27 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_28 duk_romprops_28; struct duk_romprops_28 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_29 duk_romprops_29; struct duk_romprops_29 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_30 duk_romprops_30; struct duk_romprops_30 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_31 duk_romprops_31; struct duk_romprops_31 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_32 duk_romprops_32; struct duk_romprops_32 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_33 duk_romprops_33; struct duk_romprops_33 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_34 duk_romprops_34; struct duk_romprops_34 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; duk_rom_tval_string val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; };
+typedef struct duk_romprops_36 duk_romprops_36; struct duk_romprops_36 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_object val0; duk_rom_tval_object val1; duk_rom_tval_object val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_37 duk_romprops_37; struct duk_romprops_37 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_string val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_38 duk_romprops_38; struct duk_romprops_38 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; duk_rom_tval_object val0; duk_rom_tval_object val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_string val4; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; };
+typedef struct duk_romprops_39 duk_romprops_39; struct duk_romprops_39 { const duk_hstring *key0; duk_rom_tval_number val0; duk_uint8_t flags0; };
+typedef struct duk_romprops_40 duk_romprops_40; struct duk_romprops_40 { const duk_hstring *key0; duk_rom_tval_number val0; duk_uint8_t flags0; };
+typedef struct duk_romprops_41 duk_romprops_41; struct duk_romprops_41 { const duk_hstring *key0; duk_rom_tval_number val0; duk_uint8_t flags0; };
+typedef struct duk_romprops_42 duk_romprops_42; struct duk_romprops_42 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; const duk_hstring *key27; const duk_hstring *key28; const duk_hstring *key29; const duk_hstring *key30; const duk_hstring *key31; const duk_hstring *key32; const duk_hstring *key33; const duk_hstring *key34; duk_rom_tval_number val0; duk_rom_tval_number val1; duk_rom_tval_number val2; duk_rom_tval_number val3; duk_rom_tval_number val4; duk_rom_tval_number val5; duk_rom_tval_number val6; duk_rom_tval_number val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; duk_rom_tval_object val27; duk_rom_tval_object val28; duk_rom_tval_object val29; duk_rom_tval_object val30; duk_rom_tval_object val31; duk_rom_tval_object val32; duk_rom_tval_object val33; duk_rom_tval_string val34; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; duk_uint8_t flags27; duk_uint8_t flags28; duk_uint8_t flags29; duk_uint8_t flags30; duk_uint8_t flags31; duk_uint8_t flags32; duk_uint8_t flags33; duk_uint8_t flags34; };
+typedef struct duk_romprops_43 duk_romprops_43; struct duk_romprops_43 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_object val0; duk_rom_tval_object val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_44 duk_romprops_44; struct duk_romprops_44 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_45 duk_romprops_45; struct duk_romprops_45 { const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_string val5; duk_rom_tval_string val6; duk_rom_tval_string val7; duk_rom_tval_string val8; duk_rom_tval_string val9; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; };
+typedef struct duk_romprops_46 duk_romprops_46; struct duk_romprops_46 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_accessor val0; duk_rom_tval_accessor val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_47 duk_romprops_47; struct duk_romprops_47 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_48 duk_romprops_48; struct duk_romprops_48 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_49 duk_romprops_49; struct duk_romprops_49 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_50 duk_romprops_50; struct duk_romprops_50 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_51 duk_romprops_51; struct duk_romprops_51 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_52 duk_romprops_52; struct duk_romprops_52 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_53 duk_romprops_53; struct duk_romprops_53 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_54 duk_romprops_54; struct duk_romprops_54 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_55 duk_romprops_55; struct duk_romprops_55 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_56 duk_romprops_56; struct duk_romprops_56 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_57 duk_romprops_57; struct duk_romprops_57 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_58 duk_romprops_58; struct duk_romprops_58 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_59 duk_romprops_59; struct duk_romprops_59 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_60 duk_romprops_60; struct duk_romprops_60 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_61 duk_romprops_61; struct duk_romprops_61 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_62 duk_romprops_62; struct duk_romprops_62 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_63 duk_romprops_63; struct duk_romprops_63 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_64 duk_romprops_64; struct duk_romprops_64 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_65 duk_romprops_65; struct duk_romprops_65 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_66 duk_romprops_66; struct duk_romprops_66 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_67 duk_romprops_67; struct duk_romprops_67 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_68 duk_romprops_68; struct duk_romprops_68 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_69 duk_romprops_69; struct duk_romprops_69 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_70 duk_romprops_70; struct duk_romprops_70 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_71 duk_romprops_71; struct duk_romprops_71 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_72 duk_romprops_72; struct duk_romprops_72 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_75 duk_romprops_75; struct duk_romprops_75 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_76 duk_romprops_76; struct duk_romprops_76 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_77 duk_romprops_77; struct duk_romprops_77 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_78 duk_romprops_78; struct duk_romprops_78 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_79 duk_romprops_79; struct duk_romprops_79 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_80 duk_romprops_80; struct duk_romprops_80 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_81 duk_romprops_81; struct duk_romprops_81 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_82 duk_romprops_82; struct duk_romprops_82 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_83 duk_romprops_83; struct duk_romprops_83 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_84 duk_romprops_84; struct duk_romprops_84 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_85 duk_romprops_85; struct duk_romprops_85 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_86 duk_romprops_86; struct duk_romprops_86 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_87 duk_romprops_87; struct duk_romprops_87 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_88 duk_romprops_88; struct duk_romprops_88 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_89 duk_romprops_89; struct duk_romprops_89 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_92 duk_romprops_92; struct duk_romprops_92 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_93 duk_romprops_93; struct duk_romprops_93 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_94 duk_romprops_94; struct duk_romprops_94 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_95 duk_romprops_95; struct duk_romprops_95 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_96 duk_romprops_96; struct duk_romprops_96 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_97 duk_romprops_97; struct duk_romprops_97 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_98 duk_romprops_98; struct duk_romprops_98 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_99 duk_romprops_99; struct duk_romprops_99 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_100 duk_romprops_100; struct duk_romprops_100 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_101 duk_romprops_101; struct duk_romprops_101 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_102 duk_romprops_102; struct duk_romprops_102 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_103 duk_romprops_103; struct duk_romprops_103 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_104 duk_romprops_104; struct duk_romprops_104 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_105 duk_romprops_105; struct duk_romprops_105 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_106 duk_romprops_106; struct duk_romprops_106 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_107 duk_romprops_107; struct duk_romprops_107 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_108 duk_romprops_108; struct duk_romprops_108 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_109 duk_romprops_109; struct duk_romprops_109 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_110 duk_romprops_110; struct duk_romprops_110 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_111 duk_romprops_111; struct duk_romprops_111 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_112 duk_romprops_112; struct duk_romprops_112 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_113 duk_romprops_113; struct duk_romprops_113 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_114 duk_romprops_114; struct duk_romprops_114 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_115 duk_romprops_115; struct duk_romprops_115 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_116 duk_romprops_116; struct duk_romprops_116 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_117 duk_romprops_117; struct duk_romprops_117 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_118 duk_romprops_118; struct duk_romprops_118 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_119 duk_romprops_119; struct duk_romprops_119 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_120 duk_romprops_120; struct duk_romprops_120 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_121 duk_romprops_121; struct duk_romprops_121 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_122 duk_romprops_122; struct duk_romprops_122 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_123 duk_romprops_123; struct duk_romprops_123 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_124 duk_romprops_124; struct duk_romprops_124 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_125 duk_romprops_125; struct duk_romprops_125 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_126 duk_romprops_126; struct duk_romprops_126 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_127 duk_romprops_127; struct duk_romprops_127 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_128 duk_romprops_128; struct duk_romprops_128 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_129 duk_romprops_129; struct duk_romprops_129 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_130 duk_romprops_130; struct duk_romprops_130 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_131 duk_romprops_131; struct duk_romprops_131 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_132 duk_romprops_132; struct duk_romprops_132 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_133 duk_romprops_133; struct duk_romprops_133 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_134 duk_romprops_134; struct duk_romprops_134 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_135 duk_romprops_135; struct duk_romprops_135 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_136 duk_romprops_136; struct duk_romprops_136 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_137 duk_romprops_137; struct duk_romprops_137 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_138 duk_romprops_138; struct duk_romprops_138 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_139 duk_romprops_139; struct duk_romprops_139 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_140 duk_romprops_140; struct duk_romprops_140 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_141 duk_romprops_141; struct duk_romprops_141 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_142 duk_romprops_142; struct duk_romprops_142 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_143 duk_romprops_143; struct duk_romprops_143 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_144 duk_romprops_144; struct duk_romprops_144 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_145 duk_romprops_145; struct duk_romprops_145 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_146 duk_romprops_146; struct duk_romprops_146 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_147 duk_romprops_147; struct duk_romprops_147 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_148 duk_romprops_148; struct duk_romprops_148 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_149 duk_romprops_149; struct duk_romprops_149 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_150 duk_romprops_150; struct duk_romprops_150 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_151 duk_romprops_151; struct duk_romprops_151 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_152 duk_romprops_152; struct duk_romprops_152 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_153 duk_romprops_153; struct duk_romprops_153 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_154 duk_romprops_154; struct duk_romprops_154 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_155 duk_romprops_155; struct duk_romprops_155 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_156 duk_romprops_156; struct duk_romprops_156 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_157 duk_romprops_157; struct duk_romprops_157 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_158 duk_romprops_158; struct duk_romprops_158 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_159 duk_romprops_159; struct duk_romprops_159 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_160 duk_romprops_160; struct duk_romprops_160 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_161 duk_romprops_161; struct duk_romprops_161 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_162 duk_romprops_162; struct duk_romprops_162 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_163 duk_romprops_163; struct duk_romprops_163 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_164 duk_romprops_164; struct duk_romprops_164 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_165 duk_romprops_165; struct duk_romprops_165 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_166 duk_romprops_166; struct duk_romprops_166 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_167 duk_romprops_167; struct duk_romprops_167 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_168 duk_romprops_168; struct duk_romprops_168 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_169 duk_romprops_169; struct duk_romprops_169 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_170 duk_romprops_170; struct duk_romprops_170 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_171 duk_romprops_171; struct duk_romprops_171 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_172 duk_romprops_172; struct duk_romprops_172 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_173 duk_romprops_173; struct duk_romprops_173 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_174 duk_romprops_174; struct duk_romprops_174 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_175 duk_romprops_175; struct duk_romprops_175 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_176 duk_romprops_176; struct duk_romprops_176 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_177 duk_romprops_177; struct duk_romprops_177 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_178 duk_romprops_178; struct duk_romprops_178 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_179 duk_romprops_179; struct duk_romprops_179 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_180 duk_romprops_180; struct duk_romprops_180 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_181 duk_romprops_181; struct duk_romprops_181 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_182 duk_romprops_182; struct duk_romprops_182 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_183 duk_romprops_183; struct duk_romprops_183 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_184 duk_romprops_184; struct duk_romprops_184 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_185 duk_romprops_185; struct duk_romprops_185 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_186 duk_romprops_186; struct duk_romprops_186 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_187 duk_romprops_187; struct duk_romprops_187 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_188 duk_romprops_188; struct duk_romprops_188 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_189 duk_romprops_189; struct duk_romprops_189 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_190 duk_romprops_190; struct duk_romprops_190 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_191 duk_romprops_191; struct duk_romprops_191 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_192 duk_romprops_192; struct duk_romprops_192 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_193 duk_romprops_193; struct duk_romprops_193 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_194 duk_romprops_194; struct duk_romprops_194 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_195 duk_romprops_195; struct duk_romprops_195 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_196 duk_romprops_196; struct duk_romprops_196 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_197 duk_romprops_197; struct duk_romprops_197 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_198 duk_romprops_198; struct duk_romprops_198 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_199 duk_romprops_199; struct duk_romprops_199 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_200 duk_romprops_200; struct duk_romprops_200 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_201 duk_romprops_201; struct duk_romprops_201 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_202 duk_romprops_202; struct duk_romprops_202 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_203 duk_romprops_203; struct duk_romprops_203 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_204 duk_romprops_204; struct duk_romprops_204 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_216 duk_romprops_216; struct duk_romprops_216 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_217 duk_romprops_217; struct duk_romprops_217 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_218 duk_romprops_218; struct duk_romprops_218 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_219 duk_romprops_219; struct duk_romprops_219 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_220 duk_romprops_220; struct duk_romprops_220 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_221 duk_romprops_221; struct duk_romprops_221 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_222 duk_romprops_222; struct duk_romprops_222 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_223 duk_romprops_223; struct duk_romprops_223 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_224 duk_romprops_224; struct duk_romprops_224 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_225 duk_romprops_225; struct duk_romprops_225 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_226 duk_romprops_226; struct duk_romprops_226 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_227 duk_romprops_227; struct duk_romprops_227 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_228 duk_romprops_228; struct duk_romprops_228 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_229 duk_romprops_229; struct duk_romprops_229 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_230 duk_romprops_230; struct duk_romprops_230 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_231 duk_romprops_231; struct duk_romprops_231 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_232 duk_romprops_232; struct duk_romprops_232 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_233 duk_romprops_233; struct duk_romprops_233 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_234 duk_romprops_234; struct duk_romprops_234 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_235 duk_romprops_235; struct duk_romprops_235 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_236 duk_romprops_236; struct duk_romprops_236 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_237 duk_romprops_237; struct duk_romprops_237 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_238 duk_romprops_238; struct duk_romprops_238 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_239 duk_romprops_239; struct duk_romprops_239 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_240 duk_romprops_240; struct duk_romprops_240 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_241 duk_romprops_241; struct duk_romprops_241 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_242 duk_romprops_242; struct duk_romprops_242 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_243 duk_romprops_243; struct duk_romprops_243 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_244 duk_romprops_244; struct duk_romprops_244 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_245 duk_romprops_245; struct duk_romprops_245 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_246 duk_romprops_246; struct duk_romprops_246 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_247 duk_romprops_247; struct duk_romprops_247 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_248 duk_romprops_248; struct duk_romprops_248 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_249 duk_romprops_249; struct duk_romprops_249 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_250 duk_romprops_250; struct duk_romprops_250 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_251 duk_romprops_251; struct duk_romprops_251 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_252 duk_romprops_252; struct duk_romprops_252 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_253 duk_romprops_253; struct duk_romprops_253 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_254 duk_romprops_254; struct duk_romprops_254 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_255 duk_romprops_255; struct duk_romprops_255 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_256 duk_romprops_256; struct duk_romprops_256 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_257 duk_romprops_257; struct duk_romprops_257 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_258 duk_romprops_258; struct duk_romprops_258 { const duk_hstring *key0; const duk_hstring *key1; duk_rom_tval_number val0; duk_rom_tval_string val1; duk_uint8_t flags0; duk_uint8_t flags1; };
+#elif defined(DUK_USE_HOBJECT_LAYOUT_2)
+typedef struct duk_romprops_0 duk_romprops_0; struct duk_romprops_0 { duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_number val2; duk_rom_tval_undefined val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; duk_rom_tval_object val27; duk_rom_tval_object val28; duk_rom_tval_object val29; duk_rom_tval_object val30; duk_rom_tval_object val31; duk_rom_tval_object val32; duk_rom_tval_object val33; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; const duk_hstring *key27; const duk_hstring *key28; const duk_hstring *key29; const duk_hstring *key30; const duk_hstring *key31; const duk_hstring *key32; const duk_hstring *key33; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; duk_uint8_t flags27; duk_uint8_t flags28; duk_uint8_t flags29; duk_uint8_t flags30; duk_uint8_t flags31; duk_uint8_t flags32; duk_uint8_t flags33; };
+typedef struct duk_romprops_2 duk_romprops_2; struct duk_romprops_2 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; };
+typedef struct duk_romprops_3 duk_romprops_3; struct duk_romprops_3 { duk_rom_tval_object val0; duk_rom_tval_accessor val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; };
+typedef struct duk_romprops_4 duk_romprops_4; struct duk_romprops_4 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_5 duk_romprops_5; struct duk_romprops_5 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; };
+typedef struct duk_romprops_6 duk_romprops_6; struct duk_romprops_6 { duk_rom_tval_accessor val0; duk_rom_tval_accessor val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_7 duk_romprops_7; struct duk_romprops_7 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; };
+typedef struct duk_romprops_8 duk_romprops_8; struct duk_romprops_8 { duk_rom_tval_object val0; duk_rom_tval_object val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; };
+typedef struct duk_romprops_9 duk_romprops_9; struct duk_romprops_9 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; };
+typedef struct duk_romprops_10 duk_romprops_10; struct duk_romprops_10 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; };
+typedef struct duk_romprops_11 duk_romprops_11; struct duk_romprops_11 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_12 duk_romprops_12; struct duk_romprops_12 { duk_rom_tval_object val0; duk_rom_tval_boolean val1; duk_rom_tval_object val2; duk_rom_tval_object val3; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; };
+typedef struct duk_romprops_13 duk_romprops_13; struct duk_romprops_13 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_number val3; duk_rom_tval_number val4; duk_rom_tval_number val5; duk_rom_tval_number val6; duk_rom_tval_number val7; duk_rom_tval_number val8; duk_rom_tval_number val9; duk_rom_tval_number val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; };
+typedef struct duk_romprops_14 duk_romprops_14; struct duk_romprops_14 { duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; };
+typedef struct duk_romprops_15 duk_romprops_15; struct duk_romprops_15 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; };
+typedef struct duk_romprops_16 duk_romprops_16; struct duk_romprops_16 { duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; duk_rom_tval_object val27; duk_rom_tval_object val28; duk_rom_tval_object val29; duk_rom_tval_object val30; duk_rom_tval_object val31; duk_rom_tval_object val32; duk_rom_tval_object val33; duk_rom_tval_object val34; duk_rom_tval_object val35; duk_rom_tval_object val36; duk_rom_tval_object val37; duk_rom_tval_object val38; duk_rom_tval_object val39; duk_rom_tval_object val40; duk_rom_tval_object val41; duk_rom_tval_object val42; duk_rom_tval_object val43; duk_rom_tval_object val44; duk_rom_tval_object val45; duk_rom_tval_object val46; duk_rom_tval_object val47; duk_rom_tval_object val48; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; const duk_hstring *key27; const duk_hstring *key28; const duk_hstring *key29; const duk_hstring *key30; const duk_hstring *key31; const duk_hstring *key32; const duk_hstring *key33; const duk_hstring *key34; const duk_hstring *key35; const duk_hstring *key36; const duk_hstring *key37; const duk_hstring *key38; const duk_hstring *key39; const duk_hstring *key40; const duk_hstring *key41; const duk_hstring *key42; const duk_hstring *key43; const duk_hstring *key44; const duk_hstring *key45; const duk_hstring *key46; const duk_hstring *key47; const duk_hstring *key48; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; duk_uint8_t flags27; duk_uint8_t flags28; duk_uint8_t flags29; duk_uint8_t flags30; duk_uint8_t flags31; duk_uint8_t flags32; duk_uint8_t flags33; duk_uint8_t flags34; duk_uint8_t flags35; duk_uint8_t flags36; duk_uint8_t flags37; duk_uint8_t flags38; duk_uint8_t flags39; duk_uint8_t flags40; duk_uint8_t flags41; duk_uint8_t flags42; duk_uint8_t flags43; duk_uint8_t flags44; duk_uint8_t flags45; duk_uint8_t flags46; duk_uint8_t flags47; duk_uint8_t flags48; };
+typedef struct duk_romprops_17 duk_romprops_17; struct duk_romprops_17 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_18 duk_romprops_18; struct duk_romprops_18 { duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_accessor val5; duk_rom_tval_accessor val6; duk_rom_tval_accessor val7; duk_rom_tval_accessor val8; duk_rom_tval_accessor val9; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; };
+typedef struct duk_romprops_19 duk_romprops_19; struct duk_romprops_19 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_20 duk_romprops_20; struct duk_romprops_20 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; duk_rom_tval_accessor val3; duk_rom_tval_accessor val4; duk_rom_tval_accessor val5; duk_rom_tval_object val6; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; };
+typedef struct duk_romprops_21 duk_romprops_21; struct duk_romprops_21 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_22 duk_romprops_22; struct duk_romprops_22 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_23 duk_romprops_23; struct duk_romprops_23 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_24 duk_romprops_24; struct duk_romprops_24 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_25 duk_romprops_25; struct duk_romprops_25 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_26 duk_romprops_26; struct duk_romprops_26 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_27 duk_romprops_27; struct duk_romprops_27 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_28 duk_romprops_28; struct duk_romprops_28 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_29 duk_romprops_29; struct duk_romprops_29 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_30 duk_romprops_30; struct duk_romprops_30 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_31 duk_romprops_31; struct duk_romprops_31 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_32 duk_romprops_32; struct duk_romprops_32 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_33 duk_romprops_33; struct duk_romprops_33 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_34 duk_romprops_34; struct duk_romprops_34 { duk_rom_tval_string val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; };
+typedef struct duk_romprops_36 duk_romprops_36; struct duk_romprops_36 { duk_rom_tval_object val0; duk_rom_tval_object val1; duk_rom_tval_object val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_37 duk_romprops_37; struct duk_romprops_37 { duk_rom_tval_string val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_38 duk_romprops_38; struct duk_romprops_38 { duk_rom_tval_object val0; duk_rom_tval_object val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_string val4; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; };
+typedef struct duk_romprops_39 duk_romprops_39; struct duk_romprops_39 { duk_rom_tval_number val0; const duk_hstring *key0; duk_uint8_t flags0; };
+typedef struct duk_romprops_40 duk_romprops_40; struct duk_romprops_40 { duk_rom_tval_number val0; const duk_hstring *key0; duk_uint8_t flags0; };
+typedef struct duk_romprops_41 duk_romprops_41; struct duk_romprops_41 { duk_rom_tval_number val0; const duk_hstring *key0; duk_uint8_t flags0; };
+typedef struct duk_romprops_42 duk_romprops_42; struct duk_romprops_42 { duk_rom_tval_number val0; duk_rom_tval_number val1; duk_rom_tval_number val2; duk_rom_tval_number val3; duk_rom_tval_number val4; duk_rom_tval_number val5; duk_rom_tval_number val6; duk_rom_tval_number val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; duk_rom_tval_object val27; duk_rom_tval_object val28; duk_rom_tval_object val29; duk_rom_tval_object val30; duk_rom_tval_object val31; duk_rom_tval_object val32; duk_rom_tval_object val33; duk_rom_tval_string val34; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; const duk_hstring *key27; const duk_hstring *key28; const duk_hstring *key29; const duk_hstring *key30; const duk_hstring *key31; const duk_hstring *key32; const duk_hstring *key33; const duk_hstring *key34; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; duk_uint8_t flags27; duk_uint8_t flags28; duk_uint8_t flags29; duk_uint8_t flags30; duk_uint8_t flags31; duk_uint8_t flags32; duk_uint8_t flags33; duk_uint8_t flags34; };
+typedef struct duk_romprops_43 duk_romprops_43; struct duk_romprops_43 { duk_rom_tval_object val0; duk_rom_tval_object val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_44 duk_romprops_44; struct duk_romprops_44 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_45 duk_romprops_45; struct duk_romprops_45 { duk_rom_tval_number val0; duk_rom_tval_string val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_string val5; duk_rom_tval_string val6; duk_rom_tval_string val7; duk_rom_tval_string val8; duk_rom_tval_string val9; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; };
+typedef struct duk_romprops_46 duk_romprops_46; struct duk_romprops_46 { duk_rom_tval_accessor val0; duk_rom_tval_accessor val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_47 duk_romprops_47; struct duk_romprops_47 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_48 duk_romprops_48; struct duk_romprops_48 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_49 duk_romprops_49; struct duk_romprops_49 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_50 duk_romprops_50; struct duk_romprops_50 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_51 duk_romprops_51; struct duk_romprops_51 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_52 duk_romprops_52; struct duk_romprops_52 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_53 duk_romprops_53; struct duk_romprops_53 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_54 duk_romprops_54; struct duk_romprops_54 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_55 duk_romprops_55; struct duk_romprops_55 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_56 duk_romprops_56; struct duk_romprops_56 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_57 duk_romprops_57; struct duk_romprops_57 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_58 duk_romprops_58; struct duk_romprops_58 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_59 duk_romprops_59; struct duk_romprops_59 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_60 duk_romprops_60; struct duk_romprops_60 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_61 duk_romprops_61; struct duk_romprops_61 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_62 duk_romprops_62; struct duk_romprops_62 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_63 duk_romprops_63; struct duk_romprops_63 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_64 duk_romprops_64; struct duk_romprops_64 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_65 duk_romprops_65; struct duk_romprops_65 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_66 duk_romprops_66; struct duk_romprops_66 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_67 duk_romprops_67; struct duk_romprops_67 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_68 duk_romprops_68; struct duk_romprops_68 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_69 duk_romprops_69; struct duk_romprops_69 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_70 duk_romprops_70; struct duk_romprops_70 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_71 duk_romprops_71; struct duk_romprops_71 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_72 duk_romprops_72; struct duk_romprops_72 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_75 duk_romprops_75; struct duk_romprops_75 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_76 duk_romprops_76; struct duk_romprops_76 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_77 duk_romprops_77; struct duk_romprops_77 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_78 duk_romprops_78; struct duk_romprops_78 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_79 duk_romprops_79; struct duk_romprops_79 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_80 duk_romprops_80; struct duk_romprops_80 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_81 duk_romprops_81; struct duk_romprops_81 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_82 duk_romprops_82; struct duk_romprops_82 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_83 duk_romprops_83; struct duk_romprops_83 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_84 duk_romprops_84; struct duk_romprops_84 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_85 duk_romprops_85; struct duk_romprops_85 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_86 duk_romprops_86; struct duk_romprops_86 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_87 duk_romprops_87; struct duk_romprops_87 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_88 duk_romprops_88; struct duk_romprops_88 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_89 duk_romprops_89; struct duk_romprops_89 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_92 duk_romprops_92; struct duk_romprops_92 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_93 duk_romprops_93; struct duk_romprops_93 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_94 duk_romprops_94; struct duk_romprops_94 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_95 duk_romprops_95; struct duk_romprops_95 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_96 duk_romprops_96; struct duk_romprops_96 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_97 duk_romprops_97; struct duk_romprops_97 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_98 duk_romprops_98; struct duk_romprops_98 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_99 duk_romprops_99; struct duk_romprops_99 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_100 duk_romprops_100; struct duk_romprops_100 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_101 duk_romprops_101; struct duk_romprops_101 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_102 duk_romprops_102; struct duk_romprops_102 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_103 duk_romprops_103; struct duk_romprops_103 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_104 duk_romprops_104; struct duk_romprops_104 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_105 duk_romprops_105; struct duk_romprops_105 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_106 duk_romprops_106; struct duk_romprops_106 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_107 duk_romprops_107; struct duk_romprops_107 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_108 duk_romprops_108; struct duk_romprops_108 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_109 duk_romprops_109; struct duk_romprops_109 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_110 duk_romprops_110; struct duk_romprops_110 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_111 duk_romprops_111; struct duk_romprops_111 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_112 duk_romprops_112; struct duk_romprops_112 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_113 duk_romprops_113; struct duk_romprops_113 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_114 duk_romprops_114; struct duk_romprops_114 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_115 duk_romprops_115; struct duk_romprops_115 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_116 duk_romprops_116; struct duk_romprops_116 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_117 duk_romprops_117; struct duk_romprops_117 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_118 duk_romprops_118; struct duk_romprops_118 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_119 duk_romprops_119; struct duk_romprops_119 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_120 duk_romprops_120; struct duk_romprops_120 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_121 duk_romprops_121; struct duk_romprops_121 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_122 duk_romprops_122; struct duk_romprops_122 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_123 duk_romprops_123; struct duk_romprops_123 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_124 duk_romprops_124; struct duk_romprops_124 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_125 duk_romprops_125; struct duk_romprops_125 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_126 duk_romprops_126; struct duk_romprops_126 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_127 duk_romprops_127; struct duk_romprops_127 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_128 duk_romprops_128; struct duk_romprops_128 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_129 duk_romprops_129; struct duk_romprops_129 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_130 duk_romprops_130; struct duk_romprops_130 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_131 duk_romprops_131; struct duk_romprops_131 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_132 duk_romprops_132; struct duk_romprops_132 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_133 duk_romprops_133; struct duk_romprops_133 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_134 duk_romprops_134; struct duk_romprops_134 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_135 duk_romprops_135; struct duk_romprops_135 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_136 duk_romprops_136; struct duk_romprops_136 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_137 duk_romprops_137; struct duk_romprops_137 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_138 duk_romprops_138; struct duk_romprops_138 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_139 duk_romprops_139; struct duk_romprops_139 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_140 duk_romprops_140; struct duk_romprops_140 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_141 duk_romprops_141; struct duk_romprops_141 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_142 duk_romprops_142; struct duk_romprops_142 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_143 duk_romprops_143; struct duk_romprops_143 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_144 duk_romprops_144; struct duk_romprops_144 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_145 duk_romprops_145; struct duk_romprops_145 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_146 duk_romprops_146; struct duk_romprops_146 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_147 duk_romprops_147; struct duk_romprops_147 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_148 duk_romprops_148; struct duk_romprops_148 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_149 duk_romprops_149; struct duk_romprops_149 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_150 duk_romprops_150; struct duk_romprops_150 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_151 duk_romprops_151; struct duk_romprops_151 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_152 duk_romprops_152; struct duk_romprops_152 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_153 duk_romprops_153; struct duk_romprops_153 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_154 duk_romprops_154; struct duk_romprops_154 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_155 duk_romprops_155; struct duk_romprops_155 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_156 duk_romprops_156; struct duk_romprops_156 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_157 duk_romprops_157; struct duk_romprops_157 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_158 duk_romprops_158; struct duk_romprops_158 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_159 duk_romprops_159; struct duk_romprops_159 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_160 duk_romprops_160; struct duk_romprops_160 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_161 duk_romprops_161; struct duk_romprops_161 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_162 duk_romprops_162; struct duk_romprops_162 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_163 duk_romprops_163; struct duk_romprops_163 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_164 duk_romprops_164; struct duk_romprops_164 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_165 duk_romprops_165; struct duk_romprops_165 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_166 duk_romprops_166; struct duk_romprops_166 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_167 duk_romprops_167; struct duk_romprops_167 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_168 duk_romprops_168; struct duk_romprops_168 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_169 duk_romprops_169; struct duk_romprops_169 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_170 duk_romprops_170; struct duk_romprops_170 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_171 duk_romprops_171; struct duk_romprops_171 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_172 duk_romprops_172; struct duk_romprops_172 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_173 duk_romprops_173; struct duk_romprops_173 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_174 duk_romprops_174; struct duk_romprops_174 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_175 duk_romprops_175; struct duk_romprops_175 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_176 duk_romprops_176; struct duk_romprops_176 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_177 duk_romprops_177; struct duk_romprops_177 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_178 duk_romprops_178; struct duk_romprops_178 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_179 duk_romprops_179; struct duk_romprops_179 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_180 duk_romprops_180; struct duk_romprops_180 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_181 duk_romprops_181; struct duk_romprops_181 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_182 duk_romprops_182; struct duk_romprops_182 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_183 duk_romprops_183; struct duk_romprops_183 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_184 duk_romprops_184; struct duk_romprops_184 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_185 duk_romprops_185; struct duk_romprops_185 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_186 duk_romprops_186; struct duk_romprops_186 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_187 duk_romprops_187; struct duk_romprops_187 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_188 duk_romprops_188; struct duk_romprops_188 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_189 duk_romprops_189; struct duk_romprops_189 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_190 duk_romprops_190; struct duk_romprops_190 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_191 duk_romprops_191; struct duk_romprops_191 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_192 duk_romprops_192; struct duk_romprops_192 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_193 duk_romprops_193; struct duk_romprops_193 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_194 duk_romprops_194; struct duk_romprops_194 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_195 duk_romprops_195; struct duk_romprops_195 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_196 duk_romprops_196; struct duk_romprops_196 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_197 duk_romprops_197; struct duk_romprops_197 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_198 duk_romprops_198; struct duk_romprops_198 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_199 duk_romprops_199; struct duk_romprops_199 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_200 duk_romprops_200; struct duk_romprops_200 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_201 duk_romprops_201; struct duk_romprops_201 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_202 duk_romprops_202; struct duk_romprops_202 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_203 duk_romprops_203; struct duk_romprops_203 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_204 duk_romprops_204; struct duk_romprops_204 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_216 duk_romprops_216; struct duk_romprops_216 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_217 duk_romprops_217; struct duk_romprops_217 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_218 duk_romprops_218; struct duk_romprops_218 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_219 duk_romprops_219; struct duk_romprops_219 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_220 duk_romprops_220; struct duk_romprops_220 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_221 duk_romprops_221; struct duk_romprops_221 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_222 duk_romprops_222; struct duk_romprops_222 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_223 duk_romprops_223; struct duk_romprops_223 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_224 duk_romprops_224; struct duk_romprops_224 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_225 duk_romprops_225; struct duk_romprops_225 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_226 duk_romprops_226; struct duk_romprops_226 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_227 duk_romprops_227; struct duk_romprops_227 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_228 duk_romprops_228; struct duk_romprops_228 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_229 duk_romprops_229; struct duk_romprops_229 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_230 duk_romprops_230; struct duk_romprops_230 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_231 duk_romprops_231; struct duk_romprops_231 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_232 duk_romprops_232; struct duk_romprops_232 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_233 duk_romprops_233; struct duk_romprops_233 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_234 duk_romprops_234; struct duk_romprops_234 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_235 duk_romprops_235; struct duk_romprops_235 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_236 duk_romprops_236; struct duk_romprops_236 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_237 duk_romprops_237; struct duk_romprops_237 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_238 duk_romprops_238; struct duk_romprops_238 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_239 duk_romprops_239; struct duk_romprops_239 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_240 duk_romprops_240; struct duk_romprops_240 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_241 duk_romprops_241; struct duk_romprops_241 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_242 duk_romprops_242; struct duk_romprops_242 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_243 duk_romprops_243; struct duk_romprops_243 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_244 duk_romprops_244; struct duk_romprops_244 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_245 duk_romprops_245; struct duk_romprops_245 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_246 duk_romprops_246; struct duk_romprops_246 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_247 duk_romprops_247; struct duk_romprops_247 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_248 duk_romprops_248; struct duk_romprops_248 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_249 duk_romprops_249; struct duk_romprops_249 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_250 duk_romprops_250; struct duk_romprops_250 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_251 duk_romprops_251; struct duk_romprops_251 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_252 duk_romprops_252; struct duk_romprops_252 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_253 duk_romprops_253; struct duk_romprops_253 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_254 duk_romprops_254; struct duk_romprops_254 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_255 duk_romprops_255; struct duk_romprops_255 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_256 duk_romprops_256; struct duk_romprops_256 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_257 duk_romprops_257; struct duk_romprops_257 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_258 duk_romprops_258; struct duk_romprops_258 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+#elif defined(DUK_USE_HOBJECT_LAYOUT_3)
+typedef struct duk_romprops_0 duk_romprops_0; struct duk_romprops_0 { duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_number val2; duk_rom_tval_undefined val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; duk_rom_tval_object val27; duk_rom_tval_object val28; duk_rom_tval_object val29; duk_rom_tval_object val30; duk_rom_tval_object val31; duk_rom_tval_object val32; duk_rom_tval_object val33; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; const duk_hstring *key27; const duk_hstring *key28; const duk_hstring *key29; const duk_hstring *key30; const duk_hstring *key31; const duk_hstring *key32; const duk_hstring *key33; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; duk_uint8_t flags27; duk_uint8_t flags28; duk_uint8_t flags29; duk_uint8_t flags30; duk_uint8_t flags31; duk_uint8_t flags32; duk_uint8_t flags33; };
+typedef struct duk_romprops_2 duk_romprops_2; struct duk_romprops_2 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; };
+typedef struct duk_romprops_3 duk_romprops_3; struct duk_romprops_3 { duk_rom_tval_object val0; duk_rom_tval_accessor val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; };
+typedef struct duk_romprops_4 duk_romprops_4; struct duk_romprops_4 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_5 duk_romprops_5; struct duk_romprops_5 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; };
+typedef struct duk_romprops_6 duk_romprops_6; struct duk_romprops_6 { duk_rom_tval_accessor val0; duk_rom_tval_accessor val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_7 duk_romprops_7; struct duk_romprops_7 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; };
+typedef struct duk_romprops_8 duk_romprops_8; struct duk_romprops_8 { duk_rom_tval_object val0; duk_rom_tval_object val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; };
+typedef struct duk_romprops_9 duk_romprops_9; struct duk_romprops_9 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; };
+typedef struct duk_romprops_10 duk_romprops_10; struct duk_romprops_10 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; };
+typedef struct duk_romprops_11 duk_romprops_11; struct duk_romprops_11 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_12 duk_romprops_12; struct duk_romprops_12 { duk_rom_tval_object val0; duk_rom_tval_boolean val1; duk_rom_tval_object val2; duk_rom_tval_object val3; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; };
+typedef struct duk_romprops_13 duk_romprops_13; struct duk_romprops_13 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_number val3; duk_rom_tval_number val4; duk_rom_tval_number val5; duk_rom_tval_number val6; duk_rom_tval_number val7; duk_rom_tval_number val8; duk_rom_tval_number val9; duk_rom_tval_number val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; };
+typedef struct duk_romprops_14 duk_romprops_14; struct duk_romprops_14 { duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; };
+typedef struct duk_romprops_15 duk_romprops_15; struct duk_romprops_15 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; };
+typedef struct duk_romprops_16 duk_romprops_16; struct duk_romprops_16 { duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; duk_rom_tval_object val27; duk_rom_tval_object val28; duk_rom_tval_object val29; duk_rom_tval_object val30; duk_rom_tval_object val31; duk_rom_tval_object val32; duk_rom_tval_object val33; duk_rom_tval_object val34; duk_rom_tval_object val35; duk_rom_tval_object val36; duk_rom_tval_object val37; duk_rom_tval_object val38; duk_rom_tval_object val39; duk_rom_tval_object val40; duk_rom_tval_object val41; duk_rom_tval_object val42; duk_rom_tval_object val43; duk_rom_tval_object val44; duk_rom_tval_object val45; duk_rom_tval_object val46; duk_rom_tval_object val47; duk_rom_tval_object val48; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; const duk_hstring *key27; const duk_hstring *key28; const duk_hstring *key29; const duk_hstring *key30; const duk_hstring *key31; const duk_hstring *key32; const duk_hstring *key33; const duk_hstring *key34; const duk_hstring *key35; const duk_hstring *key36; const duk_hstring *key37; const duk_hstring *key38; const duk_hstring *key39; const duk_hstring *key40; const duk_hstring *key41; const duk_hstring *key42; const duk_hstring *key43; const duk_hstring *key44; const duk_hstring *key45; const duk_hstring *key46; const duk_hstring *key47; const duk_hstring *key48; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; duk_uint8_t flags27; duk_uint8_t flags28; duk_uint8_t flags29; duk_uint8_t flags30; duk_uint8_t flags31; duk_uint8_t flags32; duk_uint8_t flags33; duk_uint8_t flags34; duk_uint8_t flags35; duk_uint8_t flags36; duk_uint8_t flags37; duk_uint8_t flags38; duk_uint8_t flags39; duk_uint8_t flags40; duk_uint8_t flags41; duk_uint8_t flags42; duk_uint8_t flags43; duk_uint8_t flags44; duk_uint8_t flags45; duk_uint8_t flags46; duk_uint8_t flags47; duk_uint8_t flags48; };
+typedef struct duk_romprops_17 duk_romprops_17; struct duk_romprops_17 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_18 duk_romprops_18; struct duk_romprops_18 { duk_rom_tval_object val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_accessor val5; duk_rom_tval_accessor val6; duk_rom_tval_accessor val7; duk_rom_tval_accessor val8; duk_rom_tval_accessor val9; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; };
+typedef struct duk_romprops_19 duk_romprops_19; struct duk_romprops_19 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_20 duk_romprops_20; struct duk_romprops_20 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; duk_rom_tval_accessor val3; duk_rom_tval_accessor val4; duk_rom_tval_accessor val5; duk_rom_tval_object val6; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; };
+typedef struct duk_romprops_21 duk_romprops_21; struct duk_romprops_21 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_22 duk_romprops_22; struct duk_romprops_22 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_23 duk_romprops_23; struct duk_romprops_23 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_24 duk_romprops_24; struct duk_romprops_24 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_25 duk_romprops_25; struct duk_romprops_25 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_26 duk_romprops_26; struct duk_romprops_26 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_27 duk_romprops_27; struct duk_romprops_27 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_28 duk_romprops_28; struct duk_romprops_28 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_29 duk_romprops_29; struct duk_romprops_29 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_30 duk_romprops_30; struct duk_romprops_30 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_31 duk_romprops_31; struct duk_romprops_31 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_32 duk_romprops_32; struct duk_romprops_32 { duk_rom_tval_object val0; duk_rom_tval_string val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_33 duk_romprops_33; struct duk_romprops_33 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_34 duk_romprops_34; struct duk_romprops_34 { duk_rom_tval_string val0; duk_rom_tval_number val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_object val5; duk_rom_tval_object val6; duk_rom_tval_object val7; duk_rom_tval_object val8; duk_rom_tval_object val9; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; };
+typedef struct duk_romprops_36 duk_romprops_36; struct duk_romprops_36 { duk_rom_tval_object val0; duk_rom_tval_object val1; duk_rom_tval_object val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_37 duk_romprops_37; struct duk_romprops_37 { duk_rom_tval_string val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_38 duk_romprops_38; struct duk_romprops_38 { duk_rom_tval_object val0; duk_rom_tval_object val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_string val4; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; };
+typedef struct duk_romprops_39 duk_romprops_39; struct duk_romprops_39 { duk_rom_tval_number val0; const duk_hstring *key0; duk_uint8_t flags0; };
+typedef struct duk_romprops_40 duk_romprops_40; struct duk_romprops_40 { duk_rom_tval_number val0; const duk_hstring *key0; duk_uint8_t flags0; };
+typedef struct duk_romprops_41 duk_romprops_41; struct duk_romprops_41 { duk_rom_tval_number val0; const duk_hstring *key0; duk_uint8_t flags0; };
+typedef struct duk_romprops_42 duk_romprops_42; struct duk_romprops_42 { duk_rom_tval_number val0; duk_rom_tval_number val1; duk_rom_tval_number val2; duk_rom_tval_number val3; duk_rom_tval_number val4; duk_rom_tval_number val5; duk_rom_tval_number val6; duk_rom_tval_number val7; duk_rom_tval_object val8; duk_rom_tval_object val9; duk_rom_tval_object val10; duk_rom_tval_object val11; duk_rom_tval_object val12; duk_rom_tval_object val13; duk_rom_tval_object val14; duk_rom_tval_object val15; duk_rom_tval_object val16; duk_rom_tval_object val17; duk_rom_tval_object val18; duk_rom_tval_object val19; duk_rom_tval_object val20; duk_rom_tval_object val21; duk_rom_tval_object val22; duk_rom_tval_object val23; duk_rom_tval_object val24; duk_rom_tval_object val25; duk_rom_tval_object val26; duk_rom_tval_object val27; duk_rom_tval_object val28; duk_rom_tval_object val29; duk_rom_tval_object val30; duk_rom_tval_object val31; duk_rom_tval_object val32; duk_rom_tval_object val33; duk_rom_tval_string val34; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; const duk_hstring *key10; const duk_hstring *key11; const duk_hstring *key12; const duk_hstring *key13; const duk_hstring *key14; const duk_hstring *key15; const duk_hstring *key16; const duk_hstring *key17; const duk_hstring *key18; const duk_hstring *key19; const duk_hstring *key20; const duk_hstring *key21; const duk_hstring *key22; const duk_hstring *key23; const duk_hstring *key24; const duk_hstring *key25; const duk_hstring *key26; const duk_hstring *key27; const duk_hstring *key28; const duk_hstring *key29; const duk_hstring *key30; const duk_hstring *key31; const duk_hstring *key32; const duk_hstring *key33; const duk_hstring *key34; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; duk_uint8_t flags10; duk_uint8_t flags11; duk_uint8_t flags12; duk_uint8_t flags13; duk_uint8_t flags14; duk_uint8_t flags15; duk_uint8_t flags16; duk_uint8_t flags17; duk_uint8_t flags18; duk_uint8_t flags19; duk_uint8_t flags20; duk_uint8_t flags21; duk_uint8_t flags22; duk_uint8_t flags23; duk_uint8_t flags24; duk_uint8_t flags25; duk_uint8_t flags26; duk_uint8_t flags27; duk_uint8_t flags28; duk_uint8_t flags29; duk_uint8_t flags30; duk_uint8_t flags31; duk_uint8_t flags32; duk_uint8_t flags33; duk_uint8_t flags34; };
+typedef struct duk_romprops_43 duk_romprops_43; struct duk_romprops_43 { duk_rom_tval_object val0; duk_rom_tval_object val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_44 duk_romprops_44; struct duk_romprops_44 { duk_rom_tval_number val0; duk_rom_tval_object val1; duk_rom_tval_string val2; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; };
+typedef struct duk_romprops_45 duk_romprops_45; struct duk_romprops_45 { duk_rom_tval_number val0; duk_rom_tval_string val1; duk_rom_tval_object val2; duk_rom_tval_object val3; duk_rom_tval_object val4; duk_rom_tval_string val5; duk_rom_tval_string val6; duk_rom_tval_string val7; duk_rom_tval_string val8; duk_rom_tval_string val9; const duk_hstring *key0; const duk_hstring *key1; const duk_hstring *key2; const duk_hstring *key3; const duk_hstring *key4; const duk_hstring *key5; const duk_hstring *key6; const duk_hstring *key7; const duk_hstring *key8; const duk_hstring *key9; duk_uint8_t flags0; duk_uint8_t flags1; duk_uint8_t flags2; duk_uint8_t flags3; duk_uint8_t flags4; duk_uint8_t flags5; duk_uint8_t flags6; duk_uint8_t flags7; duk_uint8_t flags8; duk_uint8_t flags9; };
+typedef struct duk_romprops_46 duk_romprops_46; struct duk_romprops_46 { duk_rom_tval_accessor val0; duk_rom_tval_accessor val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_47 duk_romprops_47; struct duk_romprops_47 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_48 duk_romprops_48; struct duk_romprops_48 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_49 duk_romprops_49; struct duk_romprops_49 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_50 duk_romprops_50; struct duk_romprops_50 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_51 duk_romprops_51; struct duk_romprops_51 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_52 duk_romprops_52; struct duk_romprops_52 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_53 duk_romprops_53; struct duk_romprops_53 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_54 duk_romprops_54; struct duk_romprops_54 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_55 duk_romprops_55; struct duk_romprops_55 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_56 duk_romprops_56; struct duk_romprops_56 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_57 duk_romprops_57; struct duk_romprops_57 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_58 duk_romprops_58; struct duk_romprops_58 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_59 duk_romprops_59; struct duk_romprops_59 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_60 duk_romprops_60; struct duk_romprops_60 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_61 duk_romprops_61; struct duk_romprops_61 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_62 duk_romprops_62; struct duk_romprops_62 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_63 duk_romprops_63; struct duk_romprops_63 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_64 duk_romprops_64; struct duk_romprops_64 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_65 duk_romprops_65; struct duk_romprops_65 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_66 duk_romprops_66; struct duk_romprops_66 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_67 duk_romprops_67; struct duk_romprops_67 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_68 duk_romprops_68; struct duk_romprops_68 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_69 duk_romprops_69; struct duk_romprops_69 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_70 duk_romprops_70; struct duk_romprops_70 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_71 duk_romprops_71; struct duk_romprops_71 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_72 duk_romprops_72; struct duk_romprops_72 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_75 duk_romprops_75; struct duk_romprops_75 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_76 duk_romprops_76; struct duk_romprops_76 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_77 duk_romprops_77; struct duk_romprops_77 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_78 duk_romprops_78; struct duk_romprops_78 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_79 duk_romprops_79; struct duk_romprops_79 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_80 duk_romprops_80; struct duk_romprops_80 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_81 duk_romprops_81; struct duk_romprops_81 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_82 duk_romprops_82; struct duk_romprops_82 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_83 duk_romprops_83; struct duk_romprops_83 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_84 duk_romprops_84; struct duk_romprops_84 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_85 duk_romprops_85; struct duk_romprops_85 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_86 duk_romprops_86; struct duk_romprops_86 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_87 duk_romprops_87; struct duk_romprops_87 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_88 duk_romprops_88; struct duk_romprops_88 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_89 duk_romprops_89; struct duk_romprops_89 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_92 duk_romprops_92; struct duk_romprops_92 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_93 duk_romprops_93; struct duk_romprops_93 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_94 duk_romprops_94; struct duk_romprops_94 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_95 duk_romprops_95; struct duk_romprops_95 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_96 duk_romprops_96; struct duk_romprops_96 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_97 duk_romprops_97; struct duk_romprops_97 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_98 duk_romprops_98; struct duk_romprops_98 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_99 duk_romprops_99; struct duk_romprops_99 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_100 duk_romprops_100; struct duk_romprops_100 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_101 duk_romprops_101; struct duk_romprops_101 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_102 duk_romprops_102; struct duk_romprops_102 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_103 duk_romprops_103; struct duk_romprops_103 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_104 duk_romprops_104; struct duk_romprops_104 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_105 duk_romprops_105; struct duk_romprops_105 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_106 duk_romprops_106; struct duk_romprops_106 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_107 duk_romprops_107; struct duk_romprops_107 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_108 duk_romprops_108; struct duk_romprops_108 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_109 duk_romprops_109; struct duk_romprops_109 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_110 duk_romprops_110; struct duk_romprops_110 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_111 duk_romprops_111; struct duk_romprops_111 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_112 duk_romprops_112; struct duk_romprops_112 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_113 duk_romprops_113; struct duk_romprops_113 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_114 duk_romprops_114; struct duk_romprops_114 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_115 duk_romprops_115; struct duk_romprops_115 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_116 duk_romprops_116; struct duk_romprops_116 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_117 duk_romprops_117; struct duk_romprops_117 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_118 duk_romprops_118; struct duk_romprops_118 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_119 duk_romprops_119; struct duk_romprops_119 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_120 duk_romprops_120; struct duk_romprops_120 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_121 duk_romprops_121; struct duk_romprops_121 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_122 duk_romprops_122; struct duk_romprops_122 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_123 duk_romprops_123; struct duk_romprops_123 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_124 duk_romprops_124; struct duk_romprops_124 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_125 duk_romprops_125; struct duk_romprops_125 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_126 duk_romprops_126; struct duk_romprops_126 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_127 duk_romprops_127; struct duk_romprops_127 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_128 duk_romprops_128; struct duk_romprops_128 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_129 duk_romprops_129; struct duk_romprops_129 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_130 duk_romprops_130; struct duk_romprops_130 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_131 duk_romprops_131; struct duk_romprops_131 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_132 duk_romprops_132; struct duk_romprops_132 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_133 duk_romprops_133; struct duk_romprops_133 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_134 duk_romprops_134; struct duk_romprops_134 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_135 duk_romprops_135; struct duk_romprops_135 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_136 duk_romprops_136; struct duk_romprops_136 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_137 duk_romprops_137; struct duk_romprops_137 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_138 duk_romprops_138; struct duk_romprops_138 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_139 duk_romprops_139; struct duk_romprops_139 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_140 duk_romprops_140; struct duk_romprops_140 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_141 duk_romprops_141; struct duk_romprops_141 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_142 duk_romprops_142; struct duk_romprops_142 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_143 duk_romprops_143; struct duk_romprops_143 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_144 duk_romprops_144; struct duk_romprops_144 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_145 duk_romprops_145; struct duk_romprops_145 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_146 duk_romprops_146; struct duk_romprops_146 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_147 duk_romprops_147; struct duk_romprops_147 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_148 duk_romprops_148; struct duk_romprops_148 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_149 duk_romprops_149; struct duk_romprops_149 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_150 duk_romprops_150; struct duk_romprops_150 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_151 duk_romprops_151; struct duk_romprops_151 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_152 duk_romprops_152; struct duk_romprops_152 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_153 duk_romprops_153; struct duk_romprops_153 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_154 duk_romprops_154; struct duk_romprops_154 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_155 duk_romprops_155; struct duk_romprops_155 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_156 duk_romprops_156; struct duk_romprops_156 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_157 duk_romprops_157; struct duk_romprops_157 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_158 duk_romprops_158; struct duk_romprops_158 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_159 duk_romprops_159; struct duk_romprops_159 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_160 duk_romprops_160; struct duk_romprops_160 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_161 duk_romprops_161; struct duk_romprops_161 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_162 duk_romprops_162; struct duk_romprops_162 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_163 duk_romprops_163; struct duk_romprops_163 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_164 duk_romprops_164; struct duk_romprops_164 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_165 duk_romprops_165; struct duk_romprops_165 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_166 duk_romprops_166; struct duk_romprops_166 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_167 duk_romprops_167; struct duk_romprops_167 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_168 duk_romprops_168; struct duk_romprops_168 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_169 duk_romprops_169; struct duk_romprops_169 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_170 duk_romprops_170; struct duk_romprops_170 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_171 duk_romprops_171; struct duk_romprops_171 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_172 duk_romprops_172; struct duk_romprops_172 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_173 duk_romprops_173; struct duk_romprops_173 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_174 duk_romprops_174; struct duk_romprops_174 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_175 duk_romprops_175; struct duk_romprops_175 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_176 duk_romprops_176; struct duk_romprops_176 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_177 duk_romprops_177; struct duk_romprops_177 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_178 duk_romprops_178; struct duk_romprops_178 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_179 duk_romprops_179; struct duk_romprops_179 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_180 duk_romprops_180; struct duk_romprops_180 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_181 duk_romprops_181; struct duk_romprops_181 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_182 duk_romprops_182; struct duk_romprops_182 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_183 duk_romprops_183; struct duk_romprops_183 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_184 duk_romprops_184; struct duk_romprops_184 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_185 duk_romprops_185; struct duk_romprops_185 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_186 duk_romprops_186; struct duk_romprops_186 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_187 duk_romprops_187; struct duk_romprops_187 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_188 duk_romprops_188; struct duk_romprops_188 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_189 duk_romprops_189; struct duk_romprops_189 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_190 duk_romprops_190; struct duk_romprops_190 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_191 duk_romprops_191; struct duk_romprops_191 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_192 duk_romprops_192; struct duk_romprops_192 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_193 duk_romprops_193; struct duk_romprops_193 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_194 duk_romprops_194; struct duk_romprops_194 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_195 duk_romprops_195; struct duk_romprops_195 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_196 duk_romprops_196; struct duk_romprops_196 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_197 duk_romprops_197; struct duk_romprops_197 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_198 duk_romprops_198; struct duk_romprops_198 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_199 duk_romprops_199; struct duk_romprops_199 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_200 duk_romprops_200; struct duk_romprops_200 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_201 duk_romprops_201; struct duk_romprops_201 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_202 duk_romprops_202; struct duk_romprops_202 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_203 duk_romprops_203; struct duk_romprops_203 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_204 duk_romprops_204; struct duk_romprops_204 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_216 duk_romprops_216; struct duk_romprops_216 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_217 duk_romprops_217; struct duk_romprops_217 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_218 duk_romprops_218; struct duk_romprops_218 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_219 duk_romprops_219; struct duk_romprops_219 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_220 duk_romprops_220; struct duk_romprops_220 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_221 duk_romprops_221; struct duk_romprops_221 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_222 duk_romprops_222; struct duk_romprops_222 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_223 duk_romprops_223; struct duk_romprops_223 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_224 duk_romprops_224; struct duk_romprops_224 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_225 duk_romprops_225; struct duk_romprops_225 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_226 duk_romprops_226; struct duk_romprops_226 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_227 duk_romprops_227; struct duk_romprops_227 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_228 duk_romprops_228; struct duk_romprops_228 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_229 duk_romprops_229; struct duk_romprops_229 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_230 duk_romprops_230; struct duk_romprops_230 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_231 duk_romprops_231; struct duk_romprops_231 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_232 duk_romprops_232; struct duk_romprops_232 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_233 duk_romprops_233; struct duk_romprops_233 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_234 duk_romprops_234; struct duk_romprops_234 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_235 duk_romprops_235; struct duk_romprops_235 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_236 duk_romprops_236; struct duk_romprops_236 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_237 duk_romprops_237; struct duk_romprops_237 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_238 duk_romprops_238; struct duk_romprops_238 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_239 duk_romprops_239; struct duk_romprops_239 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_240 duk_romprops_240; struct duk_romprops_240 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_241 duk_romprops_241; struct duk_romprops_241 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_242 duk_romprops_242; struct duk_romprops_242 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_243 duk_romprops_243; struct duk_romprops_243 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_244 duk_romprops_244; struct duk_romprops_244 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_245 duk_romprops_245; struct duk_romprops_245 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_246 duk_romprops_246; struct duk_romprops_246 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_247 duk_romprops_247; struct duk_romprops_247 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_248 duk_romprops_248; struct duk_romprops_248 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_249 duk_romprops_249; struct duk_romprops_249 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_250 duk_romprops_250; struct duk_romprops_250 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_251 duk_romprops_251; struct duk_romprops_251 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_252 duk_romprops_252; struct duk_romprops_252 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_253 duk_romprops_253; struct duk_romprops_253 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_254 duk_romprops_254; struct duk_romprops_254 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_255 duk_romprops_255; struct duk_romprops_255 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_256 duk_romprops_256; struct duk_romprops_256 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_257 duk_romprops_257; struct duk_romprops_257 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+typedef struct duk_romprops_258 duk_romprops_258; struct duk_romprops_258 { duk_rom_tval_number val0; duk_rom_tval_string val1; const duk_hstring *key0; const duk_hstring *key1; duk_uint8_t flags0; duk_uint8_t flags1; };
+#else
+#error invalid object layout
+#endif
+
+DUK_EXTERNAL_DECL const duk_romprops_0 duk_prop_0;
+DUK_EXTERNAL_DECL const duk_romprops_2 duk_prop_2;
+DUK_EXTERNAL_DECL const duk_romprops_3 duk_prop_3;
+DUK_EXTERNAL_DECL const duk_romprops_4 duk_prop_4;
+DUK_EXTERNAL_DECL const duk_romprops_5 duk_prop_5;
+DUK_EXTERNAL_DECL const duk_romprops_6 duk_prop_6;
+DUK_EXTERNAL_DECL const duk_romprops_7 duk_prop_7;
+DUK_EXTERNAL_DECL const duk_romprops_8 duk_prop_8;
+DUK_EXTERNAL_DECL const duk_romprops_9 duk_prop_9;
+DUK_EXTERNAL_DECL const duk_romprops_10 duk_prop_10;
+DUK_EXTERNAL_DECL const duk_romprops_11 duk_prop_11;
+DUK_EXTERNAL_DECL const duk_romprops_12 duk_prop_12;
+DUK_EXTERNAL_DECL const duk_romprops_13 duk_prop_13;
+DUK_EXTERNAL_DECL const duk_romprops_14 duk_prop_14;
+DUK_EXTERNAL_DECL const duk_romprops_15 duk_prop_15;
+DUK_EXTERNAL_DECL const duk_romprops_16 duk_prop_16;
+DUK_EXTERNAL_DECL const duk_romprops_17 duk_prop_17;
+DUK_EXTERNAL_DECL const duk_romprops_18 duk_prop_18;
+DUK_EXTERNAL_DECL const duk_romprops_19 duk_prop_19;
+DUK_EXTERNAL_DECL const duk_romprops_20 duk_prop_20;
+DUK_EXTERNAL_DECL const duk_romprops_21 duk_prop_21;
+DUK_EXTERNAL_DECL const duk_romprops_22 duk_prop_22;
+DUK_EXTERNAL_DECL const duk_romprops_23 duk_prop_23;
+DUK_EXTERNAL_DECL const duk_romprops_24 duk_prop_24;
+DUK_EXTERNAL_DECL const duk_romprops_25 duk_prop_25;
+DUK_EXTERNAL_DECL const duk_romprops_26 duk_prop_26;
+DUK_EXTERNAL_DECL const duk_romprops_27 duk_prop_27;
+DUK_EXTERNAL_DECL const duk_romprops_28 duk_prop_28;
+DUK_EXTERNAL_DECL const duk_romprops_29 duk_prop_29;
+DUK_EXTERNAL_DECL const duk_romprops_30 duk_prop_30;
+DUK_EXTERNAL_DECL const duk_romprops_31 duk_prop_31;
+DUK_EXTERNAL_DECL const duk_romprops_32 duk_prop_32;
+DUK_EXTERNAL_DECL const duk_romprops_33 duk_prop_33;
+DUK_EXTERNAL_DECL const duk_romprops_34 duk_prop_34;
+DUK_EXTERNAL_DECL const duk_romprops_36 duk_prop_36;
+DUK_EXTERNAL_DECL const duk_romprops_37 duk_prop_37;
+DUK_EXTERNAL_DECL const duk_romprops_38 duk_prop_38;
+DUK_EXTERNAL_DECL const duk_romprops_39 duk_prop_39;
+DUK_EXTERNAL_DECL const duk_romprops_40 duk_prop_40;
+DUK_EXTERNAL_DECL const duk_romprops_41 duk_prop_41;
+DUK_EXTERNAL_DECL const duk_romprops_42 duk_prop_42;
+DUK_EXTERNAL_DECL const duk_romprops_43 duk_prop_43;
+DUK_EXTERNAL_DECL const duk_romprops_44 duk_prop_44;
+DUK_EXTERNAL_DECL const duk_romprops_45 duk_prop_45;
+DUK_EXTERNAL_DECL const duk_romprops_46 duk_prop_46;
+DUK_EXTERNAL_DECL const duk_romprops_47 duk_prop_47;
+DUK_EXTERNAL_DECL const duk_romprops_48 duk_prop_48;
+DUK_EXTERNAL_DECL const duk_romprops_49 duk_prop_49;
+DUK_EXTERNAL_DECL const duk_romprops_50 duk_prop_50;
+DUK_EXTERNAL_DECL const duk_romprops_51 duk_prop_51;
+DUK_EXTERNAL_DECL const duk_romprops_52 duk_prop_52;
+DUK_EXTERNAL_DECL const duk_romprops_53 duk_prop_53;
+DUK_EXTERNAL_DECL const duk_romprops_54 duk_prop_54;
+DUK_EXTERNAL_DECL const duk_romprops_55 duk_prop_55;
+DUK_EXTERNAL_DECL const duk_romprops_56 duk_prop_56;
+DUK_EXTERNAL_DECL const duk_romprops_57 duk_prop_57;
+DUK_EXTERNAL_DECL const duk_romprops_58 duk_prop_58;
+DUK_EXTERNAL_DECL const duk_romprops_59 duk_prop_59;
+DUK_EXTERNAL_DECL const duk_romprops_60 duk_prop_60;
+DUK_EXTERNAL_DECL const duk_romprops_61 duk_prop_61;
+DUK_EXTERNAL_DECL const duk_romprops_62 duk_prop_62;
+DUK_EXTERNAL_DECL const duk_romprops_63 duk_prop_63;
+DUK_EXTERNAL_DECL const duk_romprops_64 duk_prop_64;
+DUK_EXTERNAL_DECL const duk_romprops_65 duk_prop_65;
+DUK_EXTERNAL_DECL const duk_romprops_66 duk_prop_66;
+DUK_EXTERNAL_DECL const duk_romprops_67 duk_prop_67;
+DUK_EXTERNAL_DECL const duk_romprops_68 duk_prop_68;
+DUK_EXTERNAL_DECL const duk_romprops_69 duk_prop_69;
+DUK_EXTERNAL_DECL const duk_romprops_70 duk_prop_70;
+DUK_EXTERNAL_DECL const duk_romprops_71 duk_prop_71;
+DUK_EXTERNAL_DECL const duk_romprops_72 duk_prop_72;
+DUK_EXTERNAL_DECL const duk_romprops_75 duk_prop_75;
+DUK_EXTERNAL_DECL const duk_romprops_76 duk_prop_76;
+DUK_EXTERNAL_DECL const duk_romprops_77 duk_prop_77;
+DUK_EXTERNAL_DECL const duk_romprops_78 duk_prop_78;
+DUK_EXTERNAL_DECL const duk_romprops_79 duk_prop_79;
+DUK_EXTERNAL_DECL const duk_romprops_80 duk_prop_80;
+DUK_EXTERNAL_DECL const duk_romprops_81 duk_prop_81;
+DUK_EXTERNAL_DECL const duk_romprops_82 duk_prop_82;
+DUK_EXTERNAL_DECL const duk_romprops_83 duk_prop_83;
+DUK_EXTERNAL_DECL const duk_romprops_84 duk_prop_84;
+DUK_EXTERNAL_DECL const duk_romprops_85 duk_prop_85;
+DUK_EXTERNAL_DECL const duk_romprops_86 duk_prop_86;
+DUK_EXTERNAL_DECL const duk_romprops_87 duk_prop_87;
+DUK_EXTERNAL_DECL const duk_romprops_88 duk_prop_88;
+DUK_EXTERNAL_DECL const duk_romprops_89 duk_prop_89;
+DUK_EXTERNAL_DECL const duk_romprops_92 duk_prop_92;
+DUK_EXTERNAL_DECL const duk_romprops_93 duk_prop_93;
+DUK_EXTERNAL_DECL const duk_romprops_94 duk_prop_94;
+DUK_EXTERNAL_DECL const duk_romprops_95 duk_prop_95;
+DUK_EXTERNAL_DECL const duk_romprops_96 duk_prop_96;
+DUK_EXTERNAL_DECL const duk_romprops_97 duk_prop_97;
+DUK_EXTERNAL_DECL const duk_romprops_98 duk_prop_98;
+DUK_EXTERNAL_DECL const duk_romprops_99 duk_prop_99;
+DUK_EXTERNAL_DECL const duk_romprops_100 duk_prop_100;
+DUK_EXTERNAL_DECL const duk_romprops_101 duk_prop_101;
+DUK_EXTERNAL_DECL const duk_romprops_102 duk_prop_102;
+DUK_EXTERNAL_DECL const duk_romprops_103 duk_prop_103;
+DUK_EXTERNAL_DECL const duk_romprops_104 duk_prop_104;
+DUK_EXTERNAL_DECL const duk_romprops_105 duk_prop_105;
+DUK_EXTERNAL_DECL const duk_romprops_106 duk_prop_106;
+DUK_EXTERNAL_DECL const duk_romprops_107 duk_prop_107;
+DUK_EXTERNAL_DECL const duk_romprops_108 duk_prop_108;
+DUK_EXTERNAL_DECL const duk_romprops_109 duk_prop_109;
+DUK_EXTERNAL_DECL const duk_romprops_110 duk_prop_110;
+DUK_EXTERNAL_DECL const duk_romprops_111 duk_prop_111;
+DUK_EXTERNAL_DECL const duk_romprops_112 duk_prop_112;
+DUK_EXTERNAL_DECL const duk_romprops_113 duk_prop_113;
+DUK_EXTERNAL_DECL const duk_romprops_114 duk_prop_114;
+DUK_EXTERNAL_DECL const duk_romprops_115 duk_prop_115;
+DUK_EXTERNAL_DECL const duk_romprops_116 duk_prop_116;
+DUK_EXTERNAL_DECL const duk_romprops_117 duk_prop_117;
+DUK_EXTERNAL_DECL const duk_romprops_118 duk_prop_118;
+DUK_EXTERNAL_DECL const duk_romprops_119 duk_prop_119;
+DUK_EXTERNAL_DECL const duk_romprops_120 duk_prop_120;
+DUK_EXTERNAL_DECL const duk_romprops_121 duk_prop_121;
+DUK_EXTERNAL_DECL const duk_romprops_122 duk_prop_122;
+DUK_EXTERNAL_DECL const duk_romprops_123 duk_prop_123;
+DUK_EXTERNAL_DECL const duk_romprops_124 duk_prop_124;
+DUK_EXTERNAL_DECL const duk_romprops_125 duk_prop_125;
+DUK_EXTERNAL_DECL const duk_romprops_126 duk_prop_126;
+DUK_EXTERNAL_DECL const duk_romprops_127 duk_prop_127;
+DUK_EXTERNAL_DECL const duk_romprops_128 duk_prop_128;
+DUK_EXTERNAL_DECL const duk_romprops_129 duk_prop_129;
+DUK_EXTERNAL_DECL const duk_romprops_130 duk_prop_130;
+DUK_EXTERNAL_DECL const duk_romprops_131 duk_prop_131;
+DUK_EXTERNAL_DECL const duk_romprops_132 duk_prop_132;
+DUK_EXTERNAL_DECL const duk_romprops_133 duk_prop_133;
+DUK_EXTERNAL_DECL const duk_romprops_134 duk_prop_134;
+DUK_EXTERNAL_DECL const duk_romprops_135 duk_prop_135;
+DUK_EXTERNAL_DECL const duk_romprops_136 duk_prop_136;
+DUK_EXTERNAL_DECL const duk_romprops_137 duk_prop_137;
+DUK_EXTERNAL_DECL const duk_romprops_138 duk_prop_138;
+DUK_EXTERNAL_DECL const duk_romprops_139 duk_prop_139;
+DUK_EXTERNAL_DECL const duk_romprops_140 duk_prop_140;
+DUK_EXTERNAL_DECL const duk_romprops_141 duk_prop_141;
+DUK_EXTERNAL_DECL const duk_romprops_142 duk_prop_142;
+DUK_EXTERNAL_DECL const duk_romprops_143 duk_prop_143;
+DUK_EXTERNAL_DECL const duk_romprops_144 duk_prop_144;
+DUK_EXTERNAL_DECL const duk_romprops_145 duk_prop_145;
+DUK_EXTERNAL_DECL const duk_romprops_146 duk_prop_146;
+DUK_EXTERNAL_DECL const duk_romprops_147 duk_prop_147;
+DUK_EXTERNAL_DECL const duk_romprops_148 duk_prop_148;
+DUK_EXTERNAL_DECL const duk_romprops_149 duk_prop_149;
+DUK_EXTERNAL_DECL const duk_romprops_150 duk_prop_150;
+DUK_EXTERNAL_DECL const duk_romprops_151 duk_prop_151;
+DUK_EXTERNAL_DECL const duk_romprops_152 duk_prop_152;
+DUK_EXTERNAL_DECL const duk_romprops_153 duk_prop_153;
+DUK_EXTERNAL_DECL const duk_romprops_154 duk_prop_154;
+DUK_EXTERNAL_DECL const duk_romprops_155 duk_prop_155;
+DUK_EXTERNAL_DECL const duk_romprops_156 duk_prop_156;
+DUK_EXTERNAL_DECL const duk_romprops_157 duk_prop_157;
+DUK_EXTERNAL_DECL const duk_romprops_158 duk_prop_158;
+DUK_EXTERNAL_DECL const duk_romprops_159 duk_prop_159;
+DUK_EXTERNAL_DECL const duk_romprops_160 duk_prop_160;
+DUK_EXTERNAL_DECL const duk_romprops_161 duk_prop_161;
+DUK_EXTERNAL_DECL const duk_romprops_162 duk_prop_162;
+DUK_EXTERNAL_DECL const duk_romprops_163 duk_prop_163;
+DUK_EXTERNAL_DECL const duk_romprops_164 duk_prop_164;
+DUK_EXTERNAL_DECL const duk_romprops_165 duk_prop_165;
+DUK_EXTERNAL_DECL const duk_romprops_166 duk_prop_166;
+DUK_EXTERNAL_DECL const duk_romprops_167 duk_prop_167;
+DUK_EXTERNAL_DECL const duk_romprops_168 duk_prop_168;
+DUK_EXTERNAL_DECL const duk_romprops_169 duk_prop_169;
+DUK_EXTERNAL_DECL const duk_romprops_170 duk_prop_170;
+DUK_EXTERNAL_DECL const duk_romprops_171 duk_prop_171;
+DUK_EXTERNAL_DECL const duk_romprops_172 duk_prop_172;
+DUK_EXTERNAL_DECL const duk_romprops_173 duk_prop_173;
+DUK_EXTERNAL_DECL const duk_romprops_174 duk_prop_174;
+DUK_EXTERNAL_DECL const duk_romprops_175 duk_prop_175;
+DUK_EXTERNAL_DECL const duk_romprops_176 duk_prop_176;
+DUK_EXTERNAL_DECL const duk_romprops_177 duk_prop_177;
+DUK_EXTERNAL_DECL const duk_romprops_178 duk_prop_178;
+DUK_EXTERNAL_DECL const duk_romprops_179 duk_prop_179;
+DUK_EXTERNAL_DECL const duk_romprops_180 duk_prop_180;
+DUK_EXTERNAL_DECL const duk_romprops_181 duk_prop_181;
+DUK_EXTERNAL_DECL const duk_romprops_182 duk_prop_182;
+DUK_EXTERNAL_DECL const duk_romprops_183 duk_prop_183;
+DUK_EXTERNAL_DECL const duk_romprops_184 duk_prop_184;
+DUK_EXTERNAL_DECL const duk_romprops_185 duk_prop_185;
+DUK_EXTERNAL_DECL const duk_romprops_186 duk_prop_186;
+DUK_EXTERNAL_DECL const duk_romprops_187 duk_prop_187;
+DUK_EXTERNAL_DECL const duk_romprops_188 duk_prop_188;
+DUK_EXTERNAL_DECL const duk_romprops_189 duk_prop_189;
+DUK_EXTERNAL_DECL const duk_romprops_190 duk_prop_190;
+DUK_EXTERNAL_DECL const duk_romprops_191 duk_prop_191;
+DUK_EXTERNAL_DECL const duk_romprops_192 duk_prop_192;
+DUK_EXTERNAL_DECL const duk_romprops_193 duk_prop_193;
+DUK_EXTERNAL_DECL const duk_romprops_194 duk_prop_194;
+DUK_EXTERNAL_DECL const duk_romprops_195 duk_prop_195;
+DUK_EXTERNAL_DECL const duk_romprops_196 duk_prop_196;
+DUK_EXTERNAL_DECL const duk_romprops_197 duk_prop_197;
+DUK_EXTERNAL_DECL const duk_romprops_198 duk_prop_198;
+DUK_EXTERNAL_DECL const duk_romprops_199 duk_prop_199;
+DUK_EXTERNAL_DECL const duk_romprops_200 duk_prop_200;
+DUK_EXTERNAL_DECL const duk_romprops_201 duk_prop_201;
+DUK_EXTERNAL_DECL const duk_romprops_202 duk_prop_202;
+DUK_EXTERNAL_DECL const duk_romprops_203 duk_prop_203;
+DUK_EXTERNAL_DECL const duk_romprops_204 duk_prop_204;
+DUK_EXTERNAL_DECL const duk_romprops_216 duk_prop_216;
+DUK_EXTERNAL_DECL const duk_romprops_217 duk_prop_217;
+DUK_EXTERNAL_DECL const duk_romprops_218 duk_prop_218;
+DUK_EXTERNAL_DECL const duk_romprops_219 duk_prop_219;
+DUK_EXTERNAL_DECL const duk_romprops_220 duk_prop_220;
+DUK_EXTERNAL_DECL const duk_romprops_221 duk_prop_221;
+DUK_EXTERNAL_DECL const duk_romprops_222 duk_prop_222;
+DUK_EXTERNAL_DECL const duk_romprops_223 duk_prop_223;
+DUK_EXTERNAL_DECL const duk_romprops_224 duk_prop_224;
+DUK_EXTERNAL_DECL const duk_romprops_225 duk_prop_225;
+DUK_EXTERNAL_DECL const duk_romprops_226 duk_prop_226;
+DUK_EXTERNAL_DECL const duk_romprops_227 duk_prop_227;
+DUK_EXTERNAL_DECL const duk_romprops_228 duk_prop_228;
+DUK_EXTERNAL_DECL const duk_romprops_229 duk_prop_229;
+DUK_EXTERNAL_DECL const duk_romprops_230 duk_prop_230;
+DUK_EXTERNAL_DECL const duk_romprops_231 duk_prop_231;
+DUK_EXTERNAL_DECL const duk_romprops_232 duk_prop_232;
+DUK_EXTERNAL_DECL const duk_romprops_233 duk_prop_233;
+DUK_EXTERNAL_DECL const duk_romprops_234 duk_prop_234;
+DUK_EXTERNAL_DECL const duk_romprops_235 duk_prop_235;
+DUK_EXTERNAL_DECL const duk_romprops_236 duk_prop_236;
+DUK_EXTERNAL_DECL const duk_romprops_237 duk_prop_237;
+DUK_EXTERNAL_DECL const duk_romprops_238 duk_prop_238;
+DUK_EXTERNAL_DECL const duk_romprops_239 duk_prop_239;
+DUK_EXTERNAL_DECL const duk_romprops_240 duk_prop_240;
+DUK_EXTERNAL_DECL const duk_romprops_241 duk_prop_241;
+DUK_EXTERNAL_DECL const duk_romprops_242 duk_prop_242;
+DUK_EXTERNAL_DECL const duk_romprops_243 duk_prop_243;
+DUK_EXTERNAL_DECL const duk_romprops_244 duk_prop_244;
+DUK_EXTERNAL_DECL const duk_romprops_245 duk_prop_245;
+DUK_EXTERNAL_DECL const duk_romprops_246 duk_prop_246;
+DUK_EXTERNAL_DECL const duk_romprops_247 duk_prop_247;
+DUK_EXTERNAL_DECL const duk_romprops_248 duk_prop_248;
+DUK_EXTERNAL_DECL const duk_romprops_249 duk_prop_249;
+DUK_EXTERNAL_DECL const duk_romprops_250 duk_prop_250;
+DUK_EXTERNAL_DECL const duk_romprops_251 duk_prop_251;
+DUK_EXTERNAL_DECL const duk_romprops_252 duk_prop_252;
+DUK_EXTERNAL_DECL const duk_romprops_253 duk_prop_253;
+DUK_EXTERNAL_DECL const duk_romprops_254 duk_prop_254;
+DUK_EXTERNAL_DECL const duk_romprops_255 duk_prop_255;
+DUK_EXTERNAL_DECL const duk_romprops_256 duk_prop_256;
+DUK_EXTERNAL_DECL const duk_romprops_257 duk_prop_257;
+DUK_EXTERNAL_DECL const duk_romprops_258 duk_prop_258;
+
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_0;
+DUK_EXTERNAL_DECL const duk_romobjenv duk_obj_1;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_2;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_3;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_4;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_5;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_6;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_7;
+DUK_EXTERNAL_DECL const duk_romarr duk_obj_8;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_9;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_10;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_11;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_12;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_13;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_14;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_15;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_16;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_17;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_18;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_19;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_20;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_21;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_22;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_23;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_24;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_25;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_26;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_27;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_28;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_29;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_30;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_31;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_32;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_33;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_34;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_35;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_36;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_37;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_38;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_39;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_40;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_41;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_42;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_43;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_44;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_45;
+DUK_EXTERNAL_DECL const duk_romobj duk_obj_46;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_47;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_48;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_49;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_50;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_51;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_52;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_53;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_54;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_55;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_56;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_57;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_58;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_59;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_60;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_61;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_62;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_63;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_64;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_65;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_66;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_67;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_68;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_69;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_70;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_71;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_72;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_73;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_74;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_75;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_76;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_77;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_78;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_79;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_80;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_81;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_82;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_83;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_84;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_85;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_86;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_87;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_88;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_89;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_90;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_91;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_92;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_93;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_94;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_95;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_96;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_97;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_98;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_99;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_100;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_101;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_102;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_103;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_104;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_105;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_106;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_107;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_108;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_109;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_110;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_111;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_112;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_113;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_114;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_115;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_116;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_117;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_118;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_119;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_120;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_121;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_122;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_123;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_124;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_125;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_126;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_127;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_128;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_129;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_130;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_131;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_132;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_133;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_134;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_135;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_136;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_137;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_138;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_139;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_140;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_141;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_142;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_143;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_144;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_145;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_146;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_147;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_148;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_149;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_150;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_151;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_152;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_153;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_154;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_155;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_156;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_157;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_158;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_159;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_160;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_161;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_162;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_163;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_164;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_165;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_166;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_167;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_168;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_169;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_170;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_171;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_172;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_173;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_174;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_175;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_176;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_177;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_178;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_179;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_180;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_181;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_182;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_183;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_184;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_185;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_186;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_187;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_188;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_189;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_190;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_191;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_192;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_193;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_194;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_195;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_196;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_197;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_198;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_199;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_200;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_201;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_202;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_203;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_204;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_205;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_206;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_207;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_208;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_209;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_210;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_211;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_212;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_213;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_214;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_215;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_216;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_217;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_218;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_219;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_220;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_221;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_222;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_223;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_224;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_225;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_226;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_227;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_228;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_229;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_230;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_231;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_232;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_233;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_234;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_235;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_236;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_237;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_238;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_239;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_240;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_241;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_242;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_243;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_244;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_245;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_246;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_247;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_248;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_249;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_250;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_251;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_252;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_253;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_254;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_255;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_256;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_257;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_258;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_259;
+DUK_EXTERNAL_DECL const duk_romfun duk_obj_260;
+
+DUK_EXTERNAL const duk_romobj duk_obj_0 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(13),1,&duk_prop_0,64182,&duk_obj_3,63943,34,34,0,0);
+DUK_EXTERNAL const duk_romobjenv duk_obj_1 = DUK__ROMOBJENV_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(15),1,NULL,0,NULL,0,0,0,0,0,&duk_obj_0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_2 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_2,64183,&duk_obj_5,63934,20,20,0,0,duk_bi_object_constructor,1,0);
+DUK_EXTERNAL const duk_romobj duk_obj_3 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(1),1,&duk_prop_3,64184,NULL,0,12,12,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_4 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_4,64185,&duk_obj_5,63934,3,3,0,0,duk_bi_function_constructor,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_5 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_5,64186,&duk_obj_3,63943,8,8,0,0,duk_bi_function_prototype,0,0);
+DUK_EXTERNAL const duk_romobj duk_obj_6 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(1),1,&duk_prop_6,64187,&duk_obj_5,63934,2,2,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_7 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_7,64188,&duk_obj_5,63934,4,4,0,0,duk_bi_array_constructor,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romarr duk_obj_8 = DUK__ROMARR_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_EXOTIC_ARRAY|DUK_HOBJECT_CLASS_AS_FLAGS(2),1,&duk_prop_8,64189,&duk_obj_3,63943,22,22,0,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_9 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_9,64190,&duk_obj_5,63934,5,5,0,0,duk_bi_string_constructor,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romobj duk_obj_10 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(12),1,&duk_prop_10,64191,&duk_obj_3,63943,27,27,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_11 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_11,64192,&duk_obj_5,63934,3,3,0,0,duk_bi_boolean_constructor,1,0);
+DUK_EXTERNAL const duk_romobj duk_obj_12 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(5),1,&duk_prop_12,64193,&duk_obj_3,63943,4,4,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_13 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_13,64194,&duk_obj_5,63934,17,17,0,0,duk_bi_number_constructor,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romobj duk_obj_14 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(10),1,&duk_prop_14,64195,&duk_obj_3,63943,8,8,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_15 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_15,64196,&duk_obj_5,63934,6,6,0,0,duk_bi_date_constructor,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romobj duk_obj_16 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(6),1,&duk_prop_16,64197,&duk_obj_3,63943,49,49,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_17 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_17,64198,&duk_obj_5,63934,3,3,0,0,duk_bi_regexp_constructor,2,0);
+DUK_EXTERNAL const duk_romobj duk_obj_18 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(1),1,&duk_prop_18,64199,&duk_obj_3,63943,10,10,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_19 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_19,64200,&duk_obj_5,63934,3,3,0,0,duk_bi_error_constructor_shared,1,20);
+DUK_EXTERNAL const duk_romobj duk_obj_20 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(7),1,&duk_prop_20,64201,&duk_obj_3,63943,7,7,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_21 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_21,64202,&duk_obj_19,63929,3,3,0,0,duk_bi_error_constructor_shared,1,22);
+DUK_EXTERNAL const duk_romobj duk_obj_22 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(7),1,&duk_prop_22,64203,&duk_obj_20,63930,3,3,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_23 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_23,64204,&duk_obj_19,63929,3,3,0,0,duk_bi_error_constructor_shared,1,24);
+DUK_EXTERNAL const duk_romobj duk_obj_24 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(7),1,&duk_prop_24,64205,&duk_obj_20,63930,3,3,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_25 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_25,64206,&duk_obj_19,63929,3,3,0,0,duk_bi_error_constructor_shared,1,26);
+DUK_EXTERNAL const duk_romobj duk_obj_26 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(7),1,&duk_prop_26,64207,&duk_obj_20,63930,3,3,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_27 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_27,64208,&duk_obj_19,63929,3,3,0,0,duk_bi_error_constructor_shared,1,28);
+DUK_EXTERNAL const duk_romobj duk_obj_28 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(7),1,&duk_prop_28,64209,&duk_obj_20,63930,3,3,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_29 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_29,64210,&duk_obj_19,63929,3,3,0,0,duk_bi_error_constructor_shared,1,30);
+DUK_EXTERNAL const duk_romobj duk_obj_30 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(7),1,&duk_prop_30,64211,&duk_obj_20,63930,3,3,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_31 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_31,64212,&duk_obj_19,63929,3,3,0,0,duk_bi_error_constructor_shared,1,32);
+DUK_EXTERNAL const duk_romobj duk_obj_32 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(7),1,&duk_prop_32,64213,&duk_obj_20,63930,3,3,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_33 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_33,64214,&duk_obj_5,63934,2,2,0,0,duk_bi_type_error_thrower,0,0);
+DUK_EXTERNAL const duk_romobj duk_obj_34 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(1),1,&duk_prop_34,64215,&duk_obj_3,63943,10,10,0,0);
+DUK_EXTERNAL const duk_romobj duk_obj_35 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(1),1,NULL,0,&duk_obj_3,63943,0,0,0,0);
+DUK_EXTERNAL const duk_romobj duk_obj_36 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(17),1,&duk_prop_36,64216,&duk_obj_3,63943,3,3,0,0);
+DUK_EXTERNAL const duk_romobj duk_obj_37 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(7),1,&duk_prop_37,64217,&duk_obj_20,63930,2,2,0,0);
+DUK_EXTERNAL const duk_romobj duk_obj_38 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(1),1,&duk_prop_38,64218,&duk_obj_3,63943,5,5,0,0);
+DUK_EXTERNAL const duk_romobj duk_obj_39 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(1),1,&duk_prop_39,64219,&duk_obj_46,63964,1,1,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_40 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_40,64220,&duk_obj_5,63934,1,1,0,0,duk_bi_global_object_parse_int,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_41 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_41,64221,&duk_obj_5,63934,1,1,0,0,duk_bi_global_object_parse_float,1,0);
+DUK_EXTERNAL const duk_romobj duk_obj_42 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(9),1,&duk_prop_42,64222,&duk_obj_3,63943,35,35,0,0);
+DUK_EXTERNAL const duk_romobj duk_obj_43 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(8),1,&duk_prop_43,64223,&duk_obj_3,63943,2,2,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_44 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_CONSTRUCTABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_44,64224,&duk_obj_5,63934,3,3,0,0,duk_bi_pointer_constructor,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_45 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_45,64225,&duk_obj_5,63934,10,10,0,0,duk_bi_symbol_constructor_shared,1,0);
+DUK_EXTERNAL const duk_romobj duk_obj_46 = DUK__ROMOBJ_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_CLASS_AS_FLAGS(1),1,&duk_prop_46,64226,&duk_obj_3,63943,2,2,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_47 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_SPECIAL_CALL|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_47,64227,&duk_obj_5,63934,2,2,0,0,duk_bi_global_object_eval,1,15);
+DUK_EXTERNAL const duk_romfun duk_obj_48 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_48,64228,&duk_obj_5,63934,2,2,0,0,duk_bi_global_object_is_nan,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_49 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_49,64229,&duk_obj_5,63934,2,2,0,0,duk_bi_global_object_is_finite,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_50 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_50,64230,&duk_obj_5,63934,2,2,0,0,duk_bi_global_object_decode_uri,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_51 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_51,64231,&duk_obj_5,63934,2,2,0,0,duk_bi_global_object_decode_uri_component,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_52 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_52,64232,&duk_obj_5,63934,2,2,0,0,duk_bi_global_object_encode_uri,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_53 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_53,64233,&duk_obj_5,63934,2,2,0,0,duk_bi_global_object_encode_uri_component,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_54 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_54,64234,&duk_obj_5,63934,2,2,0,0,duk_bi_global_object_escape,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_55 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_55,64235,&duk_obj_5,63934,2,2,0,0,duk_bi_global_object_unescape,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_56 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_56,64236,&duk_obj_5,63934,2,2,0,0,duk_bi_object_getprototype_shared,1,1);
+DUK_EXTERNAL const duk_romfun duk_obj_57 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_57,64237,&duk_obj_5,63934,2,2,0,0,duk_bi_object_setprototype_shared,2,1);
+DUK_EXTERNAL const duk_romfun duk_obj_58 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_58,64238,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_get_own_property_descriptor,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_59 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_59,64239,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_keys_shared,1,1);
+DUK_EXTERNAL const duk_romfun duk_obj_60 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_60,64240,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_assign,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_61 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_61,64241,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_create,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_62 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_62,64242,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_define_property,3,0);
+DUK_EXTERNAL const duk_romfun duk_obj_63 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_63,64243,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_define_properties,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_64 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_64,64244,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_seal_freeze_shared,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_65 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_65,64245,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_seal_freeze_shared,1,1);
+DUK_EXTERNAL const duk_romfun duk_obj_66 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_66,64246,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_prevent_extensions,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_67 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_67,64247,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_is_sealed_frozen_shared,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_68 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_68,64248,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_is_sealed_frozen_shared,1,1);
+DUK_EXTERNAL const duk_romfun duk_obj_69 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_69,64249,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_is_extensible,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_70 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_70,64250,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_keys_shared,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_71 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_71,64251,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_keys_shared,1,2);
+DUK_EXTERNAL const duk_romfun duk_obj_72 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_72,64252,&duk_obj_5,63934,2,2,0,0,duk_bi_object_constructor_is,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_73 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_object_getprototype_shared,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_74 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_object_setprototype_shared,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_75 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_75,64253,&duk_obj_5,63934,2,2,0,0,duk_bi_object_prototype_to_string,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_76 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_76,64254,&duk_obj_5,63934,2,2,0,0,duk_bi_object_prototype_to_locale_string,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_77 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_77,64255,&duk_obj_5,63934,2,2,0,0,duk_bi_object_prototype_value_of,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_78 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_78,64256,&duk_obj_5,63934,2,2,0,0,duk_bi_object_prototype_has_own_property,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_79 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_79,64257,&duk_obj_5,63934,2,2,0,0,duk_bi_object_prototype_is_prototype_of,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_80 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_80,64258,&duk_obj_5,63934,2,2,0,0,duk_bi_object_prototype_property_is_enumerable,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_81 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_81,64259,&duk_obj_5,63934,2,2,0,0,duk_bi_object_prototype_defineaccessor,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_82 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_82,64260,&duk_obj_5,63934,2,2,0,0,duk_bi_object_prototype_defineaccessor,2,1);
+DUK_EXTERNAL const duk_romfun duk_obj_83 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_83,64261,&duk_obj_5,63934,2,2,0,0,duk_bi_object_prototype_lookupaccessor,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_84 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_84,64262,&duk_obj_5,63934,2,2,0,0,duk_bi_object_prototype_lookupaccessor,1,1);
+DUK_EXTERNAL const duk_romfun duk_obj_85 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_85,64263,&duk_obj_5,63934,2,2,0,0,duk_bi_function_prototype_to_string,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_86 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_SPECIAL_CALL|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_86,64264,&duk_obj_5,63934,2,2,0,0,duk_bi_function_prototype_apply,2,1);
+DUK_EXTERNAL const duk_romfun duk_obj_87 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_FLAG_SPECIAL_CALL|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_87,64265,&duk_obj_5,63934,2,2,0,0,duk_bi_function_prototype_call,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_88 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_88,64266,&duk_obj_5,63934,2,2,0,0,duk_bi_function_prototype_bind,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_89 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_89,64267,&duk_obj_5,63934,2,2,0,0,duk_bi_function_prototype_hasinstance,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_90 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_native_function_length,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_91 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_native_function_name,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_92 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_92,64268,&duk_obj_5,63934,2,2,0,0,duk_bi_array_constructor_is_array,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_93 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_93,64269,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_to_string,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_94 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_94,64270,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_join_shared,0,1);
+DUK_EXTERNAL const duk_romfun duk_obj_95 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_95,64271,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_concat,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_96 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_96,64272,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_join_shared,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_97 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_97,64273,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_pop,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_98 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_98,64274,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_push,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_99 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_99,64275,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_reverse,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_100 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_100,64276,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_shift,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_101 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_101,64277,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_slice,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_102 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_102,64278,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_sort,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_103 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_103,64279,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_splice,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_104 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_104,64280,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_unshift,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_105 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_105,64281,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_indexof_shared,DUK_VARARGS,1);
+DUK_EXTERNAL const duk_romfun duk_obj_106 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_106,64282,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_indexof_shared,DUK_VARARGS,-1);
+DUK_EXTERNAL const duk_romfun duk_obj_107 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_107,64283,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_iter_shared,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_108 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_108,64284,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_iter_shared,2,1);
+DUK_EXTERNAL const duk_romfun duk_obj_109 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_109,64285,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_iter_shared,2,2);
+DUK_EXTERNAL const duk_romfun duk_obj_110 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_110,64286,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_iter_shared,2,3);
+DUK_EXTERNAL const duk_romfun duk_obj_111 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_111,64287,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_iter_shared,2,4);
+DUK_EXTERNAL const duk_romfun duk_obj_112 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_112,64288,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_reduce_shared,DUK_VARARGS,1);
+DUK_EXTERNAL const duk_romfun duk_obj_113 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_113,64289,&duk_obj_5,63934,2,2,0,0,duk_bi_array_prototype_reduce_shared,DUK_VARARGS,-1);
+DUK_EXTERNAL const duk_romfun duk_obj_114 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_114,64290,&duk_obj_5,63934,2,2,0,0,duk_bi_string_constructor_from_char_code,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_115 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_115,64291,&duk_obj_5,63934,2,2,0,0,duk_bi_string_constructor_from_code_point,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_116 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_116,64292,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_to_string,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_117 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_117,64293,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_to_string,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_118 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_118,64294,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_char_at,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_119 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_119,64295,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_char_code_at,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_120 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_120,64296,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_char_code_at,1,1);
+DUK_EXTERNAL const duk_romfun duk_obj_121 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_121,64297,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_concat,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_122 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_122,64298,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_indexof_shared,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_123 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_123,64299,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_indexof_shared,2,1);
+DUK_EXTERNAL const duk_romfun duk_obj_124 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_124,64300,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_locale_compare,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_125 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_125,64301,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_match,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_126 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_126,64302,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_replace,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_127 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_127,64303,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_search,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_128 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_128,64304,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_slice,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_129 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_129,64305,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_split,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_130 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_130,64306,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_substring,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_131 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_131,64307,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_caseconv_shared,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_132 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_132,64308,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_caseconv_shared,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_133 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_133,64309,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_caseconv_shared,0,1);
+DUK_EXTERNAL const duk_romfun duk_obj_134 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_134,64310,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_caseconv_shared,0,1);
+DUK_EXTERNAL const duk_romfun duk_obj_135 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_135,64311,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_trim,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_136 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_136,64312,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_repeat,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_137 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_137,64313,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_startswith_endswith,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_138 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_138,64314,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_startswith_endswith,2,1);
+DUK_EXTERNAL const duk_romfun duk_obj_139 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_139,64315,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_includes,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_140 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_140,64316,&duk_obj_5,63934,2,2,0,0,duk_bi_string_prototype_substr,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_141 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_141,64317,&duk_obj_5,63934,2,2,0,0,duk_bi_boolean_prototype_tostring_shared,0,1);
+DUK_EXTERNAL const duk_romfun duk_obj_142 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_142,64318,&duk_obj_5,63934,2,2,0,0,duk_bi_boolean_prototype_tostring_shared,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_143 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_143,64319,&duk_obj_5,63934,2,2,0,0,duk_bi_number_check_shared,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_144 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_144,64320,&duk_obj_5,63934,2,2,0,0,duk_bi_number_check_shared,1,1);
+DUK_EXTERNAL const duk_romfun duk_obj_145 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_145,64321,&duk_obj_5,63934,2,2,0,0,duk_bi_number_check_shared,1,2);
+DUK_EXTERNAL const duk_romfun duk_obj_146 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_146,64322,&duk_obj_5,63934,2,2,0,0,duk_bi_number_check_shared,1,3);
+DUK_EXTERNAL const duk_romfun duk_obj_147 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_147,64323,&duk_obj_5,63934,2,2,0,0,duk_bi_number_prototype_to_string,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_148 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_148,64324,&duk_obj_5,63934,2,2,0,0,duk_bi_number_prototype_to_locale_string,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_149 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_149,64325,&duk_obj_5,63934,2,2,0,0,duk_bi_number_prototype_value_of,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_150 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_150,64326,&duk_obj_5,63934,2,2,0,0,duk_bi_number_prototype_to_fixed,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_151 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_151,64327,&duk_obj_5,63934,2,2,0,0,duk_bi_number_prototype_to_exponential,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_152 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_152,64328,&duk_obj_5,63934,2,2,0,0,duk_bi_number_prototype_to_precision,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_153 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_153,64329,&duk_obj_5,63934,2,2,0,0,duk_bi_date_constructor_parse,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_154 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_154,64330,&duk_obj_5,63934,2,2,0,0,duk_bi_date_constructor_utc,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_155 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_155,64331,&duk_obj_5,63934,2,2,0,0,duk_bi_date_constructor_now,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_156 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_156,64332,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_tostring_shared,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_157 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_157,64333,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_tostring_shared,0,1);
+DUK_EXTERNAL const duk_romfun duk_obj_158 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_158,64334,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_tostring_shared,0,2);
+DUK_EXTERNAL const duk_romfun duk_obj_159 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_159,64335,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_tostring_shared,0,3);
+DUK_EXTERNAL const duk_romfun duk_obj_160 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_160,64336,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_tostring_shared,0,4);
+DUK_EXTERNAL const duk_romfun duk_obj_161 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_161,64337,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_tostring_shared,0,5);
+DUK_EXTERNAL const duk_romfun duk_obj_162 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_162,64338,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_tostring_shared,0,6);
+DUK_EXTERNAL const duk_romfun duk_obj_163 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_163,64339,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_tostring_shared,0,7);
+DUK_EXTERNAL const duk_romfun duk_obj_164 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_164,64340,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_to_json,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_165 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_165,64341,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_value_of,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_166 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_166,64342,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_value_of,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_167 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_167,64343,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,8);
+DUK_EXTERNAL const duk_romfun duk_obj_168 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_168,64344,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,9);
+DUK_EXTERNAL const duk_romfun duk_obj_169 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_169,64345,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,10);
+DUK_EXTERNAL const duk_romfun duk_obj_170 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_170,64346,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,11);
+DUK_EXTERNAL const duk_romfun duk_obj_171 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_171,64347,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,12);
+DUK_EXTERNAL const duk_romfun duk_obj_172 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_172,64348,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,13);
+DUK_EXTERNAL const duk_romfun duk_obj_173 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_173,64349,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,14);
+DUK_EXTERNAL const duk_romfun duk_obj_174 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_174,64350,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,15);
+DUK_EXTERNAL const duk_romfun duk_obj_175 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_175,64351,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,16);
+DUK_EXTERNAL const duk_romfun duk_obj_176 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_176,64352,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,17);
+DUK_EXTERNAL const duk_romfun duk_obj_177 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_177,64353,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,18);
+DUK_EXTERNAL const duk_romfun duk_obj_178 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_178,64354,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,19);
+DUK_EXTERNAL const duk_romfun duk_obj_179 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_179,64355,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,20);
+DUK_EXTERNAL const duk_romfun duk_obj_180 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_180,64356,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,21);
+DUK_EXTERNAL const duk_romfun duk_obj_181 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_181,64357,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,22);
+DUK_EXTERNAL const duk_romfun duk_obj_182 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_182,64358,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,23);
+DUK_EXTERNAL const duk_romfun duk_obj_183 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_183,64359,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_timezone_offset,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_184 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_184,64360,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_time,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_185 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_185,64361,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,1,24);
+DUK_EXTERNAL const duk_romfun duk_obj_186 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_186,64362,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,1,25);
+DUK_EXTERNAL const duk_romfun duk_obj_187 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_187,64363,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,DUK_VARARGS,26);
+DUK_EXTERNAL const duk_romfun duk_obj_188 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_188,64364,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,DUK_VARARGS,27);
+DUK_EXTERNAL const duk_romfun duk_obj_189 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_189,64365,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,DUK_VARARGS,28);
+DUK_EXTERNAL const duk_romfun duk_obj_190 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_190,64366,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,DUK_VARARGS,29);
+DUK_EXTERNAL const duk_romfun duk_obj_191 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_191,64367,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,DUK_VARARGS,30);
+DUK_EXTERNAL const duk_romfun duk_obj_192 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_192,64368,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,DUK_VARARGS,31);
+DUK_EXTERNAL const duk_romfun duk_obj_193 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_193,64369,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,1,32);
+DUK_EXTERNAL const duk_romfun duk_obj_194 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_194,64370,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,1,33);
+DUK_EXTERNAL const duk_romfun duk_obj_195 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_195,64371,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,DUK_VARARGS,34);
+DUK_EXTERNAL const duk_romfun duk_obj_196 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_196,64372,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,DUK_VARARGS,35);
+DUK_EXTERNAL const duk_romfun duk_obj_197 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_197,64373,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,DUK_VARARGS,36);
+DUK_EXTERNAL const duk_romfun duk_obj_198 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_198,64374,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,DUK_VARARGS,37);
+DUK_EXTERNAL const duk_romfun duk_obj_199 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_199,64375,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_get_shared,0,38);
+DUK_EXTERNAL const duk_romfun duk_obj_200 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_200,64376,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_set_shared,1,39);
+DUK_EXTERNAL const duk_romfun duk_obj_201 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_201,64377,&duk_obj_5,63934,2,2,0,0,duk_bi_date_prototype_toprimitive,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_202 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_202,64378,&duk_obj_5,63934,2,2,0,0,duk_bi_regexp_prototype_exec,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_203 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_203,64379,&duk_obj_5,63934,2,2,0,0,duk_bi_regexp_prototype_test,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_204 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_204,64380,&duk_obj_5,63934,2,2,0,0,duk_bi_regexp_prototype_tostring,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_205 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_regexp_prototype_flags,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_206 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_regexp_prototype_shared_getter,0,16);
+DUK_EXTERNAL const duk_romfun duk_obj_207 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_regexp_prototype_shared_getter,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_208 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_regexp_prototype_shared_getter,0,1);
+DUK_EXTERNAL const duk_romfun duk_obj_209 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_regexp_prototype_shared_getter,0,2);
+DUK_EXTERNAL const duk_romfun duk_obj_210 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_error_prototype_stack_getter,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_211 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_error_prototype_stack_setter,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_212 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_error_prototype_filename_getter,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_213 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_error_prototype_filename_setter,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_214 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_error_prototype_linenumber_getter,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_215 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_error_prototype_linenumber_setter,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_216 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_216,64381,&duk_obj_5,63934,2,2,0,0,duk_bi_error_prototype_to_string,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_217 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_217,64382,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_218 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_218,64383,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,1);
+DUK_EXTERNAL const duk_romfun duk_obj_219 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_219,64384,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,2);
+DUK_EXTERNAL const duk_romfun duk_obj_220 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_220,64385,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,3);
+DUK_EXTERNAL const duk_romfun duk_obj_221 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_221,64386,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_twoarg_shared,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_222 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_222,64387,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,13);
+DUK_EXTERNAL const duk_romfun duk_obj_223 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_223,64388,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,4);
+DUK_EXTERNAL const duk_romfun duk_obj_224 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_224,64389,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_clz32,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_225 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_225,64390,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,5);
+DUK_EXTERNAL const duk_romfun duk_obj_226 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_226,64391,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,6);
+DUK_EXTERNAL const duk_romfun duk_obj_227 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_227,64392,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,7);
+DUK_EXTERNAL const duk_romfun duk_obj_228 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_228,64393,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_hypot,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_229 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_229,64394,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_imul,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_230 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_230,64395,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,8);
+DUK_EXTERNAL const duk_romfun duk_obj_231 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_231,64396,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,14);
+DUK_EXTERNAL const duk_romfun duk_obj_232 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_232,64397,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,15);
+DUK_EXTERNAL const duk_romfun duk_obj_233 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_233,64398,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_max,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_234 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_234,64399,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_min,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_235 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_235,64400,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_twoarg_shared,2,1);
+DUK_EXTERNAL const duk_romfun duk_obj_236 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_236,64401,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_random,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_237 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_237,64402,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,9);
+DUK_EXTERNAL const duk_romfun duk_obj_238 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_238,64403,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_sign,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_239 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_239,64404,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,10);
+DUK_EXTERNAL const duk_romfun duk_obj_240 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_240,64405,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,11);
+DUK_EXTERNAL const duk_romfun duk_obj_241 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_241,64406,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,12);
+DUK_EXTERNAL const duk_romfun duk_obj_242 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_242,64407,&duk_obj_5,63934,2,2,0,0,duk_bi_math_object_onearg_shared,1,16);
+DUK_EXTERNAL const duk_romfun duk_obj_243 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_243,64408,&duk_obj_5,63934,2,2,0,0,duk_bi_json_object_parse,2,0);
+DUK_EXTERNAL const duk_romfun duk_obj_244 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_244,64409,&duk_obj_5,63934,2,2,0,0,duk_bi_json_object_stringify,3,0);
+DUK_EXTERNAL const duk_romfun duk_obj_245 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_245,64410,&duk_obj_5,63934,2,2,0,0,duk_bi_duktape_object_info,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_246 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_246,64411,&duk_obj_5,63934,2,2,0,0,duk_bi_duktape_object_act,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_247 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_247,64412,&duk_obj_5,63934,2,2,0,0,duk_bi_duktape_object_gc,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_248 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_248,64413,&duk_obj_5,63934,2,2,0,0,duk_bi_duktape_object_fin,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_249 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_249,64414,&duk_obj_5,63934,2,2,0,0,duk_bi_duktape_object_enc,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_250 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_250,64415,&duk_obj_5,63934,2,2,0,0,duk_bi_duktape_object_dec,DUK_VARARGS,0);
+DUK_EXTERNAL const duk_romfun duk_obj_251 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_251,64416,&duk_obj_5,63934,2,2,0,0,duk_bi_duktape_object_compact,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_252 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_252,64417,&duk_obj_5,63934,2,2,0,0,duk_bi_pointer_prototype_tostring_shared,0,1);
+DUK_EXTERNAL const duk_romfun duk_obj_253 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_253,64418,&duk_obj_5,63934,2,2,0,0,duk_bi_pointer_prototype_tostring_shared,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_254 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_254,64419,&duk_obj_5,63934,2,2,0,0,duk_bi_symbol_constructor_shared,1,1);
+DUK_EXTERNAL const duk_romfun duk_obj_255 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_255,64420,&duk_obj_5,63934,2,2,0,0,duk_bi_symbol_key_for,1,0);
+DUK_EXTERNAL const duk_romfun duk_obj_256 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_256,64421,&duk_obj_5,63934,2,2,0,0,duk_bi_symbol_tostring_shared,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_257 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_257,64422,&duk_obj_5,63934,2,2,0,0,duk_bi_symbol_tostring_shared,0,1);
+DUK_EXTERNAL const duk_romfun duk_obj_258 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,&duk_prop_258,64423,&duk_obj_5,63934,2,2,0,0,duk_bi_symbol_toprimitive,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_259 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_typedarray_bytelength_getter,0,0);
+DUK_EXTERNAL const duk_romfun duk_obj_260 = DUK__ROMFUN_INIT(DUK_HTYPE_OBJECT|DUK_HEAPHDR_FLAG_READONLY|DUK_HEAPHDR_FLAG_REACHABLE|DUK_HOBJECT_FLAG_NATFUNC|DUK_HOBJECT_FLAG_STRICT|DUK_HOBJECT_FLAG_NEWENV|DUK_HOBJECT_FLAG_CALLABLE|DUK_HOBJECT_CLASS_AS_FLAGS(3),1,NULL,0,&duk_obj_5,63934,0,0,0,0,duk_bi_typedarray_byteoffset_getter,0,0);
+#if defined(DUK_USE_HOBJECT_LAYOUT_1)
+DUK_EXTERNAL const duk_romprops_0 duk_prop_0 = {(const duk_hstring *)&duk_str_393,(const duk_hstring *)&duk_str_180,(const duk_hstring *)&duk_str_181,(const duk_hstring *)&duk_str_179,(const duk_hstring *)&duk_str_4,(const duk_hstring *)&duk_str_5,(const duk_hstring *)&duk_str_6,(const duk_hstring *)&duk_str_7,(const duk_hstring *)&duk_str_8,(const duk_hstring *)&duk_str_9,(const duk_hstring *)&duk_str_10,(const duk_hstring *)&duk_str_11,(const duk_hstring *)&duk_str_12,(const duk_hstring *)&duk_str_13,(const duk_hstring *)&duk_str_14,(const duk_hstring *)&duk_str_15,(const duk_hstring *)&duk_str_16,(const duk_hstring *)&duk_str_17,(const duk_hstring *)&duk_str_18,(const duk_hstring *)&duk_str_19,(const duk_hstring *)&duk_str_20,(const duk_hstring *)&duk_str_296,(const duk_hstring *)&duk_str_2,(const duk_hstring *)&duk_str_21,(const duk_hstring *)&duk_str_22,(const duk_hstring *)&duk_str_23,(const duk_hstring *)&duk_str_24,(const duk_hstring *)&duk_str_25,(const duk_hstring *)&duk_str_26,(const duk_hstring *)&duk_str_27,(const duk_hstring *)&duk_str_28,(const duk_hstring *)&duk_str_29,(const duk_hstring *)&duk_str_30,(const duk_hstring *)&duk_str_31,DUK__TVAL_OBJECT(&duk_obj_0),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,248U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,240U,0,0,0,0,0,0)),DUK__TVAL_UNDEFINED(),DUK__TVAL_OBJECT(&duk_obj_2),DUK__TVAL_OBJECT(&duk_obj_4),DUK__TVAL_OBJECT(&duk_obj_7),DUK__TVAL_OBJECT(&duk_obj_9),DUK__TVAL_OBJECT(&duk_obj_11),DUK__TVAL_OBJECT(&duk_obj_13),DUK__TVAL_OBJECT(&duk_obj_15),DUK__TVAL_OBJECT(&duk_obj_17),DUK__TVAL_OBJECT(&duk_obj_19),DUK__TVAL_OBJECT(&duk_obj_21),DUK__TVAL_OBJECT(&duk_obj_23),DUK__TVAL_OBJECT(&duk_obj_25),DUK__TVAL_OBJECT(&duk_obj_27),DUK__TVAL_OBJECT(&duk_obj_29),DUK__TVAL_OBJECT(&duk_obj_31),DUK__TVAL_OBJECT(&duk_obj_42),DUK__TVAL_OBJECT(&duk_obj_43),DUK__TVAL_OBJECT(&duk_obj_34),DUK__TVAL_OBJECT(&duk_obj_45),DUK__TVAL_OBJECT(&duk_obj_47),DUK__TVAL_OBJECT(&duk_obj_40),DUK__TVAL_OBJECT(&duk_obj_41),DUK__TVAL_OBJECT(&duk_obj_48),DUK__TVAL_OBJECT(&duk_obj_49),DUK__TVAL_OBJECT(&duk_obj_50),DUK__TVAL_OBJECT(&duk_obj_51),DUK__TVAL_OBJECT(&duk_obj_52),DUK__TVAL_OBJECT(&duk_obj_53),DUK__TVAL_OBJECT(&duk_obj_54),DUK__TVAL_OBJECT(&duk_obj_55),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_2 duk_prop_2 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_203,(const duk_hstring *)&duk_str_212,(const duk_hstring *)&duk_str_202,(const duk_hstring *)&duk_str_32,(const duk_hstring *)&duk_str_394,(const duk_hstring *)&duk_str_33,(const duk_hstring *)&duk_str_199,(const duk_hstring *)&duk_str_34,(const duk_hstring *)&duk_str_35,(const duk_hstring *)&duk_str_36,(const duk_hstring *)&duk_str_207,(const duk_hstring *)&duk_str_37,(const duk_hstring *)&duk_str_38,(const duk_hstring *)&duk_str_205,(const duk_hstring *)&duk_str_39,(const duk_hstring *)&duk_str_395,(const duk_hstring *)&duk_str_396,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_3),DUK__TVAL_STRING(&duk_str_4),DUK__TVAL_OBJECT(&duk_obj_56),DUK__TVAL_OBJECT(&duk_obj_57),DUK__TVAL_OBJECT(&duk_obj_58),DUK__TVAL_OBJECT(&duk_obj_59),DUK__TVAL_OBJECT(&duk_obj_60),DUK__TVAL_OBJECT(&duk_obj_61),DUK__TVAL_OBJECT(&duk_obj_62),DUK__TVAL_OBJECT(&duk_obj_63),DUK__TVAL_OBJECT(&duk_obj_64),DUK__TVAL_OBJECT(&duk_obj_65),DUK__TVAL_OBJECT(&duk_obj_66),DUK__TVAL_OBJECT(&duk_obj_67),DUK__TVAL_OBJECT(&duk_obj_68),DUK__TVAL_OBJECT(&duk_obj_69),DUK__TVAL_OBJECT(&duk_obj_70),DUK__TVAL_OBJECT(&duk_obj_71),DUK__TVAL_OBJECT(&duk_obj_72),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_3 duk_prop_3 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_213,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_44,(const duk_hstring *)&duk_str_45,(const duk_hstring *)&duk_str_46,(const duk_hstring *)&duk_str_397,(const duk_hstring *)&duk_str_398,(const duk_hstring *)&duk_str_399,(const duk_hstring *)&duk_str_400,DUK__TVAL_OBJECT(&duk_obj_2),DUK__TVAL_ACCESSOR(&duk_obj_73, &duk_obj_74),DUK__TVAL_OBJECT(&duk_obj_75),DUK__TVAL_OBJECT(&duk_obj_76),DUK__TVAL_OBJECT(&duk_obj_77),DUK__TVAL_OBJECT(&duk_obj_78),DUK__TVAL_OBJECT(&duk_obj_79),DUK__TVAL_OBJECT(&duk_obj_80),DUK__TVAL_OBJECT(&duk_obj_81),DUK__TVAL_OBJECT(&duk_obj_82),DUK__TVAL_OBJECT(&duk_obj_83),DUK__TVAL_OBJECT(&duk_obj_84),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_4 duk_prop_4 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_5),DUK__TVAL_STRING(&duk_str_5),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_5 duk_prop_5 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_197,(const duk_hstring *)&duk_str_47,(const duk_hstring *)&duk_str_48,(const duk_hstring *)&duk_str_209,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_4),DUK__TVAL_STRING(&duk_str_187),DUK__TVAL_OBJECT(&duk_obj_85),DUK__TVAL_OBJECT(&duk_obj_86),DUK__TVAL_OBJECT(&duk_obj_87),DUK__TVAL_OBJECT(&duk_obj_88),DUK__TVAL_OBJECT(&duk_obj_89),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_6 duk_prop_6 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_ACCESSOR(&duk_obj_90, NULL),DUK__TVAL_ACCESSOR(&duk_obj_91, NULL),DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR};
+DUK_EXTERNAL const duk_romprops_7 duk_prop_7 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_49,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_8),DUK__TVAL_STRING(&duk_str_6),DUK__TVAL_OBJECT(&duk_obj_92),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_8 duk_prop_8 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_214,(const duk_hstring *)&duk_str_50,(const duk_hstring *)&duk_str_51,(const duk_hstring *)&duk_str_52,(const duk_hstring *)&duk_str_53,(const duk_hstring *)&duk_str_54,(const duk_hstring *)&duk_str_275,(const duk_hstring *)&duk_str_55,(const duk_hstring *)&duk_str_56,(const duk_hstring *)&duk_str_57,(const duk_hstring *)&duk_str_68,(const duk_hstring *)&duk_str_69,(const duk_hstring *)&duk_str_58,(const duk_hstring *)&duk_str_59,(const duk_hstring *)&duk_str_60,(const duk_hstring *)&duk_str_61,(const duk_hstring *)&duk_str_62,(const duk_hstring *)&duk_str_63,(const duk_hstring *)&duk_str_64,DUK__TVAL_OBJECT(&duk_obj_7),DUK__TVAL_OBJECT(&duk_obj_93),DUK__TVAL_OBJECT(&duk_obj_94),DUK__TVAL_OBJECT(&duk_obj_95),DUK__TVAL_OBJECT(&duk_obj_96),DUK__TVAL_OBJECT(&duk_obj_97),DUK__TVAL_OBJECT(&duk_obj_98),DUK__TVAL_OBJECT(&duk_obj_99),DUK__TVAL_OBJECT(&duk_obj_100),DUK__TVAL_OBJECT(&duk_obj_101),DUK__TVAL_OBJECT(&duk_obj_102),DUK__TVAL_OBJECT(&duk_obj_103),DUK__TVAL_OBJECT(&duk_obj_104),DUK__TVAL_OBJECT(&duk_obj_105),DUK__TVAL_OBJECT(&duk_obj_106),DUK__TVAL_OBJECT(&duk_obj_107),DUK__TVAL_OBJECT(&duk_obj_108),DUK__TVAL_OBJECT(&duk_obj_109),DUK__TVAL_OBJECT(&duk_obj_110),DUK__TVAL_OBJECT(&duk_obj_111),DUK__TVAL_OBJECT(&duk_obj_112),DUK__TVAL_OBJECT(&duk_obj_113),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_9 duk_prop_9 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_65,(const duk_hstring *)&duk_str_401,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_10),DUK__TVAL_STRING(&duk_str_7),DUK__TVAL_OBJECT(&duk_obj_114),DUK__TVAL_OBJECT(&duk_obj_115),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_10 duk_prop_10 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_66,(const duk_hstring *)&duk_str_67,(const duk_hstring *)&duk_str_402,(const duk_hstring *)&duk_str_214,(const duk_hstring *)&duk_str_68,(const duk_hstring *)&duk_str_69,(const duk_hstring *)&duk_str_70,(const duk_hstring *)&duk_str_71,(const duk_hstring *)&duk_str_72,(const duk_hstring *)&duk_str_73,(const duk_hstring *)&duk_str_275,(const duk_hstring *)&duk_str_74,(const duk_hstring *)&duk_str_75,(const duk_hstring *)&duk_str_76,(const duk_hstring *)&duk_str_77,(const duk_hstring *)&duk_str_78,(const duk_hstring *)&duk_str_79,(const duk_hstring *)&duk_str_80,(const duk_hstring *)&duk_str_403,(const duk_hstring *)&duk_str_404,(const duk_hstring *)&duk_str_405,(const duk_hstring *)&duk_str_406,(const duk_hstring *)&duk_str_81,DUK__TVAL_OBJECT(&duk_obj_9),DUK__TVAL_STRING(&duk_str_187),DUK__TVAL_OBJECT(&duk_obj_116),DUK__TVAL_OBJECT(&duk_obj_117),DUK__TVAL_OBJECT(&duk_obj_118),DUK__TVAL_OBJECT(&duk_obj_119),DUK__TVAL_OBJECT(&duk_obj_120),DUK__TVAL_OBJECT(&duk_obj_121),DUK__TVAL_OBJECT(&duk_obj_122),DUK__TVAL_OBJECT(&duk_obj_123),DUK__TVAL_OBJECT(&duk_obj_124),DUK__TVAL_OBJECT(&duk_obj_125),DUK__TVAL_OBJECT(&duk_obj_126),DUK__TVAL_OBJECT(&duk_obj_127),DUK__TVAL_OBJECT(&duk_obj_128),DUK__TVAL_OBJECT(&duk_obj_129),DUK__TVAL_OBJECT(&duk_obj_130),DUK__TVAL_OBJECT(&duk_obj_131),DUK__TVAL_OBJECT(&duk_obj_132),DUK__TVAL_OBJECT(&duk_obj_133),DUK__TVAL_OBJECT(&duk_obj_134),DUK__TVAL_OBJECT(&duk_obj_135),DUK__TVAL_OBJECT(&duk_obj_136),DUK__TVAL_OBJECT(&duk_obj_137),DUK__TVAL_OBJECT(&duk_obj_138),DUK__TVAL_OBJECT(&duk_obj_139),DUK__TVAL_OBJECT(&duk_obj_140),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_11 duk_prop_11 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_12),DUK__TVAL_STRING(&duk_str_8),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_12 duk_prop_12 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,DUK__TVAL_OBJECT(&duk_obj_11),DUK__TVAL_BOOLEAN(0),DUK__TVAL_OBJECT(&duk_obj_141),DUK__TVAL_OBJECT(&duk_obj_142),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_13 duk_prop_13 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_82,(const duk_hstring *)&duk_str_83,(const duk_hstring *)&duk_str_180,(const duk_hstring *)&duk_str_85,(const duk_hstring *)&duk_str_84,(const duk_hstring *)&duk_str_407,(const duk_hstring *)&duk_str_408,(const duk_hstring *)&duk_str_409,(const duk_hstring *)&duk_str_25,(const duk_hstring *)&duk_str_410,(const duk_hstring *)&duk_str_24,(const duk_hstring *)&duk_str_411,(const duk_hstring *)&duk_str_22,(const duk_hstring *)&duk_str_23,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_14),DUK__TVAL_STRING(&duk_str_9),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,239U,255U,255U,255U,255U,255U,255U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,1)),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,248U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,240U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(255U,240U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(60,176U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(67,63,255U,255U,255U,255U,255U,255U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(195U,63,255U,255U,255U,255U,255U,255U)),DUK__TVAL_OBJECT(&duk_obj_143),DUK__TVAL_OBJECT(&duk_obj_144),DUK__TVAL_OBJECT(&duk_obj_145),DUK__TVAL_OBJECT(&duk_obj_146),DUK__TVAL_OBJECT(&duk_obj_40),DUK__TVAL_OBJECT(&duk_obj_41),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_14 duk_prop_14 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_86,(const duk_hstring *)&duk_str_87,(const duk_hstring *)&duk_str_88,DUK__TVAL_OBJECT(&duk_obj_13),DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_147),DUK__TVAL_OBJECT(&duk_obj_148),DUK__TVAL_OBJECT(&duk_obj_149),DUK__TVAL_OBJECT(&duk_obj_150),DUK__TVAL_OBJECT(&duk_obj_151),DUK__TVAL_OBJECT(&duk_obj_152),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_15 duk_prop_15 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_172,(const duk_hstring *)&duk_str_89,(const duk_hstring *)&duk_str_90,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,28,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_16),DUK__TVAL_STRING(&duk_str_10),DUK__TVAL_OBJECT(&duk_obj_153),DUK__TVAL_OBJECT(&duk_obj_154),DUK__TVAL_OBJECT(&duk_obj_155),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_16 duk_prop_16 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_91,(const duk_hstring *)&duk_str_92,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_94,(const duk_hstring *)&duk_str_95,(const duk_hstring *)&duk_str_130,(const duk_hstring *)&duk_str_134,(const duk_hstring *)&duk_str_131,(const duk_hstring *)&duk_str_219,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_97,(const duk_hstring *)&duk_str_98,(const duk_hstring *)&duk_str_99,(const duk_hstring *)&duk_str_100,(const duk_hstring *)&duk_str_101,(const duk_hstring *)&duk_str_102,(const duk_hstring *)&duk_str_103,(const duk_hstring *)&duk_str_104,(const duk_hstring *)&duk_str_105,(const duk_hstring *)&duk_str_106,(const duk_hstring *)&duk_str_107,(const duk_hstring *)&duk_str_108,(const duk_hstring *)&duk_str_109,(const duk_hstring *)&duk_str_110,(const duk_hstring *)&duk_str_111,(const duk_hstring *)&duk_str_112,(const duk_hstring *)&duk_str_113,(const duk_hstring *)&duk_str_114,(const duk_hstring *)&duk_str_115,(const duk_hstring *)&duk_str_116,(const duk_hstring *)&duk_str_117,(const duk_hstring *)&duk_str_118,(const duk_hstring *)&duk_str_119,(const duk_hstring *)&duk_str_120,(const duk_hstring *)&duk_str_121,(const duk_hstring *)&duk_str_122,(const duk_hstring *)&duk_str_123,(const duk_hstring *)&duk_str_124,(const duk_hstring *)&duk_str_125,(const duk_hstring *)&duk_str_126,(const duk_hstring *)&duk_str_127,(const duk_hstring *)&duk_str_128,(const duk_hstring *)&duk_str_129,(const duk_hstring *)&duk_str_132,(const duk_hstring *)&duk_str_133,(const duk_hstring *)&duk_str_208,DUK__TVAL_OBJECT(&duk_obj_15),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,248U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_156),DUK__TVAL_OBJECT(&duk_obj_157),DUK__TVAL_OBJECT(&duk_obj_158),DUK__TVAL_OBJECT(&duk_obj_159),DUK__TVAL_OBJECT(&duk_obj_160),DUK__TVAL_OBJECT(&duk_obj_161),DUK__TVAL_OBJECT(&duk_obj_162),DUK__TVAL_OBJECT(&duk_obj_162),DUK__TVAL_OBJECT(&duk_obj_163),DUK__TVAL_OBJECT(&duk_obj_164),DUK__TVAL_OBJECT(&duk_obj_165),DUK__TVAL_OBJECT(&duk_obj_166),DUK__TVAL_OBJECT(&duk_obj_167),DUK__TVAL_OBJECT(&duk_obj_168),DUK__TVAL_OBJECT(&duk_obj_169),DUK__TVAL_OBJECT(&duk_obj_170),DUK__TVAL_OBJECT(&duk_obj_171),DUK__TVAL_OBJECT(&duk_obj_172),DUK__TVAL_OBJECT(&duk_obj_173),DUK__TVAL_OBJECT(&duk_obj_174),DUK__TVAL_OBJECT(&duk_obj_175),DUK__TVAL_OBJECT(&duk_obj_176),DUK__TVAL_OBJECT(&duk_obj_177),DUK__TVAL_OBJECT(&duk_obj_178),DUK__TVAL_OBJECT(&duk_obj_179),DUK__TVAL_OBJECT(&duk_obj_180),DUK__TVAL_OBJECT(&duk_obj_181),DUK__TVAL_OBJECT(&duk_obj_182),DUK__TVAL_OBJECT(&duk_obj_183),DUK__TVAL_OBJECT(&duk_obj_184),DUK__TVAL_OBJECT(&duk_obj_185),DUK__TVAL_OBJECT(&duk_obj_186),DUK__TVAL_OBJECT(&duk_obj_187),DUK__TVAL_OBJECT(&duk_obj_188),DUK__TVAL_OBJECT(&duk_obj_189),DUK__TVAL_OBJECT(&duk_obj_190),DUK__TVAL_OBJECT(&duk_obj_191),DUK__TVAL_OBJECT(&duk_obj_192),DUK__TVAL_OBJECT(&duk_obj_193),DUK__TVAL_OBJECT(&duk_obj_194),DUK__TVAL_OBJECT(&duk_obj_195),DUK__TVAL_OBJECT(&duk_obj_196),DUK__TVAL_OBJECT(&duk_obj_197),DUK__TVAL_OBJECT(&duk_obj_198),DUK__TVAL_OBJECT(&duk_obj_199),DUK__TVAL_OBJECT(&duk_obj_200),DUK__TVAL_OBJECT(&duk_obj_201),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_17 duk_prop_17 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_18),DUK__TVAL_STRING(&duk_str_11),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_18 duk_prop_18 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_140,(const duk_hstring *)&duk_str_135,(const duk_hstring *)&duk_str_136,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_141,(const duk_hstring *)&duk_str_137,(const duk_hstring *)&duk_str_297,(const duk_hstring *)&duk_str_138,(const duk_hstring *)&duk_str_139,DUK__TVAL_OBJECT(&duk_obj_17),DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_202),DUK__TVAL_OBJECT(&duk_obj_203),DUK__TVAL_OBJECT(&duk_obj_204),DUK__TVAL_ACCESSOR(&duk_obj_205, NULL),DUK__TVAL_ACCESSOR(&duk_obj_206, NULL),DUK__TVAL_ACCESSOR(&duk_obj_207, NULL),DUK__TVAL_ACCESSOR(&duk_obj_208, NULL),DUK__TVAL_ACCESSOR(&duk_obj_209, NULL),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR};
+DUK_EXTERNAL const duk_romprops_19 duk_prop_19 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_20),DUK__TVAL_STRING(&duk_str_12),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_20 duk_prop_20 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,(const duk_hstring *)&duk_str_304,(const duk_hstring *)&duk_str_309,(const duk_hstring *)&duk_str_306,(const duk_hstring *)&duk_str_218,DUK__TVAL_OBJECT(&duk_obj_19),DUK__TVAL_STRING(&duk_str_12),DUK__TVAL_STRING(&duk_str_187),DUK__TVAL_ACCESSOR(&duk_obj_210, &duk_obj_211),DUK__TVAL_ACCESSOR(&duk_obj_212, &duk_obj_213),DUK__TVAL_ACCESSOR(&duk_obj_214, &duk_obj_215),DUK__TVAL_OBJECT(&duk_obj_216),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_21 duk_prop_21 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_22),DUK__TVAL_STRING(&duk_str_13),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_22 duk_prop_22 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK__TVAL_OBJECT(&duk_obj_21),DUK__TVAL_STRING(&duk_str_13),DUK__TVAL_STRING(&duk_str_187),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_23 duk_prop_23 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_24),DUK__TVAL_STRING(&duk_str_14),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_24 duk_prop_24 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK__TVAL_OBJECT(&duk_obj_23),DUK__TVAL_STRING(&duk_str_14),DUK__TVAL_STRING(&duk_str_187),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_25 duk_prop_25 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_26),DUK__TVAL_STRING(&duk_str_15),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_26 duk_prop_26 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK__TVAL_OBJECT(&duk_obj_25),DUK__TVAL_STRING(&duk_str_15),DUK__TVAL_STRING(&duk_str_187),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_27 duk_prop_27 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_28),DUK__TVAL_STRING(&duk_str_16),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_28 duk_prop_28 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK__TVAL_OBJECT(&duk_obj_27),DUK__TVAL_STRING(&duk_str_16),DUK__TVAL_STRING(&duk_str_187),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_29 duk_prop_29 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_30),DUK__TVAL_STRING(&duk_str_17),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_30 duk_prop_30 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK__TVAL_OBJECT(&duk_obj_29),DUK__TVAL_STRING(&duk_str_17),DUK__TVAL_STRING(&duk_str_187),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_31 duk_prop_31 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_32),DUK__TVAL_STRING(&duk_str_18),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_32 duk_prop_32 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK__TVAL_OBJECT(&duk_obj_31),DUK__TVAL_STRING(&duk_str_18),DUK__TVAL_STRING(&duk_str_187),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_33 duk_prop_33 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_303),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_34 duk_prop_34 = {(const duk_hstring *)&duk_str_327,(const duk_hstring *)&duk_str_328,(const duk_hstring *)&duk_str_301,(const duk_hstring *)&duk_str_329,(const duk_hstring *)&duk_str_330,(const duk_hstring *)&duk_str_331,(const duk_hstring *)&duk_str_332,(const duk_hstring *)&duk_str_333,(const duk_hstring *)&duk_str_334,(const duk_hstring *)&duk_str_335,DUK__TVAL_STRING(&duk_str_412),DUK__TVAL_NUMBER(DUK__DBLBYTES(64,212U,55,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_44),DUK__TVAL_OBJECT(&duk_obj_245),DUK__TVAL_OBJECT(&duk_obj_246),DUK__TVAL_OBJECT(&duk_obj_247),DUK__TVAL_OBJECT(&duk_obj_248),DUK__TVAL_OBJECT(&duk_obj_249),DUK__TVAL_OBJECT(&duk_obj_250),DUK__TVAL_OBJECT(&duk_obj_251),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_36 duk_prop_36 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,DUK__TVAL_OBJECT(&duk_obj_44),DUK__TVAL_OBJECT(&duk_obj_252),DUK__TVAL_OBJECT(&duk_obj_253),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_37 duk_prop_37 = {(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK__TVAL_STRING(&duk_str_413),DUK__TVAL_STRING(&duk_str_414),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_38 duk_prop_38 = {(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_208,(const duk_hstring *)&duk_str_210,DUK__TVAL_OBJECT(&duk_obj_45),DUK__TVAL_OBJECT(&duk_obj_256),DUK__TVAL_OBJECT(&duk_obj_257),DUK__TVAL_OBJECT(&duk_obj_258),DUK__TVAL_STRING(&duk_str_2),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_39 duk_prop_39 = {(const duk_hstring *)&duk_str_415,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_40 duk_prop_40 = {(const duk_hstring *)&duk_str_277,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_41 duk_prop_41 = {(const duk_hstring *)&duk_str_277,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_42 duk_prop_42 = {(const duk_hstring *)&duk_str_146,(const duk_hstring *)&duk_str_147,(const duk_hstring *)&duk_str_148,(const duk_hstring *)&duk_str_149,(const duk_hstring *)&duk_str_150,(const duk_hstring *)&duk_str_151,(const duk_hstring *)&duk_str_152,(const duk_hstring *)&duk_str_153,(const duk_hstring *)&duk_str_154,(const duk_hstring *)&duk_str_155,(const duk_hstring *)&duk_str_156,(const duk_hstring *)&duk_str_157,(const duk_hstring *)&duk_str_158,(const duk_hstring *)&duk_str_416,(const duk_hstring *)&duk_str_159,(const duk_hstring *)&duk_str_417,(const duk_hstring *)&duk_str_160,(const duk_hstring *)&duk_str_161,(const duk_hstring *)&duk_str_162,(const duk_hstring *)&duk_str_418,(const duk_hstring *)&duk_str_419,(const duk_hstring *)&duk_str_163,(const duk_hstring *)&duk_str_420,(const duk_hstring *)&duk_str_421,(const duk_hstring *)&duk_str_164,(const duk_hstring *)&duk_str_165,(const duk_hstring *)&duk_str_166,(const duk_hstring *)&duk_str_167,(const duk_hstring *)&duk_str_168,(const duk_hstring *)&duk_str_422,(const duk_hstring *)&duk_str_169,(const duk_hstring *)&duk_str_170,(const duk_hstring *)&duk_str_171,(const duk_hstring *)&duk_str_423,(const duk_hstring *)&duk_str_210,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,5,191U,10,139U,20,87,105)),DUK__TVAL_NUMBER(DUK__DBLBYTES(64,2,107,177U,187U,181U,85,22)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,230U,46,66,254U,250U,57,239U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,247U,21,71,101,43,130U,254U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,219U,203U,123,21,38,229U,14)),DUK__TVAL_NUMBER(DUK__DBLBYTES(64,9,33,251U,84,68,45,24)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,230U,160U,158U,102,127,59,205U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,246U,160U,158U,102,127,59,205U)),DUK__TVAL_OBJECT(&duk_obj_217),DUK__TVAL_OBJECT(&duk_obj_218),DUK__TVAL_OBJECT(&duk_obj_219),DUK__TVAL_OBJECT(&duk_obj_220),DUK__TVAL_OBJECT(&duk_obj_221),DUK__TVAL_OBJECT(&duk_obj_222),DUK__TVAL_OBJECT(&duk_obj_223),DUK__TVAL_OBJECT(&duk_obj_224),DUK__TVAL_OBJECT(&duk_obj_225),DUK__TVAL_OBJECT(&duk_obj_226),DUK__TVAL_OBJECT(&duk_obj_227),DUK__TVAL_OBJECT(&duk_obj_228),DUK__TVAL_OBJECT(&duk_obj_229),DUK__TVAL_OBJECT(&duk_obj_230),DUK__TVAL_OBJECT(&duk_obj_231),DUK__TVAL_OBJECT(&duk_obj_232),DUK__TVAL_OBJECT(&duk_obj_233),DUK__TVAL_OBJECT(&duk_obj_234),DUK__TVAL_OBJECT(&duk_obj_235),DUK__TVAL_OBJECT(&duk_obj_236),DUK__TVAL_OBJECT(&duk_obj_237),DUK__TVAL_OBJECT(&duk_obj_238),DUK__TVAL_OBJECT(&duk_obj_239),DUK__TVAL_OBJECT(&duk_obj_240),DUK__TVAL_OBJECT(&duk_obj_241),DUK__TVAL_OBJECT(&duk_obj_242),DUK__TVAL_STRING(&duk_str_19),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_43 duk_prop_43 = {(const duk_hstring *)&duk_str_172,(const duk_hstring *)&duk_str_173,DUK__TVAL_OBJECT(&duk_obj_243),DUK__TVAL_OBJECT(&duk_obj_244),DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_44 duk_prop_44 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_36),DUK__TVAL_STRING(&duk_str_301),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_45 duk_prop_45 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_358,(const duk_hstring *)&duk_str_424,(const duk_hstring *)&duk_str_425,(const duk_hstring *)&duk_str_426,(const duk_hstring *)&duk_str_427,(const duk_hstring *)&duk_str_429,(const duk_hstring *)&duk_str_430,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_2),DUK__TVAL_OBJECT(&duk_obj_38),DUK__TVAL_OBJECT(&duk_obj_254),DUK__TVAL_OBJECT(&duk_obj_255),DUK__TVAL_STRING(&duk_str_209),DUK__TVAL_STRING(&duk_str_211),DUK__TVAL_STRING(&duk_str_428),DUK__TVAL_STRING(&duk_str_208),DUK__TVAL_STRING(&duk_str_210),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_46 duk_prop_46 = {(const duk_hstring *)&duk_str_217,(const duk_hstring *)&duk_str_431,DUK__TVAL_ACCESSOR(&duk_obj_259, NULL),DUK__TVAL_ACCESSOR(&duk_obj_260, NULL),DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR};
+DUK_EXTERNAL const duk_romprops_47 duk_prop_47 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_21),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_48 duk_prop_48 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_24),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_49 duk_prop_49 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_25),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_50 duk_prop_50 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_26),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_51 duk_prop_51 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_27),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_52 duk_prop_52 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_28),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_53 duk_prop_53 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_29),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_54 duk_prop_54 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_30),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_55 duk_prop_55 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_31),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_56 duk_prop_56 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_203),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_57 duk_prop_57 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_212),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_58 duk_prop_58 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_202),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_59 duk_prop_59 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_32),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_60 duk_prop_60 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_394),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_61 duk_prop_61 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_33),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_62 duk_prop_62 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_199),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_63 duk_prop_63 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_34),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_64 duk_prop_64 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_35),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_65 duk_prop_65 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_36),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_66 duk_prop_66 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_207),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_67 duk_prop_67 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_37),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_68 duk_prop_68 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_38),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_69 duk_prop_69 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_205),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_70 duk_prop_70 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_39),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_71 duk_prop_71 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_395),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_72 duk_prop_72 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_396),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_75 duk_prop_75 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_76 duk_prop_76 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_77 duk_prop_77 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_78 duk_prop_78 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_44),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_79 duk_prop_79 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_45),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_80 duk_prop_80 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_46),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_81 duk_prop_81 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_397),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_82 duk_prop_82 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_398),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_83 duk_prop_83 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_399),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_84 duk_prop_84 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_400),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_85 duk_prop_85 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_86 duk_prop_86 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_197),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_87 duk_prop_87 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_47),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_88 duk_prop_88 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_48),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_89 duk_prop_89 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_209),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_92 duk_prop_92 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_49),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_93 duk_prop_93 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_94 duk_prop_94 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_95 duk_prop_95 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_214),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_96 duk_prop_96 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_50),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_97 duk_prop_97 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_51),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_98 duk_prop_98 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_52),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_99 duk_prop_99 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_53),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_100 duk_prop_100 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_54),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_101 duk_prop_101 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_275),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_102 duk_prop_102 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_55),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_103 duk_prop_103 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_56),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_104 duk_prop_104 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_57),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_105 duk_prop_105 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_68),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_106 duk_prop_106 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_69),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_107 duk_prop_107 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_58),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_108 duk_prop_108 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_59),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_109 duk_prop_109 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_60),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_110 duk_prop_110 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_61),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_111 duk_prop_111 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_62),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_112 duk_prop_112 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_63),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_113 duk_prop_113 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_64),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_114 duk_prop_114 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_65),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_115 duk_prop_115 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_401),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_116 duk_prop_116 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_117 duk_prop_117 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_118 duk_prop_118 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_66),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_119 duk_prop_119 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_67),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_120 duk_prop_120 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_402),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_121 duk_prop_121 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_214),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_122 duk_prop_122 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_68),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_123 duk_prop_123 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_69),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_124 duk_prop_124 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_70),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_125 duk_prop_125 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_71),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_126 duk_prop_126 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_72),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_127 duk_prop_127 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_73),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_128 duk_prop_128 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_275),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_129 duk_prop_129 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_74),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_130 duk_prop_130 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_75),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_131 duk_prop_131 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_76),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_132 duk_prop_132 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_77),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_133 duk_prop_133 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_78),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_134 duk_prop_134 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_79),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_135 duk_prop_135 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_80),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_136 duk_prop_136 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_403),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_137 duk_prop_137 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_404),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_138 duk_prop_138 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_405),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_139 duk_prop_139 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_406),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_140 duk_prop_140 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_81),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_141 duk_prop_141 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_142 duk_prop_142 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_143 duk_prop_143 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_25),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_144 duk_prop_144 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_410),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_145 duk_prop_145 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_24),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_146 duk_prop_146 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_411),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_147 duk_prop_147 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_148 duk_prop_148 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_149 duk_prop_149 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_150 duk_prop_150 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_86),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_151 duk_prop_151 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_87),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_152 duk_prop_152 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_88),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_153 duk_prop_153 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_172),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_154 duk_prop_154 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,28,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_89),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_155 duk_prop_155 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_90),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_156 duk_prop_156 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_157 duk_prop_157 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_91),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_158 duk_prop_158 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_92),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_159 duk_prop_159 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_160 duk_prop_160 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_94),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_161 duk_prop_161 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_95),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_162 duk_prop_162 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_130),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_163 duk_prop_163 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_131),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_164 duk_prop_164 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_219),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_165 duk_prop_165 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_166 duk_prop_166 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_97),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_167 duk_prop_167 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_98),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_168 duk_prop_168 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_99),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_169 duk_prop_169 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_100),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_170 duk_prop_170 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_101),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_171 duk_prop_171 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_102),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_172 duk_prop_172 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_103),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_173 duk_prop_173 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_104),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_174 duk_prop_174 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_105),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_175 duk_prop_175 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_106),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_176 duk_prop_176 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_107),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_177 duk_prop_177 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_108),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_178 duk_prop_178 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_109),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_179 duk_prop_179 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_110),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_180 duk_prop_180 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_111),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_181 duk_prop_181 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_112),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_182 duk_prop_182 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_113),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_183 duk_prop_183 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_114),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_184 duk_prop_184 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_115),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_185 duk_prop_185 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_116),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_186 duk_prop_186 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_117),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_187 duk_prop_187 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_118),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_188 duk_prop_188 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_119),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_189 duk_prop_189 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_120),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_190 duk_prop_190 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_121),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_191 duk_prop_191 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,16,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_122),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_192 duk_prop_192 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,16,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_123),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_193 duk_prop_193 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_124),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_194 duk_prop_194 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_125),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_195 duk_prop_195 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_126),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_196 duk_prop_196 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_127),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_197 duk_prop_197 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_128),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_198 duk_prop_198 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_129),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_199 duk_prop_199 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_132),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_200 duk_prop_200 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_133),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_201 duk_prop_201 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_432),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_202 duk_prop_202 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_135),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_203 duk_prop_203 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_136),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_204 duk_prop_204 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_216 duk_prop_216 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_217 duk_prop_217 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_154),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_218 duk_prop_218 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_155),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_219 duk_prop_219 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_156),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_220 duk_prop_220 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_157),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_221 duk_prop_221 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_158),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_222 duk_prop_222 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_416),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_223 duk_prop_223 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_159),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_224 duk_prop_224 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_417),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_225 duk_prop_225 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_160),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_226 duk_prop_226 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_161),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_227 duk_prop_227 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_162),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_228 duk_prop_228 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_418),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_229 duk_prop_229 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_419),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_230 duk_prop_230 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_163),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_231 duk_prop_231 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_420),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_232 duk_prop_232 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_421),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_233 duk_prop_233 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_164),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_234 duk_prop_234 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_165),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_235 duk_prop_235 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_166),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_236 duk_prop_236 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_167),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_237 duk_prop_237 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_168),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_238 duk_prop_238 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_422),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_239 duk_prop_239 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_169),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_240 duk_prop_240 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_170),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_241 duk_prop_241 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_171),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_242 duk_prop_242 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_423),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_243 duk_prop_243 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_172),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_244 duk_prop_244 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_173),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_245 duk_prop_245 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_329),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_246 duk_prop_246 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_330),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_247 duk_prop_247 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_331),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_248 duk_prop_248 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_332),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_249 duk_prop_249 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_333),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_250 duk_prop_250 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_334),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_251 duk_prop_251 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_335),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_252 duk_prop_252 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_253 duk_prop_253 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_254 duk_prop_254 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_358),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_255 duk_prop_255 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_424),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_256 duk_prop_256 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_257 duk_prop_257 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_258 duk_prop_258 = {(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_432),DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+#elif defined(DUK_USE_HOBJECT_LAYOUT_2)
+DUK_EXTERNAL const duk_romprops_0 duk_prop_0 = {DUK__TVAL_OBJECT(&duk_obj_0),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,248U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,240U,0,0,0,0,0,0)),DUK__TVAL_UNDEFINED(),DUK__TVAL_OBJECT(&duk_obj_2),DUK__TVAL_OBJECT(&duk_obj_4),DUK__TVAL_OBJECT(&duk_obj_7),DUK__TVAL_OBJECT(&duk_obj_9),DUK__TVAL_OBJECT(&duk_obj_11),DUK__TVAL_OBJECT(&duk_obj_13),DUK__TVAL_OBJECT(&duk_obj_15),DUK__TVAL_OBJECT(&duk_obj_17),DUK__TVAL_OBJECT(&duk_obj_19),DUK__TVAL_OBJECT(&duk_obj_21),DUK__TVAL_OBJECT(&duk_obj_23),DUK__TVAL_OBJECT(&duk_obj_25),DUK__TVAL_OBJECT(&duk_obj_27),DUK__TVAL_OBJECT(&duk_obj_29),DUK__TVAL_OBJECT(&duk_obj_31),DUK__TVAL_OBJECT(&duk_obj_42),DUK__TVAL_OBJECT(&duk_obj_43),DUK__TVAL_OBJECT(&duk_obj_34),DUK__TVAL_OBJECT(&duk_obj_45),DUK__TVAL_OBJECT(&duk_obj_47),DUK__TVAL_OBJECT(&duk_obj_40),DUK__TVAL_OBJECT(&duk_obj_41),DUK__TVAL_OBJECT(&duk_obj_48),DUK__TVAL_OBJECT(&duk_obj_49),DUK__TVAL_OBJECT(&duk_obj_50),DUK__TVAL_OBJECT(&duk_obj_51),DUK__TVAL_OBJECT(&duk_obj_52),DUK__TVAL_OBJECT(&duk_obj_53),DUK__TVAL_OBJECT(&duk_obj_54),DUK__TVAL_OBJECT(&duk_obj_55),(const duk_hstring *)&duk_str_393,(const duk_hstring *)&duk_str_180,(const duk_hstring *)&duk_str_181,(const duk_hstring *)&duk_str_179,(const duk_hstring *)&duk_str_4,(const duk_hstring *)&duk_str_5,(const duk_hstring *)&duk_str_6,(const duk_hstring *)&duk_str_7,(const duk_hstring *)&duk_str_8,(const duk_hstring *)&duk_str_9,(const duk_hstring *)&duk_str_10,(const duk_hstring *)&duk_str_11,(const duk_hstring *)&duk_str_12,(const duk_hstring *)&duk_str_13,(const duk_hstring *)&duk_str_14,(const duk_hstring *)&duk_str_15,(const duk_hstring *)&duk_str_16,(const duk_hstring *)&duk_str_17,(const duk_hstring *)&duk_str_18,(const duk_hstring *)&duk_str_19,(const duk_hstring *)&duk_str_20,(const duk_hstring *)&duk_str_296,(const duk_hstring *)&duk_str_2,(const duk_hstring *)&duk_str_21,(const duk_hstring *)&duk_str_22,(const duk_hstring *)&duk_str_23,(const duk_hstring *)&duk_str_24,(const duk_hstring *)&duk_str_25,(const duk_hstring *)&duk_str_26,(const duk_hstring *)&duk_str_27,(const duk_hstring *)&duk_str_28,(const duk_hstring *)&duk_str_29,(const duk_hstring *)&duk_str_30,(const duk_hstring *)&duk_str_31,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_2 duk_prop_2 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_3),DUK__TVAL_STRING(&duk_str_4),DUK__TVAL_OBJECT(&duk_obj_56),DUK__TVAL_OBJECT(&duk_obj_57),DUK__TVAL_OBJECT(&duk_obj_58),DUK__TVAL_OBJECT(&duk_obj_59),DUK__TVAL_OBJECT(&duk_obj_60),DUK__TVAL_OBJECT(&duk_obj_61),DUK__TVAL_OBJECT(&duk_obj_62),DUK__TVAL_OBJECT(&duk_obj_63),DUK__TVAL_OBJECT(&duk_obj_64),DUK__TVAL_OBJECT(&duk_obj_65),DUK__TVAL_OBJECT(&duk_obj_66),DUK__TVAL_OBJECT(&duk_obj_67),DUK__TVAL_OBJECT(&duk_obj_68),DUK__TVAL_OBJECT(&duk_obj_69),DUK__TVAL_OBJECT(&duk_obj_70),DUK__TVAL_OBJECT(&duk_obj_71),DUK__TVAL_OBJECT(&duk_obj_72),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_203,(const duk_hstring *)&duk_str_212,(const duk_hstring *)&duk_str_202,(const duk_hstring *)&duk_str_32,(const duk_hstring *)&duk_str_394,(const duk_hstring *)&duk_str_33,(const duk_hstring *)&duk_str_199,(const duk_hstring *)&duk_str_34,(const duk_hstring *)&duk_str_35,(const duk_hstring *)&duk_str_36,(const duk_hstring *)&duk_str_207,(const duk_hstring *)&duk_str_37,(const duk_hstring *)&duk_str_38,(const duk_hstring *)&duk_str_205,(const duk_hstring *)&duk_str_39,(const duk_hstring *)&duk_str_395,(const duk_hstring *)&duk_str_396,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_3 duk_prop_3 = {DUK__TVAL_OBJECT(&duk_obj_2),DUK__TVAL_ACCESSOR(&duk_obj_73, &duk_obj_74),DUK__TVAL_OBJECT(&duk_obj_75),DUK__TVAL_OBJECT(&duk_obj_76),DUK__TVAL_OBJECT(&duk_obj_77),DUK__TVAL_OBJECT(&duk_obj_78),DUK__TVAL_OBJECT(&duk_obj_79),DUK__TVAL_OBJECT(&duk_obj_80),DUK__TVAL_OBJECT(&duk_obj_81),DUK__TVAL_OBJECT(&duk_obj_82),DUK__TVAL_OBJECT(&duk_obj_83),DUK__TVAL_OBJECT(&duk_obj_84),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_213,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_44,(const duk_hstring *)&duk_str_45,(const duk_hstring *)&duk_str_46,(const duk_hstring *)&duk_str_397,(const duk_hstring *)&duk_str_398,(const duk_hstring *)&duk_str_399,(const duk_hstring *)&duk_str_400,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_4 duk_prop_4 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_5),DUK__TVAL_STRING(&duk_str_5),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_5 duk_prop_5 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_4),DUK__TVAL_STRING(&duk_str_187),DUK__TVAL_OBJECT(&duk_obj_85),DUK__TVAL_OBJECT(&duk_obj_86),DUK__TVAL_OBJECT(&duk_obj_87),DUK__TVAL_OBJECT(&duk_obj_88),DUK__TVAL_OBJECT(&duk_obj_89),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_197,(const duk_hstring *)&duk_str_47,(const duk_hstring *)&duk_str_48,(const duk_hstring *)&duk_str_209,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_6 duk_prop_6 = {DUK__TVAL_ACCESSOR(&duk_obj_90, NULL),DUK__TVAL_ACCESSOR(&duk_obj_91, NULL),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR};
+DUK_EXTERNAL const duk_romprops_7 duk_prop_7 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_8),DUK__TVAL_STRING(&duk_str_6),DUK__TVAL_OBJECT(&duk_obj_92),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_49,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_8 duk_prop_8 = {DUK__TVAL_OBJECT(&duk_obj_7),DUK__TVAL_OBJECT(&duk_obj_93),DUK__TVAL_OBJECT(&duk_obj_94),DUK__TVAL_OBJECT(&duk_obj_95),DUK__TVAL_OBJECT(&duk_obj_96),DUK__TVAL_OBJECT(&duk_obj_97),DUK__TVAL_OBJECT(&duk_obj_98),DUK__TVAL_OBJECT(&duk_obj_99),DUK__TVAL_OBJECT(&duk_obj_100),DUK__TVAL_OBJECT(&duk_obj_101),DUK__TVAL_OBJECT(&duk_obj_102),DUK__TVAL_OBJECT(&duk_obj_103),DUK__TVAL_OBJECT(&duk_obj_104),DUK__TVAL_OBJECT(&duk_obj_105),DUK__TVAL_OBJECT(&duk_obj_106),DUK__TVAL_OBJECT(&duk_obj_107),DUK__TVAL_OBJECT(&duk_obj_108),DUK__TVAL_OBJECT(&duk_obj_109),DUK__TVAL_OBJECT(&duk_obj_110),DUK__TVAL_OBJECT(&duk_obj_111),DUK__TVAL_OBJECT(&duk_obj_112),DUK__TVAL_OBJECT(&duk_obj_113),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_214,(const duk_hstring *)&duk_str_50,(const duk_hstring *)&duk_str_51,(const duk_hstring *)&duk_str_52,(const duk_hstring *)&duk_str_53,(const duk_hstring *)&duk_str_54,(const duk_hstring *)&duk_str_275,(const duk_hstring *)&duk_str_55,(const duk_hstring *)&duk_str_56,(const duk_hstring *)&duk_str_57,(const duk_hstring *)&duk_str_68,(const duk_hstring *)&duk_str_69,(const duk_hstring *)&duk_str_58,(const duk_hstring *)&duk_str_59,(const duk_hstring *)&duk_str_60,(const duk_hstring *)&duk_str_61,(const duk_hstring *)&duk_str_62,(const duk_hstring *)&duk_str_63,(const duk_hstring *)&duk_str_64,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_9 duk_prop_9 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_10),DUK__TVAL_STRING(&duk_str_7),DUK__TVAL_OBJECT(&duk_obj_114),DUK__TVAL_OBJECT(&duk_obj_115),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_65,(const duk_hstring *)&duk_str_401,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_10 duk_prop_10 = {DUK__TVAL_OBJECT(&duk_obj_9),DUK__TVAL_STRING(&duk_str_187),DUK__TVAL_OBJECT(&duk_obj_116),DUK__TVAL_OBJECT(&duk_obj_117),DUK__TVAL_OBJECT(&duk_obj_118),DUK__TVAL_OBJECT(&duk_obj_119),DUK__TVAL_OBJECT(&duk_obj_120),DUK__TVAL_OBJECT(&duk_obj_121),DUK__TVAL_OBJECT(&duk_obj_122),DUK__TVAL_OBJECT(&duk_obj_123),DUK__TVAL_OBJECT(&duk_obj_124),DUK__TVAL_OBJECT(&duk_obj_125),DUK__TVAL_OBJECT(&duk_obj_126),DUK__TVAL_OBJECT(&duk_obj_127),DUK__TVAL_OBJECT(&duk_obj_128),DUK__TVAL_OBJECT(&duk_obj_129),DUK__TVAL_OBJECT(&duk_obj_130),DUK__TVAL_OBJECT(&duk_obj_131),DUK__TVAL_OBJECT(&duk_obj_132),DUK__TVAL_OBJECT(&duk_obj_133),DUK__TVAL_OBJECT(&duk_obj_134),DUK__TVAL_OBJECT(&duk_obj_135),DUK__TVAL_OBJECT(&duk_obj_136),DUK__TVAL_OBJECT(&duk_obj_137),DUK__TVAL_OBJECT(&duk_obj_138),DUK__TVAL_OBJECT(&duk_obj_139),DUK__TVAL_OBJECT(&duk_obj_140),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_66,(const duk_hstring *)&duk_str_67,(const duk_hstring *)&duk_str_402,(const duk_hstring *)&duk_str_214,(const duk_hstring *)&duk_str_68,(const duk_hstring *)&duk_str_69,(const duk_hstring *)&duk_str_70,(const duk_hstring *)&duk_str_71,(const duk_hstring *)&duk_str_72,(const duk_hstring *)&duk_str_73,(const duk_hstring *)&duk_str_275,(const duk_hstring *)&duk_str_74,(const duk_hstring *)&duk_str_75,(const duk_hstring *)&duk_str_76,(const duk_hstring *)&duk_str_77,(const duk_hstring *)&duk_str_78,(const duk_hstring *)&duk_str_79,(const duk_hstring *)&duk_str_80,(const duk_hstring *)&duk_str_403,(const duk_hstring *)&duk_str_404,(const duk_hstring *)&duk_str_405,(const duk_hstring *)&duk_str_406,(const duk_hstring *)&duk_str_81,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_11 duk_prop_11 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_12),DUK__TVAL_STRING(&duk_str_8),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_12 duk_prop_12 = {DUK__TVAL_OBJECT(&duk_obj_11),DUK__TVAL_BOOLEAN(0),DUK__TVAL_OBJECT(&duk_obj_141),DUK__TVAL_OBJECT(&duk_obj_142),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_13 duk_prop_13 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_14),DUK__TVAL_STRING(&duk_str_9),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,239U,255U,255U,255U,255U,255U,255U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,1)),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,248U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,240U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(255U,240U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(60,176U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(67,63,255U,255U,255U,255U,255U,255U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(195U,63,255U,255U,255U,255U,255U,255U)),DUK__TVAL_OBJECT(&duk_obj_143),DUK__TVAL_OBJECT(&duk_obj_144),DUK__TVAL_OBJECT(&duk_obj_145),DUK__TVAL_OBJECT(&duk_obj_146),DUK__TVAL_OBJECT(&duk_obj_40),DUK__TVAL_OBJECT(&duk_obj_41),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_82,(const duk_hstring *)&duk_str_83,(const duk_hstring *)&duk_str_180,(const duk_hstring *)&duk_str_85,(const duk_hstring *)&duk_str_84,(const duk_hstring *)&duk_str_407,(const duk_hstring *)&duk_str_408,(const duk_hstring *)&duk_str_409,(const duk_hstring *)&duk_str_25,(const duk_hstring *)&duk_str_410,(const duk_hstring *)&duk_str_24,(const duk_hstring *)&duk_str_411,(const duk_hstring *)&duk_str_22,(const duk_hstring *)&duk_str_23,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_14 duk_prop_14 = {DUK__TVAL_OBJECT(&duk_obj_13),DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_147),DUK__TVAL_OBJECT(&duk_obj_148),DUK__TVAL_OBJECT(&duk_obj_149),DUK__TVAL_OBJECT(&duk_obj_150),DUK__TVAL_OBJECT(&duk_obj_151),DUK__TVAL_OBJECT(&duk_obj_152),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_86,(const duk_hstring *)&duk_str_87,(const duk_hstring *)&duk_str_88,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_15 duk_prop_15 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,28,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_16),DUK__TVAL_STRING(&duk_str_10),DUK__TVAL_OBJECT(&duk_obj_153),DUK__TVAL_OBJECT(&duk_obj_154),DUK__TVAL_OBJECT(&duk_obj_155),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_172,(const duk_hstring *)&duk_str_89,(const duk_hstring *)&duk_str_90,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_16 duk_prop_16 = {DUK__TVAL_OBJECT(&duk_obj_15),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,248U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_156),DUK__TVAL_OBJECT(&duk_obj_157),DUK__TVAL_OBJECT(&duk_obj_158),DUK__TVAL_OBJECT(&duk_obj_159),DUK__TVAL_OBJECT(&duk_obj_160),DUK__TVAL_OBJECT(&duk_obj_161),DUK__TVAL_OBJECT(&duk_obj_162),DUK__TVAL_OBJECT(&duk_obj_162),DUK__TVAL_OBJECT(&duk_obj_163),DUK__TVAL_OBJECT(&duk_obj_164),DUK__TVAL_OBJECT(&duk_obj_165),DUK__TVAL_OBJECT(&duk_obj_166),DUK__TVAL_OBJECT(&duk_obj_167),DUK__TVAL_OBJECT(&duk_obj_168),DUK__TVAL_OBJECT(&duk_obj_169),DUK__TVAL_OBJECT(&duk_obj_170),DUK__TVAL_OBJECT(&duk_obj_171),DUK__TVAL_OBJECT(&duk_obj_172),DUK__TVAL_OBJECT(&duk_obj_173),DUK__TVAL_OBJECT(&duk_obj_174),DUK__TVAL_OBJECT(&duk_obj_175),DUK__TVAL_OBJECT(&duk_obj_176),DUK__TVAL_OBJECT(&duk_obj_177),DUK__TVAL_OBJECT(&duk_obj_178),DUK__TVAL_OBJECT(&duk_obj_179),DUK__TVAL_OBJECT(&duk_obj_180),DUK__TVAL_OBJECT(&duk_obj_181),DUK__TVAL_OBJECT(&duk_obj_182),DUK__TVAL_OBJECT(&duk_obj_183),DUK__TVAL_OBJECT(&duk_obj_184),DUK__TVAL_OBJECT(&duk_obj_185),DUK__TVAL_OBJECT(&duk_obj_186),DUK__TVAL_OBJECT(&duk_obj_187),DUK__TVAL_OBJECT(&duk_obj_188),DUK__TVAL_OBJECT(&duk_obj_189),DUK__TVAL_OBJECT(&duk_obj_190),DUK__TVAL_OBJECT(&duk_obj_191),DUK__TVAL_OBJECT(&duk_obj_192),DUK__TVAL_OBJECT(&duk_obj_193),DUK__TVAL_OBJECT(&duk_obj_194),DUK__TVAL_OBJECT(&duk_obj_195),DUK__TVAL_OBJECT(&duk_obj_196),DUK__TVAL_OBJECT(&duk_obj_197),DUK__TVAL_OBJECT(&duk_obj_198),DUK__TVAL_OBJECT(&duk_obj_199),DUK__TVAL_OBJECT(&duk_obj_200),DUK__TVAL_OBJECT(&duk_obj_201),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_91,(const duk_hstring *)&duk_str_92,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_94,(const duk_hstring *)&duk_str_95,(const duk_hstring *)&duk_str_130,(const duk_hstring *)&duk_str_134,(const duk_hstring *)&duk_str_131,(const duk_hstring *)&duk_str_219,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_97,(const duk_hstring *)&duk_str_98,(const duk_hstring *)&duk_str_99,(const duk_hstring *)&duk_str_100,(const duk_hstring *)&duk_str_101,(const duk_hstring *)&duk_str_102,(const duk_hstring *)&duk_str_103,(const duk_hstring *)&duk_str_104,(const duk_hstring *)&duk_str_105,(const duk_hstring *)&duk_str_106,(const duk_hstring *)&duk_str_107,(const duk_hstring *)&duk_str_108,(const duk_hstring *)&duk_str_109,(const duk_hstring *)&duk_str_110,(const duk_hstring *)&duk_str_111,(const duk_hstring *)&duk_str_112,(const duk_hstring *)&duk_str_113,(const duk_hstring *)&duk_str_114,(const duk_hstring *)&duk_str_115,(const duk_hstring *)&duk_str_116,(const duk_hstring *)&duk_str_117,(const duk_hstring *)&duk_str_118,(const duk_hstring *)&duk_str_119,(const duk_hstring *)&duk_str_120,(const duk_hstring *)&duk_str_121,(const duk_hstring *)&duk_str_122,(const duk_hstring *)&duk_str_123,(const duk_hstring *)&duk_str_124,(const duk_hstring *)&duk_str_125,(const duk_hstring *)&duk_str_126,(const duk_hstring *)&duk_str_127,(const duk_hstring *)&duk_str_128,(const duk_hstring *)&duk_str_129,(const duk_hstring *)&duk_str_132,(const duk_hstring *)&duk_str_133,(const duk_hstring *)&duk_str_208,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_17 duk_prop_17 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_18),DUK__TVAL_STRING(&duk_str_11),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_18 duk_prop_18 = {DUK__TVAL_OBJECT(&duk_obj_17),DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_202),DUK__TVAL_OBJECT(&duk_obj_203),DUK__TVAL_OBJECT(&duk_obj_204),DUK__TVAL_ACCESSOR(&duk_obj_205, NULL),DUK__TVAL_ACCESSOR(&duk_obj_206, NULL),DUK__TVAL_ACCESSOR(&duk_obj_207, NULL),DUK__TVAL_ACCESSOR(&duk_obj_208, NULL),DUK__TVAL_ACCESSOR(&duk_obj_209, NULL),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_140,(const duk_hstring *)&duk_str_135,(const duk_hstring *)&duk_str_136,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_141,(const duk_hstring *)&duk_str_137,(const duk_hstring *)&duk_str_297,(const duk_hstring *)&duk_str_138,(const duk_hstring *)&duk_str_139,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR};
+DUK_EXTERNAL const duk_romprops_19 duk_prop_19 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_20),DUK__TVAL_STRING(&duk_str_12),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_20 duk_prop_20 = {DUK__TVAL_OBJECT(&duk_obj_19),DUK__TVAL_STRING(&duk_str_12),DUK__TVAL_STRING(&duk_str_187),DUK__TVAL_ACCESSOR(&duk_obj_210, &duk_obj_211),DUK__TVAL_ACCESSOR(&duk_obj_212, &duk_obj_213),DUK__TVAL_ACCESSOR(&duk_obj_214, &duk_obj_215),DUK__TVAL_OBJECT(&duk_obj_216),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,(const duk_hstring *)&duk_str_304,(const duk_hstring *)&duk_str_309,(const duk_hstring *)&duk_str_306,(const duk_hstring *)&duk_str_218,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_21 duk_prop_21 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_22),DUK__TVAL_STRING(&duk_str_13),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_22 duk_prop_22 = {DUK__TVAL_OBJECT(&duk_obj_21),DUK__TVAL_STRING(&duk_str_13),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_23 duk_prop_23 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_24),DUK__TVAL_STRING(&duk_str_14),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_24 duk_prop_24 = {DUK__TVAL_OBJECT(&duk_obj_23),DUK__TVAL_STRING(&duk_str_14),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_25 duk_prop_25 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_26),DUK__TVAL_STRING(&duk_str_15),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_26 duk_prop_26 = {DUK__TVAL_OBJECT(&duk_obj_25),DUK__TVAL_STRING(&duk_str_15),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_27 duk_prop_27 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_28),DUK__TVAL_STRING(&duk_str_16),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_28 duk_prop_28 = {DUK__TVAL_OBJECT(&duk_obj_27),DUK__TVAL_STRING(&duk_str_16),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_29 duk_prop_29 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_30),DUK__TVAL_STRING(&duk_str_17),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_30 duk_prop_30 = {DUK__TVAL_OBJECT(&duk_obj_29),DUK__TVAL_STRING(&duk_str_17),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_31 duk_prop_31 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_32),DUK__TVAL_STRING(&duk_str_18),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_32 duk_prop_32 = {DUK__TVAL_OBJECT(&duk_obj_31),DUK__TVAL_STRING(&duk_str_18),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_33 duk_prop_33 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_303),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_34 duk_prop_34 = {DUK__TVAL_STRING(&duk_str_412),DUK__TVAL_NUMBER(DUK__DBLBYTES(64,212U,55,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_44),DUK__TVAL_OBJECT(&duk_obj_245),DUK__TVAL_OBJECT(&duk_obj_246),DUK__TVAL_OBJECT(&duk_obj_247),DUK__TVAL_OBJECT(&duk_obj_248),DUK__TVAL_OBJECT(&duk_obj_249),DUK__TVAL_OBJECT(&duk_obj_250),DUK__TVAL_OBJECT(&duk_obj_251),(const duk_hstring *)&duk_str_327,(const duk_hstring *)&duk_str_328,(const duk_hstring *)&duk_str_301,(const duk_hstring *)&duk_str_329,(const duk_hstring *)&duk_str_330,(const duk_hstring *)&duk_str_331,(const duk_hstring *)&duk_str_332,(const duk_hstring *)&duk_str_333,(const duk_hstring *)&duk_str_334,(const duk_hstring *)&duk_str_335,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_36 duk_prop_36 = {DUK__TVAL_OBJECT(&duk_obj_44),DUK__TVAL_OBJECT(&duk_obj_252),DUK__TVAL_OBJECT(&duk_obj_253),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_37 duk_prop_37 = {DUK__TVAL_STRING(&duk_str_413),DUK__TVAL_STRING(&duk_str_414),(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_38 duk_prop_38 = {DUK__TVAL_OBJECT(&duk_obj_45),DUK__TVAL_OBJECT(&duk_obj_256),DUK__TVAL_OBJECT(&duk_obj_257),DUK__TVAL_OBJECT(&duk_obj_258),DUK__TVAL_STRING(&duk_str_2),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_208,(const duk_hstring *)&duk_str_210,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_39 duk_prop_39 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),(const duk_hstring *)&duk_str_415,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_40 duk_prop_40 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),(const duk_hstring *)&duk_str_277,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_41 duk_prop_41 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),(const duk_hstring *)&duk_str_277,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_42 duk_prop_42 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,5,191U,10,139U,20,87,105)),DUK__TVAL_NUMBER(DUK__DBLBYTES(64,2,107,177U,187U,181U,85,22)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,230U,46,66,254U,250U,57,239U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,247U,21,71,101,43,130U,254U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,219U,203U,123,21,38,229U,14)),DUK__TVAL_NUMBER(DUK__DBLBYTES(64,9,33,251U,84,68,45,24)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,230U,160U,158U,102,127,59,205U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,246U,160U,158U,102,127,59,205U)),DUK__TVAL_OBJECT(&duk_obj_217),DUK__TVAL_OBJECT(&duk_obj_218),DUK__TVAL_OBJECT(&duk_obj_219),DUK__TVAL_OBJECT(&duk_obj_220),DUK__TVAL_OBJECT(&duk_obj_221),DUK__TVAL_OBJECT(&duk_obj_222),DUK__TVAL_OBJECT(&duk_obj_223),DUK__TVAL_OBJECT(&duk_obj_224),DUK__TVAL_OBJECT(&duk_obj_225),DUK__TVAL_OBJECT(&duk_obj_226),DUK__TVAL_OBJECT(&duk_obj_227),DUK__TVAL_OBJECT(&duk_obj_228),DUK__TVAL_OBJECT(&duk_obj_229),DUK__TVAL_OBJECT(&duk_obj_230),DUK__TVAL_OBJECT(&duk_obj_231),DUK__TVAL_OBJECT(&duk_obj_232),DUK__TVAL_OBJECT(&duk_obj_233),DUK__TVAL_OBJECT(&duk_obj_234),DUK__TVAL_OBJECT(&duk_obj_235),DUK__TVAL_OBJECT(&duk_obj_236),DUK__TVAL_OBJECT(&duk_obj_237),DUK__TVAL_OBJECT(&duk_obj_238),DUK__TVAL_OBJECT(&duk_obj_239),DUK__TVAL_OBJECT(&duk_obj_240),DUK__TVAL_OBJECT(&duk_obj_241),DUK__TVAL_OBJECT(&duk_obj_242),DUK__TVAL_STRING(&duk_str_19),(const duk_hstring *)&duk_str_146,(const duk_hstring *)&duk_str_147,(const duk_hstring *)&duk_str_148,(const duk_hstring *)&duk_str_149,(const duk_hstring *)&duk_str_150,(const duk_hstring *)&duk_str_151,(const duk_hstring *)&duk_str_152,(const duk_hstring *)&duk_str_153,(const duk_hstring *)&duk_str_154,(const duk_hstring *)&duk_str_155,(const duk_hstring *)&duk_str_156,(const duk_hstring *)&duk_str_157,(const duk_hstring *)&duk_str_158,(const duk_hstring *)&duk_str_416,(const duk_hstring *)&duk_str_159,(const duk_hstring *)&duk_str_417,(const duk_hstring *)&duk_str_160,(const duk_hstring *)&duk_str_161,(const duk_hstring *)&duk_str_162,(const duk_hstring *)&duk_str_418,(const duk_hstring *)&duk_str_419,(const duk_hstring *)&duk_str_163,(const duk_hstring *)&duk_str_420,(const duk_hstring *)&duk_str_421,(const duk_hstring *)&duk_str_164,(const duk_hstring *)&duk_str_165,(const duk_hstring *)&duk_str_166,(const duk_hstring *)&duk_str_167,(const duk_hstring *)&duk_str_168,(const duk_hstring *)&duk_str_422,(const duk_hstring *)&duk_str_169,(const duk_hstring *)&duk_str_170,(const duk_hstring *)&duk_str_171,(const duk_hstring *)&duk_str_423,(const duk_hstring *)&duk_str_210,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_43 duk_prop_43 = {DUK__TVAL_OBJECT(&duk_obj_243),DUK__TVAL_OBJECT(&duk_obj_244),(const duk_hstring *)&duk_str_172,(const duk_hstring *)&duk_str_173,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_44 duk_prop_44 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_36),DUK__TVAL_STRING(&duk_str_301),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_45 duk_prop_45 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_2),DUK__TVAL_OBJECT(&duk_obj_38),DUK__TVAL_OBJECT(&duk_obj_254),DUK__TVAL_OBJECT(&duk_obj_255),DUK__TVAL_STRING(&duk_str_209),DUK__TVAL_STRING(&duk_str_211),DUK__TVAL_STRING(&duk_str_428),DUK__TVAL_STRING(&duk_str_208),DUK__TVAL_STRING(&duk_str_210),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_358,(const duk_hstring *)&duk_str_424,(const duk_hstring *)&duk_str_425,(const duk_hstring *)&duk_str_426,(const duk_hstring *)&duk_str_427,(const duk_hstring *)&duk_str_429,(const duk_hstring *)&duk_str_430,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_46 duk_prop_46 = {DUK__TVAL_ACCESSOR(&duk_obj_259, NULL),DUK__TVAL_ACCESSOR(&duk_obj_260, NULL),(const duk_hstring *)&duk_str_217,(const duk_hstring *)&duk_str_431,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR};
+DUK_EXTERNAL const duk_romprops_47 duk_prop_47 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_21),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_48 duk_prop_48 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_24),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_49 duk_prop_49 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_25),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_50 duk_prop_50 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_26),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_51 duk_prop_51 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_27),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_52 duk_prop_52 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_28),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_53 duk_prop_53 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_29),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_54 duk_prop_54 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_30),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_55 duk_prop_55 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_31),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_56 duk_prop_56 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_203),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_57 duk_prop_57 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_212),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_58 duk_prop_58 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_202),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_59 duk_prop_59 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_32),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_60 duk_prop_60 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_394),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_61 duk_prop_61 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_33),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_62 duk_prop_62 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_199),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_63 duk_prop_63 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_34),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_64 duk_prop_64 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_35),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_65 duk_prop_65 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_36),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_66 duk_prop_66 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_207),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_67 duk_prop_67 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_37),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_68 duk_prop_68 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_38),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_69 duk_prop_69 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_205),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_70 duk_prop_70 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_39),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_71 duk_prop_71 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_395),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_72 duk_prop_72 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_396),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_75 duk_prop_75 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_76 duk_prop_76 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_77 duk_prop_77 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_78 duk_prop_78 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_44),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_79 duk_prop_79 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_45),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_80 duk_prop_80 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_46),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_81 duk_prop_81 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_397),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_82 duk_prop_82 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_398),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_83 duk_prop_83 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_399),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_84 duk_prop_84 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_400),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_85 duk_prop_85 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_86 duk_prop_86 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_197),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_87 duk_prop_87 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_47),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_88 duk_prop_88 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_48),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_89 duk_prop_89 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_209),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_92 duk_prop_92 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_49),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_93 duk_prop_93 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_94 duk_prop_94 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_95 duk_prop_95 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_214),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_96 duk_prop_96 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_50),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_97 duk_prop_97 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_51),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_98 duk_prop_98 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_52),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_99 duk_prop_99 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_53),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_100 duk_prop_100 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_54),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_101 duk_prop_101 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_275),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_102 duk_prop_102 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_55),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_103 duk_prop_103 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_56),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_104 duk_prop_104 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_57),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_105 duk_prop_105 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_68),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_106 duk_prop_106 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_69),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_107 duk_prop_107 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_58),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_108 duk_prop_108 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_59),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_109 duk_prop_109 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_60),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_110 duk_prop_110 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_61),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_111 duk_prop_111 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_62),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_112 duk_prop_112 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_63),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_113 duk_prop_113 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_64),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_114 duk_prop_114 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_65),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_115 duk_prop_115 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_401),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_116 duk_prop_116 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_117 duk_prop_117 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_118 duk_prop_118 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_66),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_119 duk_prop_119 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_67),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_120 duk_prop_120 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_402),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_121 duk_prop_121 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_214),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_122 duk_prop_122 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_68),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_123 duk_prop_123 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_69),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_124 duk_prop_124 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_70),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_125 duk_prop_125 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_71),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_126 duk_prop_126 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_72),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_127 duk_prop_127 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_73),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_128 duk_prop_128 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_275),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_129 duk_prop_129 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_74),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_130 duk_prop_130 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_75),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_131 duk_prop_131 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_76),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_132 duk_prop_132 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_77),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_133 duk_prop_133 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_78),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_134 duk_prop_134 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_79),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_135 duk_prop_135 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_80),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_136 duk_prop_136 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_403),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_137 duk_prop_137 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_404),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_138 duk_prop_138 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_405),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_139 duk_prop_139 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_406),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_140 duk_prop_140 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_81),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_141 duk_prop_141 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_142 duk_prop_142 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_143 duk_prop_143 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_25),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_144 duk_prop_144 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_410),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_145 duk_prop_145 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_24),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_146 duk_prop_146 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_411),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_147 duk_prop_147 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_148 duk_prop_148 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_149 duk_prop_149 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_150 duk_prop_150 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_86),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_151 duk_prop_151 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_87),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_152 duk_prop_152 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_88),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_153 duk_prop_153 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_172),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_154 duk_prop_154 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,28,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_89),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_155 duk_prop_155 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_90),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_156 duk_prop_156 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_157 duk_prop_157 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_91),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_158 duk_prop_158 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_92),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_159 duk_prop_159 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_160 duk_prop_160 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_94),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_161 duk_prop_161 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_95),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_162 duk_prop_162 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_130),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_163 duk_prop_163 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_131),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_164 duk_prop_164 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_219),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_165 duk_prop_165 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_166 duk_prop_166 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_97),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_167 duk_prop_167 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_98),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_168 duk_prop_168 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_99),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_169 duk_prop_169 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_100),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_170 duk_prop_170 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_101),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_171 duk_prop_171 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_102),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_172 duk_prop_172 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_103),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_173 duk_prop_173 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_104),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_174 duk_prop_174 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_105),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_175 duk_prop_175 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_106),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_176 duk_prop_176 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_107),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_177 duk_prop_177 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_108),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_178 duk_prop_178 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_109),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_179 duk_prop_179 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_110),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_180 duk_prop_180 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_111),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_181 duk_prop_181 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_112),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_182 duk_prop_182 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_113),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_183 duk_prop_183 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_114),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_184 duk_prop_184 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_115),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_185 duk_prop_185 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_116),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_186 duk_prop_186 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_117),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_187 duk_prop_187 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_118),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_188 duk_prop_188 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_119),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_189 duk_prop_189 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_120),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_190 duk_prop_190 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_121),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_191 duk_prop_191 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,16,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_122),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_192 duk_prop_192 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,16,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_123),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_193 duk_prop_193 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_124),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_194 duk_prop_194 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_125),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_195 duk_prop_195 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_126),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_196 duk_prop_196 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_127),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_197 duk_prop_197 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_128),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_198 duk_prop_198 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_129),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_199 duk_prop_199 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_132),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_200 duk_prop_200 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_133),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_201 duk_prop_201 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_432),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_202 duk_prop_202 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_135),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_203 duk_prop_203 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_136),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_204 duk_prop_204 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_216 duk_prop_216 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_217 duk_prop_217 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_154),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_218 duk_prop_218 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_155),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_219 duk_prop_219 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_156),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_220 duk_prop_220 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_157),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_221 duk_prop_221 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_158),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_222 duk_prop_222 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_416),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_223 duk_prop_223 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_159),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_224 duk_prop_224 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_417),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_225 duk_prop_225 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_160),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_226 duk_prop_226 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_161),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_227 duk_prop_227 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_162),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_228 duk_prop_228 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_418),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_229 duk_prop_229 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_419),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_230 duk_prop_230 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_163),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_231 duk_prop_231 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_420),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_232 duk_prop_232 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_421),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_233 duk_prop_233 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_164),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_234 duk_prop_234 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_165),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_235 duk_prop_235 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_166),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_236 duk_prop_236 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_167),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_237 duk_prop_237 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_168),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_238 duk_prop_238 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_422),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_239 duk_prop_239 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_169),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_240 duk_prop_240 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_170),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_241 duk_prop_241 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_171),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_242 duk_prop_242 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_423),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_243 duk_prop_243 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_172),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_244 duk_prop_244 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_173),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_245 duk_prop_245 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_329),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_246 duk_prop_246 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_330),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_247 duk_prop_247 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_331),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_248 duk_prop_248 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_332),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_249 duk_prop_249 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_333),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_250 duk_prop_250 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_334),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_251 duk_prop_251 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_335),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_252 duk_prop_252 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_253 duk_prop_253 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_254 duk_prop_254 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_358),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_255 duk_prop_255 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_424),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_256 duk_prop_256 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_257 duk_prop_257 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_258 duk_prop_258 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_432),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+#elif defined(DUK_USE_HOBJECT_LAYOUT_3)
+DUK_EXTERNAL const duk_romprops_0 duk_prop_0 = {DUK__TVAL_OBJECT(&duk_obj_0),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,248U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,240U,0,0,0,0,0,0)),DUK__TVAL_UNDEFINED(),DUK__TVAL_OBJECT(&duk_obj_2),DUK__TVAL_OBJECT(&duk_obj_4),DUK__TVAL_OBJECT(&duk_obj_7),DUK__TVAL_OBJECT(&duk_obj_9),DUK__TVAL_OBJECT(&duk_obj_11),DUK__TVAL_OBJECT(&duk_obj_13),DUK__TVAL_OBJECT(&duk_obj_15),DUK__TVAL_OBJECT(&duk_obj_17),DUK__TVAL_OBJECT(&duk_obj_19),DUK__TVAL_OBJECT(&duk_obj_21),DUK__TVAL_OBJECT(&duk_obj_23),DUK__TVAL_OBJECT(&duk_obj_25),DUK__TVAL_OBJECT(&duk_obj_27),DUK__TVAL_OBJECT(&duk_obj_29),DUK__TVAL_OBJECT(&duk_obj_31),DUK__TVAL_OBJECT(&duk_obj_42),DUK__TVAL_OBJECT(&duk_obj_43),DUK__TVAL_OBJECT(&duk_obj_34),DUK__TVAL_OBJECT(&duk_obj_45),DUK__TVAL_OBJECT(&duk_obj_47),DUK__TVAL_OBJECT(&duk_obj_40),DUK__TVAL_OBJECT(&duk_obj_41),DUK__TVAL_OBJECT(&duk_obj_48),DUK__TVAL_OBJECT(&duk_obj_49),DUK__TVAL_OBJECT(&duk_obj_50),DUK__TVAL_OBJECT(&duk_obj_51),DUK__TVAL_OBJECT(&duk_obj_52),DUK__TVAL_OBJECT(&duk_obj_53),DUK__TVAL_OBJECT(&duk_obj_54),DUK__TVAL_OBJECT(&duk_obj_55),(const duk_hstring *)&duk_str_393,(const duk_hstring *)&duk_str_180,(const duk_hstring *)&duk_str_181,(const duk_hstring *)&duk_str_179,(const duk_hstring *)&duk_str_4,(const duk_hstring *)&duk_str_5,(const duk_hstring *)&duk_str_6,(const duk_hstring *)&duk_str_7,(const duk_hstring *)&duk_str_8,(const duk_hstring *)&duk_str_9,(const duk_hstring *)&duk_str_10,(const duk_hstring *)&duk_str_11,(const duk_hstring *)&duk_str_12,(const duk_hstring *)&duk_str_13,(const duk_hstring *)&duk_str_14,(const duk_hstring *)&duk_str_15,(const duk_hstring *)&duk_str_16,(const duk_hstring *)&duk_str_17,(const duk_hstring *)&duk_str_18,(const duk_hstring *)&duk_str_19,(const duk_hstring *)&duk_str_20,(const duk_hstring *)&duk_str_296,(const duk_hstring *)&duk_str_2,(const duk_hstring *)&duk_str_21,(const duk_hstring *)&duk_str_22,(const duk_hstring *)&duk_str_23,(const duk_hstring *)&duk_str_24,(const duk_hstring *)&duk_str_25,(const duk_hstring *)&duk_str_26,(const duk_hstring *)&duk_str_27,(const duk_hstring *)&duk_str_28,(const duk_hstring *)&duk_str_29,(const duk_hstring *)&duk_str_30,(const duk_hstring *)&duk_str_31,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_2 duk_prop_2 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_3),DUK__TVAL_STRING(&duk_str_4),DUK__TVAL_OBJECT(&duk_obj_56),DUK__TVAL_OBJECT(&duk_obj_57),DUK__TVAL_OBJECT(&duk_obj_58),DUK__TVAL_OBJECT(&duk_obj_59),DUK__TVAL_OBJECT(&duk_obj_60),DUK__TVAL_OBJECT(&duk_obj_61),DUK__TVAL_OBJECT(&duk_obj_62),DUK__TVAL_OBJECT(&duk_obj_63),DUK__TVAL_OBJECT(&duk_obj_64),DUK__TVAL_OBJECT(&duk_obj_65),DUK__TVAL_OBJECT(&duk_obj_66),DUK__TVAL_OBJECT(&duk_obj_67),DUK__TVAL_OBJECT(&duk_obj_68),DUK__TVAL_OBJECT(&duk_obj_69),DUK__TVAL_OBJECT(&duk_obj_70),DUK__TVAL_OBJECT(&duk_obj_71),DUK__TVAL_OBJECT(&duk_obj_72),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_203,(const duk_hstring *)&duk_str_212,(const duk_hstring *)&duk_str_202,(const duk_hstring *)&duk_str_32,(const duk_hstring *)&duk_str_394,(const duk_hstring *)&duk_str_33,(const duk_hstring *)&duk_str_199,(const duk_hstring *)&duk_str_34,(const duk_hstring *)&duk_str_35,(const duk_hstring *)&duk_str_36,(const duk_hstring *)&duk_str_207,(const duk_hstring *)&duk_str_37,(const duk_hstring *)&duk_str_38,(const duk_hstring *)&duk_str_205,(const duk_hstring *)&duk_str_39,(const duk_hstring *)&duk_str_395,(const duk_hstring *)&duk_str_396,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_3 duk_prop_3 = {DUK__TVAL_OBJECT(&duk_obj_2),DUK__TVAL_ACCESSOR(&duk_obj_73, &duk_obj_74),DUK__TVAL_OBJECT(&duk_obj_75),DUK__TVAL_OBJECT(&duk_obj_76),DUK__TVAL_OBJECT(&duk_obj_77),DUK__TVAL_OBJECT(&duk_obj_78),DUK__TVAL_OBJECT(&duk_obj_79),DUK__TVAL_OBJECT(&duk_obj_80),DUK__TVAL_OBJECT(&duk_obj_81),DUK__TVAL_OBJECT(&duk_obj_82),DUK__TVAL_OBJECT(&duk_obj_83),DUK__TVAL_OBJECT(&duk_obj_84),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_213,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_44,(const duk_hstring *)&duk_str_45,(const duk_hstring *)&duk_str_46,(const duk_hstring *)&duk_str_397,(const duk_hstring *)&duk_str_398,(const duk_hstring *)&duk_str_399,(const duk_hstring *)&duk_str_400,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_4 duk_prop_4 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_5),DUK__TVAL_STRING(&duk_str_5),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_5 duk_prop_5 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_4),DUK__TVAL_STRING(&duk_str_187),DUK__TVAL_OBJECT(&duk_obj_85),DUK__TVAL_OBJECT(&duk_obj_86),DUK__TVAL_OBJECT(&duk_obj_87),DUK__TVAL_OBJECT(&duk_obj_88),DUK__TVAL_OBJECT(&duk_obj_89),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_197,(const duk_hstring *)&duk_str_47,(const duk_hstring *)&duk_str_48,(const duk_hstring *)&duk_str_209,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_6 duk_prop_6 = {DUK__TVAL_ACCESSOR(&duk_obj_90, NULL),DUK__TVAL_ACCESSOR(&duk_obj_91, NULL),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR};
+DUK_EXTERNAL const duk_romprops_7 duk_prop_7 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_8),DUK__TVAL_STRING(&duk_str_6),DUK__TVAL_OBJECT(&duk_obj_92),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_49,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_8 duk_prop_8 = {DUK__TVAL_OBJECT(&duk_obj_7),DUK__TVAL_OBJECT(&duk_obj_93),DUK__TVAL_OBJECT(&duk_obj_94),DUK__TVAL_OBJECT(&duk_obj_95),DUK__TVAL_OBJECT(&duk_obj_96),DUK__TVAL_OBJECT(&duk_obj_97),DUK__TVAL_OBJECT(&duk_obj_98),DUK__TVAL_OBJECT(&duk_obj_99),DUK__TVAL_OBJECT(&duk_obj_100),DUK__TVAL_OBJECT(&duk_obj_101),DUK__TVAL_OBJECT(&duk_obj_102),DUK__TVAL_OBJECT(&duk_obj_103),DUK__TVAL_OBJECT(&duk_obj_104),DUK__TVAL_OBJECT(&duk_obj_105),DUK__TVAL_OBJECT(&duk_obj_106),DUK__TVAL_OBJECT(&duk_obj_107),DUK__TVAL_OBJECT(&duk_obj_108),DUK__TVAL_OBJECT(&duk_obj_109),DUK__TVAL_OBJECT(&duk_obj_110),DUK__TVAL_OBJECT(&duk_obj_111),DUK__TVAL_OBJECT(&duk_obj_112),DUK__TVAL_OBJECT(&duk_obj_113),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_214,(const duk_hstring *)&duk_str_50,(const duk_hstring *)&duk_str_51,(const duk_hstring *)&duk_str_52,(const duk_hstring *)&duk_str_53,(const duk_hstring *)&duk_str_54,(const duk_hstring *)&duk_str_275,(const duk_hstring *)&duk_str_55,(const duk_hstring *)&duk_str_56,(const duk_hstring *)&duk_str_57,(const duk_hstring *)&duk_str_68,(const duk_hstring *)&duk_str_69,(const duk_hstring *)&duk_str_58,(const duk_hstring *)&duk_str_59,(const duk_hstring *)&duk_str_60,(const duk_hstring *)&duk_str_61,(const duk_hstring *)&duk_str_62,(const duk_hstring *)&duk_str_63,(const duk_hstring *)&duk_str_64,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_9 duk_prop_9 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_10),DUK__TVAL_STRING(&duk_str_7),DUK__TVAL_OBJECT(&duk_obj_114),DUK__TVAL_OBJECT(&duk_obj_115),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_65,(const duk_hstring *)&duk_str_401,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_10 duk_prop_10 = {DUK__TVAL_OBJECT(&duk_obj_9),DUK__TVAL_STRING(&duk_str_187),DUK__TVAL_OBJECT(&duk_obj_116),DUK__TVAL_OBJECT(&duk_obj_117),DUK__TVAL_OBJECT(&duk_obj_118),DUK__TVAL_OBJECT(&duk_obj_119),DUK__TVAL_OBJECT(&duk_obj_120),DUK__TVAL_OBJECT(&duk_obj_121),DUK__TVAL_OBJECT(&duk_obj_122),DUK__TVAL_OBJECT(&duk_obj_123),DUK__TVAL_OBJECT(&duk_obj_124),DUK__TVAL_OBJECT(&duk_obj_125),DUK__TVAL_OBJECT(&duk_obj_126),DUK__TVAL_OBJECT(&duk_obj_127),DUK__TVAL_OBJECT(&duk_obj_128),DUK__TVAL_OBJECT(&duk_obj_129),DUK__TVAL_OBJECT(&duk_obj_130),DUK__TVAL_OBJECT(&duk_obj_131),DUK__TVAL_OBJECT(&duk_obj_132),DUK__TVAL_OBJECT(&duk_obj_133),DUK__TVAL_OBJECT(&duk_obj_134),DUK__TVAL_OBJECT(&duk_obj_135),DUK__TVAL_OBJECT(&duk_obj_136),DUK__TVAL_OBJECT(&duk_obj_137),DUK__TVAL_OBJECT(&duk_obj_138),DUK__TVAL_OBJECT(&duk_obj_139),DUK__TVAL_OBJECT(&duk_obj_140),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_66,(const duk_hstring *)&duk_str_67,(const duk_hstring *)&duk_str_402,(const duk_hstring *)&duk_str_214,(const duk_hstring *)&duk_str_68,(const duk_hstring *)&duk_str_69,(const duk_hstring *)&duk_str_70,(const duk_hstring *)&duk_str_71,(const duk_hstring *)&duk_str_72,(const duk_hstring *)&duk_str_73,(const duk_hstring *)&duk_str_275,(const duk_hstring *)&duk_str_74,(const duk_hstring *)&duk_str_75,(const duk_hstring *)&duk_str_76,(const duk_hstring *)&duk_str_77,(const duk_hstring *)&duk_str_78,(const duk_hstring *)&duk_str_79,(const duk_hstring *)&duk_str_80,(const duk_hstring *)&duk_str_403,(const duk_hstring *)&duk_str_404,(const duk_hstring *)&duk_str_405,(const duk_hstring *)&duk_str_406,(const duk_hstring *)&duk_str_81,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_11 duk_prop_11 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_12),DUK__TVAL_STRING(&duk_str_8),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_12 duk_prop_12 = {DUK__TVAL_OBJECT(&duk_obj_11),DUK__TVAL_BOOLEAN(0),DUK__TVAL_OBJECT(&duk_obj_141),DUK__TVAL_OBJECT(&duk_obj_142),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_13 duk_prop_13 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_14),DUK__TVAL_STRING(&duk_str_9),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,239U,255U,255U,255U,255U,255U,255U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,1)),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,248U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,240U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(255U,240U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(60,176U,0,0,0,0,0,0)),DUK__TVAL_NUMBER(DUK__DBLBYTES(67,63,255U,255U,255U,255U,255U,255U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(195U,63,255U,255U,255U,255U,255U,255U)),DUK__TVAL_OBJECT(&duk_obj_143),DUK__TVAL_OBJECT(&duk_obj_144),DUK__TVAL_OBJECT(&duk_obj_145),DUK__TVAL_OBJECT(&duk_obj_146),DUK__TVAL_OBJECT(&duk_obj_40),DUK__TVAL_OBJECT(&duk_obj_41),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_82,(const duk_hstring *)&duk_str_83,(const duk_hstring *)&duk_str_180,(const duk_hstring *)&duk_str_85,(const duk_hstring *)&duk_str_84,(const duk_hstring *)&duk_str_407,(const duk_hstring *)&duk_str_408,(const duk_hstring *)&duk_str_409,(const duk_hstring *)&duk_str_25,(const duk_hstring *)&duk_str_410,(const duk_hstring *)&duk_str_24,(const duk_hstring *)&duk_str_411,(const duk_hstring *)&duk_str_22,(const duk_hstring *)&duk_str_23,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_14 duk_prop_14 = {DUK__TVAL_OBJECT(&duk_obj_13),DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_147),DUK__TVAL_OBJECT(&duk_obj_148),DUK__TVAL_OBJECT(&duk_obj_149),DUK__TVAL_OBJECT(&duk_obj_150),DUK__TVAL_OBJECT(&duk_obj_151),DUK__TVAL_OBJECT(&duk_obj_152),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_86,(const duk_hstring *)&duk_str_87,(const duk_hstring *)&duk_str_88,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_15 duk_prop_15 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,28,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_16),DUK__TVAL_STRING(&duk_str_10),DUK__TVAL_OBJECT(&duk_obj_153),DUK__TVAL_OBJECT(&duk_obj_154),DUK__TVAL_OBJECT(&duk_obj_155),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_172,(const duk_hstring *)&duk_str_89,(const duk_hstring *)&duk_str_90,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_16 duk_prop_16 = {DUK__TVAL_OBJECT(&duk_obj_15),DUK__TVAL_NUMBER(DUK__DBLBYTES(127,248U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_156),DUK__TVAL_OBJECT(&duk_obj_157),DUK__TVAL_OBJECT(&duk_obj_158),DUK__TVAL_OBJECT(&duk_obj_159),DUK__TVAL_OBJECT(&duk_obj_160),DUK__TVAL_OBJECT(&duk_obj_161),DUK__TVAL_OBJECT(&duk_obj_162),DUK__TVAL_OBJECT(&duk_obj_162),DUK__TVAL_OBJECT(&duk_obj_163),DUK__TVAL_OBJECT(&duk_obj_164),DUK__TVAL_OBJECT(&duk_obj_165),DUK__TVAL_OBJECT(&duk_obj_166),DUK__TVAL_OBJECT(&duk_obj_167),DUK__TVAL_OBJECT(&duk_obj_168),DUK__TVAL_OBJECT(&duk_obj_169),DUK__TVAL_OBJECT(&duk_obj_170),DUK__TVAL_OBJECT(&duk_obj_171),DUK__TVAL_OBJECT(&duk_obj_172),DUK__TVAL_OBJECT(&duk_obj_173),DUK__TVAL_OBJECT(&duk_obj_174),DUK__TVAL_OBJECT(&duk_obj_175),DUK__TVAL_OBJECT(&duk_obj_176),DUK__TVAL_OBJECT(&duk_obj_177),DUK__TVAL_OBJECT(&duk_obj_178),DUK__TVAL_OBJECT(&duk_obj_179),DUK__TVAL_OBJECT(&duk_obj_180),DUK__TVAL_OBJECT(&duk_obj_181),DUK__TVAL_OBJECT(&duk_obj_182),DUK__TVAL_OBJECT(&duk_obj_183),DUK__TVAL_OBJECT(&duk_obj_184),DUK__TVAL_OBJECT(&duk_obj_185),DUK__TVAL_OBJECT(&duk_obj_186),DUK__TVAL_OBJECT(&duk_obj_187),DUK__TVAL_OBJECT(&duk_obj_188),DUK__TVAL_OBJECT(&duk_obj_189),DUK__TVAL_OBJECT(&duk_obj_190),DUK__TVAL_OBJECT(&duk_obj_191),DUK__TVAL_OBJECT(&duk_obj_192),DUK__TVAL_OBJECT(&duk_obj_193),DUK__TVAL_OBJECT(&duk_obj_194),DUK__TVAL_OBJECT(&duk_obj_195),DUK__TVAL_OBJECT(&duk_obj_196),DUK__TVAL_OBJECT(&duk_obj_197),DUK__TVAL_OBJECT(&duk_obj_198),DUK__TVAL_OBJECT(&duk_obj_199),DUK__TVAL_OBJECT(&duk_obj_200),DUK__TVAL_OBJECT(&duk_obj_201),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_322,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_91,(const duk_hstring *)&duk_str_92,(const duk_hstring *)&duk_str_93,(const duk_hstring *)&duk_str_94,(const duk_hstring *)&duk_str_95,(const duk_hstring *)&duk_str_130,(const duk_hstring *)&duk_str_134,(const duk_hstring *)&duk_str_131,(const duk_hstring *)&duk_str_219,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_97,(const duk_hstring *)&duk_str_98,(const duk_hstring *)&duk_str_99,(const duk_hstring *)&duk_str_100,(const duk_hstring *)&duk_str_101,(const duk_hstring *)&duk_str_102,(const duk_hstring *)&duk_str_103,(const duk_hstring *)&duk_str_104,(const duk_hstring *)&duk_str_105,(const duk_hstring *)&duk_str_106,(const duk_hstring *)&duk_str_107,(const duk_hstring *)&duk_str_108,(const duk_hstring *)&duk_str_109,(const duk_hstring *)&duk_str_110,(const duk_hstring *)&duk_str_111,(const duk_hstring *)&duk_str_112,(const duk_hstring *)&duk_str_113,(const duk_hstring *)&duk_str_114,(const duk_hstring *)&duk_str_115,(const duk_hstring *)&duk_str_116,(const duk_hstring *)&duk_str_117,(const duk_hstring *)&duk_str_118,(const duk_hstring *)&duk_str_119,(const duk_hstring *)&duk_str_120,(const duk_hstring *)&duk_str_121,(const duk_hstring *)&duk_str_122,(const duk_hstring *)&duk_str_123,(const duk_hstring *)&duk_str_124,(const duk_hstring *)&duk_str_125,(const duk_hstring *)&duk_str_126,(const duk_hstring *)&duk_str_127,(const duk_hstring *)&duk_str_128,(const duk_hstring *)&duk_str_129,(const duk_hstring *)&duk_str_132,(const duk_hstring *)&duk_str_133,(const duk_hstring *)&duk_str_208,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_17 duk_prop_17 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_18),DUK__TVAL_STRING(&duk_str_11),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_18 duk_prop_18 = {DUK__TVAL_OBJECT(&duk_obj_17),DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_202),DUK__TVAL_OBJECT(&duk_obj_203),DUK__TVAL_OBJECT(&duk_obj_204),DUK__TVAL_ACCESSOR(&duk_obj_205, NULL),DUK__TVAL_ACCESSOR(&duk_obj_206, NULL),DUK__TVAL_ACCESSOR(&duk_obj_207, NULL),DUK__TVAL_ACCESSOR(&duk_obj_208, NULL),DUK__TVAL_ACCESSOR(&duk_obj_209, NULL),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_140,(const duk_hstring *)&duk_str_135,(const duk_hstring *)&duk_str_136,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_141,(const duk_hstring *)&duk_str_137,(const duk_hstring *)&duk_str_297,(const duk_hstring *)&duk_str_138,(const duk_hstring *)&duk_str_139,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR};
+DUK_EXTERNAL const duk_romprops_19 duk_prop_19 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_20),DUK__TVAL_STRING(&duk_str_12),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_20 duk_prop_20 = {DUK__TVAL_OBJECT(&duk_obj_19),DUK__TVAL_STRING(&duk_str_12),DUK__TVAL_STRING(&duk_str_187),DUK__TVAL_ACCESSOR(&duk_obj_210, &duk_obj_211),DUK__TVAL_ACCESSOR(&duk_obj_212, &duk_obj_213),DUK__TVAL_ACCESSOR(&duk_obj_214, &duk_obj_215),DUK__TVAL_OBJECT(&duk_obj_216),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,(const duk_hstring *)&duk_str_304,(const duk_hstring *)&duk_str_309,(const duk_hstring *)&duk_str_306,(const duk_hstring *)&duk_str_218,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_21 duk_prop_21 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_22),DUK__TVAL_STRING(&duk_str_13),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_22 duk_prop_22 = {DUK__TVAL_OBJECT(&duk_obj_21),DUK__TVAL_STRING(&duk_str_13),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_23 duk_prop_23 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_24),DUK__TVAL_STRING(&duk_str_14),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_24 duk_prop_24 = {DUK__TVAL_OBJECT(&duk_obj_23),DUK__TVAL_STRING(&duk_str_14),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_25 duk_prop_25 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_26),DUK__TVAL_STRING(&duk_str_15),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_26 duk_prop_26 = {DUK__TVAL_OBJECT(&duk_obj_25),DUK__TVAL_STRING(&duk_str_15),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_27 duk_prop_27 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_28),DUK__TVAL_STRING(&duk_str_16),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_28 duk_prop_28 = {DUK__TVAL_OBJECT(&duk_obj_27),DUK__TVAL_STRING(&duk_str_16),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_29 duk_prop_29 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_30),DUK__TVAL_STRING(&duk_str_17),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_30 duk_prop_30 = {DUK__TVAL_OBJECT(&duk_obj_29),DUK__TVAL_STRING(&duk_str_17),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_31 duk_prop_31 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_32),DUK__TVAL_STRING(&duk_str_18),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_32 duk_prop_32 = {DUK__TVAL_OBJECT(&duk_obj_31),DUK__TVAL_STRING(&duk_str_18),DUK__TVAL_STRING(&duk_str_187),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_33 duk_prop_33 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_303),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_34 duk_prop_34 = {DUK__TVAL_STRING(&duk_str_412),DUK__TVAL_NUMBER(DUK__DBLBYTES(64,212U,55,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_44),DUK__TVAL_OBJECT(&duk_obj_245),DUK__TVAL_OBJECT(&duk_obj_246),DUK__TVAL_OBJECT(&duk_obj_247),DUK__TVAL_OBJECT(&duk_obj_248),DUK__TVAL_OBJECT(&duk_obj_249),DUK__TVAL_OBJECT(&duk_obj_250),DUK__TVAL_OBJECT(&duk_obj_251),(const duk_hstring *)&duk_str_327,(const duk_hstring *)&duk_str_328,(const duk_hstring *)&duk_str_301,(const duk_hstring *)&duk_str_329,(const duk_hstring *)&duk_str_330,(const duk_hstring *)&duk_str_331,(const duk_hstring *)&duk_str_332,(const duk_hstring *)&duk_str_333,(const duk_hstring *)&duk_str_334,(const duk_hstring *)&duk_str_335,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_36 duk_prop_36 = {DUK__TVAL_OBJECT(&duk_obj_44),DUK__TVAL_OBJECT(&duk_obj_252),DUK__TVAL_OBJECT(&duk_obj_253),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_37 duk_prop_37 = {DUK__TVAL_STRING(&duk_str_413),DUK__TVAL_STRING(&duk_str_414),(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_145,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_38 duk_prop_38 = {DUK__TVAL_OBJECT(&duk_obj_45),DUK__TVAL_OBJECT(&duk_obj_256),DUK__TVAL_OBJECT(&duk_obj_257),DUK__TVAL_OBJECT(&duk_obj_258),DUK__TVAL_STRING(&duk_str_2),(const duk_hstring *)&duk_str_144,(const duk_hstring *)&duk_str_218,(const duk_hstring *)&duk_str_96,(const duk_hstring *)&duk_str_208,(const duk_hstring *)&duk_str_210,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_39 duk_prop_39 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),(const duk_hstring *)&duk_str_415,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_40 duk_prop_40 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),(const duk_hstring *)&duk_str_277,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_41 duk_prop_41 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),(const duk_hstring *)&duk_str_277,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_42 duk_prop_42 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,5,191U,10,139U,20,87,105)),DUK__TVAL_NUMBER(DUK__DBLBYTES(64,2,107,177U,187U,181U,85,22)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,230U,46,66,254U,250U,57,239U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,247U,21,71,101,43,130U,254U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,219U,203U,123,21,38,229U,14)),DUK__TVAL_NUMBER(DUK__DBLBYTES(64,9,33,251U,84,68,45,24)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,230U,160U,158U,102,127,59,205U)),DUK__TVAL_NUMBER(DUK__DBLBYTES(63,246U,160U,158U,102,127,59,205U)),DUK__TVAL_OBJECT(&duk_obj_217),DUK__TVAL_OBJECT(&duk_obj_218),DUK__TVAL_OBJECT(&duk_obj_219),DUK__TVAL_OBJECT(&duk_obj_220),DUK__TVAL_OBJECT(&duk_obj_221),DUK__TVAL_OBJECT(&duk_obj_222),DUK__TVAL_OBJECT(&duk_obj_223),DUK__TVAL_OBJECT(&duk_obj_224),DUK__TVAL_OBJECT(&duk_obj_225),DUK__TVAL_OBJECT(&duk_obj_226),DUK__TVAL_OBJECT(&duk_obj_227),DUK__TVAL_OBJECT(&duk_obj_228),DUK__TVAL_OBJECT(&duk_obj_229),DUK__TVAL_OBJECT(&duk_obj_230),DUK__TVAL_OBJECT(&duk_obj_231),DUK__TVAL_OBJECT(&duk_obj_232),DUK__TVAL_OBJECT(&duk_obj_233),DUK__TVAL_OBJECT(&duk_obj_234),DUK__TVAL_OBJECT(&duk_obj_235),DUK__TVAL_OBJECT(&duk_obj_236),DUK__TVAL_OBJECT(&duk_obj_237),DUK__TVAL_OBJECT(&duk_obj_238),DUK__TVAL_OBJECT(&duk_obj_239),DUK__TVAL_OBJECT(&duk_obj_240),DUK__TVAL_OBJECT(&duk_obj_241),DUK__TVAL_OBJECT(&duk_obj_242),DUK__TVAL_STRING(&duk_str_19),(const duk_hstring *)&duk_str_146,(const duk_hstring *)&duk_str_147,(const duk_hstring *)&duk_str_148,(const duk_hstring *)&duk_str_149,(const duk_hstring *)&duk_str_150,(const duk_hstring *)&duk_str_151,(const duk_hstring *)&duk_str_152,(const duk_hstring *)&duk_str_153,(const duk_hstring *)&duk_str_154,(const duk_hstring *)&duk_str_155,(const duk_hstring *)&duk_str_156,(const duk_hstring *)&duk_str_157,(const duk_hstring *)&duk_str_158,(const duk_hstring *)&duk_str_416,(const duk_hstring *)&duk_str_159,(const duk_hstring *)&duk_str_417,(const duk_hstring *)&duk_str_160,(const duk_hstring *)&duk_str_161,(const duk_hstring *)&duk_str_162,(const duk_hstring *)&duk_str_418,(const duk_hstring *)&duk_str_419,(const duk_hstring *)&duk_str_163,(const duk_hstring *)&duk_str_420,(const duk_hstring *)&duk_str_421,(const duk_hstring *)&duk_str_164,(const duk_hstring *)&duk_str_165,(const duk_hstring *)&duk_str_166,(const duk_hstring *)&duk_str_167,(const duk_hstring *)&duk_str_168,(const duk_hstring *)&duk_str_422,(const duk_hstring *)&duk_str_169,(const duk_hstring *)&duk_str_170,(const duk_hstring *)&duk_str_171,(const duk_hstring *)&duk_str_423,(const duk_hstring *)&duk_str_210,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_43 duk_prop_43 = {DUK__TVAL_OBJECT(&duk_obj_243),DUK__TVAL_OBJECT(&duk_obj_244),(const duk_hstring *)&duk_str_172,(const duk_hstring *)&duk_str_173,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W};
+DUK_EXTERNAL const duk_romprops_44 duk_prop_44 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_OBJECT(&duk_obj_36),DUK__TVAL_STRING(&duk_str_301),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_45 duk_prop_45 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_2),DUK__TVAL_OBJECT(&duk_obj_38),DUK__TVAL_OBJECT(&duk_obj_254),DUK__TVAL_OBJECT(&duk_obj_255),DUK__TVAL_STRING(&duk_str_209),DUK__TVAL_STRING(&duk_str_211),DUK__TVAL_STRING(&duk_str_428),DUK__TVAL_STRING(&duk_str_208),DUK__TVAL_STRING(&duk_str_210),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,(const duk_hstring *)&duk_str_143,(const duk_hstring *)&duk_str_358,(const duk_hstring *)&duk_str_424,(const duk_hstring *)&duk_str_425,(const duk_hstring *)&duk_str_426,(const duk_hstring *)&duk_str_427,(const duk_hstring *)&duk_str_429,(const duk_hstring *)&duk_str_430,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_W,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_46 duk_prop_46 = {DUK__TVAL_ACCESSOR(&duk_obj_259, NULL),DUK__TVAL_ACCESSOR(&duk_obj_260, NULL),(const duk_hstring *)&duk_str_217,(const duk_hstring *)&duk_str_431,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR,DUK_PROPDESC_FLAGS_NONE|DUK_PROPDESC_FLAG_ACCESSOR};
+DUK_EXTERNAL const duk_romprops_47 duk_prop_47 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_21),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_48 duk_prop_48 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_24),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_49 duk_prop_49 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_25),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_50 duk_prop_50 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_26),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_51 duk_prop_51 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_27),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_52 duk_prop_52 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_28),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_53 duk_prop_53 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_29),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_54 duk_prop_54 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_30),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_55 duk_prop_55 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_31),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_56 duk_prop_56 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_203),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_57 duk_prop_57 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_212),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_58 duk_prop_58 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_202),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_59 duk_prop_59 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_32),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_60 duk_prop_60 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_394),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_61 duk_prop_61 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_33),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_62 duk_prop_62 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_199),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_63 duk_prop_63 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_34),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_64 duk_prop_64 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_35),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_65 duk_prop_65 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_36),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_66 duk_prop_66 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_207),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_67 duk_prop_67 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_37),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_68 duk_prop_68 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_38),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_69 duk_prop_69 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_205),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_70 duk_prop_70 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_39),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_71 duk_prop_71 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_395),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_72 duk_prop_72 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_396),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_75 duk_prop_75 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_76 duk_prop_76 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_77 duk_prop_77 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_78 duk_prop_78 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_44),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_79 duk_prop_79 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_45),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_80 duk_prop_80 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_46),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_81 duk_prop_81 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_397),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_82 duk_prop_82 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_398),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_83 duk_prop_83 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_399),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_84 duk_prop_84 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_400),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_85 duk_prop_85 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_86 duk_prop_86 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_197),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_87 duk_prop_87 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_47),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_88 duk_prop_88 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_48),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_89 duk_prop_89 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_209),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_92 duk_prop_92 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_49),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_93 duk_prop_93 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_94 duk_prop_94 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_95 duk_prop_95 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_214),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_96 duk_prop_96 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_50),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_97 duk_prop_97 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_51),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_98 duk_prop_98 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_52),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_99 duk_prop_99 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_53),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_100 duk_prop_100 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_54),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_101 duk_prop_101 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_275),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_102 duk_prop_102 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_55),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_103 duk_prop_103 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_56),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_104 duk_prop_104 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_57),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_105 duk_prop_105 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_68),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_106 duk_prop_106 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_69),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_107 duk_prop_107 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_58),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_108 duk_prop_108 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_59),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_109 duk_prop_109 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_60),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_110 duk_prop_110 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_61),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_111 duk_prop_111 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_62),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_112 duk_prop_112 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_63),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_113 duk_prop_113 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_64),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_114 duk_prop_114 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_65),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_115 duk_prop_115 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_401),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_116 duk_prop_116 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_117 duk_prop_117 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_118 duk_prop_118 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_66),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_119 duk_prop_119 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_67),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_120 duk_prop_120 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_402),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_121 duk_prop_121 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_214),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_122 duk_prop_122 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_68),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_123 duk_prop_123 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_69),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_124 duk_prop_124 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_70),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_125 duk_prop_125 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_71),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_126 duk_prop_126 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_72),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_127 duk_prop_127 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_73),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_128 duk_prop_128 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_275),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_129 duk_prop_129 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_74),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_130 duk_prop_130 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_75),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_131 duk_prop_131 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_76),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_132 duk_prop_132 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_77),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_133 duk_prop_133 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_78),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_134 duk_prop_134 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_79),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_135 duk_prop_135 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_80),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_136 duk_prop_136 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_403),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_137 duk_prop_137 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_404),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_138 duk_prop_138 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_405),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_139 duk_prop_139 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_406),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_140 duk_prop_140 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_81),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_141 duk_prop_141 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_142 duk_prop_142 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_143 duk_prop_143 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_25),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_144 duk_prop_144 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_410),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_145 duk_prop_145 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_24),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_146 duk_prop_146 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_411),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_147 duk_prop_147 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_148 duk_prop_148 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_149 duk_prop_149 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_150 duk_prop_150 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_86),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_151 duk_prop_151 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_87),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_152 duk_prop_152 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_88),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_153 duk_prop_153 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_172),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_154 duk_prop_154 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,28,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_89),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_155 duk_prop_155 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_90),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_156 duk_prop_156 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_157 duk_prop_157 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_91),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_158 duk_prop_158 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_92),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_159 duk_prop_159 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_93),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_160 duk_prop_160 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_94),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_161 duk_prop_161 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_95),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_162 duk_prop_162 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_130),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_163 duk_prop_163 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_131),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_164 duk_prop_164 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_219),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_165 duk_prop_165 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_166 duk_prop_166 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_97),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_167 duk_prop_167 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_98),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_168 duk_prop_168 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_99),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_169 duk_prop_169 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_100),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_170 duk_prop_170 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_101),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_171 duk_prop_171 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_102),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_172 duk_prop_172 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_103),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_173 duk_prop_173 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_104),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_174 duk_prop_174 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_105),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_175 duk_prop_175 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_106),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_176 duk_prop_176 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_107),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_177 duk_prop_177 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_108),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_178 duk_prop_178 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_109),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_179 duk_prop_179 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_110),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_180 duk_prop_180 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_111),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_181 duk_prop_181 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_112),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_182 duk_prop_182 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_113),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_183 duk_prop_183 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_114),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_184 duk_prop_184 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_115),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_185 duk_prop_185 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_116),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_186 duk_prop_186 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_117),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_187 duk_prop_187 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_118),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_188 duk_prop_188 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_119),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_189 duk_prop_189 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_120),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_190 duk_prop_190 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_121),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_191 duk_prop_191 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,16,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_122),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_192 duk_prop_192 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,16,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_123),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_193 duk_prop_193 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_124),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_194 duk_prop_194 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_125),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_195 duk_prop_195 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_126),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_196 duk_prop_196 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_127),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_197 duk_prop_197 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_128),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_198 duk_prop_198 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_129),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_199 duk_prop_199 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_132),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_200 duk_prop_200 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_133),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_201 duk_prop_201 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_432),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_202 duk_prop_202 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_135),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_203 duk_prop_203 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_136),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_204 duk_prop_204 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_216 duk_prop_216 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_217 duk_prop_217 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_154),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_218 duk_prop_218 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_155),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_219 duk_prop_219 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_156),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_220 duk_prop_220 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_157),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_221 duk_prop_221 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_158),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_222 duk_prop_222 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_416),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_223 duk_prop_223 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_159),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_224 duk_prop_224 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_417),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_225 duk_prop_225 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_160),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_226 duk_prop_226 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_161),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_227 duk_prop_227 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_162),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_228 duk_prop_228 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_418),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_229 duk_prop_229 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_419),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_230 duk_prop_230 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_163),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_231 duk_prop_231 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_420),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_232 duk_prop_232 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_421),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_233 duk_prop_233 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_164),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_234 duk_prop_234 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_165),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_235 duk_prop_235 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_166),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_236 duk_prop_236 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_167),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_237 duk_prop_237 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_168),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_238 duk_prop_238 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_422),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_239 duk_prop_239 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_169),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_240 duk_prop_240 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_170),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_241 duk_prop_241 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_171),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_242 duk_prop_242 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_423),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_243 duk_prop_243 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_172),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_244 duk_prop_244 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(64,8,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_173),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_245 duk_prop_245 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_329),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_246 duk_prop_246 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_330),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_247 duk_prop_247 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_331),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_248 duk_prop_248 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_332),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_249 duk_prop_249 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_333),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_250 duk_prop_250 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_334),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_251 duk_prop_251 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_335),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_252 duk_prop_252 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_253 duk_prop_253 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_254 duk_prop_254 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_358),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_255 duk_prop_255 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(63,240U,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_424),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_256 duk_prop_256 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_218),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_257 duk_prop_257 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_96),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+DUK_EXTERNAL const duk_romprops_258 duk_prop_258 = {DUK__TVAL_NUMBER(DUK__DBLBYTES(0,0,0,0,0,0,0,0)),DUK__TVAL_STRING(&duk_str_432),(const duk_hstring *)&duk_str_277,(const duk_hstring *)&duk_str_308,DUK_PROPDESC_FLAGS_NONE,DUK_PROPDESC_FLAGS_NONE};
+#else
+#error invalid object layout
+#endif
+
+DUK_INTERNAL const duk_hobject * const duk_rom_builtins_bidx[40] = {
+	(const duk_hobject *) &duk_obj_0,
+	(const duk_hobject *) &duk_obj_1,
+	(const duk_hobject *) &duk_obj_2,
+	(const duk_hobject *) &duk_obj_3,
+	(const duk_hobject *) &duk_obj_4,
+	(const duk_hobject *) &duk_obj_5,
+	(const duk_hobject *) &duk_obj_6,
+	(const duk_hobject *) &duk_obj_7,
+	(const duk_hobject *) &duk_obj_8,
+	(const duk_hobject *) &duk_obj_9,
+	(const duk_hobject *) &duk_obj_10,
+	(const duk_hobject *) &duk_obj_11,
+	(const duk_hobject *) &duk_obj_12,
+	(const duk_hobject *) &duk_obj_13,
+	(const duk_hobject *) &duk_obj_14,
+	(const duk_hobject *) &duk_obj_15,
+	(const duk_hobject *) &duk_obj_16,
+	(const duk_hobject *) &duk_obj_17,
+	(const duk_hobject *) &duk_obj_18,
+	(const duk_hobject *) &duk_obj_19,
+	(const duk_hobject *) &duk_obj_20,
+	(const duk_hobject *) &duk_obj_21,
+	(const duk_hobject *) &duk_obj_22,
+	(const duk_hobject *) &duk_obj_23,
+	(const duk_hobject *) &duk_obj_24,
+	(const duk_hobject *) &duk_obj_25,
+	(const duk_hobject *) &duk_obj_26,
+	(const duk_hobject *) &duk_obj_27,
+	(const duk_hobject *) &duk_obj_28,
+	(const duk_hobject *) &duk_obj_29,
+	(const duk_hobject *) &duk_obj_30,
+	(const duk_hobject *) &duk_obj_31,
+	(const duk_hobject *) &duk_obj_32,
+	(const duk_hobject *) &duk_obj_33,
+	(const duk_hobject *) &duk_obj_34,
+	(const duk_hobject *) &duk_obj_35,
+	(const duk_hobject *) &duk_obj_36,
+	(const duk_hobject *) &duk_obj_37,
+	(const duk_hobject *) &duk_obj_38,
+	(const duk_hobject *) &duk_obj_39,
+};
+
+#if defined(DUK_USE_ROM_OBJECTS) && defined(DUK_USE_HEAPPTR16)
+DUK_EXTERNAL const void * const duk_rom_compressed_pointers[937] = {
+	(const void *) &duk_str_187,  /* 0xf800 */
+	(const void *) &duk_str_189,  /* 0xf801 */
+	(const void *) &duk_str_185,  /* 0xf802 */
+	(const void *) &duk_str_182,  /* 0xf803 */
+	(const void *) &duk_str_188,  /* 0xf804 */
+	(const void *) &duk_str_186,  /* 0xf805 */
+	(const void *) &duk_str_183,  /* 0xf806 */
+	(const void *) &duk_str_184,  /* 0xf807 */
+	(const void *) &duk_str_3,  /* 0xf808 */
+	(const void *) &duk_str_6,  /* 0xf809 */
+	(const void *) &duk_str_263,  /* 0xf80a */
+	(const void *) &duk_str_415,  /* 0xf80b */
+	(const void *) &duk_str_8,  /* 0xf80c */
+	(const void *) &duk_str_300,  /* 0xf80d */
+	(const void *) &duk_str_264,  /* 0xf80e */
+	(const void *) &duk_str_10,  /* 0xf80f */
+	(const void *) &duk_str_299,  /* 0xf810 */
+	(const void *) &duk_str_413,  /* 0xf811 */
+	(const void *) &duk_str_296,  /* 0xf812 */
+	(const void *) &duk_str_146,  /* 0xf813 */
+	(const void *) &duk_str_407,  /* 0xf814 */
+	(const void *) &duk_str_12,  /* 0xf815 */
+	(const void *) &duk_str_13,  /* 0xf816 */
+	(const void *) &duk_str_272,  /* 0xf817 */
+	(const void *) &duk_str_273,  /* 0xf818 */
+	(const void *) &duk_str_5,  /* 0xf819 */
+	(const void *) &duk_str_181,  /* 0xf81a */
+	(const void *) &duk_str_268,  /* 0xf81b */
+	(const void *) &duk_str_270,  /* 0xf81c */
+	(const void *) &duk_str_265,  /* 0xf81d */
+	(const void *) &duk_str_191,  /* 0xf81e */
+	(const void *) &duk_str_20,  /* 0xf81f */
+	(const void *) &duk_str_147,  /* 0xf820 */
+	(const void *) &duk_str_148,  /* 0xf821 */
+	(const void *) &duk_str_150,  /* 0xf822 */
+	(const void *) &duk_str_149,  /* 0xf823 */
+	(const void *) &duk_str_408,  /* 0xf824 */
+	(const void *) &duk_str_82,  /* 0xf825 */
+	(const void *) &duk_str_409,  /* 0xf826 */
+	(const void *) &duk_str_83,  /* 0xf827 */
+	(const void *) &duk_str_19,  /* 0xf828 */
+	(const void *) &duk_str_84,  /* 0xf829 */
+	(const void *) &duk_str_180,  /* 0xf82a */
+	(const void *) &duk_str_1,  /* 0xf82b */
+	(const void *) &duk_str_9,  /* 0xf82c */
+	(const void *) &duk_str_298,  /* 0xf82d */
+	(const void *) &duk_str_4,  /* 0xf82e */
+	(const void *) &duk_str_151,  /* 0xf82f */
+	(const void *) &duk_str_85,  /* 0xf830 */
+	(const void *) &duk_str_301,  /* 0xf831 */
+	(const void *) &duk_str_195,  /* 0xf832 */
+	(const void *) &duk_str_412,  /* 0xf833 */
+	(const void *) &duk_str_14,  /* 0xf834 */
+	(const void *) &duk_str_15,  /* 0xf835 */
+	(const void *) &duk_str_196,  /* 0xf836 */
+	(const void *) &duk_str_11,  /* 0xf837 */
+	(const void *) &duk_str_152,  /* 0xf838 */
+	(const void *) &duk_str_153,  /* 0xf839 */
+	(const void *) &duk_str_7,  /* 0xf83a */
+	(const void *) &duk_str_2,  /* 0xf83b */
+	(const void *) &duk_str_16,  /* 0xf83c */
+	(const void *) &duk_str_302,  /* 0xf83d */
+	(const void *) &duk_str_303,  /* 0xf83e */
+	(const void *) &duk_str_17,  /* 0xf83f */
+	(const void *) &duk_str_18,  /* 0xf840 */
+	(const void *) &duk_str_89,  /* 0xf841 */
+	(const void *) &duk_str_269,  /* 0xf842 */
+	(const void *) &duk_str_271,  /* 0xf843 */
+	(const void *) &duk_str_266,  /* 0xf844 */
+	(const void *) &duk_str_267,  /* 0xf845 */
+	(const void *) &duk_str_0,  /* 0xf846 */
+	(const void *) &duk_str_190,  /* 0xf847 */
+	(const void *) &duk_str_432,  /* 0xf848 */
+	(const void *) &duk_str_397,  /* 0xf849 */
+	(const void *) &duk_str_398,  /* 0xf84a */
+	(const void *) &duk_str_399,  /* 0xf84b */
+	(const void *) &duk_str_400,  /* 0xf84c */
+	(const void *) &duk_str_213,  /* 0xf84d */
+	(const void *) &duk_str_154,  /* 0xf84e */
+	(const void *) &duk_str_155,  /* 0xf84f */
+	(const void *) &duk_str_330,  /* 0xf850 */
+	(const void *) &duk_str_197,  /* 0xf851 */
+	(const void *) &duk_str_192,  /* 0xf852 */
+	(const void *) &duk_str_156,  /* 0xf853 */
+	(const void *) &duk_str_394,  /* 0xf854 */
+	(const void *) &duk_str_157,  /* 0xf855 */
+	(const void *) &duk_str_158,  /* 0xf856 */
+	(const void *) &duk_str_337,  /* 0xf857 */
+	(const void *) &duk_str_48,  /* 0xf858 */
+	(const void *) &duk_str_174,  /* 0xf859 */
+	(const void *) &duk_str_348,  /* 0xf85a */
+	(const void *) &duk_str_276,  /* 0xf85b */
+	(const void *) &duk_str_217,  /* 0xf85c */
+	(const void *) &duk_str_431,  /* 0xf85d */
+	(const void *) &duk_str_47,  /* 0xf85e */
+	(const void *) &duk_str_193,  /* 0xf85f */
+	(const void *) &duk_str_194,  /* 0xf860 */
+	(const void *) &duk_str_349,  /* 0xf861 */
+	(const void *) &duk_str_350,  /* 0xf862 */
+	(const void *) &duk_str_416,  /* 0xf863 */
+	(const void *) &duk_str_159,  /* 0xf864 */
+	(const void *) &duk_str_66,  /* 0xf865 */
+	(const void *) &duk_str_67,  /* 0xf866 */
+	(const void *) &duk_str_375,  /* 0xf867 */
+	(const void *) &duk_str_417,  /* 0xf868 */
+	(const void *) &duk_str_402,  /* 0xf869 */
+	(const void *) &duk_str_335,  /* 0xf86a */
+	(const void *) &duk_str_223,  /* 0xf86b */
+	(const void *) &duk_str_323,  /* 0xf86c */
+	(const void *) &duk_str_214,  /* 0xf86d */
+	(const void *) &duk_str_42,  /* 0xf86e */
+	(const void *) &duk_str_371,  /* 0xf86f */
+	(const void *) &duk_str_198,  /* 0xf870 */
+	(const void *) &duk_str_144,  /* 0xf871 */
+	(const void *) &duk_str_351,  /* 0xf872 */
+	(const void *) &duk_str_224,  /* 0xf873 */
+	(const void *) &duk_str_160,  /* 0xf874 */
+	(const void *) &duk_str_33,  /* 0xf875 */
+	(const void *) &duk_str_341,  /* 0xf876 */
+	(const void *) &duk_str_262,  /* 0xf877 */
+	(const void *) &duk_str_352,  /* 0xf878 */
+	(const void *) &duk_str_334,  /* 0xf879 */
+	(const void *) &duk_str_26,  /* 0xf87a */
+	(const void *) &duk_str_27,  /* 0xf87b */
+	(const void *) &duk_str_353,  /* 0xf87c */
+	(const void *) &duk_str_34,  /* 0xf87d */
+	(const void *) &duk_str_199,  /* 0xf87e */
+	(const void *) &duk_str_354,  /* 0xf87f */
+	(const void *) &duk_str_200,  /* 0xf880 */
+	(const void *) &duk_str_355,  /* 0xf881 */
+	(const void *) &duk_str_356,  /* 0xf882 */
+	(const void *) &duk_str_333,  /* 0xf883 */
+	(const void *) &duk_str_28,  /* 0xf884 */
+	(const void *) &duk_str_29,  /* 0xf885 */
+	(const void *) &duk_str_405,  /* 0xf886 */
+	(const void *) &duk_str_376,  /* 0xf887 */
+	(const void *) &duk_str_43,  /* 0xf888 */
+	(const void *) &duk_str_327,  /* 0xf889 */
+	(const void *) &duk_str_222,  /* 0xf88a */
+	(const void *) &duk_str_325,  /* 0xf88b */
+	(const void *) &duk_str_326,  /* 0xf88c */
+	(const void *) &duk_str_414,  /* 0xf88d */
+	(const void *) &duk_str_30,  /* 0xf88e */
+	(const void *) &duk_str_21,  /* 0xf88f */
+	(const void *) &duk_str_58,  /* 0xf890 */
+	(const void *) &duk_str_135,  /* 0xf891 */
+	(const void *) &duk_str_161,  /* 0xf892 */
+	(const void *) &duk_str_377,  /* 0xf893 */
+	(const void *) &duk_str_378,  /* 0xf894 */
+	(const void *) &duk_str_383,  /* 0xf895 */
+	(const void *) &duk_str_309,  /* 0xf896 */
+	(const void *) &duk_str_221,  /* 0xf897 */
+	(const void *) &duk_str_62,  /* 0xf898 */
+	(const void *) &duk_str_332,  /* 0xf899 */
+	(const void *) &duk_str_357,  /* 0xf89a */
+	(const void *) &duk_str_141,  /* 0xf89b */
+	(const void *) &duk_str_162,  /* 0xf89c */
+	(const void *) &duk_str_358,  /* 0xf89d */
+	(const void *) &duk_str_60,  /* 0xf89e */
+	(const void *) &duk_str_36,  /* 0xf89f */
+	(const void *) &duk_str_65,  /* 0xf8a0 */
+	(const void *) &duk_str_401,  /* 0xf8a1 */
+	(const void *) &duk_str_359,  /* 0xf8a2 */
+	(const void *) &duk_str_331,  /* 0xf8a3 */
+	(const void *) &duk_str_201,  /* 0xf8a4 */
+	(const void *) &duk_str_102,  /* 0xf8a5 */
+	(const void *) &duk_str_104,  /* 0xf8a6 */
+	(const void *) &duk_str_286,  /* 0xf8a7 */
+	(const void *) &duk_str_287,  /* 0xf8a8 */
+	(const void *) &duk_str_98,  /* 0xf8a9 */
+	(const void *) &duk_str_106,  /* 0xf8aa */
+	(const void *) &duk_str_282,  /* 0xf8ab */
+	(const void *) &duk_str_284,  /* 0xf8ac */
+	(const void *) &duk_str_280,  /* 0xf8ad */
+	(const void *) &duk_str_112,  /* 0xf8ae */
+	(const void *) &duk_str_108,  /* 0xf8af */
+	(const void *) &duk_str_100,  /* 0xf8b0 */
+	(const void *) &duk_str_202,  /* 0xf8b1 */
+	(const void *) &duk_str_32,  /* 0xf8b2 */
+	(const void *) &duk_str_395,  /* 0xf8b3 */
+	(const void *) &duk_str_203,  /* 0xf8b4 */
+	(const void *) &duk_str_110,  /* 0xf8b5 */
+	(const void *) &duk_str_97,  /* 0xf8b6 */
+	(const void *) &duk_str_114,  /* 0xf8b7 */
+	(const void *) &duk_str_103,  /* 0xf8b8 */
+	(const void *) &duk_str_105,  /* 0xf8b9 */
+	(const void *) &duk_str_99,  /* 0xf8ba */
+	(const void *) &duk_str_107,  /* 0xf8bb */
+	(const void *) &duk_str_113,  /* 0xf8bc */
+	(const void *) &duk_str_109,  /* 0xf8bd */
+	(const void *) &duk_str_101,  /* 0xf8be */
+	(const void *) &duk_str_111,  /* 0xf8bf */
+	(const void *) &duk_str_283,  /* 0xf8c0 */
+	(const void *) &duk_str_285,  /* 0xf8c1 */
+	(const void *) &duk_str_281,  /* 0xf8c2 */
+	(const void *) &duk_str_132,  /* 0xf8c3 */
+	(const void *) &duk_str_297,  /* 0xf8c4 */
+	(const void *) &duk_str_393,  /* 0xf8c5 */
+	(const void *) &duk_str_204,  /* 0xf8c6 */
+	(const void *) &duk_str_425,  /* 0xf8c7 */
+	(const void *) &duk_str_44,  /* 0xf8c8 */
+	(const void *) &duk_str_336,  /* 0xf8c9 */
+	(const void *) &duk_str_418,  /* 0xf8ca */
+	(const void *) &duk_str_360,  /* 0xf8cb */
+	(const void *) &duk_str_138,  /* 0xf8cc */
+	(const void *) &duk_str_384,  /* 0xf8cd */
+	(const void *) &duk_str_379,  /* 0xf8ce */
+	(const void *) &duk_str_419,  /* 0xf8cf */
+	(const void *) &duk_str_361,  /* 0xf8d0 */
+	(const void *) &duk_str_406,  /* 0xf8d1 */
+	(const void *) &duk_str_142,  /* 0xf8d2 */
+	(const void *) &duk_str_68,  /* 0xf8d3 */
+	(const void *) &duk_str_329,  /* 0xf8d4 */
+	(const void *) &duk_str_324,  /* 0xf8d5 */
+	(const void *) &duk_str_362,  /* 0xf8d6 */
+	(const void *) &duk_str_385,  /* 0xf8d7 */
+	(const void *) &duk_str_396,  /* 0xf8d8 */
+	(const void *) &duk_str_49,  /* 0xf8d9 */
+	(const void *) &duk_str_216,  /* 0xf8da */
+	(const void *) &duk_str_426,  /* 0xf8db */
+	(const void *) &duk_str_215,  /* 0xf8dc */
+	(const void *) &duk_str_205,  /* 0xf8dd */
+	(const void *) &duk_str_25,  /* 0xf8de */
+	(const void *) &duk_str_38,  /* 0xf8df */
+	(const void *) &duk_str_410,  /* 0xf8e0 */
+	(const void *) &duk_str_24,  /* 0xf8e1 */
+	(const void *) &duk_str_45,  /* 0xf8e2 */
+	(const void *) &duk_str_411,  /* 0xf8e3 */
+	(const void *) &duk_str_37,  /* 0xf8e4 */
+	(const void *) &duk_str_274,  /* 0xf8e5 */
+	(const void *) &duk_str_427,  /* 0xf8e6 */
+	(const void *) &duk_str_339,  /* 0xf8e7 */
+	(const void *) &duk_str_50,  /* 0xf8e8 */
+	(const void *) &duk_str_338,  /* 0xf8e9 */
+	(const void *) &duk_str_424,  /* 0xf8ea */
+	(const void *) &duk_str_39,  /* 0xf8eb */
+	(const void *) &duk_str_140,  /* 0xf8ec */
+	(const void *) &duk_str_69,  /* 0xf8ed */
+	(const void *) &duk_str_277,  /* 0xf8ee */
+	(const void *) &duk_str_386,  /* 0xf8ef */
+	(const void *) &duk_str_306,  /* 0xf8f0 */
+	(const void *) &duk_str_70,  /* 0xf8f1 */
+	(const void *) &duk_str_163,  /* 0xf8f2 */
+	(const void *) &duk_str_421,  /* 0xf8f3 */
+	(const void *) &duk_str_420,  /* 0xf8f4 */
+	(const void *) &duk_str_61,  /* 0xf8f5 */
+	(const void *) &duk_str_71,  /* 0xf8f6 */
+	(const void *) &duk_str_164,  /* 0xf8f7 */
+	(const void *) &duk_str_145,  /* 0xf8f8 */
+	(const void *) &duk_str_165,  /* 0xf8f9 */
+	(const void *) &duk_str_139,  /* 0xf8fa */
+	(const void *) &duk_str_308,  /* 0xf8fb */
+	(const void *) &duk_str_363,  /* 0xf8fc */
+	(const void *) &duk_str_90,  /* 0xf8fd */
+	(const void *) &duk_str_381,  /* 0xf8fe */
+	(const void *) &duk_str_175,  /* 0xf8ff */
+	(const void *) &duk_str_178,  /* 0xf900 */
+	(const void *) &duk_str_206,  /* 0xf901 */
+	(const void *) &duk_str_387,  /* 0xf902 */
+	(const void *) &duk_str_172,  /* 0xf903 */
+	(const void *) &duk_str_23,  /* 0xf904 */
+	(const void *) &duk_str_22,  /* 0xf905 */
+	(const void *) &duk_str_305,  /* 0xf906 */
+	(const void *) &duk_str_310,  /* 0xf907 */
+	(const void *) &duk_str_51,  /* 0xf908 */
+	(const void *) &duk_str_166,  /* 0xf909 */
+	(const void *) &duk_str_207,  /* 0xf90a */
+	(const void *) &duk_str_388,  /* 0xf90b */
+	(const void *) &duk_str_46,  /* 0xf90c */
+	(const void *) &duk_str_389,  /* 0xf90d */
+	(const void *) &duk_str_143,  /* 0xf90e */
+	(const void *) &duk_str_390,  /* 0xf90f */
+	(const void *) &duk_str_52,  /* 0xf910 */
+	(const void *) &duk_str_167,  /* 0xf911 */
+	(const void *) &duk_str_238,  /* 0xf912 */
+	(const void *) &duk_str_237,  /* 0xf913 */
+	(const void *) &duk_str_236,  /* 0xf914 */
+	(const void *) &duk_str_235,  /* 0xf915 */
+	(const void *) &duk_str_230,  /* 0xf916 */
+	(const void *) &duk_str_229,  /* 0xf917 */
+	(const void *) &duk_str_234,  /* 0xf918 */
+	(const void *) &duk_str_233,  /* 0xf919 */
+	(const void *) &duk_str_226,  /* 0xf91a */
+	(const void *) &duk_str_242,  /* 0xf91b */
+	(const void *) &duk_str_241,  /* 0xf91c */
+	(const void *) &duk_str_228,  /* 0xf91d */
+	(const void *) &duk_str_227,  /* 0xf91e */
+	(const void *) &duk_str_232,  /* 0xf91f */
+	(const void *) &duk_str_231,  /* 0xf920 */
+	(const void *) &duk_str_225,  /* 0xf921 */
+	(const void *) &duk_str_240,  /* 0xf922 */
+	(const void *) &duk_str_239,  /* 0xf923 */
+	(const void *) &duk_str_63,  /* 0xf924 */
+	(const void *) &duk_str_64,  /* 0xf925 */
+	(const void *) &duk_str_403,  /* 0xf926 */
+	(const void *) &duk_str_72,  /* 0xf927 */
+	(const void *) &duk_str_340,  /* 0xf928 */
+	(const void *) &duk_str_364,  /* 0xf929 */
+	(const void *) &duk_str_53,  /* 0xf92a */
+	(const void *) &duk_str_168,  /* 0xf92b */
+	(const void *) &duk_str_35,  /* 0xf92c */
+	(const void *) &duk_str_73,  /* 0xf92d */
+	(const void *) &duk_str_278,  /* 0xf92e */
+	(const void *) &duk_str_124,  /* 0xf92f */
+	(const void *) &duk_str_294,  /* 0xf930 */
+	(const void *) &duk_str_295,  /* 0xf931 */
+	(const void *) &duk_str_128,  /* 0xf932 */
+	(const void *) &duk_str_122,  /* 0xf933 */
+	(const void *) &duk_str_290,  /* 0xf934 */
+	(const void *) &duk_str_292,  /* 0xf935 */
+	(const void *) &duk_str_288,  /* 0xf936 */
+	(const void *) &duk_str_116,  /* 0xf937 */
+	(const void *) &duk_str_120,  /* 0xf938 */
+	(const void *) &duk_str_126,  /* 0xf939 */
+	(const void *) &duk_str_212,  /* 0xf93a */
+	(const void *) &duk_str_118,  /* 0xf93b */
+	(const void *) &duk_str_115,  /* 0xf93c */
+	(const void *) &duk_str_125,  /* 0xf93d */
+	(const void *) &duk_str_129,  /* 0xf93e */
+	(const void *) &duk_str_123,  /* 0xf93f */
+	(const void *) &duk_str_117,  /* 0xf940 */
+	(const void *) &duk_str_121,  /* 0xf941 */
+	(const void *) &duk_str_127,  /* 0xf942 */
+	(const void *) &duk_str_119,  /* 0xf943 */
+	(const void *) &duk_str_291,  /* 0xf944 */
+	(const void *) &duk_str_293,  /* 0xf945 */
+	(const void *) &duk_str_289,  /* 0xf946 */
+	(const void *) &duk_str_133,  /* 0xf947 */
+	(const void *) &duk_str_54,  /* 0xf948 */
+	(const void *) &duk_str_422,  /* 0xf949 */
+	(const void *) &duk_str_169,  /* 0xf94a */
+	(const void *) &duk_str_275,  /* 0xf94b */
+	(const void *) &duk_str_59,  /* 0xf94c */
+	(const void *) &duk_str_55,  /* 0xf94d */
+	(const void *) &duk_str_137,  /* 0xf94e */
+	(const void *) &duk_str_56,  /* 0xf94f */
+	(const void *) &duk_str_74,  /* 0xf950 */
+	(const void *) &duk_str_170,  /* 0xf951 */
+	(const void *) &duk_str_304,  /* 0xf952 */
+	(const void *) &duk_str_404,  /* 0xf953 */
+	(const void *) &duk_str_391,  /* 0xf954 */
+	(const void *) &duk_str_176,  /* 0xf955 */
+	(const void *) &duk_str_173,  /* 0xf956 */
+	(const void *) &duk_str_279,  /* 0xf957 */
+	(const void *) &duk_str_81,  /* 0xf958 */
+	(const void *) &duk_str_75,  /* 0xf959 */
+	(const void *) &duk_str_380,  /* 0xf95a */
+	(const void *) &duk_str_365,  /* 0xf95b */
+	(const void *) &duk_str_177,  /* 0xf95c */
+	(const void *) &duk_str_171,  /* 0xf95d */
+	(const void *) &duk_str_136,  /* 0xf95e */
+	(const void *) &duk_str_366,  /* 0xf95f */
+	(const void *) &duk_str_367,  /* 0xf960 */
+	(const void *) &duk_str_91,  /* 0xf961 */
+	(const void *) &duk_str_87,  /* 0xf962 */
+	(const void *) &duk_str_86,  /* 0xf963 */
+	(const void *) &duk_str_134,  /* 0xf964 */
+	(const void *) &duk_str_131,  /* 0xf965 */
+	(const void *) &duk_str_219,  /* 0xf966 */
+	(const void *) &duk_str_94,  /* 0xf967 */
+	(const void *) &duk_str_77,  /* 0xf968 */
+	(const void *) &duk_str_93,  /* 0xf969 */
+	(const void *) &duk_str_95,  /* 0xf96a */
+	(const void *) &duk_str_79,  /* 0xf96b */
+	(const void *) &duk_str_76,  /* 0xf96c */
+	(const void *) &duk_str_88,  /* 0xf96d */
+	(const void *) &duk_str_429,  /* 0xf96e */
+	(const void *) &duk_str_218,  /* 0xf96f */
+	(const void *) &duk_str_430,  /* 0xf970 */
+	(const void *) &duk_str_92,  /* 0xf971 */
+	(const void *) &duk_str_130,  /* 0xf972 */
+	(const void *) &duk_str_78,  /* 0xf973 */
+	(const void *) &duk_str_80,  /* 0xf974 */
+	(const void *) &duk_str_382,  /* 0xf975 */
+	(const void *) &duk_str_423,  /* 0xf976 */
+	(const void *) &duk_str_368,  /* 0xf977 */
+	(const void *) &duk_str_261,  /* 0xf978 */
+	(const void *) &duk_str_369,  /* 0xf979 */
+	(const void *) &duk_str_179,  /* 0xf97a */
+	(const void *) &duk_str_31,  /* 0xf97b */
+	(const void *) &duk_str_57,  /* 0xf97c */
+	(const void *) &duk_str_40,  /* 0xf97d */
+	(const void *) &duk_str_96,  /* 0xf97e */
+	(const void *) &duk_str_370,  /* 0xf97f */
+	(const void *) &duk_str_328,  /* 0xf980 */
+	(const void *) &duk_str_372,  /* 0xf981 */
+	(const void *) &duk_str_373,  /* 0xf982 */
+	(const void *) &duk_str_374,  /* 0xf983 */
+	(const void *) &duk_str_41,  /* 0xf984 */
+	(const void *) &duk_str_220,  /* 0xf985 */
+	(const void *) &duk_str_256,  /* 0xf986 */
+	(const void *) &duk_str_255,  /* 0xf987 */
+	(const void *) &duk_str_254,  /* 0xf988 */
+	(const void *) &duk_str_253,  /* 0xf989 */
+	(const void *) &duk_str_248,  /* 0xf98a */
+	(const void *) &duk_str_247,  /* 0xf98b */
+	(const void *) &duk_str_252,  /* 0xf98c */
+	(const void *) &duk_str_251,  /* 0xf98d */
+	(const void *) &duk_str_244,  /* 0xf98e */
+	(const void *) &duk_str_260,  /* 0xf98f */
+	(const void *) &duk_str_259,  /* 0xf990 */
+	(const void *) &duk_str_246,  /* 0xf991 */
+	(const void *) &duk_str_245,  /* 0xf992 */
+	(const void *) &duk_str_250,  /* 0xf993 */
+	(const void *) &duk_str_249,  /* 0xf994 */
+	(const void *) &duk_str_243,  /* 0xf995 */
+	(const void *) &duk_str_258,  /* 0xf996 */
+	(const void *) &duk_str_257,  /* 0xf997 */
+	(const void *) &duk_str_392,  /* 0xf998 */
+	(const void *) &duk_str_346,  /* 0xf999 */
+	(const void *) &duk_str_344,  /* 0xf99a */
+	(const void *) &duk_str_343,  /* 0xf99b */
+	(const void *) &duk_str_345,  /* 0xf99c */
+	(const void *) &duk_str_342,  /* 0xf99d */
+	(const void *) &duk_str_347,  /* 0xf99e */
+	(const void *) &duk_str_209,  /* 0xf99f */
+	(const void *) &duk_str_211,  /* 0xf9a0 */
+	(const void *) &duk_str_428,  /* 0xf9a1 */
+	(const void *) &duk_str_208,  /* 0xf9a2 */
+	(const void *) &duk_str_210,  /* 0xf9a3 */
+	(const void *) &duk_str_313,  /* 0xf9a4 */
+	(const void *) &duk_str_320,  /* 0xf9a5 */
+	(const void *) &duk_str_321,  /* 0xf9a6 */
+	(const void *) &duk_str_314,  /* 0xf9a7 */
+	(const void *) &duk_str_318,  /* 0xf9a8 */
+	(const void *) &duk_str_312,  /* 0xf9a9 */
+	(const void *) &duk_str_317,  /* 0xf9aa */
+	(const void *) &duk_str_316,  /* 0xf9ab */
+	(const void *) &duk_str_311,  /* 0xf9ac */
+	(const void *) &duk_str_307,  /* 0xf9ad */
+	(const void *) &duk_str_322,  /* 0xf9ae */
+	(const void *) &duk_str_319,  /* 0xf9af */
+	(const void *) &duk_str_315,  /* 0xf9b0 */
+	(const void *) &duk_obj_7,  /* 0xf9b1 */
+	(const void *) &duk_obj_8,  /* 0xf9b2 */
+	(const void *) &duk_obj_11,  /* 0xf9b3 */
+	(const void *) &duk_obj_12,  /* 0xf9b4 */
+	(const void *) &duk_obj_15,  /* 0xf9b5 */
+	(const void *) &duk_obj_16,  /* 0xf9b6 */
+	(const void *) &duk_obj_37,  /* 0xf9b7 */
+	(const void *) &duk_obj_34,  /* 0xf9b8 */
+	(const void *) &duk_obj_19,  /* 0xf9b9 */
+	(const void *) &duk_obj_20,  /* 0xf9ba */
+	(const void *) &duk_obj_21,  /* 0xf9bb */
+	(const void *) &duk_obj_22,  /* 0xf9bc */
+	(const void *) &duk_obj_4,  /* 0xf9bd */
+	(const void *) &duk_obj_5,  /* 0xf9be */
+	(const void *) &duk_obj_0,  /* 0xf9bf */
+	(const void *) &duk_obj_1,  /* 0xf9c0 */
+	(const void *) &duk_obj_43,  /* 0xf9c1 */
+	(const void *) &duk_obj_42,  /* 0xf9c2 */
+	(const void *) &duk_obj_6,  /* 0xf9c3 */
+	(const void *) &duk_obj_13,  /* 0xf9c4 */
+	(const void *) &duk_obj_14,  /* 0xf9c5 */
+	(const void *) &duk_obj_2,  /* 0xf9c6 */
+	(const void *) &duk_obj_3,  /* 0xf9c7 */
+	(const void *) &duk_obj_41,  /* 0xf9c8 */
+	(const void *) &duk_obj_40,  /* 0xf9c9 */
+	(const void *) &duk_obj_44,  /* 0xf9ca */
+	(const void *) &duk_obj_36,  /* 0xf9cb */
+	(const void *) &duk_obj_23,  /* 0xf9cc */
+	(const void *) &duk_obj_24,  /* 0xf9cd */
+	(const void *) &duk_obj_25,  /* 0xf9ce */
+	(const void *) &duk_obj_26,  /* 0xf9cf */
+	(const void *) &duk_obj_17,  /* 0xf9d0 */
+	(const void *) &duk_obj_18,  /* 0xf9d1 */
+	(const void *) &duk_obj_9,  /* 0xf9d2 */
+	(const void *) &duk_obj_10,  /* 0xf9d3 */
+	(const void *) &duk_obj_45,  /* 0xf9d4 */
+	(const void *) &duk_obj_38,  /* 0xf9d5 */
+	(const void *) &duk_obj_27,  /* 0xf9d6 */
+	(const void *) &duk_obj_28,  /* 0xf9d7 */
+	(const void *) &duk_obj_35,  /* 0xf9d8 */
+	(const void *) &duk_obj_29,  /* 0xf9d9 */
+	(const void *) &duk_obj_30,  /* 0xf9da */
+	(const void *) &duk_obj_33,  /* 0xf9db */
+	(const void *) &duk_obj_46,  /* 0xf9dc */
+	(const void *) &duk_obj_39,  /* 0xf9dd */
+	(const void *) &duk_obj_31,  /* 0xf9de */
+	(const void *) &duk_obj_32,  /* 0xf9df */
+	(const void *) &duk_obj_47,  /* 0xf9e0 */
+	(const void *) &duk_obj_48,  /* 0xf9e1 */
+	(const void *) &duk_obj_57,  /* 0xf9e2 */
+	(const void *) &duk_obj_147,  /* 0xf9e3 */
+	(const void *) &duk_obj_148,  /* 0xf9e4 */
+	(const void *) &duk_obj_149,  /* 0xf9e5 */
+	(const void *) &duk_obj_150,  /* 0xf9e6 */
+	(const void *) &duk_obj_151,  /* 0xf9e7 */
+	(const void *) &duk_obj_152,  /* 0xf9e8 */
+	(const void *) &duk_obj_153,  /* 0xf9e9 */
+	(const void *) &duk_obj_154,  /* 0xf9ea */
+	(const void *) &duk_obj_155,  /* 0xf9eb */
+	(const void *) &duk_obj_156,  /* 0xf9ec */
+	(const void *) &duk_obj_58,  /* 0xf9ed */
+	(const void *) &duk_obj_157,  /* 0xf9ee */
+	(const void *) &duk_obj_158,  /* 0xf9ef */
+	(const void *) &duk_obj_159,  /* 0xf9f0 */
+	(const void *) &duk_obj_160,  /* 0xf9f1 */
+	(const void *) &duk_obj_161,  /* 0xf9f2 */
+	(const void *) &duk_obj_162,  /* 0xf9f3 */
+	(const void *) &duk_obj_163,  /* 0xf9f4 */
+	(const void *) &duk_obj_164,  /* 0xf9f5 */
+	(const void *) &duk_obj_165,  /* 0xf9f6 */
+	(const void *) &duk_obj_166,  /* 0xf9f7 */
+	(const void *) &duk_obj_59,  /* 0xf9f8 */
+	(const void *) &duk_obj_167,  /* 0xf9f9 */
+	(const void *) &duk_obj_168,  /* 0xf9fa */
+	(const void *) &duk_obj_169,  /* 0xf9fb */
+	(const void *) &duk_obj_170,  /* 0xf9fc */
+	(const void *) &duk_obj_171,  /* 0xf9fd */
+	(const void *) &duk_obj_172,  /* 0xf9fe */
+	(const void *) &duk_obj_173,  /* 0xf9ff */
+	(const void *) &duk_obj_174,  /* 0xfa00 */
+	(const void *) &duk_obj_175,  /* 0xfa01 */
+	(const void *) &duk_obj_176,  /* 0xfa02 */
+	(const void *) &duk_obj_60,  /* 0xfa03 */
+	(const void *) &duk_obj_177,  /* 0xfa04 */
+	(const void *) &duk_obj_178,  /* 0xfa05 */
+	(const void *) &duk_obj_179,  /* 0xfa06 */
+	(const void *) &duk_obj_180,  /* 0xfa07 */
+	(const void *) &duk_obj_181,  /* 0xfa08 */
+	(const void *) &duk_obj_182,  /* 0xfa09 */
+	(const void *) &duk_obj_183,  /* 0xfa0a */
+	(const void *) &duk_obj_184,  /* 0xfa0b */
+	(const void *) &duk_obj_185,  /* 0xfa0c */
+	(const void *) &duk_obj_186,  /* 0xfa0d */
+	(const void *) &duk_obj_61,  /* 0xfa0e */
+	(const void *) &duk_obj_187,  /* 0xfa0f */
+	(const void *) &duk_obj_188,  /* 0xfa10 */
+	(const void *) &duk_obj_189,  /* 0xfa11 */
+	(const void *) &duk_obj_190,  /* 0xfa12 */
+	(const void *) &duk_obj_191,  /* 0xfa13 */
+	(const void *) &duk_obj_192,  /* 0xfa14 */
+	(const void *) &duk_obj_193,  /* 0xfa15 */
+	(const void *) &duk_obj_194,  /* 0xfa16 */
+	(const void *) &duk_obj_195,  /* 0xfa17 */
+	(const void *) &duk_obj_196,  /* 0xfa18 */
+	(const void *) &duk_obj_62,  /* 0xfa19 */
+	(const void *) &duk_obj_197,  /* 0xfa1a */
+	(const void *) &duk_obj_198,  /* 0xfa1b */
+	(const void *) &duk_obj_199,  /* 0xfa1c */
+	(const void *) &duk_obj_200,  /* 0xfa1d */
+	(const void *) &duk_obj_201,  /* 0xfa1e */
+	(const void *) &duk_obj_202,  /* 0xfa1f */
+	(const void *) &duk_obj_203,  /* 0xfa20 */
+	(const void *) &duk_obj_204,  /* 0xfa21 */
+	(const void *) &duk_obj_205,  /* 0xfa22 */
+	(const void *) &duk_obj_206,  /* 0xfa23 */
+	(const void *) &duk_obj_63,  /* 0xfa24 */
+	(const void *) &duk_obj_207,  /* 0xfa25 */
+	(const void *) &duk_obj_208,  /* 0xfa26 */
+	(const void *) &duk_obj_209,  /* 0xfa27 */
+	(const void *) &duk_obj_210,  /* 0xfa28 */
+	(const void *) &duk_obj_211,  /* 0xfa29 */
+	(const void *) &duk_obj_212,  /* 0xfa2a */
+	(const void *) &duk_obj_213,  /* 0xfa2b */
+	(const void *) &duk_obj_214,  /* 0xfa2c */
+	(const void *) &duk_obj_215,  /* 0xfa2d */
+	(const void *) &duk_obj_216,  /* 0xfa2e */
+	(const void *) &duk_obj_64,  /* 0xfa2f */
+	(const void *) &duk_obj_217,  /* 0xfa30 */
+	(const void *) &duk_obj_218,  /* 0xfa31 */
+	(const void *) &duk_obj_219,  /* 0xfa32 */
+	(const void *) &duk_obj_220,  /* 0xfa33 */
+	(const void *) &duk_obj_221,  /* 0xfa34 */
+	(const void *) &duk_obj_222,  /* 0xfa35 */
+	(const void *) &duk_obj_223,  /* 0xfa36 */
+	(const void *) &duk_obj_224,  /* 0xfa37 */
+	(const void *) &duk_obj_225,  /* 0xfa38 */
+	(const void *) &duk_obj_226,  /* 0xfa39 */
+	(const void *) &duk_obj_65,  /* 0xfa3a */
+	(const void *) &duk_obj_227,  /* 0xfa3b */
+	(const void *) &duk_obj_228,  /* 0xfa3c */
+	(const void *) &duk_obj_229,  /* 0xfa3d */
+	(const void *) &duk_obj_230,  /* 0xfa3e */
+	(const void *) &duk_obj_231,  /* 0xfa3f */
+	(const void *) &duk_obj_232,  /* 0xfa40 */
+	(const void *) &duk_obj_233,  /* 0xfa41 */
+	(const void *) &duk_obj_234,  /* 0xfa42 */
+	(const void *) &duk_obj_235,  /* 0xfa43 */
+	(const void *) &duk_obj_236,  /* 0xfa44 */
+	(const void *) &duk_obj_66,  /* 0xfa45 */
+	(const void *) &duk_obj_237,  /* 0xfa46 */
+	(const void *) &duk_obj_238,  /* 0xfa47 */
+	(const void *) &duk_obj_239,  /* 0xfa48 */
+	(const void *) &duk_obj_240,  /* 0xfa49 */
+	(const void *) &duk_obj_241,  /* 0xfa4a */
+	(const void *) &duk_obj_242,  /* 0xfa4b */
+	(const void *) &duk_obj_243,  /* 0xfa4c */
+	(const void *) &duk_obj_244,  /* 0xfa4d */
+	(const void *) &duk_obj_245,  /* 0xfa4e */
+	(const void *) &duk_obj_246,  /* 0xfa4f */
+	(const void *) &duk_obj_49,  /* 0xfa50 */
+	(const void *) &duk_obj_67,  /* 0xfa51 */
+	(const void *) &duk_obj_247,  /* 0xfa52 */
+	(const void *) &duk_obj_248,  /* 0xfa53 */
+	(const void *) &duk_obj_249,  /* 0xfa54 */
+	(const void *) &duk_obj_250,  /* 0xfa55 */
+	(const void *) &duk_obj_251,  /* 0xfa56 */
+	(const void *) &duk_obj_252,  /* 0xfa57 */
+	(const void *) &duk_obj_253,  /* 0xfa58 */
+	(const void *) &duk_obj_254,  /* 0xfa59 */
+	(const void *) &duk_obj_255,  /* 0xfa5a */
+	(const void *) &duk_obj_256,  /* 0xfa5b */
+	(const void *) &duk_obj_68,  /* 0xfa5c */
+	(const void *) &duk_obj_257,  /* 0xfa5d */
+	(const void *) &duk_obj_258,  /* 0xfa5e */
+	(const void *) &duk_obj_259,  /* 0xfa5f */
+	(const void *) &duk_obj_260,  /* 0xfa60 */
+	(const void *) &duk_obj_69,  /* 0xfa61 */
+	(const void *) &duk_obj_70,  /* 0xfa62 */
+	(const void *) &duk_obj_71,  /* 0xfa63 */
+	(const void *) &duk_obj_72,  /* 0xfa64 */
+	(const void *) &duk_obj_73,  /* 0xfa65 */
+	(const void *) &duk_obj_74,  /* 0xfa66 */
+	(const void *) &duk_obj_75,  /* 0xfa67 */
+	(const void *) &duk_obj_76,  /* 0xfa68 */
+	(const void *) &duk_obj_50,  /* 0xfa69 */
+	(const void *) &duk_obj_77,  /* 0xfa6a */
+	(const void *) &duk_obj_78,  /* 0xfa6b */
+	(const void *) &duk_obj_79,  /* 0xfa6c */
+	(const void *) &duk_obj_80,  /* 0xfa6d */
+	(const void *) &duk_obj_81,  /* 0xfa6e */
+	(const void *) &duk_obj_82,  /* 0xfa6f */
+	(const void *) &duk_obj_83,  /* 0xfa70 */
+	(const void *) &duk_obj_84,  /* 0xfa71 */
+	(const void *) &duk_obj_85,  /* 0xfa72 */
+	(const void *) &duk_obj_86,  /* 0xfa73 */
+	(const void *) &duk_obj_51,  /* 0xfa74 */
+	(const void *) &duk_obj_87,  /* 0xfa75 */
+	(const void *) &duk_obj_88,  /* 0xfa76 */
+	(const void *) &duk_obj_89,  /* 0xfa77 */
+	(const void *) &duk_obj_90,  /* 0xfa78 */
+	(const void *) &duk_obj_91,  /* 0xfa79 */
+	(const void *) &duk_obj_92,  /* 0xfa7a */
+	(const void *) &duk_obj_93,  /* 0xfa7b */
+	(const void *) &duk_obj_94,  /* 0xfa7c */
+	(const void *) &duk_obj_95,  /* 0xfa7d */
+	(const void *) &duk_obj_96,  /* 0xfa7e */
+	(const void *) &duk_obj_52,  /* 0xfa7f */
+	(const void *) &duk_obj_97,  /* 0xfa80 */
+	(const void *) &duk_obj_98,  /* 0xfa81 */
+	(const void *) &duk_obj_99,  /* 0xfa82 */
+	(const void *) &duk_obj_100,  /* 0xfa83 */
+	(const void *) &duk_obj_101,  /* 0xfa84 */
+	(const void *) &duk_obj_102,  /* 0xfa85 */
+	(const void *) &duk_obj_103,  /* 0xfa86 */
+	(const void *) &duk_obj_104,  /* 0xfa87 */
+	(const void *) &duk_obj_105,  /* 0xfa88 */
+	(const void *) &duk_obj_106,  /* 0xfa89 */
+	(const void *) &duk_obj_53,  /* 0xfa8a */
+	(const void *) &duk_obj_107,  /* 0xfa8b */
+	(const void *) &duk_obj_108,  /* 0xfa8c */
+	(const void *) &duk_obj_109,  /* 0xfa8d */
+	(const void *) &duk_obj_110,  /* 0xfa8e */
+	(const void *) &duk_obj_111,  /* 0xfa8f */
+	(const void *) &duk_obj_112,  /* 0xfa90 */
+	(const void *) &duk_obj_113,  /* 0xfa91 */
+	(const void *) &duk_obj_114,  /* 0xfa92 */
+	(const void *) &duk_obj_115,  /* 0xfa93 */
+	(const void *) &duk_obj_116,  /* 0xfa94 */
+	(const void *) &duk_obj_54,  /* 0xfa95 */
+	(const void *) &duk_obj_117,  /* 0xfa96 */
+	(const void *) &duk_obj_118,  /* 0xfa97 */
+	(const void *) &duk_obj_119,  /* 0xfa98 */
+	(const void *) &duk_obj_120,  /* 0xfa99 */
+	(const void *) &duk_obj_121,  /* 0xfa9a */
+	(const void *) &duk_obj_122,  /* 0xfa9b */
+	(const void *) &duk_obj_123,  /* 0xfa9c */
+	(const void *) &duk_obj_124,  /* 0xfa9d */
+	(const void *) &duk_obj_125,  /* 0xfa9e */
+	(const void *) &duk_obj_126,  /* 0xfa9f */
+	(const void *) &duk_obj_55,  /* 0xfaa0 */
+	(const void *) &duk_obj_127,  /* 0xfaa1 */
+	(const void *) &duk_obj_128,  /* 0xfaa2 */
+	(const void *) &duk_obj_129,  /* 0xfaa3 */
+	(const void *) &duk_obj_130,  /* 0xfaa4 */
+	(const void *) &duk_obj_131,  /* 0xfaa5 */
+	(const void *) &duk_obj_132,  /* 0xfaa6 */
+	(const void *) &duk_obj_133,  /* 0xfaa7 */
+	(const void *) &duk_obj_134,  /* 0xfaa8 */
+	(const void *) &duk_obj_135,  /* 0xfaa9 */
+	(const void *) &duk_obj_136,  /* 0xfaaa */
+	(const void *) &duk_obj_56,  /* 0xfaab */
+	(const void *) &duk_obj_137,  /* 0xfaac */
+	(const void *) &duk_obj_138,  /* 0xfaad */
+	(const void *) &duk_obj_139,  /* 0xfaae */
+	(const void *) &duk_obj_140,  /* 0xfaaf */
+	(const void *) &duk_obj_141,  /* 0xfab0 */
+	(const void *) &duk_obj_142,  /* 0xfab1 */
+	(const void *) &duk_obj_143,  /* 0xfab2 */
+	(const void *) &duk_obj_144,  /* 0xfab3 */
+	(const void *) &duk_obj_145,  /* 0xfab4 */
+	(const void *) &duk_obj_146,  /* 0xfab5 */
+	(const void *) &duk_prop_0,  /* 0xfab6 */
+	(const void *) &duk_prop_2,  /* 0xfab7 */
+	(const void *) &duk_prop_3,  /* 0xfab8 */
+	(const void *) &duk_prop_4,  /* 0xfab9 */
+	(const void *) &duk_prop_5,  /* 0xfaba */
+	(const void *) &duk_prop_6,  /* 0xfabb */
+	(const void *) &duk_prop_7,  /* 0xfabc */
+	(const void *) &duk_prop_8,  /* 0xfabd */
+	(const void *) &duk_prop_9,  /* 0xfabe */
+	(const void *) &duk_prop_10,  /* 0xfabf */
+	(const void *) &duk_prop_11,  /* 0xfac0 */
+	(const void *) &duk_prop_12,  /* 0xfac1 */
+	(const void *) &duk_prop_13,  /* 0xfac2 */
+	(const void *) &duk_prop_14,  /* 0xfac3 */
+	(const void *) &duk_prop_15,  /* 0xfac4 */
+	(const void *) &duk_prop_16,  /* 0xfac5 */
+	(const void *) &duk_prop_17,  /* 0xfac6 */
+	(const void *) &duk_prop_18,  /* 0xfac7 */
+	(const void *) &duk_prop_19,  /* 0xfac8 */
+	(const void *) &duk_prop_20,  /* 0xfac9 */
+	(const void *) &duk_prop_21,  /* 0xfaca */
+	(const void *) &duk_prop_22,  /* 0xfacb */
+	(const void *) &duk_prop_23,  /* 0xfacc */
+	(const void *) &duk_prop_24,  /* 0xfacd */
+	(const void *) &duk_prop_25,  /* 0xface */
+	(const void *) &duk_prop_26,  /* 0xfacf */
+	(const void *) &duk_prop_27,  /* 0xfad0 */
+	(const void *) &duk_prop_28,  /* 0xfad1 */
+	(const void *) &duk_prop_29,  /* 0xfad2 */
+	(const void *) &duk_prop_30,  /* 0xfad3 */
+	(const void *) &duk_prop_31,  /* 0xfad4 */
+	(const void *) &duk_prop_32,  /* 0xfad5 */
+	(const void *) &duk_prop_33,  /* 0xfad6 */
+	(const void *) &duk_prop_34,  /* 0xfad7 */
+	(const void *) &duk_prop_36,  /* 0xfad8 */
+	(const void *) &duk_prop_37,  /* 0xfad9 */
+	(const void *) &duk_prop_38,  /* 0xfada */
+	(const void *) &duk_prop_39,  /* 0xfadb */
+	(const void *) &duk_prop_40,  /* 0xfadc */
+	(const void *) &duk_prop_41,  /* 0xfadd */
+	(const void *) &duk_prop_42,  /* 0xfade */
+	(const void *) &duk_prop_43,  /* 0xfadf */
+	(const void *) &duk_prop_44,  /* 0xfae0 */
+	(const void *) &duk_prop_45,  /* 0xfae1 */
+	(const void *) &duk_prop_46,  /* 0xfae2 */
+	(const void *) &duk_prop_47,  /* 0xfae3 */
+	(const void *) &duk_prop_48,  /* 0xfae4 */
+	(const void *) &duk_prop_49,  /* 0xfae5 */
+	(const void *) &duk_prop_50,  /* 0xfae6 */
+	(const void *) &duk_prop_51,  /* 0xfae7 */
+	(const void *) &duk_prop_52,  /* 0xfae8 */
+	(const void *) &duk_prop_53,  /* 0xfae9 */
+	(const void *) &duk_prop_54,  /* 0xfaea */
+	(const void *) &duk_prop_55,  /* 0xfaeb */
+	(const void *) &duk_prop_56,  /* 0xfaec */
+	(const void *) &duk_prop_57,  /* 0xfaed */
+	(const void *) &duk_prop_58,  /* 0xfaee */
+	(const void *) &duk_prop_59,  /* 0xfaef */
+	(const void *) &duk_prop_60,  /* 0xfaf0 */
+	(const void *) &duk_prop_61,  /* 0xfaf1 */
+	(const void *) &duk_prop_62,  /* 0xfaf2 */
+	(const void *) &duk_prop_63,  /* 0xfaf3 */
+	(const void *) &duk_prop_64,  /* 0xfaf4 */
+	(const void *) &duk_prop_65,  /* 0xfaf5 */
+	(const void *) &duk_prop_66,  /* 0xfaf6 */
+	(const void *) &duk_prop_67,  /* 0xfaf7 */
+	(const void *) &duk_prop_68,  /* 0xfaf8 */
+	(const void *) &duk_prop_69,  /* 0xfaf9 */
+	(const void *) &duk_prop_70,  /* 0xfafa */
+	(const void *) &duk_prop_71,  /* 0xfafb */
+	(const void *) &duk_prop_72,  /* 0xfafc */
+	(const void *) &duk_prop_75,  /* 0xfafd */
+	(const void *) &duk_prop_76,  /* 0xfafe */
+	(const void *) &duk_prop_77,  /* 0xfaff */
+	(const void *) &duk_prop_78,  /* 0xfb00 */
+	(const void *) &duk_prop_79,  /* 0xfb01 */
+	(const void *) &duk_prop_80,  /* 0xfb02 */
+	(const void *) &duk_prop_81,  /* 0xfb03 */
+	(const void *) &duk_prop_82,  /* 0xfb04 */
+	(const void *) &duk_prop_83,  /* 0xfb05 */
+	(const void *) &duk_prop_84,  /* 0xfb06 */
+	(const void *) &duk_prop_85,  /* 0xfb07 */
+	(const void *) &duk_prop_86,  /* 0xfb08 */
+	(const void *) &duk_prop_87,  /* 0xfb09 */
+	(const void *) &duk_prop_88,  /* 0xfb0a */
+	(const void *) &duk_prop_89,  /* 0xfb0b */
+	(const void *) &duk_prop_92,  /* 0xfb0c */
+	(const void *) &duk_prop_93,  /* 0xfb0d */
+	(const void *) &duk_prop_94,  /* 0xfb0e */
+	(const void *) &duk_prop_95,  /* 0xfb0f */
+	(const void *) &duk_prop_96,  /* 0xfb10 */
+	(const void *) &duk_prop_97,  /* 0xfb11 */
+	(const void *) &duk_prop_98,  /* 0xfb12 */
+	(const void *) &duk_prop_99,  /* 0xfb13 */
+	(const void *) &duk_prop_100,  /* 0xfb14 */
+	(const void *) &duk_prop_101,  /* 0xfb15 */
+	(const void *) &duk_prop_102,  /* 0xfb16 */
+	(const void *) &duk_prop_103,  /* 0xfb17 */
+	(const void *) &duk_prop_104,  /* 0xfb18 */
+	(const void *) &duk_prop_105,  /* 0xfb19 */
+	(const void *) &duk_prop_106,  /* 0xfb1a */
+	(const void *) &duk_prop_107,  /* 0xfb1b */
+	(const void *) &duk_prop_108,  /* 0xfb1c */
+	(const void *) &duk_prop_109,  /* 0xfb1d */
+	(const void *) &duk_prop_110,  /* 0xfb1e */
+	(const void *) &duk_prop_111,  /* 0xfb1f */
+	(const void *) &duk_prop_112,  /* 0xfb20 */
+	(const void *) &duk_prop_113,  /* 0xfb21 */
+	(const void *) &duk_prop_114,  /* 0xfb22 */
+	(const void *) &duk_prop_115,  /* 0xfb23 */
+	(const void *) &duk_prop_116,  /* 0xfb24 */
+	(const void *) &duk_prop_117,  /* 0xfb25 */
+	(const void *) &duk_prop_118,  /* 0xfb26 */
+	(const void *) &duk_prop_119,  /* 0xfb27 */
+	(const void *) &duk_prop_120,  /* 0xfb28 */
+	(const void *) &duk_prop_121,  /* 0xfb29 */
+	(const void *) &duk_prop_122,  /* 0xfb2a */
+	(const void *) &duk_prop_123,  /* 0xfb2b */
+	(const void *) &duk_prop_124,  /* 0xfb2c */
+	(const void *) &duk_prop_125,  /* 0xfb2d */
+	(const void *) &duk_prop_126,  /* 0xfb2e */
+	(const void *) &duk_prop_127,  /* 0xfb2f */
+	(const void *) &duk_prop_128,  /* 0xfb30 */
+	(const void *) &duk_prop_129,  /* 0xfb31 */
+	(const void *) &duk_prop_130,  /* 0xfb32 */
+	(const void *) &duk_prop_131,  /* 0xfb33 */
+	(const void *) &duk_prop_132,  /* 0xfb34 */
+	(const void *) &duk_prop_133,  /* 0xfb35 */
+	(const void *) &duk_prop_134,  /* 0xfb36 */
+	(const void *) &duk_prop_135,  /* 0xfb37 */
+	(const void *) &duk_prop_136,  /* 0xfb38 */
+	(const void *) &duk_prop_137,  /* 0xfb39 */
+	(const void *) &duk_prop_138,  /* 0xfb3a */
+	(const void *) &duk_prop_139,  /* 0xfb3b */
+	(const void *) &duk_prop_140,  /* 0xfb3c */
+	(const void *) &duk_prop_141,  /* 0xfb3d */
+	(const void *) &duk_prop_142,  /* 0xfb3e */
+	(const void *) &duk_prop_143,  /* 0xfb3f */
+	(const void *) &duk_prop_144,  /* 0xfb40 */
+	(const void *) &duk_prop_145,  /* 0xfb41 */
+	(const void *) &duk_prop_146,  /* 0xfb42 */
+	(const void *) &duk_prop_147,  /* 0xfb43 */
+	(const void *) &duk_prop_148,  /* 0xfb44 */
+	(const void *) &duk_prop_149,  /* 0xfb45 */
+	(const void *) &duk_prop_150,  /* 0xfb46 */
+	(const void *) &duk_prop_151,  /* 0xfb47 */
+	(const void *) &duk_prop_152,  /* 0xfb48 */
+	(const void *) &duk_prop_153,  /* 0xfb49 */
+	(const void *) &duk_prop_154,  /* 0xfb4a */
+	(const void *) &duk_prop_155,  /* 0xfb4b */
+	(const void *) &duk_prop_156,  /* 0xfb4c */
+	(const void *) &duk_prop_157,  /* 0xfb4d */
+	(const void *) &duk_prop_158,  /* 0xfb4e */
+	(const void *) &duk_prop_159,  /* 0xfb4f */
+	(const void *) &duk_prop_160,  /* 0xfb50 */
+	(const void *) &duk_prop_161,  /* 0xfb51 */
+	(const void *) &duk_prop_162,  /* 0xfb52 */
+	(const void *) &duk_prop_163,  /* 0xfb53 */
+	(const void *) &duk_prop_164,  /* 0xfb54 */
+	(const void *) &duk_prop_165,  /* 0xfb55 */
+	(const void *) &duk_prop_166,  /* 0xfb56 */
+	(const void *) &duk_prop_167,  /* 0xfb57 */
+	(const void *) &duk_prop_168,  /* 0xfb58 */
+	(const void *) &duk_prop_169,  /* 0xfb59 */
+	(const void *) &duk_prop_170,  /* 0xfb5a */
+	(const void *) &duk_prop_171,  /* 0xfb5b */
+	(const void *) &duk_prop_172,  /* 0xfb5c */
+	(const void *) &duk_prop_173,  /* 0xfb5d */
+	(const void *) &duk_prop_174,  /* 0xfb5e */
+	(const void *) &duk_prop_175,  /* 0xfb5f */
+	(const void *) &duk_prop_176,  /* 0xfb60 */
+	(const void *) &duk_prop_177,  /* 0xfb61 */
+	(const void *) &duk_prop_178,  /* 0xfb62 */
+	(const void *) &duk_prop_179,  /* 0xfb63 */
+	(const void *) &duk_prop_180,  /* 0xfb64 */
+	(const void *) &duk_prop_181,  /* 0xfb65 */
+	(const void *) &duk_prop_182,  /* 0xfb66 */
+	(const void *) &duk_prop_183,  /* 0xfb67 */
+	(const void *) &duk_prop_184,  /* 0xfb68 */
+	(const void *) &duk_prop_185,  /* 0xfb69 */
+	(const void *) &duk_prop_186,  /* 0xfb6a */
+	(const void *) &duk_prop_187,  /* 0xfb6b */
+	(const void *) &duk_prop_188,  /* 0xfb6c */
+	(const void *) &duk_prop_189,  /* 0xfb6d */
+	(const void *) &duk_prop_190,  /* 0xfb6e */
+	(const void *) &duk_prop_191,  /* 0xfb6f */
+	(const void *) &duk_prop_192,  /* 0xfb70 */
+	(const void *) &duk_prop_193,  /* 0xfb71 */
+	(const void *) &duk_prop_194,  /* 0xfb72 */
+	(const void *) &duk_prop_195,  /* 0xfb73 */
+	(const void *) &duk_prop_196,  /* 0xfb74 */
+	(const void *) &duk_prop_197,  /* 0xfb75 */
+	(const void *) &duk_prop_198,  /* 0xfb76 */
+	(const void *) &duk_prop_199,  /* 0xfb77 */
+	(const void *) &duk_prop_200,  /* 0xfb78 */
+	(const void *) &duk_prop_201,  /* 0xfb79 */
+	(const void *) &duk_prop_202,  /* 0xfb7a */
+	(const void *) &duk_prop_203,  /* 0xfb7b */
+	(const void *) &duk_prop_204,  /* 0xfb7c */
+	(const void *) &duk_prop_216,  /* 0xfb7d */
+	(const void *) &duk_prop_217,  /* 0xfb7e */
+	(const void *) &duk_prop_218,  /* 0xfb7f */
+	(const void *) &duk_prop_219,  /* 0xfb80 */
+	(const void *) &duk_prop_220,  /* 0xfb81 */
+	(const void *) &duk_prop_221,  /* 0xfb82 */
+	(const void *) &duk_prop_222,  /* 0xfb83 */
+	(const void *) &duk_prop_223,  /* 0xfb84 */
+	(const void *) &duk_prop_224,  /* 0xfb85 */
+	(const void *) &duk_prop_225,  /* 0xfb86 */
+	(const void *) &duk_prop_226,  /* 0xfb87 */
+	(const void *) &duk_prop_227,  /* 0xfb88 */
+	(const void *) &duk_prop_228,  /* 0xfb89 */
+	(const void *) &duk_prop_229,  /* 0xfb8a */
+	(const void *) &duk_prop_230,  /* 0xfb8b */
+	(const void *) &duk_prop_231,  /* 0xfb8c */
+	(const void *) &duk_prop_232,  /* 0xfb8d */
+	(const void *) &duk_prop_233,  /* 0xfb8e */
+	(const void *) &duk_prop_234,  /* 0xfb8f */
+	(const void *) &duk_prop_235,  /* 0xfb90 */
+	(const void *) &duk_prop_236,  /* 0xfb91 */
+	(const void *) &duk_prop_237,  /* 0xfb92 */
+	(const void *) &duk_prop_238,  /* 0xfb93 */
+	(const void *) &duk_prop_239,  /* 0xfb94 */
+	(const void *) &duk_prop_240,  /* 0xfb95 */
+	(const void *) &duk_prop_241,  /* 0xfb96 */
+	(const void *) &duk_prop_242,  /* 0xfb97 */
+	(const void *) &duk_prop_243,  /* 0xfb98 */
+	(const void *) &duk_prop_244,  /* 0xfb99 */
+	(const void *) &duk_prop_245,  /* 0xfb9a */
+	(const void *) &duk_prop_246,  /* 0xfb9b */
+	(const void *) &duk_prop_247,  /* 0xfb9c */
+	(const void *) &duk_prop_248,  /* 0xfb9d */
+	(const void *) &duk_prop_249,  /* 0xfb9e */
+	(const void *) &duk_prop_250,  /* 0xfb9f */
+	(const void *) &duk_prop_251,  /* 0xfba0 */
+	(const void *) &duk_prop_252,  /* 0xfba1 */
+	(const void *) &duk_prop_253,  /* 0xfba2 */
+	(const void *) &duk_prop_254,  /* 0xfba3 */
+	(const void *) &duk_prop_255,  /* 0xfba4 */
+	(const void *) &duk_prop_256,  /* 0xfba5 */
+	(const void *) &duk_prop_257,  /* 0xfba6 */
+	(const void *) &duk_prop_258,  /* 0xfba7 */
+	NULL
+};
+#endif
+
+#undef DUK__STRHASH16
+#undef DUK__STRHASH32
+#undef DUK__DBLBYTES
+#undef DUK__TVAL_NUMBER
+#undef DUK__TVAL_UNDEFINED
+#undef DUK__TVAL_NULL
+#undef DUK__TVAL_BOOLEAN
+#undef DUK__TVAL_OBJECT
+#undef DUK__TVAL_STRING
+#undef DUK__STRINIT
+#undef DUK__ROMOBJ_INIT
+#undef DUK__ROMFUN_INIT
 #else  /* DUK_USE_ROM_STRINGS */
 DUK_INTERNAL const duk_uint8_t duk_strings_data[972] = {
 79,40,209,144,168,105,6,78,54,139,89,185,44,48,46,90,120,8,154,140,35,103,
@@ -11711,10 +16650,15 @@ DUK_INTERNAL const duk_uint8_t duk_strings_data[972] = {
 #endif  /* DUK_USE_ROM_STRINGS */
 
 #if defined(DUK_USE_ROM_OBJECTS)
-#error ROM support not enabled, rerun configure.py with --rom-support
+#if !defined(DUK_USE_ROM_STRINGS)
+#error DUK_USE_ROM_OBJECTS requires DUK_USE_ROM_STRINGS
+#endif
+#if defined(DUK_USE_HSTRING_ARRIDX)
+#error DUK_USE_HSTRING_ARRIDX is currently incompatible with ROM built-ins
+#endif
 #else  /* DUK_USE_ROM_OBJECTS */
-/* native functions: 185 */
-DUK_INTERNAL const duk_c_function duk_bi_native_functions[185] = {
+/* native functions: 143 */
+DUK_INTERNAL const duk_c_function duk_bi_native_functions[143] = {
 	NULL,
 	duk_bi_array_constructor,
 	duk_bi_array_constructor_is_array,
@@ -11732,17 +16676,8 @@ DUK_INTERNAL const duk_c_function duk_bi_native_functions[185] = {
 	duk_bi_array_prototype_splice,
 	duk_bi_array_prototype_to_string,
 	duk_bi_array_prototype_unshift,
-	duk_bi_arraybuffer_constructor,
-	duk_bi_arraybuffer_isview,
 	duk_bi_boolean_constructor,
 	duk_bi_boolean_prototype_tostring_shared,
-	duk_bi_buffer_compare_shared,
-	duk_bi_buffer_readfield,
-	duk_bi_buffer_slice_shared,
-	duk_bi_buffer_writefield,
-	duk_bi_cbor_decode,
-	duk_bi_cbor_encode,
-	duk_bi_dataview_constructor,
 	duk_bi_date_constructor,
 	duk_bi_date_constructor_now,
 	duk_bi_date_constructor_parse,
@@ -11801,16 +16736,6 @@ DUK_INTERNAL const duk_c_function duk_bi_native_functions[185] = {
 	duk_bi_math_object_twoarg_shared,
 	duk_bi_native_function_length,
 	duk_bi_native_function_name,
-	duk_bi_nodejs_buffer_byte_length,
-	duk_bi_nodejs_buffer_concat,
-	duk_bi_nodejs_buffer_constructor,
-	duk_bi_nodejs_buffer_copy,
-	duk_bi_nodejs_buffer_fill,
-	duk_bi_nodejs_buffer_is_buffer,
-	duk_bi_nodejs_buffer_is_encoding,
-	duk_bi_nodejs_buffer_tojson,
-	duk_bi_nodejs_buffer_tostring,
-	duk_bi_nodejs_buffer_write,
 	duk_bi_number_check_shared,
 	duk_bi_number_constructor,
 	duk_bi_number_prototype_to_exponential,
@@ -11841,16 +16766,8 @@ DUK_INTERNAL const duk_c_function duk_bi_native_functions[185] = {
 	duk_bi_object_prototype_to_string,
 	duk_bi_object_prototype_value_of,
 	duk_bi_object_setprototype_shared,
-	duk_bi_performance_now,
 	duk_bi_pointer_constructor,
 	duk_bi_pointer_prototype_tostring_shared,
-	duk_bi_proxy_constructor,
-	duk_bi_reflect_apply,
-	duk_bi_reflect_construct,
-	duk_bi_reflect_object_delete_property,
-	duk_bi_reflect_object_get,
-	duk_bi_reflect_object_has,
-	duk_bi_reflect_object_set,
 	duk_bi_regexp_constructor,
 	duk_bi_regexp_prototype_exec,
 	duk_bi_regexp_prototype_flags,
@@ -11882,624 +16799,378 @@ DUK_INTERNAL const duk_c_function duk_bi_native_functions[185] = {
 	duk_bi_symbol_key_for,
 	duk_bi_symbol_toprimitive,
 	duk_bi_symbol_tostring_shared,
-	duk_bi_textdecoder_constructor,
-	duk_bi_textdecoder_prototype_decode,
-	duk_bi_textdecoder_prototype_shared_getter,
-	duk_bi_textencoder_constructor,
-	duk_bi_textencoder_prototype_encode,
-	duk_bi_textencoder_prototype_encoding_getter,
-	duk_bi_thread_constructor,
-	duk_bi_thread_current,
-	duk_bi_thread_resume,
-	duk_bi_thread_yield,
 	duk_bi_type_error_thrower,
-	duk_bi_typedarray_buffer_getter,
 	duk_bi_typedarray_bytelength_getter,
 	duk_bi_typedarray_byteoffset_getter,
-	duk_bi_typedarray_constructor,
-	duk_bi_typedarray_set,
-	duk_bi_uint8array_allocplain,
-	duk_bi_uint8array_plainof,
 };
 #if defined(DUK_USE_DOUBLE_LE)
-DUK_INTERNAL const duk_uint8_t duk_builtins_data[4281] = {
-144,148,105,226,32,68,52,228,254,12,104,202,37,132,52,167,194,138,105,245,
-124,57,28,211,57,18,64,52,239,126,44,138,111,175,241,164,19,87,145,30,33,
-167,22,145,159,8,211,139,9,225,42,5,240,145,139,163,163,8,211,139,10,228,
-64,211,19,132,140,93,29,56,70,156,88,119,34,66,146,36,104,137,194,70,46,
-142,172,35,78,44,47,146,195,102,11,240,145,139,163,175,8,211,139,9,228,240,
-242,112,145,139,163,179,8,211,139,8,237,34,130,118,49,116,118,225,26,48,0,
-1,98,29,201,158,46,183,39,135,147,132,140,93,16,132,76,66,33,8,66,16,132,
-33,8,66,26,180,105,97,167,68,150,34,33,154,112,0,1,91,247,35,79,111,237,
-198,174,232,47,31,23,95,17,13,31,249,96,211,49,50,53,214,77,141,24,0,0,181,
-10,228,240,242,15,128,140,65,128,134,188,0,0,90,167,97,181,224,0,2,213,62,
-53,224,0,2,213,66,237,120,0,0,181,81,204,107,192,0,5,170,150,67,94,0,0,45,
-84,245,90,240,0,1,106,169,162,215,128,0,11,85,93,150,188,0,0,90,171,111,53,
-109,22,162,26,48,0,1,84,23,201,146,243,225,26,39,12,145,136,104,192,0,5,61,
-11,228,201,121,240,100,19,134,72,196,33,195,14,40,203,112,64,190,76,232,
-145,153,136,0,0,0,0,0,0,31,15,249,152,0,0,0,0,0,0,30,15,249,120,144,13,96,
-155,194,56,80,206,36,67,141,20,228,70,57,81,206,100,131,156,39,132,168,23,
-194,70,46,137,208,21,200,129,166,39,9,24,186,39,72,119,34,66,146,36,104,
-137,194,70,46,137,212,23,201,97,179,5,248,72,197,209,58,194,121,60,60,156,
-36,98,232,157,129,29,164,80,78,198,46,137,218,146,121,25,71,146,9,209,5,
-209,61,48,126,14,138,152,30,67,186,23,143,139,175,131,202,135,228,72,85,
-144,83,60,179,30,94,209,233,102,30,98,105,230,103,30,114,121,231,104,30,
-122,137,231,233,30,130,153,232,106,30,138,169,232,235,30,144,67,193,25,19,
-136,108,207,30,41,224,140,137,194,173,192,153,228,5,242,100,188,248,70,137,
-195,36,79,78,47,147,37,231,193,144,78,25,34,122,145,111,36,74,232,176,13,
-17,61,234,226,93,207,148,160,84,75,141,7,27,161,32,33,18,225,80,212,76,154,
-2,2,70,65,56,100,237,34,140,209,2,67,32,156,50,118,145,64,186,230,61,205,
-35,103,155,32,36,141,19,134,78,210,40,206,16,36,70,137,195,39,105,20,11,
-174,99,220,210,54,121,210,1,137,33,1,228,207,16,17,70,146,66,3,201,164,32,
-0,65,112,152,56,196,159,31,23,77,211,195,201,199,23,160,72,214,246,81,6,12,
-73,241,214,111,31,23,60,145,158,56,50,72,81,67,230,232,242,80,19,49,39,199,
-89,188,124,92,242,70,120,227,64,194,75,154,72,12,9,73,6,111,21,120,12,40,
-144,19,39,25,0,225,144,168,105,56,248,185,228,140,241,200,96,64,100,42,26,
-78,62,46,121,35,52,18,92,116,1,36,64,47,158,64,49,98,66,100,156,242,65,23,
-196,149,35,103,194,94,100,108,144,230,203,156,64,66,37,201,16,11,32,249,
-132,4,34,92,44,93,146,55,152,72,24,137,112,151,153,27,36,5,100,229,144,8,
-162,98,92,210,5,76,73,241,214,111,31,23,60,145,158,57,44,48,46,92,185,164,
-160,72,151,41,0,50,107,179,244,59,36,93,127,92,6,19,172,3,11,216,0,56,224,
-151,29,102,241,241,115,201,25,227,164,64,106,37,199,197,211,116,240,242,
-113,197,233,144,40,248,185,228,140,241,196,75,132,109,24,72,128,43,39,84,
-129,13,173,161,144,168,105,56,98,78,100,142,214,215,69,1,13,173,161,144,
-168,105,57,34,78,100,142,214,215,69,16,67,107,105,110,114,168,254,24,147,
-153,35,181,181,212,32,67,107,105,110,114,168,254,72,147,153,35,181,181,212,
-36,65,130,3,144,8,26,252,200,13,30,85,16,16,64,90,242,231,192,64,161,163,
-203,31,26,172,193,17,4,23,105,159,96,27,172,251,16,32,196,4,14,137,112,17,
-136,48,164,28,134,80,215,202,1,132,130,8,12,39,52,64,155,31,24,56,36,1,189,
-207,132,0,35,233,35,195,62,3,196,149,36,100,72,160,2,200,232,44,227,0,11,
-37,160,68,142,128,36,157,25,200,32,26,79,90,4,73,43,192,122,54,71,65,103,
-44,248,14,134,140,151,227,138,231,208,45,96,148,248,134,140,151,227,138,
-231,240,1,255,254,10,74,146,56,128,104,4,147,152,72,6,144,28,174,143,8,1,
-30,1,165,3,96,31,0,211,3,21,11,153,35,0,211,131,68,131,160,137,16,250,5,
-196,131,160,137,200,160,199,156,67,248,0,255,255,65,140,10,48,177,115,56,
-35,130,60,19,134,79,89,240,52,177,115,56,39,12,156,123,144,217,251,15,135,
-34,167,30,20,170,154,255,232,12,47,244,0,97,28,17,224,39,238,32,40,71,4,
-120,39,12,156,4,253,228,5,137,195,39,30,228,54,124,4,253,228,128,194,115,
-68,9,252,15,128,232,104,201,126,56,191,35,64,90,193,41,241,13,25,47,199,23,
-228,105,3,86,225,1,100,224,156,199,130,36,249,144,10,192,76,71,250,16,15,
-18,61,96,17,62,200,3,72,128,136,143,247,32,22,75,64,137,248,64,22,79,90,39,
-249,64,38,84,12,167,20,52,223,196,2,230,238,45,214,36,120,32,72,158,208,4,
-102,238,45,194,2,201,197,186,196,143,4,9,19,218,0,92,221,202,61,228,143,4,
-9,19,218,8,35,55,113,110,16,22,78,81,239,36,120,32,72,158,208,64,73,197,12,
-255,0,13,18,60,128,159,212,128,169,76,17,156,185,100,76,255,163,64,65,26,
-57,114,200,153,255,70,144,33,13,18,232,50,75,226,104,6,149,3,41,199,246,
-130,12,128,28,142,156,120,203,175,158,8,194,207,1,6,81,20,79,88,11,237,84,
-11,161,32,127,255,255,255,255,255,247,191,137,235,16,221,170,129,116,36,0,
-16,0,0,0,0,0,0,12,196,0,0,0,0,0,0,15,135,242,61,123,164,137,162,164,218,67,
-74,134,162,120,128,0,0,0,0,0,1,224,254,71,173,33,129,52,84,155,72,105,80,
-212,79,16,0,0,0,0,0,0,60,63,195,244,143,146,22,230,192,0,0,0,0,0,0,176,60,
-33,214,2,251,82,1,73,180,134,204,134,36,96,127,255,255,255,255,255,159,161,
-144,235,16,221,169,0,164,218,67,102,67,18,48,63,255,255,255,255,255,207,
-240,196,60,17,145,56,134,204,241,226,158,8,200,156,42,220,9,158,65,196,34,
-92,42,26,137,147,120,64,74,37,196,54,100,49,35,188,36,5,68,184,208,113,187,
-194,80,212,75,146,1,73,196,54,100,49,35,188,38,57,37,56,240,0,0,0,0,0,0,0,
-0,32,235,248,68,48,156,2,24,94,24,0,243,119,10,139,144,123,242,3,102,238,
-18,239,115,72,217,160,11,223,16,23,55,113,241,32,145,36,57,188,18,16,102,3,
-5,120,35,34,89,32,15,180,152,173,127,0,218,235,88,0,228,180,227,200,0,0,0,
-0,0,0,248,127,197,107,240,64,6,77,220,24,38,78,74,113,67,77,130,4,12,155,
-185,52,48,156,148,226,134,155,4,10,194,96,129,132,166,238,45,194,2,201,193,
-130,100,228,167,20,52,216,32,113,41,187,139,112,128,178,114,104,97,57,41,
-197,13,54,8,32,48,216,32,130,195,224,130,19,97,124,134,23,6,0,57,137,62,77,
-12,38,12,0,179,18,124,45,22,190,96,128,141,176,134,28,98,79,180,152,139,
-218,45,124,193,1,27,97,16,32,196,159,24,230,204,246,194,40,89,137,62,210,
-98,103,92,217,158,216,70,7,49,39,193,130,100,182,17,194,140,73,246,147,16,
-250,9,146,216,72,6,49,39,193,131,22,194,72,73,137,62,210,98,31,65,139,97,
-40,32,196,159,14,234,70,86,194,88,89,137,62,210,98,63,93,72,202,216,76,10,
-49,39,198,33,180,153,37,108,38,134,152,147,237,38,38,117,13,164,201,43,97,
-56,40,196,159,36,65,57,163,149,176,158,26,98,79,180,152,165,210,9,205,28,
-173,133,0,243,18,124,98,22,180,72,130,115,71,43,97,68,72,196,159,105,49,51,
-168,90,209,34,9,205,28,173,133,33,19,18,124,154,24,76,185,164,227,138,89,
-18,119,0,7,145,39,201,161,132,188,64,124,137,62,49,11,90,36,65,57,163,149,
-210,166,37,34,79,180,152,153,212,45,104,145,4,230,142,87,74,160,84,137,62,
-72,130,115,71,43,171,234,134,200,147,237,38,41,116,130,115,71,43,171,235,5,
-72,147,227,16,218,76,146,186,254,184,108,137,62,210,98,103,80,218,76,146,
-186,254,192,68,137,62,29,212,140,174,207,178,23,34,79,180,152,143,215,82,
-50,187,62,208,60,137,62,12,19,37,210,182,21,34,79,180,152,135,208,76,151,
-74,224,68,137,62,49,205,153,238,175,186,23,34,79,180,152,153,215,54,103,
-186,190,240,92,137,62,22,139,95,48,64,70,235,251,225,210,36,251,73,136,189,
-162,215,204,16,17,186,255,2,14,98,79,152,32,35,108,48,64,242,36,249,130,2,
-55,75,6,212,224,72,200,51,128,114,108,28,100,128,0,0,0,0,0,0,0,12,110,127,
-48,98,115,249,201,117,243,249,195,21,159,206,38,47,63,156,86,8,75,144,94,
-82,1,38,73,79,208,67,95,233,1,6,128,14,79,129,186,40,249,18,149,182,207,
-144,200,155,188,248,204,105,184,207,142,199,137,175,201,0,159,72,10,5,21,
-221,10,120,74,129,124,36,98,232,228,74,81,62,160,20,10,107,186,21,114,32,
-105,137,194,70,46,142,68,165,19,235,1,64,170,187,161,119,34,66,146,36,104,
-137,194,70,46,142,68,165,19,236,1,64,174,187,161,95,37,134,204,23,225,35,
-23,71,34,82,137,246,128,160,89,93,208,167,147,195,201,194,70,46,142,68,165,
-19,238,1,64,182,187,161,71,105,20,19,177,139,163,145,41,68,16,7,6,15,82,70,
-72,115,96,0,0,0,0,0,27,234,32,91,60,165,195,201,194,8,134,149,216,162,0,
-192,41,225,8,2,48,177,36,1,149,13,196,15,0,200,209,97,199,128,99,32,176,
-195,192,113,57,143,0,167,133,32,230,80,28,202,139,175,238,2,48,189,192,20,
-1,119,80,87,193,186,129,89,56,72,197,209,200,193,185,35,23,71,109,13,219,
-36,98,232,237,156,13,26,208,211,14,102,19,87,137,91,95,128,0,10,96,24,92,0,
-0,83,2,53,56,0,0,165,3,28,204,160,160,226,100,226,200,211,76,241,240,0,1,
-102,8,22,75,64,137,73,20,230,105,133,7,19,39,22,70,154,103,143,128,0,11,48,
-20,28,76,156,113,75,34,78,62,0,0,45,3,103,31,0,0,22,65,44,57,137,62,33,179,
-216,162,152,192,131,18,124,162,27,61,138,41,108,32,196,159,16,217,232,235,
-81,76,104,73,137,62,81,13,158,142,181,20,184,16,98,79,136,108,244,244,168,
-166,56,36,196,159,40,134,207,79,74,138,93,10,49,39,194,173,192,158,158,149,
-20,188,20,98,79,133,91,129,61,109,74,41,124,30,68,159,16,217,236,83,108,96,
-68,137,62,81,13,158,197,54,182,17,34,79,136,108,244,117,169,182,52,38,68,
-159,40,134,207,71,90,155,92,8,145,39,196,54,122,122,84,219,28,19,34,79,148,
-67,103,167,165,77,174,133,72,147,225,86,224,79,79,74,155,94,10,145,39,194,
-173,192,158,182,165,54,190,206,25,212,35,208,226,100,150,211,201,29,162,44,
-140,35,103,0,0,0,0,0,0,3,192,252,206,25,228,35,208,226,100,150,211,201,29,
-162,44,140,35,103,0,0,0,0,0,0,3,192,252,206,25,244,35,208,226,100,150,211,
-201,29,162,44,140,35,103,0,0,0,0,0,0,3,192,252,206,26,4,35,208,226,100,150,
-211,201,29,162,44,140,35,103,0,0,0,0,0,0,0,1,0,206,26,20,35,208,226,100,
-150,211,201,29,162,44,140,35,103,0,0,0,0,0,0,0,1,0,206,26,36,35,208,226,
-100,150,211,201,29,162,44,140,35,103,0,0,0,0,0,0,0,65,0,206,26,52,35,208,
-226,100,150,211,201,29,162,44,140,35,103,0,0,0,0,0,0,0,65,0,206,26,68,35,
-208,226,100,150,211,201,29,162,44,140,35,103,0,0,0,0,0,0,0,65,0,206,26,84,
-35,208,226,100,150,211,201,29,162,44,140,35,103,0,0,0,0,0,0,0,129,0,195,
-154,99,16,38,36,0,251,68,117,179,216,162,128,68,72,1,241,13,158,197,20,150,
-25,18,0,125,162,58,217,232,235,117,100,162,136,25,18,0,125,162,58,217,232,
-235,116,36,162,145,2,226,64,15,136,108,244,117,186,178,81,73,129,113,32,7,
-196,54,122,58,221,9,40,165,64,200,144,3,237,17,214,207,79,75,171,37,20,80,
-200,144,3,237,17,214,207,79,75,161,37,20,138,23,18,0,124,67,103,167,165,
-213,146,138,77,11,137,0,62,33,179,211,210,232,73,69,42,133,196,128,31,10,
-183,2,125,89,40,163,5,196,128,31,10,183,2,125,9,40,164,96,200,144,3,224,
-221,64,172,157,89,40,163,134,68,128,31,6,234,5,100,232,73,69,35,133,68,128,
-31,104,142,182,125,89,40,180,0,168,144,3,237,17,214,207,161,37,22,144,19,
-18,0,124,67,103,213,146,139,80,9,137,0,62,33,179,232,73,69,172,5,90,40,153,
-59,68,117,179,216,166,192,77,162,137,147,136,108,246,41,180,176,219,69,19,
-39,104,142,182,122,58,221,89,41,178,6,218,40,153,59,68,117,179,209,214,232,
-73,77,162,6,90,40,153,56,134,207,71,91,171,37,54,152,25,104,162,100,226,27,
-61,29,110,132,148,218,160,109,162,137,147,180,71,91,61,61,46,172,148,217,
-67,109,20,76,157,162,58,217,233,233,116,36,166,209,67,45,20,76,156,67,103,
-167,165,213,146,155,77,12,180,81,50,113,13,158,158,151,66,74,109,84,50,209,
-68,201,194,173,192,159,86,74,108,193,150,138,38,78,21,110,4,250,18,83,104,
-193,182,138,38,78,13,212,10,201,213,146,155,56,109,162,137,147,131,117,2,
-178,116,36,166,209,194,237,20,76,157,162,58,217,245,100,167,16,2,237,20,76,
-157,162,58,217,244,36,167,18,2,173,20,76,156,67,103,213,146,156,80,10,180,
-81,50,113,13,159,66,74,113,97,175,221,48,216,110,64,4,42,22,189,179,0,196,
-133,0,185,80,32,28,78,99,193,18,80,36,4,19,159,141,172,0,178,90,4,74,73,0,
-22,209,68,201,187,129,4,2,8,3,132,64,60,36,6,149,113,72,176,171,240,84,0,
-157,91,116,116,32,11,42,218,221,216,181,129,32,3,234,219,165,3,188,231,235,
-249,8,187,152,252,47,86,227,105,18,7,244,17,91,42,56,175,185,248,110,173,
-198,209,208,36,0,238,82,97,87,188,189,179,240,93,122,32,12,22,162,42,125,
-144,132,160,7,236,161,25,232,237,105,64,205,59,127,102,158,160,230,63,11,
-217,66,51,210,129,154,118,254,205,61,65,236,127,171,197,34,168,48,6,90,194,
-1,0,39,75,88,72,8,9,33,186,194,80,64,76,13,214,19,2,130,96,110,150,189,0,
-65,6,51,214,20,128,65,17,11,214,19,130,137,121,211,210,211,144,6,39,75,88,
-80,0,201,119,235,10,8,41,86,231,71,88,80,129,79,135,186,122,133,224,34,25,
-69,234,80,3,91,141,172,40,96,139,113,180,181,133,36,21,110,54,142,134,176,
-165,1,176,23,213,47,0,216,134,234,215,128,111,117,181,232,128,209,3,70,230,
-107,64,5,139,168,209,235,10,32,36,144,102,235,136,3,146,27,172,40,160,146,
-132,103,172,40,192,115,3,117,133,28,22,113,163,69,172,41,103,1,66,188,17,
-145,52,168,4,202,113,67,76,130,227,76,194,13,240,108,0,0,83,224,0,2,193,0,
-104,146,84,97,48,0,1,94,192,56,169,24,145,179,192,0,5,112,8,56,16,32,128,
-56,18,52,125,230,86,147,190,140,28,50,21,13,39,31,23,60,145,158,57,12,141,
-47,129,6,155,194,188,24,49,39,199,89,188,124,92,242,70,120,224,201,33,69,
-15,155,163,201,68,14,49,39,199,197,211,116,240,242,113,197,232,18,180,254,
-36,3,17,46,18,243,35,100,128,172,156,178,70,163,154,76,34,248,146,164,108,
-248,75,204,141,146,28,217,115,137,27,95,27,241,173,236,162,160,224,200,2,
-206,9,113,13,148,192,209,18,22,164,146,37,193,57,162,4,249,39,196,128,24,2,
-178,66,213,136,68,201,16,77,209,131,31,192,242,88,96,92,191,151,34,100,136,
-38,232,255,252,92,221,199,197,12,68,209,82,66,212,11,155,185,41,197,13,55,
-38,3,66,213,47,135,254,72,12,162,99,133,116,112,0,1,72,66,14,16,16,50,37,
-202,160,150,154,66,14,20,8,57,192,28,24,80,113,50,113,100,105,166,120,248,
-0,0,179,1,65,196,201,199,20,178,36,227,224,0,2,208,54,113,240,0,1,100,11,
-181,192,0,5,178,1,18,160,65,24,131,20,145,25,188,48,132,122,28,76,146,218,
-121,35,180,69,145,132,108,224,0,0,0,0,0,0,120,31,153,188,56,132,122,28,76,
-146,218,121,35,180,69,145,132,108,224,0,0,0,0,0,0,120,31,168,160,45,110,23,
-30,176,33,184,0,0,183,32,29,235,2,27,199,23,0,0,23,4,51,120,129,8,244,56,
-153,37,180,242,71,104,139,35,8,217,192,0,0,0,0,0,0,240,63,51,120,145,8,244,
-56,153,37,180,242,71,104,139,35,8,217,192,0,0,0,0,0,0,0,64,51,120,161,8,
-244,56,153,37,180,242,71,104,139,35,8,217,192,0,0,0,0,0,0,0,64,51,120,177,
-8,244,56,153,37,180,242,71,104,139,35,8,217,192,0,0,0,0,0,0,16,64,51,120,
-193,8,244,56,153,37,180,242,71,104,139,35,8,217,192,0,0,0,0,0,0,16,64,51,
-120,209,8,244,56,153,37,180,242,71,104,139,35,8,217,192,0,0,0,0,0,0,16,64,
-51,120,225,8,244,56,153,37,180,242,71,104,139,35,8,217,192,0,0,0,0,0,0,32,
-64,32,227,194,0,97,57,162,4,246,104,5,34,92,35,68,225,161,166,220,16,16,
-137,112,52,41,73,29,185,1,65,196,201,197,145,166,153,246,72,3,137,204,120,
-34,74,8,199,1,67,17,162,112,201,84,128,97,144,78,25,42,16,131,169,1,205,66,
-8,35,68,225,161,166,239,128,0,10,192,64,196,104,156,50,96,0,2,172,73,240,
-117,96,57,170,97,4,104,156,52,52,221,240,0,1,82,1,74,9,129,125,240,0,1,82,
-32,148,25,174,137,58,23,51,190,0,0,42,69,64,195,32,156,50,96,0,2,160,81,
-238,2,3,107,173,218,3,192,
+DUK_INTERNAL const duk_uint8_t duk_builtins_data[2590] = {
+144,148,105,216,160,68,52,226,190,12,104,197,165,132,52,167,194,138,105,
+231,252,57,28,211,49,18,64,52,234,190,44,138,111,157,241,164,19,87,37,30,
+33,167,4,145,159,8,211,130,9,225,42,5,240,145,139,163,163,8,211,130,10,228,
+64,211,19,132,140,93,29,56,70,156,16,119,34,66,146,36,104,137,194,70,46,
+142,172,35,78,8,47,146,195,102,11,240,145,139,163,175,8,211,130,9,228,240,
+242,112,145,139,163,179,8,211,130,8,237,34,130,118,49,116,118,225,26,61,1,
+220,153,226,235,114,120,121,56,72,197,209,8,68,196,34,16,213,154,75,13,57,
+148,177,17,12,211,199,251,113,163,201,44,16,225,80,81,150,224,129,124,153,
+209,35,51,16,0,0,0,0,0,0,62,31,243,48,0,0,0,0,0,0,60,31,242,241,32,26,193,
+55,132,112,161,156,72,135,26,41,200,140,114,163,156,201,7,56,79,9,80,47,
+132,140,93,19,160,43,145,3,76,78,18,49,116,78,144,238,68,133,36,72,209,19,
+132,140,93,19,168,47,146,195,102,11,240,145,139,162,117,132,242,120,121,56,
+72,197,209,59,2,59,72,160,157,140,93,19,181,36,240,210,143,14,31,131,162,
+166,7,144,238,177,226,68,60,17,145,56,134,204,240,130,158,8,200,156,42,220,
+9,158,22,37,220,177,74,5,68,184,208,113,185,130,2,17,46,21,13,68,201,151,
+32,36,100,19,134,78,210,40,200,144,36,50,9,195,39,105,20,11,174,99,220,210,
+54,121,34,2,72,209,56,100,237,34,140,153,2,68,104,156,50,118,145,64,186,
+230,61,205,35,103,148,32,24,146,16,30,76,169,1,20,105,36,32,60,153,178,0,4,
+23,9,131,140,73,241,241,116,221,60,60,156,113,119,164,141,111,25,16,96,196,
+159,29,102,241,241,115,201,25,227,131,36,133,20,62,110,142,217,1,51,18,124,
+117,155,199,197,207,36,103,142,52,12,36,183,68,128,192,148,144,102,236,151,
+128,194,137,1,50,108,208,14,25,10,134,147,143,139,158,72,207,27,86,4,6,66,
+161,164,227,226,231,146,51,65,37,180,64,18,68,2,247,132,3,22,36,38,73,188,
+36,17,124,73,82,54,124,37,230,70,201,14,108,183,100,4,34,92,145,0,178,15,
+114,64,66,37,194,197,217,35,119,36,129,136,151,9,121,145,178,64,86,77,193,
+0,138,38,37,186,32,84,196,159,29,102,241,241,115,201,25,227,146,195,2,229,
+203,116,74,4,137,109,208,3,38,187,62,247,140,69,215,241,0,97,56,96,48,188,
+80,3,142,9,113,214,111,31,23,60,145,158,55,228,6,162,92,124,93,55,79,15,39,
+28,94,1,2,143,139,158,72,207,28,68,184,70,209,132,136,2,178,112,136,16,218,
+218,25,10,134,147,134,36,230,72,237,109,111,144,16,218,218,25,10,134,147,
+146,36,230,72,237,109,111,145,4,54,182,150,231,42,143,225,137,57,146,59,91,
+92,18,4,54,182,150,231,42,143,228,137,57,146,59,91,92,18,68,24,32,57,0,129,
+175,200,0,209,227,17,1,4,5,175,28,124,4,10,26,60,105,241,170,199,145,16,65,
+118,153,244,225,186,207,168,2,12,64,64,232,151,1,24,131,10,65,200,101,13,
+124,160,24,72,32,128,194,115,68,9,177,241,131,130,64,27,220,248,64,2,62,
+146,60,51,224,60,73,82,70,68,138,0,44,142,130,206,48,0,178,90,4,72,232,2,
+73,209,156,130,1,164,245,160,68,146,188,7,163,100,116,22,114,207,128,232,
+104,201,126,56,174,125,2,214,9,79,136,104,201,126,56,174,127,0,31,255,224,
+164,169,35,136,6,128,73,57,132,128,105,1,202,232,240,128,17,224,26,80,54,1,
+240,13,48,49,80,185,146,48,13,56,52,72,58,8,145,15,160,92,72,58,8,156,138,
+12,121,196,63,128,15,255,244,24,192,163,11,23,51,130,56,35,193,56,100,232,
+31,3,75,23,51,130,112,201,199,185,13,159,68,248,114,42,113,225,74,169,175,
+241,0,194,248,128,6,17,193,30,2,125,50,2,132,112,71,130,112,201,192,79,168,
+64,88,156,50,113,238,67,103,192,79,168,72,12,39,52,64,159,84,248,14,134,
+140,151,227,139,215,52,5,172,18,159,16,209,146,252,113,122,230,144,53,110,
+16,22,78,9,204,120,34,78,193,0,172,4,196,126,201,0,241,35,214,1,19,182,128,
+52,136,8,136,253,194,1,100,180,8,157,212,1,100,245,162,125,228,2,101,64,
+202,113,67,77,225,64,46,110,226,221,98,71,130,4,137,210,0,70,110,226,220,
+32,44,156,91,172,72,240,64,145,58,64,5,205,220,163,222,72,240,64,145,58,64,
+130,51,119,22,225,1,100,229,30,242,71,130,4,137,210,4,4,156,80,207,24,0,
+209,35,200,9,246,136,10,148,193,25,203,150,68,207,223,52,4,17,163,151,44,
+137,159,190,105,2,16,209,46,131,36,186,198,128,105,80,50,156,124,8,32,200,
+1,200,233,199,140,186,249,160,140,44,208,16,101,17,68,245,128,190,213,64,
+186,18,7,255,255,255,255,255,255,123,248,158,177,13,218,168,23,66,64,1,0,0,
+0,0,0,0,0,204,64,0,0,0,0,0,0,248,127,35,215,186,72,154,42,77,164,52,168,
+106,39,136,0,0,0,0,0,0,30,15,228,122,210,24,19,69,73,180,134,149,13,68,241,
+0,0,0,0,0,0,3,195,252,63,72,249,33,110,108,0,0,0,0,0,0,11,3,194,29,96,47,
+181,32,20,155,72,108,200,98,70,7,255,255,255,255,255,249,250,25,14,177,13,
+218,144,10,77,164,54,100,49,35,3,255,255,255,255,255,252,255,12,67,193,25,
+19,136,108,207,8,41,224,140,137,194,173,192,153,225,92,66,37,194,161,168,
+153,53,36,4,162,92,67,102,67,18,58,146,64,84,75,141,7,27,169,37,13,68,185,
+32,20,156,67,102,67,18,58,146,99,146,83,143,0,0,0,0,0,0,0,0,2,14,191,94,67,
+9,173,33,133,216,0,15,55,112,168,185,7,172,32,54,110,225,46,247,52,141,154,
+0,189,89,1,115,119,31,18,9,18,67,155,174,33,6,96,48,87,130,50,37,2,0,251,
+73,138,143,240,13,174,180,240,14,75,78,60,128,0,0,0,0,0,15,135,252,86,190,
+192,1,147,119,6,9,147,146,156,80,211,88,4,12,155,185,52,48,156,148,226,134,
+154,192,43,9,96,24,74,110,226,220,32,44,156,24,38,78,74,113,67,77,96,28,74,
+110,226,220,32,44,156,154,24,78,74,113,67,77,96,32,48,214,2,11,15,96,33,54,
+21,136,97,108,128,14,98,79,147,67,9,100,0,179,18,124,45,22,190,96,128,141,
+32,134,28,98,79,180,152,139,218,45,124,193,1,26,65,16,32,196,159,24,230,
+204,244,130,40,89,137,62,210,98,103,92,217,158,144,70,7,49,39,193,130,100,
+164,17,194,140,73,246,147,16,250,9,146,144,72,6,49,39,193,131,20,130,72,73,
+137,62,210,98,31,65,138,65,40,32,196,159,14,234,70,84,130,88,89,137,62,210,
+98,63,93,72,202,144,76,10,49,39,198,33,180,153,37,72,38,134,152,147,237,38,
+38,117,13,164,201,42,65,56,40,196,159,36,65,57,163,149,32,158,26,98,79,180,
+152,165,210,9,205,28,169,5,0,243,18,124,98,22,180,72,130,115,71,42,65,68,
+72,196,159,105,49,51,168,90,209,34,9,205,28,169,5,33,19,18,124,154,24,76,
+185,164,227,138,89,18,116,192,7,145,39,201,161,132,170,64,124,137,62,49,11,
+90,36,65,57,163,149,66,166,37,34,79,180,152,153,212,45,104,145,4,230,142,
+85,10,160,84,137,62,72,130,115,71,42,139,234,134,200,147,237,38,41,116,130,
+115,71,42,139,235,5,72,147,227,16,218,76,146,168,254,184,108,137,62,210,98,
+103,80,218,76,146,168,254,192,68,137,62,29,212,140,170,79,178,23,34,79,180,
+152,143,215,82,50,169,62,208,60,137,62,12,19,37,66,182,21,34,79,180,152,
+135,208,76,149,10,224,68,137,62,49,205,153,234,47,186,23,34,79,180,152,153,
+215,54,103,168,190,240,92,137,62,22,139,95,48,64,70,163,251,225,210,36,251,
+73,136,189,162,215,204,16,17,168,255,2,14,98,79,152,32,35,72,48,64,242,36,
+249,130,2,53,11,6,212,215,35,32,206,1,201,176,113,146,0,0,0,0,0,0,0,0,49,
+185,249,97,137,207,204,37,215,207,204,12,86,126,96,152,188,252,193,88,33,
+46,65,114,136,4,153,37,62,105,13,127,56,4,26,0,57,62,6,232,163,228,74,86,
+219,62,31,16,110,243,224,240,134,227,62,23,12,38,191,18,2,125,32,40,20,87,
+116,41,225,42,5,240,145,139,163,145,41,68,250,128,80,41,174,232,85,200,129,
+166,39,9,24,186,57,18,148,79,172,5,2,170,238,133,220,137,10,72,145,162,39,
+9,24,186,57,18,148,79,176,5,2,186,238,133,124,150,27,48,95,132,140,93,28,
+137,74,39,218,2,129,101,119,66,158,79,15,39,9,24,186,57,18,148,79,184,5,2,
+218,238,133,29,164,80,78,198,46,142,68,165,16,64,28,20,61,73,25,33,205,128,
+0,0,0,0,0,111,168,129,108,241,16,130,33,165,118,4,128,48,10,118,136,2,48,
+175,144,6,84,54,240,240,12,141,21,209,224,24,200,43,131,192,113,57,143,0,
+167,108,131,128,57,137,23,95,200,4,97,121,0,40,2,238,160,175,131,117,2,178,
+112,145,139,163,145,131,114,70,46,142,218,27,182,72,197,209,219,56,26,53,
+161,166,28,197,38,175,18,182,191,206,3,11,231,4,106,124,192,102,44,16,143,
+67,137,146,91,79,36,118,136,178,48,141,156,0,0,0,0,0,0,15,3,242,8,4,16,7,8,
+128,120,72,13,42,226,145,97,87,224,168,1,58,182,232,232,64,22,85,181,187,
+177,107,2,64,7,213,183,74,7,121,207,215,242,17,119,49,248,94,173,198,210,
+36,15,232,34,182,84,113,95,115,240,221,91,141,163,160,72,1,220,164,194,175,
+121,123,103,224,186,244,64,24,45,68,84,251,33,9,64,15,217,66,51,209,218,
+210,129,154,118,254,205,61,65,204,126,23,178,132,103,165,3,52,237,253,154,
+122,131,216,255,87,138,69,80,96,12,180,100,2,0,78,150,140,144,16,18,67,116,
+100,160,128,152,27,163,38,5,4,192,221,45,50,0,130,12,103,163,41,0,130,34,
+23,163,39,5,18,243,167,165,158,32,12,78,150,140,160,1,146,239,209,148,16,
+82,173,206,142,140,161,2,159,15,116,243,235,192,68,50,139,208,32,6,183,27,
+70,80,193,22,227,105,104,202,72,42,220,109,29,13,25,74,3,96,47,161,94,1,
+177,13,209,47,0,222,235,105,145,1,162,6,141,204,210,0,11,23,81,163,209,148,
+64,73,32,205,210,144,7,36,55,70,81,65,37,8,207,70,81,128,230,6,232,202,56,
+44,227,70,139,70,82,206,2,133,120,35,34,103,16,9,148,226,134,153,5,198,117,
+132,28,8,16,112,100,1,103,4,184,134,202,96,104,137,11,82,73,18,224,156,209,
+2,124,147,226,64,12,1,89,33,106,196,34,100,136,38,232,193,143,224,121,44,
+48,46,95,203,145,50,68,19,116,127,254,46,110,227,226,134,34,104,169,33,106,
+5,205,220,148,226,134,155,147,1,161,106,151,195,228,36,6,81,49,194,186,62,
+82,14,10,40,56,153,56,178,52,211,60,127,72,10,14,38,78,56,165,145,39,31,
+212,0,
 };
 #elif defined(DUK_USE_DOUBLE_BE)
-DUK_INTERNAL const duk_uint8_t duk_builtins_data[4281] = {
-144,148,105,226,32,68,52,228,254,12,104,202,37,132,52,167,194,138,105,245,
-124,57,28,211,57,18,64,52,239,126,44,138,111,175,241,164,19,87,145,30,33,
-167,22,145,159,8,211,139,9,225,42,5,240,145,139,163,163,8,211,139,10,228,
-64,211,19,132,140,93,29,56,70,156,88,119,34,66,146,36,104,137,194,70,46,
-142,172,35,78,44,47,146,195,102,11,240,145,139,163,175,8,211,139,9,228,240,
-242,112,145,139,163,179,8,211,139,8,237,34,130,118,49,116,118,225,26,48,0,
-1,98,29,201,158,46,183,39,135,147,132,140,93,16,132,76,66,33,8,66,16,132,
-33,8,66,26,180,105,97,167,68,150,34,33,154,112,0,1,91,247,35,79,111,237,
-198,174,232,47,31,23,95,17,13,31,249,96,211,49,50,53,214,77,141,24,0,0,181,
-10,228,240,242,15,128,140,65,128,134,188,0,0,90,167,97,181,224,0,2,213,62,
-53,224,0,2,213,66,237,120,0,0,181,81,204,107,192,0,5,170,150,67,94,0,0,45,
-84,245,90,240,0,1,106,169,162,215,128,0,11,85,93,150,188,0,0,90,171,111,53,
-109,22,162,26,48,0,1,84,23,201,146,243,225,26,39,12,145,136,104,192,0,5,61,
-11,228,201,121,240,100,19,134,72,196,33,195,14,40,203,112,64,190,76,232,
-145,153,136,15,255,0,0,0,0,0,0,25,152,15,254,0,0,0,0,0,0,25,120,144,13,96,
-155,194,56,80,206,36,67,141,20,228,70,57,81,206,100,131,156,39,132,168,23,
-194,70,46,137,208,21,200,129,166,39,9,24,186,39,72,119,34,66,146,36,104,
-137,194,70,46,137,212,23,201,97,179,5,248,72,197,209,58,194,121,60,60,156,
-36,98,232,157,129,29,164,80,78,198,46,137,218,146,121,25,71,146,9,209,5,
-209,61,48,126,14,138,152,30,67,186,23,143,139,175,131,202,135,228,72,85,
-144,83,60,179,30,94,209,233,102,30,98,105,230,103,30,114,121,231,104,30,
-122,137,231,233,30,130,153,232,106,30,138,169,232,235,30,144,67,193,25,19,
-136,108,207,30,41,224,140,137,194,173,192,153,228,5,242,100,188,248,70,137,
-195,36,79,78,47,147,37,231,193,144,78,25,34,122,145,111,36,74,232,176,13,
-17,61,234,226,93,207,148,160,84,75,141,7,27,161,32,33,18,225,80,212,76,154,
-2,2,70,65,56,100,237,34,140,209,2,67,32,156,50,118,145,64,186,230,61,205,
-35,103,155,32,36,141,19,134,78,210,40,206,16,36,70,137,195,39,105,20,11,
-174,99,220,210,54,121,210,1,137,33,1,228,207,16,17,70,146,66,3,201,164,32,
-0,65,112,152,56,196,159,31,23,77,211,195,201,199,23,160,72,214,246,81,6,12,
-73,241,214,111,31,23,60,145,158,56,50,72,81,67,230,232,242,80,19,49,39,199,
-89,188,124,92,242,70,120,227,64,194,75,154,72,12,9,73,6,111,21,120,12,40,
-144,19,39,25,0,225,144,168,105,56,248,185,228,140,241,200,96,64,100,42,26,
-78,62,46,121,35,52,18,92,116,1,36,64,47,158,64,49,98,66,100,156,242,65,23,
-196,149,35,103,194,94,100,108,144,230,203,156,64,66,37,201,16,11,32,249,
-132,4,34,92,44,93,146,55,152,72,24,137,112,151,153,27,36,5,100,229,144,8,
-162,98,92,210,5,76,73,241,214,111,31,23,60,145,158,57,44,48,46,92,185,164,
-160,72,151,41,0,50,107,179,244,59,36,93,127,92,6,19,172,3,11,216,0,56,224,
-151,29,102,241,241,115,201,25,227,164,64,106,37,199,197,211,116,240,242,
-113,197,233,144,40,248,185,228,140,241,196,75,132,109,24,72,128,43,39,84,
-129,13,173,161,144,168,105,56,98,78,100,142,214,215,69,1,13,173,161,144,
-168,105,57,34,78,100,142,214,215,69,16,67,107,105,110,114,168,254,24,147,
-153,35,181,181,212,32,67,107,105,110,114,168,254,72,147,153,35,181,181,212,
-36,65,130,3,144,8,26,252,200,13,30,85,16,16,64,90,242,231,192,64,161,163,
-203,31,26,172,193,17,4,23,105,159,96,27,172,251,16,32,196,4,14,137,112,17,
-136,48,164,28,134,80,215,202,1,132,130,8,12,39,52,64,155,31,24,56,36,1,189,
-207,132,0,35,233,35,195,62,3,196,149,36,100,72,160,2,200,232,44,227,0,11,
-37,160,68,142,128,36,157,25,200,32,26,79,90,4,73,43,192,122,54,71,65,103,
-44,248,14,134,140,151,227,138,231,208,45,96,148,248,134,140,151,227,138,
-231,240,1,255,254,10,74,146,56,128,104,4,147,152,72,6,144,28,174,143,8,1,
-30,1,165,3,96,31,0,211,3,21,11,153,35,0,211,131,68,131,160,137,16,250,5,
-196,131,160,137,200,160,199,156,67,248,0,255,255,65,140,10,48,177,115,56,
-35,130,60,19,134,79,89,240,52,177,115,56,39,12,156,123,144,217,251,15,135,
-34,167,30,20,170,154,255,232,12,47,244,0,97,28,17,224,39,238,32,40,71,4,
-120,39,12,156,4,253,228,5,137,195,39,30,228,54,124,4,253,228,128,194,115,
-68,9,252,15,128,232,104,201,126,56,191,35,64,90,193,41,241,13,25,47,199,23,
-228,105,3,86,225,1,100,224,156,199,130,36,249,144,10,192,76,71,250,16,15,
-18,61,96,17,62,200,3,72,128,136,143,247,32,22,75,64,137,248,64,22,79,90,39,
-249,64,38,84,12,167,20,52,223,196,2,230,238,45,214,36,120,32,72,158,208,4,
-102,238,45,194,2,201,197,186,196,143,4,9,19,218,0,92,221,202,61,228,143,4,
-9,19,218,8,35,55,113,110,16,22,78,81,239,36,120,32,72,158,208,64,73,197,12,
-255,0,13,18,60,128,159,212,128,169,76,17,156,185,100,76,255,163,64,65,26,
-57,114,200,153,255,70,144,33,13,18,232,50,75,226,104,6,149,3,41,199,246,
-130,12,128,28,142,156,120,203,175,158,8,194,207,1,6,81,20,79,88,11,237,84,
-11,161,32,63,247,255,255,255,255,255,255,137,235,16,221,170,129,116,36,0,0,
-0,0,0,0,0,0,28,196,7,255,128,0,0,0,0,0,2,61,123,164,137,162,164,218,67,74,
-134,162,120,128,255,224,0,0,0,0,0,0,71,173,33,129,52,84,155,72,105,80,212,
-79,16,63,252,0,0,0,0,0,0,3,244,143,146,22,230,192,60,176,0,0,0,0,0,0,33,
-214,2,251,82,1,73,180,134,204,134,36,96,33,159,255,255,255,255,255,255,144,
-235,16,221,169,0,164,218,67,102,67,18,48,48,207,255,255,255,255,255,255,
-196,60,17,145,56,134,204,241,226,158,8,200,156,42,220,9,158,65,196,34,92,
-42,26,137,147,120,64,74,37,196,54,100,49,35,188,36,5,68,184,208,113,187,
-194,80,212,75,146,1,73,196,54,100,49,35,188,38,57,37,56,240,0,0,0,0,0,0,0,
-0,32,235,248,68,48,156,2,24,94,24,0,243,119,10,139,144,123,242,3,102,238,
-18,239,115,72,217,160,11,223,16,23,55,113,241,32,145,36,57,188,18,16,102,3,
-5,120,35,34,89,32,15,180,152,173,127,0,218,235,88,0,228,180,227,200,127,
-248,0,0,0,0,0,0,197,107,240,64,6,77,220,24,38,78,74,113,67,77,130,4,12,155,
-185,52,48,156,148,226,134,155,4,10,194,96,129,132,166,238,45,194,2,201,193,
-130,100,228,167,20,52,216,32,113,41,187,139,112,128,178,114,104,97,57,41,
-197,13,54,8,32,48,216,32,130,195,224,130,19,97,124,134,23,6,0,57,137,62,77,
-12,38,12,0,179,18,124,45,22,190,96,128,141,176,134,28,98,79,180,152,139,
-218,45,124,193,1,27,97,16,32,196,159,24,230,204,246,194,40,89,137,62,210,
-98,103,92,217,158,216,70,7,49,39,193,130,100,182,17,194,140,73,246,147,16,
-250,9,146,216,72,6,49,39,193,131,22,194,72,73,137,62,210,98,31,65,139,97,
-40,32,196,159,14,234,70,86,194,88,89,137,62,210,98,63,93,72,202,216,76,10,
-49,39,198,33,180,153,37,108,38,134,152,147,237,38,38,117,13,164,201,43,97,
-56,40,196,159,36,65,57,163,149,176,158,26,98,79,180,152,165,210,9,205,28,
-173,133,0,243,18,124,98,22,180,72,130,115,71,43,97,68,72,196,159,105,49,51,
-168,90,209,34,9,205,28,173,133,33,19,18,124,154,24,76,185,164,227,138,89,
-18,119,0,7,145,39,201,161,132,188,64,124,137,62,49,11,90,36,65,57,163,149,
-210,166,37,34,79,180,152,153,212,45,104,145,4,230,142,87,74,160,84,137,62,
-72,130,115,71,43,171,234,134,200,147,237,38,41,116,130,115,71,43,171,235,5,
-72,147,227,16,218,76,146,186,254,184,108,137,62,210,98,103,80,218,76,146,
-186,254,192,68,137,62,29,212,140,174,207,178,23,34,79,180,152,143,215,82,
-50,187,62,208,60,137,62,12,19,37,210,182,21,34,79,180,152,135,208,76,151,
-74,224,68,137,62,49,205,153,238,175,186,23,34,79,180,152,153,215,54,103,
-186,190,240,92,137,62,22,139,95,48,64,70,235,251,225,210,36,251,73,136,189,
-162,215,204,16,17,186,255,2,14,98,79,152,32,35,108,48,64,242,36,249,130,2,
-55,75,6,212,224,72,200,51,128,114,108,28,100,128,0,0,0,0,0,0,0,12,110,127,
-48,98,115,249,201,117,243,249,195,21,159,206,38,47,63,156,86,8,75,144,94,
-82,1,38,73,79,208,67,95,233,1,6,128,14,79,129,186,40,249,18,149,182,207,
-144,200,155,188,248,204,105,184,207,142,199,137,175,201,0,159,72,10,5,21,
-221,10,120,74,129,124,36,98,232,228,74,81,62,160,20,10,107,186,21,114,32,
-105,137,194,70,46,142,68,165,19,235,1,64,170,187,161,119,34,66,146,36,104,
-137,194,70,46,142,68,165,19,236,1,64,174,187,161,95,37,134,204,23,225,35,
-23,71,34,82,137,246,128,160,89,93,208,167,147,195,201,194,70,46,142,68,165,
-19,238,1,64,182,187,161,71,105,20,19,177,139,163,145,41,68,16,7,6,15,82,70,
-72,115,96,32,106,27,128,0,0,0,0,91,60,165,195,201,194,8,134,149,216,162,0,
-192,41,225,8,2,48,177,36,1,149,13,196,15,0,200,209,97,199,128,99,32,176,
-195,192,113,57,143,0,167,133,32,230,80,28,202,139,175,238,2,48,189,192,20,
-1,119,80,87,193,186,129,89,56,72,197,209,200,193,185,35,23,71,109,13,219,
-36,98,232,237,156,13,26,208,211,14,102,19,87,137,91,95,128,0,10,96,24,92,0,
-0,83,2,53,56,0,0,165,3,28,204,160,160,226,100,226,200,211,76,241,240,0,1,
-102,8,22,75,64,137,73,20,230,105,133,7,19,39,22,70,154,103,143,128,0,11,48,
-20,28,76,156,113,75,34,78,62,0,0,45,3,103,31,0,0,22,65,44,57,137,62,33,179,
-216,162,152,192,131,18,124,162,27,61,138,41,108,32,196,159,16,217,232,235,
-81,76,104,73,137,62,81,13,158,142,181,20,184,16,98,79,136,108,244,244,168,
-166,56,36,196,159,40,134,207,79,74,138,93,10,49,39,194,173,192,158,158,149,
-20,188,20,98,79,133,91,129,61,109,74,41,124,30,68,159,16,217,236,83,108,96,
-68,137,62,81,13,158,197,54,182,17,34,79,136,108,244,117,169,182,52,38,68,
-159,40,134,207,71,90,155,92,8,145,39,196,54,122,122,84,219,28,19,34,79,148,
-67,103,167,165,77,174,133,72,147,225,86,224,79,79,74,155,94,10,145,39,194,
-173,192,158,182,165,54,190,206,25,212,35,208,226,100,150,211,201,29,162,44,
-140,35,103,0,255,192,0,0,0,0,0,0,206,25,228,35,208,226,100,150,211,201,29,
-162,44,140,35,103,0,255,192,0,0,0,0,0,0,206,25,244,35,208,226,100,150,211,
-201,29,162,44,140,35,103,0,255,192,0,0,0,0,0,0,206,26,4,35,208,226,100,150,
-211,201,29,162,44,140,35,103,1,0,0,0,0,0,0,0,0,206,26,20,35,208,226,100,
-150,211,201,29,162,44,140,35,103,1,0,0,0,0,0,0,0,0,206,26,36,35,208,226,
-100,150,211,201,29,162,44,140,35,103,1,0,64,0,0,0,0,0,0,206,26,52,35,208,
-226,100,150,211,201,29,162,44,140,35,103,1,0,64,0,0,0,0,0,0,206,26,68,35,
-208,226,100,150,211,201,29,162,44,140,35,103,1,0,64,0,0,0,0,0,0,206,26,84,
-35,208,226,100,150,211,201,29,162,44,140,35,103,1,0,128,0,0,0,0,0,0,195,
-154,99,16,38,36,0,251,68,117,179,216,162,128,68,72,1,241,13,158,197,20,150,
-25,18,0,125,162,58,217,232,235,117,100,162,136,25,18,0,125,162,58,217,232,
-235,116,36,162,145,2,226,64,15,136,108,244,117,186,178,81,73,129,113,32,7,
-196,54,122,58,221,9,40,165,64,200,144,3,237,17,214,207,79,75,171,37,20,80,
-200,144,3,237,17,214,207,79,75,161,37,20,138,23,18,0,124,67,103,167,165,
-213,146,138,77,11,137,0,62,33,179,211,210,232,73,69,42,133,196,128,31,10,
-183,2,125,89,40,163,5,196,128,31,10,183,2,125,9,40,164,96,200,144,3,224,
-221,64,172,157,89,40,163,134,68,128,31,6,234,5,100,232,73,69,35,133,68,128,
-31,104,142,182,125,89,40,180,0,168,144,3,237,17,214,207,161,37,22,144,19,
-18,0,124,67,103,213,146,139,80,9,137,0,62,33,179,232,73,69,172,5,90,40,153,
-59,68,117,179,216,166,192,77,162,137,147,136,108,246,41,180,176,219,69,19,
-39,104,142,182,122,58,221,89,41,178,6,218,40,153,59,68,117,179,209,214,232,
-73,77,162,6,90,40,153,56,134,207,71,91,171,37,54,152,25,104,162,100,226,27,
-61,29,110,132,148,218,160,109,162,137,147,180,71,91,61,61,46,172,148,217,
-67,109,20,76,157,162,58,217,233,233,116,36,166,209,67,45,20,76,156,67,103,
-167,165,213,146,155,77,12,180,81,50,113,13,158,158,151,66,74,109,84,50,209,
-68,201,194,173,192,159,86,74,108,193,150,138,38,78,21,110,4,250,18,83,104,
-193,182,138,38,78,13,212,10,201,213,146,155,56,109,162,137,147,131,117,2,
-178,116,36,166,209,194,237,20,76,157,162,58,217,245,100,167,16,2,237,20,76,
-157,162,58,217,244,36,167,18,2,173,20,76,156,67,103,213,146,156,80,10,180,
-81,50,113,13,159,66,74,113,97,175,221,48,216,110,64,4,42,22,189,179,0,196,
-133,0,185,80,32,28,78,99,193,18,80,36,4,19,159,141,172,0,178,90,4,74,73,0,
-22,209,68,201,187,129,4,2,8,3,132,64,60,36,4,0,91,240,168,177,69,118,144,
-157,91,116,116,32,32,1,53,216,221,218,170,139,3,234,219,165,0,255,152,185,
-11,251,232,231,188,47,86,227,105,18,1,255,184,170,59,41,92,23,240,110,173,
-198,209,208,36,3,253,188,183,177,82,110,80,224,93,122,32,32,4,144,253,170,
-34,22,140,7,236,161,25,232,237,105,64,63,230,160,158,102,127,59,205,11,217,
-66,51,210,128,127,237,65,60,204,254,119,155,171,197,34,168,48,6,90,194,1,0,
-39,75,88,72,8,9,33,186,194,80,64,76,13,214,19,2,130,96,110,150,189,0,65,6,
-51,214,20,128,65,17,11,214,19,130,137,121,211,210,211,144,6,39,75,88,80,0,
-201,119,235,10,8,41,86,231,71,88,80,129,79,135,186,122,133,224,34,25,69,
-234,80,3,91,141,172,40,96,139,113,180,181,133,36,21,110,54,142,134,176,165,
-1,176,23,213,47,0,216,134,234,215,128,111,117,181,232,128,209,3,70,230,107,
-64,5,139,168,209,235,10,32,36,144,102,235,136,3,146,27,172,40,160,146,132,
-103,172,40,192,115,3,117,133,28,22,113,163,69,172,41,103,1,66,188,17,145,
-52,168,4,202,113,67,76,130,227,76,194,13,240,108,0,0,83,224,0,2,193,0,104,
-146,84,97,48,0,1,94,192,56,169,24,145,179,192,0,5,112,8,56,16,32,128,56,18,
-52,125,230,86,147,190,140,28,50,21,13,39,31,23,60,145,158,57,12,141,47,129,
-6,155,194,188,24,49,39,199,89,188,124,92,242,70,120,224,201,33,69,15,155,
-163,201,68,14,49,39,199,197,211,116,240,242,113,197,232,18,180,254,36,3,17,
-46,18,243,35,100,128,172,156,178,70,163,154,76,34,248,146,164,108,248,75,
-204,141,146,28,217,115,137,27,95,27,241,173,236,162,160,224,200,2,206,9,
-113,13,148,192,209,18,22,164,146,37,193,57,162,4,249,39,196,128,24,2,178,
-66,213,136,68,201,16,77,209,131,31,192,242,88,96,92,191,151,34,100,136,38,
-232,255,252,92,221,199,197,12,68,209,82,66,212,11,155,185,41,197,13,55,38,
-3,66,213,47,135,254,72,12,162,99,133,116,112,0,1,72,66,14,16,16,50,37,202,
-160,150,154,66,14,20,8,57,192,28,24,80,113,50,113,100,105,166,120,248,0,0,
-179,1,65,196,201,199,20,178,36,227,224,0,2,208,54,113,240,0,1,100,11,181,
-192,0,5,178,1,18,160,65,24,131,20,145,25,188,48,132,122,28,76,146,218,121,
-35,180,69,145,132,108,224,31,248,0,0,0,0,0,0,25,188,56,132,122,28,76,146,
-218,121,35,180,69,145,132,108,224,31,248,0,0,0,0,0,0,40,160,45,110,23,30,
-176,33,184,0,0,183,32,29,235,2,27,199,23,0,0,23,4,51,120,129,8,244,56,153,
-37,180,242,71,104,139,35,8,217,192,63,240,0,0,0,0,0,0,51,120,145,8,244,56,
-153,37,180,242,71,104,139,35,8,217,192,64,0,0,0,0,0,0,0,51,120,161,8,244,
-56,153,37,180,242,71,104,139,35,8,217,192,64,0,0,0,0,0,0,0,51,120,177,8,
-244,56,153,37,180,242,71,104,139,35,8,217,192,64,16,0,0,0,0,0,0,51,120,193,
-8,244,56,153,37,180,242,71,104,139,35,8,217,192,64,16,0,0,0,0,0,0,51,120,
-209,8,244,56,153,37,180,242,71,104,139,35,8,217,192,64,16,0,0,0,0,0,0,51,
-120,225,8,244,56,153,37,180,242,71,104,139,35,8,217,192,64,32,0,0,0,0,0,0,
-32,227,194,0,97,57,162,4,246,104,5,34,92,35,68,225,161,166,220,16,16,137,
-112,52,41,73,29,185,1,65,196,201,197,145,166,153,246,72,3,137,204,120,34,
-74,8,199,1,67,17,162,112,201,84,128,97,144,78,25,42,16,131,169,1,205,66,8,
-35,68,225,161,166,239,128,0,10,192,64,196,104,156,50,96,0,2,172,73,240,117,
-96,57,170,97,4,104,156,52,52,221,240,0,1,82,1,74,9,129,125,240,0,1,82,32,
-148,25,174,137,58,23,51,190,0,0,42,69,64,195,32,156,50,96,0,2,160,81,238,2,
-3,107,173,218,3,192,
+DUK_INTERNAL const duk_uint8_t duk_builtins_data[2590] = {
+144,148,105,216,160,68,52,226,190,12,104,197,165,132,52,167,194,138,105,
+231,252,57,28,211,49,18,64,52,234,190,44,138,111,157,241,164,19,87,37,30,
+33,167,4,145,159,8,211,130,9,225,42,5,240,145,139,163,163,8,211,130,10,228,
+64,211,19,132,140,93,29,56,70,156,16,119,34,66,146,36,104,137,194,70,46,
+142,172,35,78,8,47,146,195,102,11,240,145,139,163,175,8,211,130,9,228,240,
+242,112,145,139,163,179,8,211,130,8,237,34,130,118,49,116,118,225,26,61,1,
+220,153,226,235,114,120,121,56,72,197,209,8,68,196,34,16,213,154,75,13,57,
+148,177,17,12,211,199,251,113,163,201,44,16,225,80,81,150,224,129,124,153,
+209,35,51,16,31,254,0,0,0,0,0,0,51,48,31,252,0,0,0,0,0,0,50,241,32,26,193,
+55,132,112,161,156,72,135,26,41,200,140,114,163,156,201,7,56,79,9,80,47,
+132,140,93,19,160,43,145,3,76,78,18,49,116,78,144,238,68,133,36,72,209,19,
+132,140,93,19,168,47,146,195,102,11,240,145,139,162,117,132,242,120,121,56,
+72,197,209,59,2,59,72,160,157,140,93,19,181,36,240,210,143,14,31,131,162,
+166,7,144,238,177,226,68,60,17,145,56,134,204,240,130,158,8,200,156,42,220,
+9,158,22,37,220,177,74,5,68,184,208,113,185,130,2,17,46,21,13,68,201,151,
+32,36,100,19,134,78,210,40,200,144,36,50,9,195,39,105,20,11,174,99,220,210,
+54,121,34,2,72,209,56,100,237,34,140,153,2,68,104,156,50,118,145,64,186,
+230,61,205,35,103,148,32,24,146,16,30,76,169,1,20,105,36,32,60,153,178,0,4,
+23,9,131,140,73,241,241,116,221,60,60,156,113,119,164,141,111,25,16,96,196,
+159,29,102,241,241,115,201,25,227,131,36,133,20,62,110,142,217,1,51,18,124,
+117,155,199,197,207,36,103,142,52,12,36,183,68,128,192,148,144,102,236,151,
+128,194,137,1,50,108,208,14,25,10,134,147,143,139,158,72,207,27,86,4,6,66,
+161,164,227,226,231,146,51,65,37,180,64,18,68,2,247,132,3,22,36,38,73,188,
+36,17,124,73,82,54,124,37,230,70,201,14,108,183,100,4,34,92,145,0,178,15,
+114,64,66,37,194,197,217,35,119,36,129,136,151,9,121,145,178,64,86,77,193,
+0,138,38,37,186,32,84,196,159,29,102,241,241,115,201,25,227,146,195,2,229,
+203,116,74,4,137,109,208,3,38,187,62,247,140,69,215,241,0,97,56,96,48,188,
+80,3,142,9,113,214,111,31,23,60,145,158,55,228,6,162,92,124,93,55,79,15,39,
+28,94,1,2,143,139,158,72,207,28,68,184,70,209,132,136,2,178,112,136,16,218,
+218,25,10,134,147,134,36,230,72,237,109,111,144,16,218,218,25,10,134,147,
+146,36,230,72,237,109,111,145,4,54,182,150,231,42,143,225,137,57,146,59,91,
+92,18,4,54,182,150,231,42,143,228,137,57,146,59,91,92,18,68,24,32,57,0,129,
+175,200,0,209,227,17,1,4,5,175,28,124,4,10,26,60,105,241,170,199,145,16,65,
+118,153,244,225,186,207,168,2,12,64,64,232,151,1,24,131,10,65,200,101,13,
+124,160,24,72,32,128,194,115,68,9,177,241,131,130,64,27,220,248,64,2,62,
+146,60,51,224,60,73,82,70,68,138,0,44,142,130,206,48,0,178,90,4,72,232,2,
+73,209,156,130,1,164,245,160,68,146,188,7,163,100,116,22,114,207,128,232,
+104,201,126,56,174,125,2,214,9,79,136,104,201,126,56,174,127,0,31,255,224,
+164,169,35,136,6,128,73,57,132,128,105,1,202,232,240,128,17,224,26,80,54,1,
+240,13,48,49,80,185,146,48,13,56,52,72,58,8,145,15,160,92,72,58,8,156,138,
+12,121,196,63,128,15,255,244,24,192,163,11,23,51,130,56,35,193,56,100,232,
+31,3,75,23,51,130,112,201,199,185,13,159,68,248,114,42,113,225,74,169,175,
+241,0,194,248,128,6,17,193,30,2,125,50,2,132,112,71,130,112,201,192,79,168,
+64,88,156,50,113,238,67,103,192,79,168,72,12,39,52,64,159,84,248,14,134,
+140,151,227,139,215,52,5,172,18,159,16,209,146,252,113,122,230,144,53,110,
+16,22,78,9,204,120,34,78,193,0,172,4,196,126,201,0,241,35,214,1,19,182,128,
+52,136,8,136,253,194,1,100,180,8,157,212,1,100,245,162,125,228,2,101,64,
+202,113,67,77,225,64,46,110,226,221,98,71,130,4,137,210,0,70,110,226,220,
+32,44,156,91,172,72,240,64,145,58,64,5,205,220,163,222,72,240,64,145,58,64,
+130,51,119,22,225,1,100,229,30,242,71,130,4,137,210,4,4,156,80,207,24,0,
+209,35,200,9,246,136,10,148,193,25,203,150,68,207,223,52,4,17,163,151,44,
+137,159,190,105,2,16,209,46,131,36,186,198,128,105,80,50,156,124,8,32,200,
+1,200,233,199,140,186,249,160,140,44,208,16,101,17,68,245,128,190,213,64,
+186,18,3,255,127,255,255,255,255,255,248,158,177,13,218,168,23,66,64,0,0,0,
+0,0,0,0,1,204,64,127,248,0,0,0,0,0,0,35,215,186,72,154,42,77,164,52,168,
+106,39,136,15,254,0,0,0,0,0,0,4,122,210,24,19,69,73,180,134,149,13,68,241,
+3,255,192,0,0,0,0,0,0,63,72,249,33,110,108,3,203,0,0,0,0,0,0,2,29,96,47,
+181,32,20,155,72,108,200,98,70,2,25,255,255,255,255,255,255,249,14,177,13,
+218,144,10,77,164,54,100,49,35,3,12,255,255,255,255,255,255,252,67,193,25,
+19,136,108,207,8,41,224,140,137,194,173,192,153,225,92,66,37,194,161,168,
+153,53,36,4,162,92,67,102,67,18,58,146,64,84,75,141,7,27,169,37,13,68,185,
+32,20,156,67,102,67,18,58,146,99,146,83,143,0,0,0,0,0,0,0,0,2,14,191,94,67,
+9,173,33,133,216,0,15,55,112,168,185,7,172,32,54,110,225,46,247,52,141,154,
+0,189,89,1,115,119,31,18,9,18,67,155,174,33,6,96,48,87,130,50,37,2,0,251,
+73,138,143,240,13,174,180,240,14,75,78,60,135,255,128,0,0,0,0,0,12,86,190,
+192,1,147,119,6,9,147,146,156,80,211,88,4,12,155,185,52,48,156,148,226,134,
+154,192,43,9,96,24,74,110,226,220,32,44,156,24,38,78,74,113,67,77,96,28,74,
+110,226,220,32,44,156,154,24,78,74,113,67,77,96,32,48,214,2,11,15,96,33,54,
+21,136,97,108,128,14,98,79,147,67,9,100,0,179,18,124,45,22,190,96,128,141,
+32,134,28,98,79,180,152,139,218,45,124,193,1,26,65,16,32,196,159,24,230,
+204,244,130,40,89,137,62,210,98,103,92,217,158,144,70,7,49,39,193,130,100,
+164,17,194,140,73,246,147,16,250,9,146,144,72,6,49,39,193,131,20,130,72,73,
+137,62,210,98,31,65,138,65,40,32,196,159,14,234,70,84,130,88,89,137,62,210,
+98,63,93,72,202,144,76,10,49,39,198,33,180,153,37,72,38,134,152,147,237,38,
+38,117,13,164,201,42,65,56,40,196,159,36,65,57,163,149,32,158,26,98,79,180,
+152,165,210,9,205,28,169,5,0,243,18,124,98,22,180,72,130,115,71,42,65,68,
+72,196,159,105,49,51,168,90,209,34,9,205,28,169,5,33,19,18,124,154,24,76,
+185,164,227,138,89,18,116,192,7,145,39,201,161,132,170,64,124,137,62,49,11,
+90,36,65,57,163,149,66,166,37,34,79,180,152,153,212,45,104,145,4,230,142,
+85,10,160,84,137,62,72,130,115,71,42,139,234,134,200,147,237,38,41,116,130,
+115,71,42,139,235,5,72,147,227,16,218,76,146,168,254,184,108,137,62,210,98,
+103,80,218,76,146,168,254,192,68,137,62,29,212,140,170,79,178,23,34,79,180,
+152,143,215,82,50,169,62,208,60,137,62,12,19,37,66,182,21,34,79,180,152,
+135,208,76,149,10,224,68,137,62,49,205,153,234,47,186,23,34,79,180,152,153,
+215,54,103,168,190,240,92,137,62,22,139,95,48,64,70,163,251,225,210,36,251,
+73,136,189,162,215,204,16,17,168,255,2,14,98,79,152,32,35,72,48,64,242,36,
+249,130,2,53,11,6,212,215,35,32,206,1,201,176,113,146,0,0,0,0,0,0,0,0,49,
+185,249,97,137,207,204,37,215,207,204,12,86,126,96,152,188,252,193,88,33,
+46,65,114,136,4,153,37,62,105,13,127,56,4,26,0,57,62,6,232,163,228,74,86,
+219,62,31,16,110,243,224,240,134,227,62,23,12,38,191,18,2,125,32,40,20,87,
+116,41,225,42,5,240,145,139,163,145,41,68,250,128,80,41,174,232,85,200,129,
+166,39,9,24,186,57,18,148,79,172,5,2,170,238,133,220,137,10,72,145,162,39,
+9,24,186,57,18,148,79,176,5,2,186,238,133,124,150,27,48,95,132,140,93,28,
+137,74,39,218,2,129,101,119,66,158,79,15,39,9,24,186,57,18,148,79,184,5,2,
+218,238,133,29,164,80,78,198,46,142,68,165,16,64,28,20,61,73,25,33,205,128,
+129,168,110,0,0,0,0,1,108,241,16,130,33,165,118,4,128,48,10,118,136,2,48,
+175,144,6,84,54,240,240,12,141,21,209,224,24,200,43,131,192,113,57,143,0,
+167,108,131,128,57,137,23,95,200,4,97,121,0,40,2,238,160,175,131,117,2,178,
+112,145,139,163,145,131,114,70,46,142,218,27,182,72,197,209,219,56,26,53,
+161,166,28,197,38,175,18,182,191,206,3,11,231,4,106,124,192,102,44,16,143,
+67,137,146,91,79,36,118,136,178,48,141,156,3,255,0,0,0,0,0,0,2,8,4,16,7,8,
+128,120,72,8,0,183,225,81,98,138,237,33,58,182,232,232,64,64,2,107,177,187,
+181,85,22,7,213,183,74,1,255,49,114,23,247,209,207,120,94,173,198,210,36,3,
+255,113,84,118,82,184,47,224,221,91,141,163,160,72,7,251,121,111,98,164,
+220,161,192,186,244,64,64,9,33,251,84,68,45,24,15,217,66,51,209,218,210,
+128,127,205,65,60,204,254,119,154,23,178,132,103,165,0,255,218,130,121,153,
+252,239,55,87,138,69,80,96,12,180,100,2,0,78,150,140,144,16,18,67,116,100,
+160,128,152,27,163,38,5,4,192,221,45,50,0,130,12,103,163,41,0,130,34,23,
+163,39,5,18,243,167,165,158,32,12,78,150,140,160,1,146,239,209,148,16,82,
+173,206,142,140,161,2,159,15,116,243,235,192,68,50,139,208,32,6,183,27,70,
+80,193,22,227,105,104,202,72,42,220,109,29,13,25,74,3,96,47,161,94,1,177,
+13,209,47,0,222,235,105,145,1,162,6,141,204,210,0,11,23,81,163,209,148,64,
+73,32,205,210,144,7,36,55,70,81,65,37,8,207,70,81,128,230,6,232,202,56,44,
+227,70,139,70,82,206,2,133,120,35,34,103,16,9,148,226,134,153,5,198,117,
+132,28,8,16,112,100,1,103,4,184,134,202,96,104,137,11,82,73,18,224,156,209,
+2,124,147,226,64,12,1,89,33,106,196,34,100,136,38,232,193,143,224,121,44,
+48,46,95,203,145,50,68,19,116,127,254,46,110,227,226,134,34,104,169,33,106,
+5,205,220,148,226,134,155,147,1,161,106,151,195,228,36,6,81,49,194,186,62,
+82,14,10,40,56,153,56,178,52,211,60,127,72,10,14,38,78,56,165,145,39,31,
+212,0,
 };
 #elif defined(DUK_USE_DOUBLE_ME)
-DUK_INTERNAL const duk_uint8_t duk_builtins_data[4281] = {
-144,148,105,226,32,68,52,228,254,12,104,202,37,132,52,167,194,138,105,245,
-124,57,28,211,57,18,64,52,239,126,44,138,111,175,241,164,19,87,145,30,33,
-167,22,145,159,8,211,139,9,225,42,5,240,145,139,163,163,8,211,139,10,228,
-64,211,19,132,140,93,29,56,70,156,88,119,34,66,146,36,104,137,194,70,46,
-142,172,35,78,44,47,146,195,102,11,240,145,139,163,175,8,211,139,9,228,240,
-242,112,145,139,163,179,8,211,139,8,237,34,130,118,49,116,118,225,26,48,0,
-1,98,29,201,158,46,183,39,135,147,132,140,93,16,132,76,66,33,8,66,16,132,
-33,8,66,26,180,105,97,167,68,150,34,33,154,112,0,1,91,247,35,79,111,237,
-198,174,232,47,31,23,95,17,13,31,249,96,211,49,50,53,214,77,141,24,0,0,181,
-10,228,240,242,15,128,140,65,128,134,188,0,0,90,167,97,181,224,0,2,213,62,
-53,224,0,2,213,66,237,120,0,0,181,81,204,107,192,0,5,170,150,67,94,0,0,45,
-84,245,90,240,0,1,106,169,162,215,128,0,11,85,93,150,188,0,0,90,171,111,53,
-109,22,162,26,48,0,1,84,23,201,146,243,225,26,39,12,145,136,104,192,0,5,61,
-11,228,201,121,240,100,19,134,72,196,33,195,14,40,203,112,64,190,76,232,
-145,153,136,0,0,31,15,224,0,0,0,25,152,0,0,30,15,224,0,0,0,25,120,144,13,
-96,155,194,56,80,206,36,67,141,20,228,70,57,81,206,100,131,156,39,132,168,
-23,194,70,46,137,208,21,200,129,166,39,9,24,186,39,72,119,34,66,146,36,104,
-137,194,70,46,137,212,23,201,97,179,5,248,72,197,209,58,194,121,60,60,156,
-36,98,232,157,129,29,164,80,78,198,46,137,218,146,121,25,71,146,9,209,5,
-209,61,48,126,14,138,152,30,67,186,23,143,139,175,131,202,135,228,72,85,
-144,83,60,179,30,94,209,233,102,30,98,105,230,103,30,114,121,231,104,30,
-122,137,231,233,30,130,153,232,106,30,138,169,232,235,30,144,67,193,25,19,
-136,108,207,30,41,224,140,137,194,173,192,153,228,5,242,100,188,248,70,137,
-195,36,79,78,47,147,37,231,193,144,78,25,34,122,145,111,36,74,232,176,13,
-17,61,234,226,93,207,148,160,84,75,141,7,27,161,32,33,18,225,80,212,76,154,
-2,2,70,65,56,100,237,34,140,209,2,67,32,156,50,118,145,64,186,230,61,205,
-35,103,155,32,36,141,19,134,78,210,40,206,16,36,70,137,195,39,105,20,11,
-174,99,220,210,54,121,210,1,137,33,1,228,207,16,17,70,146,66,3,201,164,32,
-0,65,112,152,56,196,159,31,23,77,211,195,201,199,23,160,72,214,246,81,6,12,
-73,241,214,111,31,23,60,145,158,56,50,72,81,67,230,232,242,80,19,49,39,199,
-89,188,124,92,242,70,120,227,64,194,75,154,72,12,9,73,6,111,21,120,12,40,
-144,19,39,25,0,225,144,168,105,56,248,185,228,140,241,200,96,64,100,42,26,
-78,62,46,121,35,52,18,92,116,1,36,64,47,158,64,49,98,66,100,156,242,65,23,
-196,149,35,103,194,94,100,108,144,230,203,156,64,66,37,201,16,11,32,249,
-132,4,34,92,44,93,146,55,152,72,24,137,112,151,153,27,36,5,100,229,144,8,
-162,98,92,210,5,76,73,241,214,111,31,23,60,145,158,57,44,48,46,92,185,164,
-160,72,151,41,0,50,107,179,244,59,36,93,127,92,6,19,172,3,11,216,0,56,224,
-151,29,102,241,241,115,201,25,227,164,64,106,37,199,197,211,116,240,242,
-113,197,233,144,40,248,185,228,140,241,196,75,132,109,24,72,128,43,39,84,
-129,13,173,161,144,168,105,56,98,78,100,142,214,215,69,1,13,173,161,144,
-168,105,57,34,78,100,142,214,215,69,16,67,107,105,110,114,168,254,24,147,
-153,35,181,181,212,32,67,107,105,110,114,168,254,72,147,153,35,181,181,212,
-36,65,130,3,144,8,26,252,200,13,30,85,16,16,64,90,242,231,192,64,161,163,
-203,31,26,172,193,17,4,23,105,159,96,27,172,251,16,32,196,4,14,137,112,17,
-136,48,164,28,134,80,215,202,1,132,130,8,12,39,52,64,155,31,24,56,36,1,189,
-207,132,0,35,233,35,195,62,3,196,149,36,100,72,160,2,200,232,44,227,0,11,
-37,160,68,142,128,36,157,25,200,32,26,79,90,4,73,43,192,122,54,71,65,103,
-44,248,14,134,140,151,227,138,231,208,45,96,148,248,134,140,151,227,138,
-231,240,1,255,254,10,74,146,56,128,104,4,147,152,72,6,144,28,174,143,8,1,
-30,1,165,3,96,31,0,211,3,21,11,153,35,0,211,131,68,131,160,137,16,250,5,
-196,131,160,137,200,160,199,156,67,248,0,255,255,65,140,10,48,177,115,56,
-35,130,60,19,134,79,89,240,52,177,115,56,39,12,156,123,144,217,251,15,135,
-34,167,30,20,170,154,255,232,12,47,244,0,97,28,17,224,39,238,32,40,71,4,
-120,39,12,156,4,253,228,5,137,195,39,30,228,54,124,4,253,228,128,194,115,
-68,9,252,15,128,232,104,201,126,56,191,35,64,90,193,41,241,13,25,47,199,23,
-228,105,3,86,225,1,100,224,156,199,130,36,249,144,10,192,76,71,250,16,15,
-18,61,96,17,62,200,3,72,128,136,143,247,32,22,75,64,137,248,64,22,79,90,39,
-249,64,38,84,12,167,20,52,223,196,2,230,238,45,214,36,120,32,72,158,208,4,
-102,238,45,194,2,201,197,186,196,143,4,9,19,218,0,92,221,202,61,228,143,4,
-9,19,218,8,35,55,113,110,16,22,78,81,239,36,120,32,72,158,208,64,73,197,12,
-255,0,13,18,60,128,159,212,128,169,76,17,156,185,100,76,255,163,64,65,26,
-57,114,200,153,255,70,144,33,13,18,232,50,75,226,104,6,149,3,41,199,246,
-130,12,128,28,142,156,120,203,175,158,8,194,207,1,6,81,20,79,88,11,237,84,
-11,161,32,127,255,247,191,255,255,255,255,137,235,16,221,170,129,116,36,0,
-0,0,0,0,16,0,0,12,196,0,0,15,135,240,0,0,0,2,61,123,164,137,162,164,218,67,
-74,134,162,120,128,0,1,224,254,0,0,0,0,71,173,33,129,52,84,155,72,105,80,
-212,79,16,0,0,60,63,192,0,0,0,3,244,143,146,22,230,192,0,0,176,60,0,0,0,0,
-33,214,2,251,82,1,73,180,134,204,134,36,96,127,255,159,161,255,255,255,255,
-144,235,16,221,169,0,164,218,67,102,67,18,48,63,255,207,240,255,255,255,
-255,196,60,17,145,56,134,204,241,226,158,8,200,156,42,220,9,158,65,196,34,
-92,42,26,137,147,120,64,74,37,196,54,100,49,35,188,36,5,68,184,208,113,187,
-194,80,212,75,146,1,73,196,54,100,49,35,188,38,57,37,56,240,0,0,0,0,0,0,0,
-0,32,235,248,68,48,156,2,24,94,24,0,243,119,10,139,144,123,242,3,102,238,
-18,239,115,72,217,160,11,223,16,23,55,113,241,32,145,36,57,188,18,16,102,3,
-5,120,35,34,89,32,15,180,152,173,127,0,218,235,88,0,228,180,227,200,0,0,
-248,127,0,0,0,0,197,107,240,64,6,77,220,24,38,78,74,113,67,77,130,4,12,155,
-185,52,48,156,148,226,134,155,4,10,194,96,129,132,166,238,45,194,2,201,193,
-130,100,228,167,20,52,216,32,113,41,187,139,112,128,178,114,104,97,57,41,
-197,13,54,8,32,48,216,32,130,195,224,130,19,97,124,134,23,6,0,57,137,62,77,
-12,38,12,0,179,18,124,45,22,190,96,128,141,176,134,28,98,79,180,152,139,
-218,45,124,193,1,27,97,16,32,196,159,24,230,204,246,194,40,89,137,62,210,
-98,103,92,217,158,216,70,7,49,39,193,130,100,182,17,194,140,73,246,147,16,
-250,9,146,216,72,6,49,39,193,131,22,194,72,73,137,62,210,98,31,65,139,97,
-40,32,196,159,14,234,70,86,194,88,89,137,62,210,98,63,93,72,202,216,76,10,
-49,39,198,33,180,153,37,108,38,134,152,147,237,38,38,117,13,164,201,43,97,
-56,40,196,159,36,65,57,163,149,176,158,26,98,79,180,152,165,210,9,205,28,
-173,133,0,243,18,124,98,22,180,72,130,115,71,43,97,68,72,196,159,105,49,51,
-168,90,209,34,9,205,28,173,133,33,19,18,124,154,24,76,185,164,227,138,89,
-18,119,0,7,145,39,201,161,132,188,64,124,137,62,49,11,90,36,65,57,163,149,
-210,166,37,34,79,180,152,153,212,45,104,145,4,230,142,87,74,160,84,137,62,
-72,130,115,71,43,171,234,134,200,147,237,38,41,116,130,115,71,43,171,235,5,
-72,147,227,16,218,76,146,186,254,184,108,137,62,210,98,103,80,218,76,146,
-186,254,192,68,137,62,29,212,140,174,207,178,23,34,79,180,152,143,215,82,
-50,187,62,208,60,137,62,12,19,37,210,182,21,34,79,180,152,135,208,76,151,
-74,224,68,137,62,49,205,153,238,175,186,23,34,79,180,152,153,215,54,103,
-186,190,240,92,137,62,22,139,95,48,64,70,235,251,225,210,36,251,73,136,189,
-162,215,204,16,17,186,255,2,14,98,79,152,32,35,108,48,64,242,36,249,130,2,
-55,75,6,212,224,72,200,51,128,114,108,28,100,128,0,0,0,0,0,0,0,12,110,127,
-48,98,115,249,201,117,243,249,195,21,159,206,38,47,63,156,86,8,75,144,94,
-82,1,38,73,79,208,67,95,233,1,6,128,14,79,129,186,40,249,18,149,182,207,
-144,200,155,188,248,204,105,184,207,142,199,137,175,201,0,159,72,10,5,21,
-221,10,120,74,129,124,36,98,232,228,74,81,62,160,20,10,107,186,21,114,32,
-105,137,194,70,46,142,68,165,19,235,1,64,170,187,161,119,34,66,146,36,104,
-137,194,70,46,142,68,165,19,236,1,64,174,187,161,95,37,134,204,23,225,35,
-23,71,34,82,137,246,128,160,89,93,208,167,147,195,201,194,70,46,142,68,165,
-19,238,1,64,182,187,161,71,105,20,19,177,139,163,145,41,68,16,7,6,15,82,70,
-72,115,96,0,27,234,32,0,0,0,0,91,60,165,195,201,194,8,134,149,216,162,0,
-192,41,225,8,2,48,177,36,1,149,13,196,15,0,200,209,97,199,128,99,32,176,
-195,192,113,57,143,0,167,133,32,230,80,28,202,139,175,238,2,48,189,192,20,
-1,119,80,87,193,186,129,89,56,72,197,209,200,193,185,35,23,71,109,13,219,
-36,98,232,237,156,13,26,208,211,14,102,19,87,137,91,95,128,0,10,96,24,92,0,
-0,83,2,53,56,0,0,165,3,28,204,160,160,226,100,226,200,211,76,241,240,0,1,
-102,8,22,75,64,137,73,20,230,105,133,7,19,39,22,70,154,103,143,128,0,11,48,
-20,28,76,156,113,75,34,78,62,0,0,45,3,103,31,0,0,22,65,44,57,137,62,33,179,
-216,162,152,192,131,18,124,162,27,61,138,41,108,32,196,159,16,217,232,235,
-81,76,104,73,137,62,81,13,158,142,181,20,184,16,98,79,136,108,244,244,168,
-166,56,36,196,159,40,134,207,79,74,138,93,10,49,39,194,173,192,158,158,149,
-20,188,20,98,79,133,91,129,61,109,74,41,124,30,68,159,16,217,236,83,108,96,
-68,137,62,81,13,158,197,54,182,17,34,79,136,108,244,117,169,182,52,38,68,
-159,40,134,207,71,90,155,92,8,145,39,196,54,122,122,84,219,28,19,34,79,148,
-67,103,167,165,77,174,133,72,147,225,86,224,79,79,74,155,94,10,145,39,194,
-173,192,158,182,165,54,190,206,25,212,35,208,226,100,150,211,201,29,162,44,
-140,35,103,0,0,3,192,252,0,0,0,0,206,25,228,35,208,226,100,150,211,201,29,
-162,44,140,35,103,0,0,3,192,252,0,0,0,0,206,25,244,35,208,226,100,150,211,
-201,29,162,44,140,35,103,0,0,3,192,252,0,0,0,0,206,26,4,35,208,226,100,150,
-211,201,29,162,44,140,35,103,0,0,0,1,0,0,0,0,0,206,26,20,35,208,226,100,
-150,211,201,29,162,44,140,35,103,0,0,0,1,0,0,0,0,0,206,26,36,35,208,226,
-100,150,211,201,29,162,44,140,35,103,0,0,0,65,0,0,0,0,0,206,26,52,35,208,
-226,100,150,211,201,29,162,44,140,35,103,0,0,0,65,0,0,0,0,0,206,26,68,35,
-208,226,100,150,211,201,29,162,44,140,35,103,0,0,0,65,0,0,0,0,0,206,26,84,
-35,208,226,100,150,211,201,29,162,44,140,35,103,0,0,0,129,0,0,0,0,0,195,
-154,99,16,38,36,0,251,68,117,179,216,162,128,68,72,1,241,13,158,197,20,150,
-25,18,0,125,162,58,217,232,235,117,100,162,136,25,18,0,125,162,58,217,232,
-235,116,36,162,145,2,226,64,15,136,108,244,117,186,178,81,73,129,113,32,7,
-196,54,122,58,221,9,40,165,64,200,144,3,237,17,214,207,79,75,171,37,20,80,
-200,144,3,237,17,214,207,79,75,161,37,20,138,23,18,0,124,67,103,167,165,
-213,146,138,77,11,137,0,62,33,179,211,210,232,73,69,42,133,196,128,31,10,
-183,2,125,89,40,163,5,196,128,31,10,183,2,125,9,40,164,96,200,144,3,224,
-221,64,172,157,89,40,163,134,68,128,31,6,234,5,100,232,73,69,35,133,68,128,
-31,104,142,182,125,89,40,180,0,168,144,3,237,17,214,207,161,37,22,144,19,
-18,0,124,67,103,213,146,139,80,9,137,0,62,33,179,232,73,69,172,5,90,40,153,
-59,68,117,179,216,166,192,77,162,137,147,136,108,246,41,180,176,219,69,19,
-39,104,142,182,122,58,221,89,41,178,6,218,40,153,59,68,117,179,209,214,232,
-73,77,162,6,90,40,153,56,134,207,71,91,171,37,54,152,25,104,162,100,226,27,
-61,29,110,132,148,218,160,109,162,137,147,180,71,91,61,61,46,172,148,217,
-67,109,20,76,157,162,58,217,233,233,116,36,166,209,67,45,20,76,156,67,103,
-167,165,213,146,155,77,12,180,81,50,113,13,158,158,151,66,74,109,84,50,209,
-68,201,194,173,192,159,86,74,108,193,150,138,38,78,21,110,4,250,18,83,104,
-193,182,138,38,78,13,212,10,201,213,146,155,56,109,162,137,147,131,117,2,
-178,116,36,166,209,194,237,20,76,157,162,58,217,245,100,167,16,2,237,20,76,
-157,162,58,217,244,36,167,18,2,173,20,76,156,67,103,213,146,156,80,10,180,
-81,50,113,13,159,66,74,113,97,175,221,48,216,110,64,4,42,22,189,179,0,196,
-133,0,185,80,32,28,78,99,193,18,80,36,4,19,159,141,172,0,178,90,4,74,73,0,
-22,209,68,201,187,129,4,2,8,3,132,64,60,36,0,171,240,84,6,149,113,72,176,
-157,91,116,116,32,88,181,129,32,11,42,218,221,131,234,219,165,1,8,187,152,
-255,188,231,235,248,47,86,227,105,18,2,56,175,185,255,244,17,91,40,110,173,
-198,209,208,36,7,188,189,179,240,238,82,97,80,93,122,32,125,144,132,160,12,
-22,162,42,7,236,161,25,232,237,105,64,158,160,230,63,205,59,127,102,11,217,
-66,51,210,129,61,65,236,127,154,118,254,205,171,197,34,168,48,6,90,194,1,0,
-39,75,88,72,8,9,33,186,194,80,64,76,13,214,19,2,130,96,110,150,189,0,65,6,
-51,214,20,128,65,17,11,214,19,130,137,121,211,210,211,144,6,39,75,88,80,0,
-201,119,235,10,8,41,86,231,71,88,80,129,79,135,186,122,133,224,34,25,69,
-234,80,3,91,141,172,40,96,139,113,180,181,133,36,21,110,54,142,134,176,165,
-1,176,23,213,47,0,216,134,234,215,128,111,117,181,232,128,209,3,70,230,107,
-64,5,139,168,209,235,10,32,36,144,102,235,136,3,146,27,172,40,160,146,132,
-103,172,40,192,115,3,117,133,28,22,113,163,69,172,41,103,1,66,188,17,145,
-52,168,4,202,113,67,76,130,227,76,194,13,240,108,0,0,83,224,0,2,193,0,104,
-146,84,97,48,0,1,94,192,56,169,24,145,179,192,0,5,112,8,56,16,32,128,56,18,
-52,125,230,86,147,190,140,28,50,21,13,39,31,23,60,145,158,57,12,141,47,129,
-6,155,194,188,24,49,39,199,89,188,124,92,242,70,120,224,201,33,69,15,155,
-163,201,68,14,49,39,199,197,211,116,240,242,113,197,232,18,180,254,36,3,17,
-46,18,243,35,100,128,172,156,178,70,163,154,76,34,248,146,164,108,248,75,
-204,141,146,28,217,115,137,27,95,27,241,173,236,162,160,224,200,2,206,9,
-113,13,148,192,209,18,22,164,146,37,193,57,162,4,249,39,196,128,24,2,178,
-66,213,136,68,201,16,77,209,131,31,192,242,88,96,92,191,151,34,100,136,38,
-232,255,252,92,221,199,197,12,68,209,82,66,212,11,155,185,41,197,13,55,38,
-3,66,213,47,135,254,72,12,162,99,133,116,112,0,1,72,66,14,16,16,50,37,202,
-160,150,154,66,14,20,8,57,192,28,24,80,113,50,113,100,105,166,120,248,0,0,
-179,1,65,196,201,199,20,178,36,227,224,0,2,208,54,113,240,0,1,100,11,181,
-192,0,5,178,1,18,160,65,24,131,20,145,25,188,48,132,122,28,76,146,218,121,
-35,180,69,145,132,108,224,0,0,120,31,128,0,0,0,25,188,56,132,122,28,76,146,
-218,121,35,180,69,145,132,108,224,0,0,120,31,128,0,0,0,40,160,45,110,23,30,
-176,33,184,0,0,183,32,29,235,2,27,199,23,0,0,23,4,51,120,129,8,244,56,153,
-37,180,242,71,104,139,35,8,217,192,0,0,240,63,0,0,0,0,51,120,145,8,244,56,
-153,37,180,242,71,104,139,35,8,217,192,0,0,0,64,0,0,0,0,51,120,161,8,244,
-56,153,37,180,242,71,104,139,35,8,217,192,0,0,0,64,0,0,0,0,51,120,177,8,
-244,56,153,37,180,242,71,104,139,35,8,217,192,0,0,16,64,0,0,0,0,51,120,193,
-8,244,56,153,37,180,242,71,104,139,35,8,217,192,0,0,16,64,0,0,0,0,51,120,
-209,8,244,56,153,37,180,242,71,104,139,35,8,217,192,0,0,16,64,0,0,0,0,51,
-120,225,8,244,56,153,37,180,242,71,104,139,35,8,217,192,0,0,32,64,0,0,0,0,
-32,227,194,0,97,57,162,4,246,104,5,34,92,35,68,225,161,166,220,16,16,137,
-112,52,41,73,29,185,1,65,196,201,197,145,166,153,246,72,3,137,204,120,34,
-74,8,199,1,67,17,162,112,201,84,128,97,144,78,25,42,16,131,169,1,205,66,8,
-35,68,225,161,166,239,128,0,10,192,64,196,104,156,50,96,0,2,172,73,240,117,
-96,57,170,97,4,104,156,52,52,221,240,0,1,82,1,74,9,129,125,240,0,1,82,32,
-148,25,174,137,58,23,51,190,0,0,42,69,64,195,32,156,50,96,0,2,160,81,238,2,
-3,107,173,218,3,192,
+DUK_INTERNAL const duk_uint8_t duk_builtins_data[2590] = {
+144,148,105,216,160,68,52,226,190,12,104,197,165,132,52,167,194,138,105,
+231,252,57,28,211,49,18,64,52,234,190,44,138,111,157,241,164,19,87,37,30,
+33,167,4,145,159,8,211,130,9,225,42,5,240,145,139,163,163,8,211,130,10,228,
+64,211,19,132,140,93,29,56,70,156,16,119,34,66,146,36,104,137,194,70,46,
+142,172,35,78,8,47,146,195,102,11,240,145,139,163,175,8,211,130,9,228,240,
+242,112,145,139,163,179,8,211,130,8,237,34,130,118,49,116,118,225,26,61,1,
+220,153,226,235,114,120,121,56,72,197,209,8,68,196,34,16,213,154,75,13,57,
+148,177,17,12,211,199,251,113,163,201,44,16,225,80,81,150,224,129,124,153,
+209,35,51,16,0,0,62,31,192,0,0,0,51,48,0,0,60,31,192,0,0,0,50,241,32,26,
+193,55,132,112,161,156,72,135,26,41,200,140,114,163,156,201,7,56,79,9,80,
+47,132,140,93,19,160,43,145,3,76,78,18,49,116,78,144,238,68,133,36,72,209,
+19,132,140,93,19,168,47,146,195,102,11,240,145,139,162,117,132,242,120,121,
+56,72,197,209,59,2,59,72,160,157,140,93,19,181,36,240,210,143,14,31,131,
+162,166,7,144,238,177,226,68,60,17,145,56,134,204,240,130,158,8,200,156,42,
+220,9,158,22,37,220,177,74,5,68,184,208,113,185,130,2,17,46,21,13,68,201,
+151,32,36,100,19,134,78,210,40,200,144,36,50,9,195,39,105,20,11,174,99,220,
+210,54,121,34,2,72,209,56,100,237,34,140,153,2,68,104,156,50,118,145,64,
+186,230,61,205,35,103,148,32,24,146,16,30,76,169,1,20,105,36,32,60,153,178,
+0,4,23,9,131,140,73,241,241,116,221,60,60,156,113,119,164,141,111,25,16,96,
+196,159,29,102,241,241,115,201,25,227,131,36,133,20,62,110,142,217,1,51,18,
+124,117,155,199,197,207,36,103,142,52,12,36,183,68,128,192,148,144,102,236,
+151,128,194,137,1,50,108,208,14,25,10,134,147,143,139,158,72,207,27,86,4,6,
+66,161,164,227,226,231,146,51,65,37,180,64,18,68,2,247,132,3,22,36,38,73,
+188,36,17,124,73,82,54,124,37,230,70,201,14,108,183,100,4,34,92,145,0,178,
+15,114,64,66,37,194,197,217,35,119,36,129,136,151,9,121,145,178,64,86,77,
+193,0,138,38,37,186,32,84,196,159,29,102,241,241,115,201,25,227,146,195,2,
+229,203,116,74,4,137,109,208,3,38,187,62,247,140,69,215,241,0,97,56,96,48,
+188,80,3,142,9,113,214,111,31,23,60,145,158,55,228,6,162,92,124,93,55,79,
+15,39,28,94,1,2,143,139,158,72,207,28,68,184,70,209,132,136,2,178,112,136,
+16,218,218,25,10,134,147,134,36,230,72,237,109,111,144,16,218,218,25,10,
+134,147,146,36,230,72,237,109,111,145,4,54,182,150,231,42,143,225,137,57,
+146,59,91,92,18,4,54,182,150,231,42,143,228,137,57,146,59,91,92,18,68,24,
+32,57,0,129,175,200,0,209,227,17,1,4,5,175,28,124,4,10,26,60,105,241,170,
+199,145,16,65,118,153,244,225,186,207,168,2,12,64,64,232,151,1,24,131,10,
+65,200,101,13,124,160,24,72,32,128,194,115,68,9,177,241,131,130,64,27,220,
+248,64,2,62,146,60,51,224,60,73,82,70,68,138,0,44,142,130,206,48,0,178,90,
+4,72,232,2,73,209,156,130,1,164,245,160,68,146,188,7,163,100,116,22,114,
+207,128,232,104,201,126,56,174,125,2,214,9,79,136,104,201,126,56,174,127,0,
+31,255,224,164,169,35,136,6,128,73,57,132,128,105,1,202,232,240,128,17,224,
+26,80,54,1,240,13,48,49,80,185,146,48,13,56,52,72,58,8,145,15,160,92,72,58,
+8,156,138,12,121,196,63,128,15,255,244,24,192,163,11,23,51,130,56,35,193,
+56,100,232,31,3,75,23,51,130,112,201,199,185,13,159,68,248,114,42,113,225,
+74,169,175,241,0,194,248,128,6,17,193,30,2,125,50,2,132,112,71,130,112,201,
+192,79,168,64,88,156,50,113,238,67,103,192,79,168,72,12,39,52,64,159,84,
+248,14,134,140,151,227,139,215,52,5,172,18,159,16,209,146,252,113,122,230,
+144,53,110,16,22,78,9,204,120,34,78,193,0,172,4,196,126,201,0,241,35,214,1,
+19,182,128,52,136,8,136,253,194,1,100,180,8,157,212,1,100,245,162,125,228,
+2,101,64,202,113,67,77,225,64,46,110,226,221,98,71,130,4,137,210,0,70,110,
+226,220,32,44,156,91,172,72,240,64,145,58,64,5,205,220,163,222,72,240,64,
+145,58,64,130,51,119,22,225,1,100,229,30,242,71,130,4,137,210,4,4,156,80,
+207,24,0,209,35,200,9,246,136,10,148,193,25,203,150,68,207,223,52,4,17,163,
+151,44,137,159,190,105,2,16,209,46,131,36,186,198,128,105,80,50,156,124,8,
+32,200,1,200,233,199,140,186,249,160,140,44,208,16,101,17,68,245,128,190,
+213,64,186,18,7,255,255,123,255,255,255,255,248,158,177,13,218,168,23,66,
+64,0,0,0,0,1,0,0,0,204,64,0,0,248,127,0,0,0,0,35,215,186,72,154,42,77,164,
+52,168,106,39,136,0,0,30,15,224,0,0,0,4,122,210,24,19,69,73,180,134,149,13,
+68,241,0,0,3,195,252,0,0,0,0,63,72,249,33,110,108,0,0,11,3,192,0,0,0,2,29,
+96,47,181,32,20,155,72,108,200,98,70,7,255,249,250,31,255,255,255,249,14,
+177,13,218,144,10,77,164,54,100,49,35,3,255,252,255,15,255,255,255,252,67,
+193,25,19,136,108,207,8,41,224,140,137,194,173,192,153,225,92,66,37,194,
+161,168,153,53,36,4,162,92,67,102,67,18,58,146,64,84,75,141,7,27,169,37,13,
+68,185,32,20,156,67,102,67,18,58,146,99,146,83,143,0,0,0,0,0,0,0,0,2,14,
+191,94,67,9,173,33,133,216,0,15,55,112,168,185,7,172,32,54,110,225,46,247,
+52,141,154,0,189,89,1,115,119,31,18,9,18,67,155,174,33,6,96,48,87,130,50,
+37,2,0,251,73,138,143,240,13,174,180,240,14,75,78,60,128,0,15,135,240,0,0,
+0,12,86,190,192,1,147,119,6,9,147,146,156,80,211,88,4,12,155,185,52,48,156,
+148,226,134,154,192,43,9,96,24,74,110,226,220,32,44,156,24,38,78,74,113,67,
+77,96,28,74,110,226,220,32,44,156,154,24,78,74,113,67,77,96,32,48,214,2,11,
+15,96,33,54,21,136,97,108,128,14,98,79,147,67,9,100,0,179,18,124,45,22,190,
+96,128,141,32,134,28,98,79,180,152,139,218,45,124,193,1,26,65,16,32,196,
+159,24,230,204,244,130,40,89,137,62,210,98,103,92,217,158,144,70,7,49,39,
+193,130,100,164,17,194,140,73,246,147,16,250,9,146,144,72,6,49,39,193,131,
+20,130,72,73,137,62,210,98,31,65,138,65,40,32,196,159,14,234,70,84,130,88,
+89,137,62,210,98,63,93,72,202,144,76,10,49,39,198,33,180,153,37,72,38,134,
+152,147,237,38,38,117,13,164,201,42,65,56,40,196,159,36,65,57,163,149,32,
+158,26,98,79,180,152,165,210,9,205,28,169,5,0,243,18,124,98,22,180,72,130,
+115,71,42,65,68,72,196,159,105,49,51,168,90,209,34,9,205,28,169,5,33,19,18,
+124,154,24,76,185,164,227,138,89,18,116,192,7,145,39,201,161,132,170,64,
+124,137,62,49,11,90,36,65,57,163,149,66,166,37,34,79,180,152,153,212,45,
+104,145,4,230,142,85,10,160,84,137,62,72,130,115,71,42,139,234,134,200,147,
+237,38,41,116,130,115,71,42,139,235,5,72,147,227,16,218,76,146,168,254,184,
+108,137,62,210,98,103,80,218,76,146,168,254,192,68,137,62,29,212,140,170,
+79,178,23,34,79,180,152,143,215,82,50,169,62,208,60,137,62,12,19,37,66,182,
+21,34,79,180,152,135,208,76,149,10,224,68,137,62,49,205,153,234,47,186,23,
+34,79,180,152,153,215,54,103,168,190,240,92,137,62,22,139,95,48,64,70,163,
+251,225,210,36,251,73,136,189,162,215,204,16,17,168,255,2,14,98,79,152,32,
+35,72,48,64,242,36,249,130,2,53,11,6,212,215,35,32,206,1,201,176,113,146,0,
+0,0,0,0,0,0,0,49,185,249,97,137,207,204,37,215,207,204,12,86,126,96,152,
+188,252,193,88,33,46,65,114,136,4,153,37,62,105,13,127,56,4,26,0,57,62,6,
+232,163,228,74,86,219,62,31,16,110,243,224,240,134,227,62,23,12,38,191,18,
+2,125,32,40,20,87,116,41,225,42,5,240,145,139,163,145,41,68,250,128,80,41,
+174,232,85,200,129,166,39,9,24,186,57,18,148,79,172,5,2,170,238,133,220,
+137,10,72,145,162,39,9,24,186,57,18,148,79,176,5,2,186,238,133,124,150,27,
+48,95,132,140,93,28,137,74,39,218,2,129,101,119,66,158,79,15,39,9,24,186,
+57,18,148,79,184,5,2,218,238,133,29,164,80,78,198,46,142,68,165,16,64,28,
+20,61,73,25,33,205,128,0,111,168,128,0,0,0,1,108,241,16,130,33,165,118,4,
+128,48,10,118,136,2,48,175,144,6,84,54,240,240,12,141,21,209,224,24,200,43,
+131,192,113,57,143,0,167,108,131,128,57,137,23,95,200,4,97,121,0,40,2,238,
+160,175,131,117,2,178,112,145,139,163,145,131,114,70,46,142,218,27,182,72,
+197,209,219,56,26,53,161,166,28,197,38,175,18,182,191,206,3,11,231,4,106,
+124,192,102,44,16,143,67,137,146,91,79,36,118,136,178,48,141,156,0,0,15,3,
+240,0,0,0,2,8,4,16,7,8,128,120,72,1,87,224,168,13,42,226,145,97,58,182,232,
+232,64,177,107,2,64,22,85,181,187,7,213,183,74,2,17,119,49,255,121,207,215,
+240,94,173,198,210,36,4,113,95,115,255,232,34,182,80,221,91,141,163,160,72,
+15,121,123,103,225,220,164,194,160,186,244,64,251,33,9,64,24,45,68,84,15,
+217,66,51,209,218,210,129,61,65,204,127,154,118,254,204,23,178,132,103,165,
+2,122,131,216,255,52,237,253,155,87,138,69,80,96,12,180,100,2,0,78,150,140,
+144,16,18,67,116,100,160,128,152,27,163,38,5,4,192,221,45,50,0,130,12,103,
+163,41,0,130,34,23,163,39,5,18,243,167,165,158,32,12,78,150,140,160,1,146,
+239,209,148,16,82,173,206,142,140,161,2,159,15,116,243,235,192,68,50,139,
+208,32,6,183,27,70,80,193,22,227,105,104,202,72,42,220,109,29,13,25,74,3,
+96,47,161,94,1,177,13,209,47,0,222,235,105,145,1,162,6,141,204,210,0,11,23,
+81,163,209,148,64,73,32,205,210,144,7,36,55,70,81,65,37,8,207,70,81,128,
+230,6,232,202,56,44,227,70,139,70,82,206,2,133,120,35,34,103,16,9,148,226,
+134,153,5,198,117,132,28,8,16,112,100,1,103,4,184,134,202,96,104,137,11,82,
+73,18,224,156,209,2,124,147,226,64,12,1,89,33,106,196,34,100,136,38,232,
+193,143,224,121,44,48,46,95,203,145,50,68,19,116,127,254,46,110,227,226,
+134,34,104,169,33,106,5,205,220,148,226,134,155,147,1,161,106,151,195,228,
+36,6,81,49,194,186,62,82,14,10,40,56,153,56,178,52,211,60,127,72,10,14,38,
+78,56,165,145,39,31,212,0,
 };
 #else
 #error invalid endianness defines
@@ -12508,6 +17179,10 @@ DUK_INTERNAL const duk_uint8_t duk_builtins_data[4281] = {
 
 /* automatic undefs */
 #undef DUK__REFCINIT
+#undef DUK__ROMARR_INIT
+#undef DUK__ROMOBJENV_INIT
+#undef DUK__TVAL_ACCESSOR
+#undef DUK__TVAL_LIGHTFUNC
 #line 1 "duk_error_macros.c"
 /*
  *  Error and fatal handling.
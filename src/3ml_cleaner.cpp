@@ -1,6 +1,7 @@
 #include "3ml_cleaner.h"
 #include "3ml_error.h"
 #include "display.h"
+#include "profiling.h"
 #include <cassert>
 #include <functional>
 #include <string>
@@ -244,6 +245,7 @@ DOMNode *DOM::get_element_by_id(std::string id) {
 }
 
 DOMNode *clean_node(DirtyDOMNode dirty, DOMNode *parent) {
+    PROFILE_SCOPE("clean_node");
     if (dirty.is_plaintext) {
         return new DOMNode(NodeType::PLAINTEXT, dirty.plaintext_node,
                            std::vector<DOMNode *>(), parent);
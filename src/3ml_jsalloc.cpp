@@ -0,0 +1,242 @@
+#include "3ml_jsalloc.h"
+#include <Arduino.h>
+#include <cstring>
+
+namespace {
+
+struct free_block_t {
+    free_block_t *next;
+};
+
+struct pool_t {
+    uint16_t block_size;
+    uint16_t weight; // Share of the region, in 1/256ths
+    char *start;
+    char *end;
+    char *carve; // Blocks below this have been handed out at least once
+    free_block_t *free_list;
+    uint16_t blocks;
+    uint16_t used;
+    uint16_t peak;
+};
+
+// Block sizes and their shares of the region, tuned for duktape's typical
+// allocation mix: many small strings and objects, fewer property tables.
+pool_t pools[JS_POOL_CLASS_COUNT] = {
+    {16, 20},  {32, 48},  {48, 40},  {64, 36},   {96, 24},
+    {128, 24}, {256, 24}, {512, 16}, {1024, 12}, {2048, 12},
+};
+
+char *region = nullptr;
+char *region_end = nullptr;
+threeml::js_pool_stats_t stats{};
+
+pool_t *find_pool(void *ptr) {
+    char *p = static_cast<char *>(ptr);
+    if (p < region || p >= region_end) {
+        return nullptr;
+    }
+    for (auto &pool : pools) {
+        if (p >= pool.start && p < pool.end) {
+            return &pool;
+        }
+    }
+    return nullptr;
+}
+
+void *take_block(pool_t &pool) {
+    void *block = nullptr;
+    if (pool.free_list != nullptr) {
+        block = pool.free_list;
+        pool.free_list = pool.free_list->next;
+    } else if (pool.carve + pool.block_size <= pool.end) {
+        block = pool.carve;
+        pool.carve += pool.block_size;
+    } else {
+        return nullptr;
+    }
+    if (++pool.used > pool.peak) {
+        pool.peak = pool.used;
+    }
+    stats.bytes_in_use += pool.block_size;
+    if (stats.bytes_in_use > stats.peak_bytes_in_use) {
+        stats.peak_bytes_in_use = stats.bytes_in_use;
+    }
+    return block;
+}
+
+void give_block(pool_t &pool, void *ptr) {
+    free_block_t *block = static_cast<free_block_t *>(ptr);
+    block->next = pool.free_list;
+    pool.free_list = block;
+    --pool.used;
+    stats.bytes_in_use -= pool.block_size;
+}
+
+void *overflow_alloc(std::size_t size) {
+    void *ptr = nullptr;
+    if (psramFound()) {
+        ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    }
+    if (ptr == nullptr) {
+        ptr = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    }
+    if (ptr != nullptr) {
+        ++stats.overflow_allocations;
+        ++stats.overflow_live;
+    }
+    return ptr;
+}
+
+} // namespace
+
+bool threeml::js_pool_init() {
+    if (region != nullptr) {
+        return true;
+    }
+    std::size_t bytes = JS_POOL_BYTES_INTERNAL;
+    if (psramFound()) {
+        region = static_cast<char *>(
+            heap_caps_malloc(JS_POOL_BYTES_SPIRAM, MALLOC_CAP_SPIRAM));
+        bytes = JS_POOL_BYTES_SPIRAM;
+        stats.in_spiram = region != nullptr;
+    }
+    if (region == nullptr) {
+        bytes = JS_POOL_BYTES_INTERNAL;
+        region = static_cast<char *>(
+            heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    }
+    if (region == nullptr) {
+        return false;
+    }
+    // Blocks are multiples of 16 bytes, so aligning the region start keeps
+    // every block 8-byte aligned for duktape's doubles.
+    std::size_t misalignment = reinterpret_cast<uintptr_t>(region) % 8;
+    if (misalignment != 0) {
+        region += 8 - misalignment;
+        bytes -= 8 - misalignment;
+    }
+    region_end = region + bytes;
+    stats.region_bytes = bytes;
+
+    // Split the region by weight; the largest class takes the remainder.
+    char *cursor = region;
+    for (auto &pool : pools) {
+        std::size_t share = bytes * pool.weight / 256;
+        share -= share % pool.block_size;
+        pool.start = pool.carve = cursor;
+        cursor += share;
+        pool.end = cursor;
+        pool.free_list = nullptr;
+        pool.blocks = share / pool.block_size;
+    }
+    pool_t &last = pools[JS_POOL_CLASS_COUNT - 1];
+    last.end = region_end - (region_end - last.start) % last.block_size;
+    last.blocks = (last.end - last.start) / last.block_size;
+    return true;
+}
+
+void *threeml::js_pool_alloc(void *udata, duk_size_t size) {
+    (void)udata;
+    if (size == 0) {
+        return nullptr;
+    }
+    ++stats.allocations;
+    if (region != nullptr) {
+        // Fall through to larger classes before giving up on the pools
+        for (auto &pool : pools) {
+            if (size <= pool.block_size) {
+                void *block = take_block(pool);
+                if (block != nullptr) {
+                    return block;
+                }
+            }
+        }
+    }
+    void *ptr = overflow_alloc(size);
+    if (ptr == nullptr) {
+        // Duktape runs an emergency GC and retries when this happens
+        ++stats.failed_allocations;
+    }
+    return ptr;
+}
+
+void *threeml::js_pool_realloc(void *udata, void *ptr, duk_size_t size) {
+    if (ptr == nullptr) {
+        return js_pool_alloc(udata, size);
+    }
+    if (size == 0) {
+        js_pool_free(udata, ptr);
+        return nullptr;
+    }
+    pool_t *pool = find_pool(ptr);
+    if (pool == nullptr) {
+        // Overflow blocks stay in the general heap
+        void *result = heap_caps_realloc(ptr, size, psramFound()
+                                                        ? MALLOC_CAP_SPIRAM
+                                                        : MALLOC_CAP_8BIT);
+        if (result == nullptr && psramFound()) {
+            result = heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT);
+        }
+        if (result == nullptr) {
+            ++stats.failed_allocations;
+        }
+        return result;
+    }
+    // Keep the block unless it is too small or a smaller class would do
+    bool fits = size <= pool->block_size;
+    bool wasteful = pool != pools && size <= (pool - 1)->block_size;
+    if (fits && !wasteful) {
+        return ptr;
+    }
+    void *result = js_pool_alloc(udata, size);
+    if (result == nullptr) {
+        return nullptr; // The old block stays valid, as realloc requires
+    }
+    memcpy(result, ptr, min((std::size_t)size, (std::size_t)pool->block_size));
+    give_block(*pool, ptr);
+    return result;
+}
+
+void threeml::js_pool_free(void *udata, void *ptr) {
+    (void)udata;
+    if (ptr == nullptr) {
+        return;
+    }
+    pool_t *pool = find_pool(ptr);
+    if (pool == nullptr) {
+        --stats.overflow_live;
+        heap_caps_free(ptr);
+        return;
+    }
+    give_block(*pool, ptr);
+}
+
+threeml::js_pool_stats_t threeml::js_pool_stats() {
+    js_pool_stats_t result = stats;
+    for (std::size_t i = 0; i < JS_POOL_CLASS_COUNT; ++i) {
+        result.classes[i] = js_pool_class_stats_t{
+            pools[i].block_size, pools[i].blocks, pools[i].used, pools[i].peak};
+    }
+    return result;
+}
+
+void threeml::print_js_pool_stats(Print &out) {
+    js_pool_stats_t snapshot = js_pool_stats();
+    if (snapshot.region_bytes == 0) {
+        out.println("JS pool: not initialized");
+        return;
+    }
+    out.printf("JS pool: %u bytes in %s\n", snapshot.region_bytes,
+               snapshot.in_spiram ? "SPIRAM" : "internal RAM");
+    out.printf("JS pool bytes in use: %u (peak %u)\n", snapshot.bytes_in_use,
+               snapshot.peak_bytes_in_use);
+    out.printf("JS allocations: %u, overflowed to heap: %u (%u live), "
+               "failed: %u\n",
+               snapshot.allocations, snapshot.overflow_allocations,
+               snapshot.overflow_live, snapshot.failed_allocations);
+    for (const auto &pool : snapshot.classes) {
+        out.printf("  %4u B blocks: %4u / %4u used (peak %u)\n",
+                   pool.block_size, pool.used, pool.blocks, pool.peak);
+    }
+}
@@ -1,11 +1,21 @@
 #include "3ml_jsbindings.h"
 #include "3ml_cleaner.h"
+#include "3ml_jsexecutor.h"
+#include "settings.h"
 #include "duktape.h"
 #include "meta.h"
 #include "state.h"
 #include <FFat.h>
 #include <queue>
 
+static threeml::JSExecutor *get_executor(duk_context *ctx) {
+    duk_push_global_stash(ctx);
+    duk_get_prop_string(ctx, -1, "executor");
+    auto executor = static_cast<threeml::JSExecutor *>(duk_get_pointer(ctx, -1));
+    duk_pop_2(ctx);
+    return executor;
+}
+
 threeml::DOMNode *threeml::get_element_by_id(threeml::DOM *dom,
                                              std::string id) {
     // Breadth-first search! Because I'm not writing a recursive helper
@@ -34,12 +44,18 @@ duk_ret_t threeml::_js_get_element_by_id(duk_context *ctx) {
     threeml::DOM *dom = static_cast<threeml::DOM *>(duk_get_pointer(ctx, -1));
     duk_pop(ctx);
     const char *id = duk_get_string(ctx, 0);
+    // The renderer may be applying a commit; hold the DOM only for as long as
+    // it takes to copy the element out.
+    auto executor = get_executor(ctx);
+    executor->lock_dom();
     auto node = threeml::get_element_by_id(dom, id);
     if (node == nullptr) {
+        executor->unlock_dom();
         duk_push_undefined(ctx);
         return 1;
     }
     construct_element(dom, node, ctx);
+    executor->unlock_dom();
     return 1;
 }
 
@@ -51,13 +67,46 @@ duk_ret_t threeml::_js_set_inner_3ml(duk_context *ctx) {
     duk_pop(ctx);
     const char *html = duk_to_string(ctx, 0);
     auto uncleaned = threeml::parse_string(html);
-    node->children.clear();
+    std::vector<threeml::DOMNode *> children;
     for (const auto &top_level : uncleaned.top_level_nodes) {
-        node->children.push_back(threeml::clean_node(top_level, node));
+        children.push_back(threeml::clean_node(top_level, node));
     }
+    // The new children only become visible once the renderer applies the
+    // handler's batch of commits.
+    get_executor(ctx)->stage_commit(node, std::move(children));
     return 0;
 }
 
+duk_ret_t threeml::_js_set_timeout(duk_context *ctx) {
+    duk_require_function(ctx, 0);
+    auto delay = static_cast<uint32_t>(duk_get_uint(ctx, 1));
+    uint32_t timer_id = get_executor(ctx)->add_timer(delay);
+    if (timer_id == 0) {
+        duk_push_undefined(ctx);
+        return 1;
+    }
+    duk_push_global_stash(ctx);
+    duk_get_prop_string(ctx, -1, "timers");
+    duk_dup(ctx, 0);
+    duk_put_prop_index(ctx, -2, timer_id);
+    duk_pop_2(ctx);
+    duk_push_uint(ctx, timer_id);
+    return 1;
+}
+
+duk_ret_t threeml::_js_subscribe_setting(duk_context *ctx) {
+    const char *pattern = duk_require_string(ctx, 0);
+    duk_require_function(ctx, 1);
+    uint32_t id = get_executor(ctx)->subscribe_setting(pattern);
+    duk_push_global_stash(ctx);
+    duk_get_prop_string(ctx, -1, "subscribers");
+    duk_dup(ctx, 1);
+    duk_put_prop_index(ctx, -2, id);
+    duk_pop_2(ctx);
+    duk_push_uint(ctx, id);
+    return 1;
+}
+
 void threeml::construct_element(DOM *dom, DOMNode *node, duk_context *ctx) {
     duk_push_object(ctx);
     duk_push_pointer(ctx, node);
@@ -71,20 +120,65 @@ void threeml::construct_element(DOM *dom, DOMNode *node, duk_context *ctx) {
     duk_def_prop(ctx, -3, DUK_DEFPROP_HAVE_SETTER);
 }
 
-void threeml::load_js_file(duk_context *ctx, const char *filename) {
+bool threeml::load_js_file(duk_context *ctx, const char *filename) {
     auto file = FFat.open(filename, FILE_READ);
     if (!file) {
-        return;
+        return false;
     }
     char *buffer = new char[file.size() + 1];
     file.readBytes(buffer, file.size());
     buffer[file.size()] = '\0';
     TaskPrint().println(buffer);
     file.close();
-    duk_peval_string(ctx, buffer);
+    bool ok = duk_peval_string(ctx, buffer) == 0;
+    if (!ok) {
+        Warn<TaskLog>().printf("%s: %s\n", filename,
+                               duk_safe_to_string(ctx, -1));
+    }
+    duk_pop(ctx);
+    delete[] buffer;
+    return ok;
 }
 
-void threeml::create_js_bindings(duk_context *ctx, threeml::DOM *dom) {
+bool threeml::push_timer_callback(duk_context *ctx, uint32_t timer_id) {
+    duk_push_global_stash(ctx);
+    duk_get_prop_string(ctx, -1, "timers");
+    if (!duk_get_prop_index(ctx, -1, timer_id)) {
+        duk_pop_3(ctx);
+        return false;
+    }
+    duk_del_prop_index(ctx, -2, timer_id);
+    // Leave only the callback on the stack
+    duk_insert(ctx, -3);
+    duk_pop_2(ctx);
+    return true;
+}
+
+bool threeml::push_subscriber(duk_context *ctx, uint32_t id) {
+    duk_push_global_stash(ctx);
+    duk_get_prop_string(ctx, -1, "subscribers");
+    if (!duk_get_prop_index(ctx, -1, id)) {
+        duk_pop_3(ctx);
+        return false;
+    }
+    // Leave only the callback on the stack
+    duk_insert(ctx, -3);
+    duk_pop_2(ctx);
+    return true;
+}
+
+void threeml::create_js_bindings(duk_context *ctx, threeml::DOM *dom,
+                                  threeml::JSExecutor *executor) {
+    // Stash the executor for bindings that need to reach back into it
+    duk_push_global_stash(ctx);
+    duk_push_pointer(ctx, executor);
+    duk_put_prop_string(ctx, -2, "executor");
+    duk_push_object(ctx);
+    duk_put_prop_string(ctx, -2, "timers");
+    duk_push_object(ctx);
+    duk_put_prop_string(ctx, -2, "subscribers");
+    duk_pop(ctx);
+
     // Create the document object
     duk_push_global_object(ctx);
     duk_push_object(ctx);
@@ -93,7 +187,15 @@ void threeml::create_js_bindings(duk_context *ctx, threeml::DOM *dom) {
     duk_push_c_function(ctx, _js_get_element_by_id, 1);
     duk_put_prop_string(ctx, -2, "getElementById");
     duk_put_prop_string(ctx, -2, "document");
-    // duk_pop(ctx);
+    duk_push_c_function(ctx, _js_set_timeout, 2);
+    duk_put_prop_string(ctx, -2, "setTimeout");
+    duk_pop(ctx);
+
+    settings::create_js_hooks(ctx);
+    duk_get_global_string(ctx, "settings");
+    duk_push_c_function(ctx, _js_subscribe_setting, 2);
+    duk_put_prop_string(ctx, -2, "subscribe");
+    duk_pop(ctx);
 }
 
 void threeml::switch_dom(DOM *dom, duk_context *ctx) {
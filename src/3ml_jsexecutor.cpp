@@ -0,0 +1,467 @@
+#include "3ml_jsexecutor.h"
+#include "3ml_jsalloc.h"
+#include "3ml_jsbindings.h"
+#include "settings.h"
+#include "state.h"
+#include "taskwrapper.h"
+#include "timeline.h"
+#include <Arduino.h>
+#include <cstring>
+
+namespace {
+
+struct timer_ctx_t {
+    threeml::JSExecutor *executor;
+    uint32_t id;
+    uint32_t generation;
+};
+
+char *copy_code(const char *code) {
+    if (code == nullptr) {
+        return nullptr;
+    }
+    std::size_t len = strlen(code);
+    char *copy = new char[len + 1];
+    memcpy(copy, code, len + 1);
+    return copy;
+}
+
+} // namespace
+
+extern "C" int duk_exec_timeout_check(void *udata) {
+    auto executor = static_cast<const threeml::JSExecutor *>(udata);
+    return executor != nullptr && executor->budget_exceeded();
+}
+
+threeml::JSExecutor::JSExecutor()
+    : m_queue(nullptr), m_dom_mutex(nullptr), m_commit_mutex(nullptr),
+      m_task(nullptr), m_ctx(nullptr), m_dom(nullptr), m_generation(0),
+      m_next_timer_id(1), m_next_subscriber_id(1), m_subscriptions(),
+      m_page(), m_staged(), m_committed(), m_stats{},
+      m_budget_ms(), m_invocation_start(0), m_deadline_us(0), m_last_gc_us(0),
+      m_gc_pending(false), m_page_stats() {}
+
+bool threeml::JSExecutor::start(SemaphoreHandle_t dom_mutex) {
+    if (m_task != nullptr) {
+        return true;
+    }
+    m_dom_mutex = dom_mutex;
+    m_budget_ms = settings::number("js.budget_ms", JS_DEFAULT_BUDGET_MS);
+    m_queue = xQueueCreate(JS_EVENT_QUEUE_DEPTH, sizeof(js_event_t));
+    m_commit_mutex = xSemaphoreCreateMutex();
+    if (m_queue == nullptr || m_commit_mutex == nullptr) {
+        return false;
+    }
+    registerTaskStack("JS Executor", JS_EXECUTOR_STACK_SIZE);
+    return pdPASS == xTaskCreatePinnedToCore(task_entry, "JS Executor",
+                                             JS_EXECUTOR_STACK_SIZE, this,
+                                             JS_EXECUTOR_PRIORITY, &m_task,
+                                             JS_EXECUTOR_CORE);
+}
+
+bool threeml::JSExecutor::post(js_event_t &event, bool lifecycle) {
+    event.posted_at = esp_timer_get_time();
+    if (m_queue == nullptr) {
+        delete[] event.code;
+        return false;
+    }
+    if (lifecycle) {
+        // Lifecycle events own DOMs and must not be lost. The reserved slots
+        // mean this only waits if the executor has fallen hopelessly behind.
+        xQueueSendToBack(m_queue, &event, portMAX_DELAY);
+        return true;
+    }
+    if (uxQueueSpacesAvailable(m_queue) <= JS_RESERVED_QUEUE_SLOTS ||
+        xQueueSendToBack(m_queue, &event, 0) != pdPASS) {
+        m_stats.events_dropped.fetch_add(1, std::memory_order_relaxed);
+        delete[] event.code;
+        return false;
+    }
+    return true;
+}
+
+void threeml::JSExecutor::post_unload(DOM *dom, const char *onbeforeunload) {
+    js_event_t event{};
+    event.type = EventType::UNLOAD;
+    event.dom = dom;
+    event.code = copy_code(onbeforeunload);
+    post(event, true);
+}
+
+void threeml::JSExecutor::post_load(DOM *dom, uint32_t generation,
+                                    const char *page, const char *onload) {
+    js_event_t event{};
+    event.type = EventType::LOAD;
+    event.generation = generation;
+    event.dom = dom;
+    // The page path rides in the same allocation as the handler code,
+    // separated by a NUL, to keep the event a plain struct.
+    std::size_t page_len = strlen(page);
+    std::size_t code_len = onload ? strlen(onload) : 0;
+    event.code = new char[page_len + code_len + 2];
+    memcpy(event.code, page, page_len + 1);
+    memcpy(event.code + page_len + 1, onload ? onload : "", code_len + 1);
+    post(event, true);
+}
+
+void threeml::JSExecutor::post_click(uint32_t generation, const char *code) {
+    js_event_t event{};
+    event.type = EventType::CLICK;
+    event.generation = generation;
+    event.code = copy_code(code);
+    post(event, false);
+}
+
+void threeml::JSExecutor::post_input(uint32_t generation, const char *code,
+                                     double value) {
+    js_event_t event{};
+    event.type = EventType::SLIDER;
+    event.generation = generation;
+    event.code = copy_code(code);
+    event.value = value;
+    post(event, false);
+}
+
+void threeml::JSExecutor::request_gc(uint32_t generation) {
+    // Set first: the executor may handle the event and clear the flag before
+    // post returns.
+    if (m_gc_pending.exchange(true)) {
+        return;
+    }
+    js_event_t event{};
+    event.type = EventType::GC;
+    event.generation = generation;
+    if (!post(event, false)) {
+        m_gc_pending = false;
+    }
+}
+
+uint32_t threeml::JSExecutor::add_timer(uint32_t delay_ms) {
+    timer_ctx_t *ctx = new timer_ctx_t{this, m_next_timer_id, m_generation};
+    TimerHandle_t timer =
+        xTimerCreate("JS Timer", max(pdMS_TO_TICKS(delay_ms), (TickType_t)1),
+                     pdFALSE, ctx, timer_cb);
+    if (timer == nullptr || xTimerStart(timer, 0) != pdPASS) {
+        if (timer != nullptr) {
+            xTimerDelete(timer, 0);
+        }
+        delete ctx;
+        return 0;
+    }
+    return m_next_timer_id++;
+}
+
+void threeml::JSExecutor::timer_cb(TimerHandle_t timer) {
+    timer_ctx_t *ctx = static_cast<timer_ctx_t *>(pvTimerGetTimerID(timer));
+    js_event_t event{};
+    event.type = EventType::TIMER;
+    event.generation = ctx->generation;
+    event.id = ctx->id;
+    ctx->executor->post(event, false);
+    delete ctx;
+    xTimerDelete(timer, 0);
+}
+
+uint32_t threeml::JSExecutor::subscribe_setting(const char *pattern) {
+    uint32_t id = m_next_subscriber_id++;
+    uint32_t generation = m_generation;
+    m_subscriptions.push_back(settings::subscribe(
+        pattern, [this, generation, id](const std::string &key) {
+            js_event_t event{};
+            event.type = EventType::SETTING;
+            event.generation = generation;
+            event.id = id;
+            event.code = copy_code(key.c_str());
+            post(event, false);
+        }));
+    return id;
+}
+
+void threeml::JSExecutor::stage_commit(DOMNode *node,
+                                       std::vector<DOMNode *> &&children) {
+    m_staged.push_back(dom_commit_t{m_generation, node, std::move(children)});
+}
+
+void threeml::JSExecutor::flush_staged() {
+    if (m_staged.empty()) {
+        return;
+    }
+    xSemaphoreTake(m_commit_mutex, portMAX_DELAY);
+    for (auto &commit : m_staged) {
+        m_committed.push_back(std::move(commit));
+    }
+    xSemaphoreGive(m_commit_mutex);
+    m_stats.commits += m_staged.size();
+    m_staged.clear();
+}
+
+bool threeml::JSExecutor::take_commits(std::vector<dom_commit_t> &out) {
+    if (m_commit_mutex == nullptr) {
+        return false;
+    }
+    xSemaphoreTake(m_commit_mutex, portMAX_DELAY);
+    out.swap(m_committed);
+    xSemaphoreGive(m_commit_mutex);
+    return !out.empty();
+}
+
+void threeml::JSExecutor::lock_dom() {
+    xSemaphoreTake(m_dom_mutex, portMAX_DELAY);
+}
+
+void threeml::JSExecutor::unlock_dom() { xSemaphoreGive(m_dom_mutex); }
+
+const threeml::js_stats_t &threeml::JSExecutor::stats() const {
+    return m_stats;
+}
+
+std::size_t threeml::JSExecutor::queue_depth() const {
+    return m_queue ? uxQueueMessagesWaiting(m_queue) : 0;
+}
+
+void threeml::JSExecutor::task_entry(void *arg) {
+    JSExecutor *executor = static_cast<JSExecutor *>(arg);
+    js_event_t event;
+    while (true) {
+        if (xQueueReceive(executor->m_queue, &event, portMAX_DELAY) !=
+            pdPASS) {
+            continue;
+        }
+        uint32_t depth = uxQueueMessagesWaiting(executor->m_queue) + 1;
+        if (depth > executor->m_stats.max_queue_depth) {
+            executor->m_stats.max_queue_depth = depth;
+        }
+        int64_t latency = esp_timer_get_time() - event.posted_at;
+        executor->m_stats.total_latency_us += latency;
+        if (latency > executor->m_stats.max_latency_us) {
+            executor->m_stats.max_latency_us = latency;
+        }
+        executor->handle(event);
+        executor->flush_staged();
+        delete[] event.code;
+        if (executor->m_ctx != nullptr &&
+            esp_timer_get_time() - executor->m_last_gc_us >
+                JS_FORCED_GC_INTERVAL_MS * 1000LL) {
+            executor->collect_garbage(false);
+        }
+    }
+}
+
+void threeml::JSExecutor::handle(js_event_t &event) {
+    switch (event.type) {
+    case EventType::UNLOAD:
+        if (event.code != nullptr && m_ctx != nullptr) {
+            eval_handler(event.code, "onbeforeunload");
+        }
+        destroy_context();
+        delete event.dom;
+        break;
+    case EventType::LOAD: {
+        TIMELINE_SCOPE("js load");
+        int64_t load_start = esp_timer_get_time();
+        bool is_a_reload = (event.dom == m_dom);
+        m_generation = event.generation;
+        m_page = event.code;
+        destroy_context();
+        create_context(event.dom);
+        m_last_gc_us = esp_timer_get_time();
+        const char *onload = event.code + m_page.size() + 1;
+        if (*onload != '\0' && !is_a_reload) {
+            eval_handler(onload, "onload");
+        }
+        m_stats.last_load_us = esp_timer_get_time() - load_start;
+        if (m_stats.last_load_us > m_stats.max_load_us) {
+            m_stats.max_load_us = m_stats.last_load_us;
+        }
+    } break;
+    case EventType::GC:
+        m_gc_pending = false;
+        // Anything else in the queue is more urgent; the renderer asks again
+        // once it is idle.
+        if (event.generation == m_generation && m_ctx != nullptr &&
+            uxQueueMessagesWaiting(m_queue) == 0) {
+            collect_garbage(true);
+        }
+        return;
+    default:
+        if (event.generation != m_generation || m_ctx == nullptr) {
+            // The page this event was meant for is gone.
+            ++m_stats.events_stale;
+            return;
+        }
+        if (event.type == EventType::CLICK) {
+            eval_handler(event.code, "onclick");
+        } else if (event.type == EventType::SLIDER) {
+            duk_push_global_object(m_ctx);
+            duk_push_object(m_ctx);
+            duk_push_number(m_ctx, event.value);
+            duk_put_prop_string(m_ctx, -2, "value");
+            duk_put_prop_string(m_ctx, -2, "event");
+            duk_pop(m_ctx);
+            eval_handler(event.code, "oninput");
+        } else if (event.type == EventType::TIMER) {
+            if (push_timer_callback(m_ctx, event.id)) {
+                begin_invocation();
+                bool failed = duk_pcall(m_ctx, 0) != DUK_EXEC_SUCCESS;
+                if (failed) {
+                    Warn<TaskLog>().printf("%s: setTimeout callback: %s\n",
+                                           m_page.c_str(),
+                                           duk_safe_to_string(m_ctx, -1));
+                }
+                end_invocation("setTimeout callback", failed);
+                duk_pop(m_ctx);
+            }
+        } else if (event.type == EventType::SETTING) {
+            if (push_subscriber(m_ctx, event.id)) {
+                duk_push_string(m_ctx, event.code);
+                settings::push_js_value(m_ctx, event.code);
+                begin_invocation();
+                bool failed = duk_pcall(m_ctx, 2) != DUK_EXEC_SUCCESS;
+                if (failed) {
+                    Warn<TaskLog>().printf("%s: settings subscriber: %s\n",
+                                           m_page.c_str(),
+                                           duk_safe_to_string(m_ctx, -1));
+                }
+                end_invocation("settings subscriber", failed);
+                duk_pop(m_ctx);
+            }
+        }
+        break;
+    }
+    ++m_stats.events_handled;
+}
+
+void threeml::JSExecutor::create_context(DOM *dom) {
+    m_dom = dom;
+    // Keep JS objects out of the general heap, where they would fragment the
+    // internal RAM shared with the DOM. The executor is the heap's user data
+    // so the timeout check can find it.
+    if (!js_pool_init()) {
+        Warn<TaskLog>().println("JS pool unavailable, using the general heap");
+    }
+    std::size_t bytes_before = js_pool_stats().bytes_in_use;
+    int64_t create_start = esp_timer_get_time();
+    m_ctx = duk_create_heap(js_pool_alloc, js_pool_realloc, js_pool_free, this,
+                            nullptr);
+    if (m_ctx == nullptr) {
+        Error<TaskLog>().printf("%s: could not create JS heap\n",
+                                m_page.c_str());
+        return;
+    }
+    m_stats.heap_create_us = esp_timer_get_time() - create_start;
+    m_stats.empty_heap_bytes = js_pool_stats().bytes_in_use - bytes_before;
+    create_js_bindings(m_ctx, dom, this);
+    // Only the head can hold scripts, and only the executor mutates the DOM,
+    // so no lock is needed to read it here.
+    for (const auto node : dom->top_level_nodes) {
+        if (node->type != threeml::NodeType::HEAD) {
+            continue;
+        }
+        for (const auto child : node->children) {
+            if (child->type == threeml::NodeType::SCRIPT) {
+                begin_invocation();
+                bool failed = !load_js_file(
+                    m_ctx, child->unique_attributes["src"].c_str());
+                end_invocation("<script>", failed);
+            }
+        }
+    }
+}
+
+void threeml::JSExecutor::destroy_context() {
+    for (auto id : m_subscriptions) {
+        settings::unsubscribe(id);
+    }
+    m_subscriptions.clear();
+    if (m_ctx != nullptr) {
+        duk_destroy_heap(m_ctx);
+        m_ctx = nullptr;
+    }
+    // Mutations staged against the old heap's DOM will never be committed.
+    for (auto &commit : m_staged) {
+        for (auto child : commit.children) {
+            delete child;
+        }
+    }
+    m_staged.clear();
+    m_dom = nullptr;
+}
+
+void threeml::JSExecutor::collect_garbage(bool idle) {
+    int64_t start = esp_timer_get_time();
+    duk_gc(m_ctx, 0);
+    m_last_gc_us = esp_timer_get_time();
+    int64_t elapsed = m_last_gc_us - start;
+    if (idle) {
+        ++m_stats.idle_collections;
+    } else {
+        ++m_stats.forced_collections;
+    }
+    m_stats.total_gc_us += elapsed;
+    if (elapsed > m_stats.max_gc_us) {
+        m_stats.max_gc_us = elapsed;
+    }
+}
+
+void threeml::JSExecutor::eval_handler(const char *code, const char *handler) {
+    begin_invocation();
+    bool failed = duk_peval_string(m_ctx, code) != 0;
+    if (failed) {
+        Warn<TaskLog>().printf("%s: %s: %s\n", m_page.c_str(), handler,
+                               duk_safe_to_string(m_ctx, -1));
+    }
+    end_invocation(handler, failed);
+    duk_pop(m_ctx);
+}
+
+void threeml::JSExecutor::begin_invocation() {
+    TIMELINE_BEGIN("js call");
+    m_invocation_start = esp_timer_get_time();
+    m_deadline_us =
+        m_invocation_start + static_cast<int64_t>(m_budget_ms.get() * 1000);
+}
+
+void threeml::JSExecutor::end_invocation(const char *handler, bool failed) {
+    int64_t now = esp_timer_get_time();
+    int64_t budget = m_deadline_us - m_invocation_start;
+    int64_t elapsed = now - m_invocation_start;
+    m_deadline_us = 0;
+    TIMELINE_END("js call");
+
+    xSemaphoreTake(m_commit_mutex, portMAX_DELAY);
+    js_page_stats_t &page = m_page_stats[m_page];
+    ++page.invocations;
+    if (failed && elapsed >= budget) {
+        ++page.aborted;
+    } else if (elapsed > budget / 2) {
+        ++page.slow;
+    }
+    xSemaphoreGive(m_commit_mutex);
+
+    if (failed && elapsed >= budget) {
+        Error<TaskLog>().printf("%s: %s aborted after %lld ms (budget %lld ms)\n",
+                                m_page.c_str(), handler, elapsed / 1000,
+                                budget / 1000);
+    } else if (elapsed > budget / 2) {
+        Warn<TaskLog>().printf("%s: %s is slow (%lld ms of %lld ms budget)\n",
+                               m_page.c_str(), handler, elapsed / 1000,
+                               budget / 1000);
+    }
+}
+
+bool threeml::JSExecutor::budget_exceeded() const {
+    return m_deadline_us != 0 && esp_timer_get_time() >= m_deadline_us;
+}
+
+void threeml::JSExecutor::print_page_stats(Print &out) const {
+    if (m_commit_mutex == nullptr) {
+        return;
+    }
+    xSemaphoreTake(m_commit_mutex, portMAX_DELAY);
+    for (const auto &page : m_page_stats) {
+        out.printf("  %s: %u invocations, %u slow, %u aborted\n",
+                   page.first.c_str(), page.second.invocations,
+                   page.second.slow, page.second.aborted);
+    }
+    xSemaphoreGive(m_commit_mutex);
+}
@@ -1,5 +1,6 @@
 #include "3ml_parser.h"
 #include "3ml_error.h"
+#include "profiling.h"
 #include <cstring>
 #include <string>
 #include <vector>
@@ -139,6 +140,7 @@ std::string trim(std::string untrimmed) {
 }
 
 DirtyDOM parse_string(const char *str) {
+  PROFILE_SCOPE("parse_string");
   std::vector<ParseNode> parse_chain;
   bool is_normal_mode = true;
   const char *cursor = str;
@@ -1,9 +1,11 @@
 #include "3ml_renderer.h"
 #include "3ml_cleaner.h"
 #include "battery.h"
-#include "button.h"
 #include "display.h"
+#include "input.h"
+#include "profiling.h"
 #include "state.h"
+#include "timeline.h"
 #include "usb_classes.h"
 #include <Arduino.h>
 #include <FFat.h>
@@ -98,8 +100,8 @@ void threeml::Renderer::interact() {
         m_current_file = node->unique_attributes["href"];
         break;
     case threeml::NodeType::BUTTON:
-        m_callback_to_run = true;
-        m_pending_callback = node->unique_attributes["onclick"];
+        m_js.post_click(m_generation,
+                        node->unique_attributes["onclick"].c_str());
         break;
     }
 }
@@ -114,6 +116,94 @@ void threeml::Renderer::go_back() {
     m_current_file = m_file_stack.top();
 }
 
+void threeml::Renderer::post_input(const InputEvent &event) {
+    if (event.id != UP_BUTTON_PIN && event.id != DOWN_BUTTON_PIN) {
+        return;
+    }
+    switch (event.type) {
+    case InputType::BUTTON_CLICK:
+    case InputType::BUTTON_HOLD:
+    case InputType::BUTTON_REPEAT:
+        if (!m_input.push(event)) {
+            m_frame_stats.dropped_inputs.fetch_add(1,
+                                                   std::memory_order_relaxed);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void threeml::Renderer::handle_input() {
+    // Downwards is positive
+    long steps = 0;
+    auto apply_steps = [&]() {
+        for (; steps > 0; --steps) {
+            select_next();
+        }
+        for (; steps < 0; ++steps) {
+            select_prev();
+        }
+    };
+    InputEvent event;
+    bool any = false;
+    while (m_input.pop(event)) {
+        any = true;
+        bool up = event.id == UP_BUTTON_PIN;
+        switch (event.type) {
+        case InputType::BUTTON_CLICK:
+            steps += up ? -1 : 1;
+            break;
+        case InputType::BUTTON_REPEAT:
+            steps += up ? -(long)event.value : (long)event.value;
+            break;
+        case InputType::BUTTON_HOLD:
+            // The steps before a hold pick what it acts on.
+            apply_steps();
+            if (up) {
+                go_back();
+            } else {
+                interact();
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    apply_steps();
+    if (any) {
+        m_last_input = xTaskGetTickCount();
+    }
+}
+
+bool threeml::Renderer::apply_commits() {
+    if (!m_js.take_commits(m_commits)) {
+        return false;
+    }
+    bool changed = false;
+    for (auto &commit : m_commits) {
+        if (commit.generation != m_generation) {
+            // Made by a page that has since been unloaded.
+            for (auto child : commit.children) {
+                delete child;
+            }
+            continue;
+        }
+        commit.node->children = std::move(commit.children);
+        changed = true;
+    }
+    m_commits.clear();
+    if (changed) {
+        refresh_selectable_nodes();
+        if (m_current_selected >= m_selectable_nodes.size()) {
+            m_current_selected = 0;
+        }
+        m_dom_rendered = false;
+        m_total_height = 0;
+    }
+    return changed;
+}
+
 void threeml::Renderer::draw_status_bar() {
     m_display->fillRect(0, 0, m_display->width(), STATUS_BAR_HEIGHT,
                         ACCENT_COLOR);
@@ -121,6 +211,14 @@ void threeml::Renderer::draw_status_bar() {
     m_display->setTextSize(2); // 12x16 pixels
     m_display->setCursor(2, 2);
     m_display->print(m_title.c_str());
+    if (!battery::available()) {
+        return;
+    }
+    // Cached by the battery sampler, so this never waits on the ADC.
+    char level[5];
+    int length = snprintf(level, sizeof(level), "%u%%", battery::get_percent());
+    m_display->setCursor(m_display->width() - 12 * length - 2, 2);
+    m_display->print(level);
 }
 
 void threeml::Renderer::render_plaintext(
@@ -220,6 +318,7 @@ void threeml::Renderer::render_button(const DOMNode *node,
 void threeml::Renderer::render_node(const threeml::DOMNode *node,
                                     std::size_t &position,
                                     std::size_t &selectable_index) {
+    PROFILE_SCOPE("render_node");
     auto bottom_of_display =
         m_scroll_height + m_display->height() - STATUS_BAR_HEIGHT;
     if (m_dom_rendered && position > bottom_of_display) {
@@ -271,23 +370,26 @@ bool threeml::Renderer::init() {
     if (m_initialized) {
         return true;
     }
-    m_up_button.on(Button::Event::CLICK, [this]() { select_prev(); });
-    m_down_button.on(Button::Event::CLICK, [this]() { select_next(); });
-    m_down_button.on(Button::Event::HOLD, [this]() { interact(); });
-    m_up_button.on(Button::Event::HOLD, [this]() { go_back(); });
-    m_up_button.attach();
-    m_down_button.attach();
+    if (!m_js.start(m_dom_mutex)) {
+        return false;
+    }
     if (!FFat.begin(true)) {
         return false;
     }
+    inputHub.subscribe([this](const InputEvent &event) { post_input(event); });
     m_initialized = true;
     return true;
 }
 
 void threeml::Renderer::render() {
+    TIMELINE_SCOPE("frame");
+    int64_t frame_start = esp_timer_get_time();
+    TIMELINE_BEGIN("wait for dma");
     while (!m_display->done_refreshing())
         ;
+    TIMELINE_END("wait for dma");
     m_display->fillScreen(BACKGROUND_COLOR);
+    handle_input();
 
     if (m_dom == nullptr) {
         // No DOM to render, so just draw the status bar and refresh the
@@ -300,15 +402,14 @@ void threeml::Renderer::render() {
         m_must_reload = false;
         load_file(m_current_file.c_str(), !m_going_back);
         m_going_back = false;
-    } else if (m_callback_to_run) {
-        m_callback_to_run = false;
-        TaskLog().println("Running callback");
-        if (m_js_ctx != nullptr) {
-            duk_peval_string(m_js_ctx, m_pending_callback.c_str());
-        }
     }
 
+    TIMELINE_BEGIN("lock dom");
     xSemaphoreTake(m_dom_mutex, portMAX_DELAY); // Lock the DOM for rendering.
+    TIMELINE_END("lock dom");
+    TIMELINE_BEGIN("apply commits");
+    bool dom_changed = apply_commits();
+    TIMELINE_END("apply commits");
     if (m_dom_rendered) {
         clamp_scroll_target();
         // Smooth scrolling effect. Just uses an alpha filter.
@@ -316,9 +417,11 @@ void threeml::Renderer::render() {
     }
     std::size_t position = 0;
     std::size_t selectable_index = 0;
+    TIMELINE_BEGIN("render nodes");
     for (const auto node : m_dom->top_level_nodes) {
         render_node(node, position, selectable_index);
     }
+    TIMELINE_END("render nodes");
     // I call this the "Christopher Columbus" method for determining the total
     // height of the document. It's expensive to render the entire document just
     // to see how tall it is, so we just keep updating our knowledge of how tall
@@ -326,12 +429,38 @@ void threeml::Renderer::render() {
     m_total_height = (position > m_total_height) ? position : m_total_height;
     m_dom_rendered = true;
     xSemaphoreGive(m_dom_mutex); // Unlock the DOM for rendering.
+    TIMELINE_BEGIN("status bar");
     draw_status_bar();
+    TIMELINE_END("status bar");
 
+    TIMELINE_INSTANT("start dma");
     m_display->refresh();
+
+    int64_t frame_time = esp_timer_get_time() - frame_start;
+    ++m_frame_stats.frames;
+    m_frame_stats.last_frame_us = frame_time;
+    if (frame_time > m_frame_stats.max_frame_us) {
+        m_frame_stats.max_frame_us = frame_time;
+    }
+    request_idle_gc(dom_changed);
+}
+
+void threeml::Renderer::request_idle_gc(bool dom_changed) {
+    TickType_t now = xTaskGetTickCount();
+    // The scroll filter rounds down, so it can settle a few pixels short.
+    bool scrolling = labs(m_scroll_target - (long)m_scroll_height) >= 4;
+    if (dom_changed || scrolling || m_must_reload ||
+        now - m_last_input < pdMS_TO_TICKS(IDLE_GC_DELAY_MS) ||
+        now - m_last_gc_request < pdMS_TO_TICKS(IDLE_GC_INTERVAL_MS)) {
+        return;
+    }
+    m_last_gc_request = now;
+    ++m_frame_stats.gc_requests;
+    m_js.request_gc(m_generation);
 }
 
 bool threeml::Renderer::load_file(const char *path, bool add_to_stack) {
+    TIMELINE_SCOPE("load file");
     fs::File f = FFat.open(path);
     if (!f) {
         return false;
@@ -340,58 +469,70 @@ bool threeml::Renderer::load_file(const char *path, bool add_to_stack) {
     f.readBytes(buffer, f.size());
     buffer[f.size()] = '\0';
     f.close();
-    auto tmp = m_dom;
-    load_dom(threeml::clean_dom(threeml::parse_string(buffer)));
+    m_current_file = path;
+    TIMELINE_BEGIN("parse");
+    threeml::DOM *dom = threeml::clean_dom(threeml::parse_string(buffer));
+    TIMELINE_END("parse");
+    load_dom(dom);
     if (add_to_stack) {
         m_file_stack.push(path);
     }
-    for (const auto node : m_dom->top_level_nodes) {
-        if (node->type != threeml::NodeType::BODY) {
-            continue;
-        }
-        auto attrs = node->unique_attributes;
-        if (attrs.find("onbeforeunload") != attrs.end()) {
-            if (m_js_ctx != nullptr) {
-                duk_peval_string(m_js_ctx, attrs["onbeforeunload"].c_str());
-            }
-            break;
-        }
-    }
     delete[] buffer;
-    delete tmp;
     return true;
 }
 
 void threeml::Renderer::load_dom(threeml::DOM *dom) {
+    TIMELINE_SCOPE("load dom");
     xSemaphoreTake(m_dom_mutex, portMAX_DELAY);
     bool is_a_reload = (m_dom == dom);
+    DOM *old_dom = is_a_reload ? nullptr : m_dom;
+    const char *onbeforeunload = nullptr;
+    if (old_dom != nullptr) {
+        for (const auto node : old_dom->top_level_nodes) {
+            auto attr = node->unique_attributes.find("onbeforeunload");
+            if (node->type == threeml::NodeType::BODY &&
+                attr != node->unique_attributes.end()) {
+                onbeforeunload = attr->second.c_str();
+            }
+        }
+    }
     m_dom = dom;
+    ++m_generation;
     m_dom_rendered = false;
     m_total_height = 0;
+    m_current_selected = 0;
     refresh_selectable_nodes();
-    duk_destroy_heap(m_js_ctx);
-    m_js_ctx = duk_create_heap_default();
-    create_js_bindings(m_js_ctx, m_dom);
+    const char *onload = nullptr;
     for (const auto node : m_dom->top_level_nodes) {
         if (node->type == threeml::NodeType::BODY) {
-            auto attrs = node->unique_attributes;
-            if (attrs.find("onload") != attrs.end() && !is_a_reload) {
-                if (m_js_ctx != nullptr) {
-                    duk_peval_string(m_js_ctx, attrs["onload"].c_str());
-                }
+            auto attr = node->unique_attributes.find("onload");
+            if (attr != node->unique_attributes.end() && !is_a_reload) {
+                onload = attr->second.c_str();
             }
             continue;
         }
         for (const auto child : node->children) {
-            if (child->type == threeml::NodeType::SCRIPT) {
-                if (m_js_ctx != nullptr) {
-                    load_js_file(m_js_ctx,
-                                 child->unique_attributes["src"].c_str());
-                }
-            } else if (child->type == threeml::NodeType::TITLE) {
+            if (child->type == threeml::NodeType::TITLE) {
                 m_title = child->children.front()->plaintext_data.front();
             }
         }
     }
     xSemaphoreGive(m_dom_mutex);
+    // Posted without the DOM locked: a script blocked in a DOM binding must be
+    // able to finish before the queue drains. Scripts are loaded and run by
+    // the executor; their DOM mutations come back as commits.
+    if (old_dom != nullptr) {
+        m_js.post_unload(old_dom, onbeforeunload);
+    }
+    m_js.post_load(dom, m_generation, m_current_file.c_str(), onload);
+}
+
+const threeml::JSExecutor &threeml::Renderer::js_executor() const {
+    return m_js;
 }
+
+const threeml::frame_stats_t &threeml::Renderer::frame_stats() const {
+    return m_frame_stats;
+}
+
+void threeml::Renderer::reset_frame_stats() { m_frame_stats.max_frame_us = 0; }
@@ -1,25 +1,157 @@
 #include "battery.h"
+#include "taskwrapper.h"
 #include <Arduino.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace {
+
+struct curve_point_t {
+    uint16_t millivolts;
+    uint8_t percent;
+};
+
+// A LiPo cell at rest, from empty to full. Flat through the middle, so a few
+// millivolts there are worth several percent.
+const curve_point_t DISCHARGE_CURVE[] = {
+    {3270, 0},  {3610, 5},  {3690, 10}, {3710, 15}, {3730, 20}, {3750, 25},
+    {3770, 30}, {3790, 35}, {3800, 40}, {3820, 45}, {3840, 50}, {3850, 55},
+    {3870, 60}, {3910, 65}, {3950, 70}, {3980, 75}, {4020, 80}, {4080, 85},
+    {4110, 90}, {4150, 95}, {4200, 100},
+};
+constexpr std::size_t CURVE_POINTS =
+    sizeof(DISCHARGE_CURVE) / sizeof(DISCHARGE_CURVE[0]);
+
+// Published by the sampler. Until it runs they hold what is reported when
+// there is no battery to measure.
+std::atomic<uint32_t> voltage_mv(3700);
+std::atomic<uint32_t> level_tenths(1000);
+std::atomic<uint32_t> shown_percent(100);
+
+battery::subscriber_t subscribers[BATTERY_MAX_SUBSCRIBERS];
+std::size_t subscriber_count = 0;
+TaskHandle_t sampler = nullptr;
+std::atomic<bool> running(false);
+battery::sampler_stats_t sampler_stats{};
+float filtered_mv = 0.0f; // Seeded by start, then the sampler task's
+
+void publish(uint32_t millivolts) {
+    voltage_mv.store(millivolts, std::memory_order_relaxed);
+    float level = battery::level_for_voltage(millivolts / 1000.0f);
+    level_tenths.store(static_cast<uint32_t>(level * 10.0f + 0.5f),
+                       std::memory_order_relaxed);
+    float shown = static_cast<float>(shown_percent.load());
+    if (fabsf(level - shown) < 0.5f + BATTERY_HYSTERESIS) {
+        return;
+    }
+    uint8_t percent = static_cast<uint8_t>(level + 0.5f);
+    shown_percent.store(percent, std::memory_order_relaxed);
+    ++sampler_stats.notifications;
+    for (std::size_t i = 0; i < subscriber_count; ++i) {
+        subscribers[i](percent);
+    }
+}
 
-float battery::get_voltage() {
 #ifdef PRO_FEATURES
-    static float voltage = 0.0f;
-    float raw = static_cast<float>(analogReadMilliVolts(BAT_ADC_PIN)) / 1000.0f;
-    voltage =
-        voltage * BATTERY_FILTER_GAIN + (1.0f - BATTERY_FILTER_GAIN) * raw;
-    return voltage;
+/// @brief Converts BATTERY_OVERSAMPLE times back to back and averages all but
+/// the BATTERY_TRIM lowest and highest, which is where spikes from the radio
+/// and the display end up.
+/// @return The voltage at the pin in millivolts.
+uint32_t read_burst() {
+    uint32_t samples[BATTERY_OVERSAMPLE];
+    int64_t start = esp_timer_get_time();
+    for (auto &sample : samples) {
+        sample = analogReadMilliVolts(BAT_ADC_PIN);
+    }
+    sampler_stats.last_burst_us = esp_timer_get_time() - start;
+    sampler_stats.conversions += BATTERY_OVERSAMPLE;
+    std::sort(samples, samples + BATTERY_OVERSAMPLE);
+    uint32_t sum = 0;
+    for (std::size_t i = BATTERY_TRIM; i < BATTERY_OVERSAMPLE - BATTERY_TRIM;
+         ++i) {
+        sum += samples[i];
+    }
+    sampler_stats.spread_mv = samples[BATTERY_OVERSAMPLE - BATTERY_TRIM - 1] -
+                              samples[BATTERY_TRIM];
+    return sum / (BATTERY_OVERSAMPLE - 2 * BATTERY_TRIM);
+}
+
+void sampler_task(void *arg) {
+    (void)arg;
+    TickType_t wake_time = xTaskGetTickCount();
+    while (true) {
+        xTaskDelayUntil(&wake_time, pdMS_TO_TICKS(BATTERY_SAMPLE_INTERVAL_MS));
+        filtered_mv = filtered_mv * BATTERY_FILTER_GAIN +
+                      (1.0f - BATTERY_FILTER_GAIN) * read_burst();
+        ++sampler_stats.readings;
+        publish(static_cast<uint32_t>(filtered_mv + 0.5f));
+    }
+}
+#endif
+
+} // namespace
+
+bool battery::start() {
+#ifdef PRO_FEATURES
+    if (sampler != nullptr) {
+        return true;
+    }
+    // The first reading seeds the filter, so it is right from the start.
+    filtered_mv = read_burst();
+    ++sampler_stats.readings;
+    publish(static_cast<uint32_t>(filtered_mv + 0.5f));
+    registerTaskStack("Battery", BATTERY_STACK_SIZE);
+    if (xTaskCreate(sampler_task, "Battery", BATTERY_STACK_SIZE, nullptr,
+                    BATTERY_PRIORITY, &sampler) != pdPASS) {
+        return false;
+    }
+    running.store(true, std::memory_order_release);
+    return true;
 #else
-    return 3.7f;
+    return false;
 #endif
 }
 
+bool battery::available() {
+    return running.load(std::memory_order_acquire);
+}
+
+float battery::get_voltage() {
+    return voltage_mv.load(std::memory_order_relaxed) / 1000.0f;
+}
+
 float battery::get_level() {
-    auto raw = (get_voltage() - 3.2f) * 200.0f;
-    if (raw < 0.0f) {
+    return level_tenths.load(std::memory_order_relaxed) / 10.0f;
+}
+
+uint8_t battery::get_percent() {
+    return shown_percent.load(std::memory_order_relaxed);
+}
+
+bool battery::subscribe(subscriber_t callback) {
+    if (subscriber_count == BATTERY_MAX_SUBSCRIBERS) {
+        return false;
+    }
+    subscribers[subscriber_count++] = std::move(callback);
+    return true;
+}
+
+float battery::level_for_voltage(float voltage) {
+    float millivolts = voltage * 1000.0f;
+    if (millivolts <= DISCHARGE_CURVE[0].millivolts) {
         return 0.0f;
-    } else if (raw > 100.0f) {
-        return 100.0f;
-    } else {
-        return raw;
     }
-}
\ No newline at end of file
+    for (std::size_t i = 1; i < CURVE_POINTS; ++i) {
+        const curve_point_t &low = DISCHARGE_CURVE[i - 1];
+        const curve_point_t &high = DISCHARGE_CURVE[i];
+        if (millivolts < high.millivolts) {
+            return low.percent + (high.percent - low.percent) *
+                                     (millivolts - low.millivolts) /
+                                     (high.millivolts - low.millivolts);
+        }
+    }
+    return 100.0f;
+}
+
+battery::sampler_stats_t battery::stats() { return sampler_stats; }
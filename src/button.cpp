@@ -1,11 +1,13 @@
 #include "button.h"
+#include "timeline.h"
 
-Button::Button(int pin)
+Button::Button(int pin, bool repeats)
     : pin(pin)
-    , state(false)
-    , pressTimestamp(0)
-    , callbacks{nullptr}
-    , debounceTimer{xTimerCreate("Button Debounce", DEBOUNCE_DURATION, false, this, DebounceCB)}
+    , edges()
+    , overflowed(false)
+    , overflows(0)
+    , consumer(nullptr)
+    , key(pin, repeats)
 {}
 
 Button::~Button() {
@@ -13,85 +15,44 @@ Button::~Button() {
 }
 
 void Button::attach() {
+    consumer = xTaskGetCurrentTaskHandle();
     pinMode(pin, INPUT);    // Pins are externally pulled HIGH in board schematic
     attachInterruptArg(pin, ISR, this, CHANGE);
 }
 
 void Button::ISR(void *arg) {
     Button *button = static_cast<Button*>(arg);
-    const TickType_t irqTime = xTaskGetTickCountFromISR();
-
-    button->poll(irqTime, true);
+    const int64_t now = esp_timer_get_time();
+    TIMELINE_INSTANT("button isr");
+
+    // Every bounce lands here too; the consumer sorts them out by time
+    bool pressed = !digitalRead(button->pin);   // Button is active low
+    if (!button->edges.push(Edge{pressed, now})) {
+        button->overflows.fetch_add(1, std::memory_order_relaxed);
+        button->overflowed.store(true, std::memory_order_relaxed);
+    }
 
     BaseType_t taskWoken = pdFALSE;
-    detachInterrupt(button->pin);
-    xTimerResetFromISR(button->debounceTimer, &taskWoken);
+    vTaskNotifyGiveFromISR(button->consumer, &taskWoken);
     if (taskWoken == pdTRUE)
         portYIELD_FROM_ISR();
 }
 
-void Button::DebounceCB(TimerHandle_t timer) {
-    Button *button = static_cast<Button*>(pvTimerGetTimerID(timer));
-    const TickType_t cbTime = xTaskGetTickCount();
-
-    // Debounce again after another interval of DEBOUNCE_DURATION ticks if the button state has changed since the last poll
-    // Otherwise, consider the pin state stable and reattach the ISR
-    if (button->poll(cbTime, false))
-        xTimerReset(timer, 0);  // The timer task invokes `DebounceCB`, so blocking the timer task until the timer queue is not full would be very bad
-    else
-        attachInterruptArg(button->pin, ISR, button, CHANGE);
-}
-
-void Button::cbInvoker(void *instance, uint32_t cbIdx) {
-    static_cast<Button*>(instance)->callbacks[cbIdx]->invoke();
+bool Button::take(Edge& edge) {
+    if (edges.pop(edge))
+        return true;
+    // The edges taken may not add up to where the pin is
+    if (overflowed.exchange(false, std::memory_order_relaxed)) {
+        edge = Edge{level(), esp_timer_get_time()};
+        return true;
+    }
+    return false;
 }
 
-bool Button::poll(const TickType_t callTime, const bool inISR) {
-    BaseType_t taskWoken = pdFALSE;
-    bool pinState = !digitalRead(pin);  // Button is active low
-
-    if (pinState == state)
-        return false;
-    
-    state = pinState;
-    if (state) {
-        pressTimestamp = callTime;
-        if (callbacks[(size_t)Event::PRESS]) {
-            if (inISR)
-                xTimerPendFunctionCallFromISR(cbInvoker, this, (size_t)Event::PRESS, &taskWoken);
-            else
-                callbacks[(size_t)Event::PRESS]->invoke();
-        }
-    }
-    else {
-        if (callTime - pressTimestamp >= LONG_PRESS_DURATION) {
-            if (callbacks[(size_t)Event::HOLD]) {
-                if (inISR)
-                    xTimerPendFunctionCallFromISR(cbInvoker, this, (size_t)Event::HOLD, &taskWoken);
-                else
-                    callbacks[(size_t)Event::HOLD]->invoke();
-            }
-        }
-        else {
-            if (callbacks[(size_t)Event::CLICK]) {
-                if (inISR)
-                    xTimerPendFunctionCallFromISR(cbInvoker, this, (size_t)Event::CLICK, &taskWoken);
-                else
-                    callbacks[(size_t)Event::CLICK]->invoke();
-            }
-        }
-        if (callbacks[(size_t)Event::RELEASE]) {
-            if (inISR)
-                xTimerPendFunctionCallFromISR(cbInvoker, this, (size_t)Event::RELEASE, &taskWoken);
-            else
-                callbacks[(size_t)Event::RELEASE]->invoke();
-        }
-    }
-    if (inISR && taskWoken == pdTRUE)
-        portYIELD_FROM_ISR();
-    return true;
+bool Button::level() const {
+    return !digitalRead(pin);
 }
 
 bool Button::isPressed() const {
-    return state;
-}
\ No newline at end of file
+    return key.pressed();
+}
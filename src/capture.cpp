@@ -0,0 +1,242 @@
+#include "capture.h"
+
+#include "state.h"
+#include "taskwrapper.h"
+
+CaptureRecorder captureRecorder;
+
+CaptureRecorder::CaptureRecorder()
+    : recording(false)
+    , stopRequested(false)
+    , lock(portMUX_INITIALIZER_UNLOCKED)
+    , buffers{{nullptr, 0}, {nullptr, 0}}
+    , active(0)
+    , startTimeUs(0)
+    , endTimeUs(0)
+    , writer(nullptr)
+    , file()
+    , path()
+    , records(0)
+    , dropped(0)
+    , bytesWritten(0)
+    , writeFailed(false)
+{}
+
+bool CaptureRecorder::start(const char *newPath, uint32_t seconds) {
+    if (writer || seconds == 0 || seconds > CAPTURE_MAX_SECONDS)
+        return false;
+    for (Buffer& buffer : buffers) {
+        // Internal RAM, since interrupt handlers append to it
+        if (!buffer.data && !(buffer.data = static_cast<uint8_t*>(heap_caps_malloc(CAPTURE_BUFFER_SIZE, MALLOC_CAP_INTERNAL))))
+            return false;
+        buffer.used = 0;
+    }
+    file = FFat.open(newPath, FILE_WRITE);
+    if (!file)
+        return false;
+    path = newPath;
+    active = 0;
+    records = 0;
+    dropped = 0;
+    bytesWritten = 0;
+    writeFailed = false;
+    stopRequested = false;
+    startTimeUs = esp_timer_get_time();
+    endTimeUs = startTimeUs + seconds * 1000000LL;
+
+    CaptureHeader header;
+    memcpy(header.magic, CAPTURE_MAGIC, 4);
+    header.version = CAPTURE_VERSION;
+    header.reserved = 0;
+    header.startTimeUs = startTimeUs;
+    memcpy(buffers[0].data, &header, sizeof(header));
+    buffers[0].used = sizeof(header);
+
+    registerTaskStack("Capture Writer", CAPTURE_WRITER_STACK_SIZE);
+    if (xTaskCreate(writerEntry, "Capture Writer", CAPTURE_WRITER_STACK_SIZE, this, CAPTURE_WRITER_PRIORITY, &writer) != pdPASS) {
+        writer = nullptr;
+        file.close();
+        return false;
+    }
+    // Producers may notify the writer once they see this
+    recording = true;
+    return true;
+}
+
+void CaptureRecorder::stop() {
+    TaskHandle_t task = writer;
+    if (task) {
+        stopRequested = true;
+        xTaskNotifyGive(task);
+    }
+}
+
+void CaptureRecorder::appendOrientation(const OrientationSample& sample) {
+    uint8_t record[sizeof(CaptureRecordHeader) + sizeof(CaptureOrientation)];
+    // A sample read just before the start still belongs at its start
+    int64_t offset = std::max<int64_t>(sample.sensorTime - startTimeUs, 0);
+    CaptureRecordHeader header{CaptureRecordType::ORIENTATION, static_cast<uint32_t>(offset)};
+    CaptureOrientation orientation{sample.orientation.roll, sample.orientation.pitch, sample.orientation.yaw};
+    memcpy(record, &header, sizeof(header));
+    memcpy(record + sizeof(header), &orientation, sizeof(orientation));
+    append(record, sizeof(record));
+}
+
+void CaptureRecorder::appendInput(CaptureRecordType type, uint8_t id, bool pressed) {
+    uint8_t record[sizeof(CaptureRecordHeader) + sizeof(CaptureInput)];
+    CaptureRecordHeader header{type, static_cast<uint32_t>(esp_timer_get_time() - startTimeUs)};
+    CaptureInput input{id, pressed};
+    memcpy(record, &header, sizeof(header));
+    memcpy(record + sizeof(header), &input, sizeof(input));
+    append(record, sizeof(record));
+}
+
+void CaptureRecorder::append(const uint8_t *record, size_t size) {
+    bool swapped = false;
+    portENTER_CRITICAL_SAFE(&lock);
+    // The writer clears `recording` under the lock before its last flush
+    if (!recording.load(std::memory_order_relaxed)) {
+        portEXIT_CRITICAL_SAFE(&lock);
+        return;
+    }
+    if (buffers[active].used + size > CAPTURE_BUFFER_SIZE) {
+        if (buffers[active ^ 1].used) {
+            // The writer is still saving the other half
+            ++dropped;
+            portEXIT_CRITICAL_SAFE(&lock);
+            return;
+        }
+        active ^= 1;
+        swapped = true;
+    }
+    Buffer& buffer = buffers[active];
+    memcpy(buffer.data + buffer.used, record, size);
+    buffer.used += size;
+    ++records;
+    portEXIT_CRITICAL_SAFE(&lock);
+
+    if (swapped) {
+        if (xPortInIsrContext()) {
+            BaseType_t taskWoken = pdFALSE;
+            vTaskNotifyGiveFromISR(writer, &taskWoken);
+            if (taskWoken == pdTRUE)
+                portYIELD_FROM_ISR();
+        } else {
+            xTaskNotifyGive(writer);
+        }
+    }
+}
+
+bool CaptureRecorder::writeBuffer(Buffer& buffer) {
+    size_t written = file.write(buffer.data, buffer.used);
+    bytesWritten += written;
+    bool ok = written == buffer.used;
+    portENTER_CRITICAL(&lock);
+    buffer.used = 0;
+    portEXIT_CRITICAL(&lock);
+    return ok;
+}
+
+void CaptureRecorder::writerEntry(void *arg) {
+    CaptureRecorder *recorder = static_cast<CaptureRecorder*>(arg);
+    while (!recorder->stopRequested) {
+        int64_t remaining = recorder->endTimeUs - esp_timer_get_time();
+        if (remaining <= 0)
+            break;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(std::min<int64_t>(remaining / 1000 + 1, 100)));
+        // Only the writer empties a half, and producers never touch the one
+        // they've moved off, so it can be written without the lock
+        portENTER_CRITICAL(&recorder->lock);
+        Buffer& full = recorder->buffers[recorder->active ^ 1];
+        bool pending = full.used != 0;
+        portEXIT_CRITICAL(&recorder->lock);
+        if (pending && !recorder->writeBuffer(full))
+            recorder->writeFailed = true;
+    }
+
+    portENTER_CRITICAL(&recorder->lock);
+    recorder->recording = false;
+    portEXIT_CRITICAL(&recorder->lock);
+    // Older half first
+    for (uint8_t half : {static_cast<uint8_t>(recorder->active ^ 1), recorder->active}) {
+        if (recorder->buffers[half].used && !recorder->writeBuffer(recorder->buffers[half]))
+            recorder->writeFailed = true;
+    }
+    recorder->file.close();
+    recorder->endTimeUs = esp_timer_get_time();
+    if (recorder->writeFailed)
+        Error<TaskLog>().printf("Failed to write capture %s\n", recorder->path.c_str());
+    recorder->writer = nullptr;
+    vTaskDelete(NULL);
+}
+
+CaptureRecorder::Stats CaptureRecorder::stats() const {
+    Stats stats;
+    portENTER_CRITICAL(&lock);
+    stats.recording = recording;
+    stats.records = records;
+    stats.dropped = dropped;
+    portEXIT_CRITICAL(&lock);
+    stats.path = path;
+    stats.bytesWritten = bytesWritten;
+    stats.writeFailed = writeFailed;
+    stats.elapsedUs = (stats.recording ? esp_timer_get_time() : endTimeUs) - startTimeUs;
+    return stats;
+}
+
+ReplaySource::ReplaySource(const uint8_t *data, size_t size)
+    : reader(data, size)
+    , pending()
+    , hasPending(false)
+    , startUs(0)
+    , done(false)
+{}
+
+bool ReplaySource::begin() {
+    if (!reader.valid())
+        return false;
+    reader.rewind();
+    hasPending = false;
+    done = false;
+    startUs = esp_timer_get_time();
+    return true;
+}
+
+size_t ReplaySource::read(OrientationSample *out, size_t capacity, TickType_t timeout) {
+    size_t count = 0;
+    while (count < capacity) {
+        while (!hasPending && reader.next(pending))
+            hasPending = pending.type == CaptureRecordType::ORIENTATION;
+        if (!hasPending) {
+            done = true;
+            break;
+        }
+        int64_t due = startUs + pending.timeUs;
+        int64_t wait = due - esp_timer_get_time();
+        if (wait > 0) {
+            if (count)
+                break;
+            TickType_t ticks = pdMS_TO_TICKS((wait + 999) / 1000);
+            vTaskDelay(ticks < timeout ? ticks : timeout);
+            if (ticks > timeout)
+                return 0;
+            continue;
+        }
+        const CaptureOrientation& o = pending.orientation;
+        out[count++] = OrientationSample{Orientation{o.roll, o.pitch, o.yaw}, due, 0};
+        hasPending = false;
+    }
+    if (count == 0 && done)
+        vTaskDelay(timeout);
+    return count;
+}
+
+bool loadCapture(const char *path, std::vector<uint8_t>& out) {
+    fs::File file = FFat.open(path);
+    if (!file || file.isDirectory())
+        return false;
+    out.resize(file.size());
+    bool ok = file.read(out.data(), out.size()) == out.size();
+    file.close();
+    return ok;
+}
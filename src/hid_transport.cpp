@@ -0,0 +1,61 @@
+#include "hid_transport.h"
+
+BleTransport::BleTransport(BleMouse& mouse)
+    : mouse(mouse)
+    , buttons(0)
+    , lastSendUs(-BLE_REPORT_INTERVAL_US)
+{}
+
+bool BleTransport::begin() {
+    mouse.begin();
+    return true;
+}
+
+bool BleTransport::connected() const {
+    return mouse.isConnected();
+}
+
+bool BleTransport::ready() const {
+    return connected() && esp_timer_get_time() - lastSendUs >= BLE_REPORT_INTERVAL_US;
+}
+
+bool BleTransport::send(const MouseReport& report) {
+    if (!mouse.isConnected())
+        return false;
+    lastSendUs = esp_timer_get_time();
+    uint8_t changed = report.buttons ^ buttons;
+    for (uint8_t button : {MOUSE_LEFT, MOUSE_RIGHT, MOUSE_MIDDLE}) {
+        if (changed & button) {
+            if (report.buttons & button)
+                mouse.press(button);
+            else
+                mouse.release(button);
+        }
+    }
+    buttons = report.buttons;
+    if (report.x || report.y || report.wheel)
+        mouse.move(report.x, report.y, report.wheel);
+    return true;
+}
+
+#if CFG_TUD_HID
+
+bool UsbTransport::connected() const {
+    return usbMounted;
+}
+
+bool UsbTransport::ready() const {
+    return USBMouse.ready();
+}
+
+bool UsbTransport::send(const MouseReport& report) {
+    return USBMouse.report(report.buttons, report.x, report.y, report.wheel);
+}
+
+#else
+
+bool UsbTransport::connected() const { return false; }
+bool UsbTransport::ready() const { return false; }
+bool UsbTransport::send(const MouseReport&) { return false; }
+
+#endif
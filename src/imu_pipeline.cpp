@@ -0,0 +1,109 @@
+#include "imu_pipeline.h"
+
+#include "state.h"
+#include "taskwrapper.h"
+
+ImuPipeline::ImuPipeline(OrientationSource& source)
+    : source(source)
+    , queue()
+    , reader(nullptr)
+    , consumer(nullptr)
+    , reads(0)
+    , samples(0)
+    , dropped(0)
+    , peakDepth(0)
+    , consumerLatency()
+{}
+
+bool ImuPipeline::start() {
+    if (reader)
+        return true;
+    registerTaskStack("IMU Reader", IMU_READER_STACK_SIZE);
+    return xTaskCreate(readerEntry, "IMU Reader", IMU_READER_STACK_SIZE, this, IMU_READER_PRIORITY, &reader) == pdPASS;
+}
+
+void ImuPipeline::stop() {
+    if (reader) {
+        vTaskDelete(reader);
+        reader = nullptr;
+    }
+}
+
+void ImuPipeline::readerEntry(void *arg) {
+    ImuPipeline *pipeline = static_cast<ImuPipeline*>(arg);
+    if (!pipeline->source.begin()) {
+        Error<TaskLog>().println("Failed to start the orientation source");
+        pipeline->reader = nullptr;
+        vTaskDelete(NULL);
+    }
+    OrientationSample batch[IMU_READ_BATCH];
+    while (true) {
+        size_t count = pipeline->source.read(batch, IMU_READ_BATCH, pdMS_TO_TICKS(IMU_READ_TIMEOUT_MS));
+        pipeline->reads.fetch_add(1, std::memory_order_relaxed);
+        if (count == 0)
+            continue;
+        int64_t now = esp_timer_get_time();
+        for (size_t i = 0; i < count; ++i) {
+            batch[i].readTime = now;
+            if (pipeline->queue.push(batch[i]))
+                pipeline->samples.fetch_add(1, std::memory_order_relaxed);
+            else
+                pipeline->dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        uint32_t depth = pipeline->queue.size();
+        if (depth > pipeline->peakDepth.load(std::memory_order_relaxed))
+            pipeline->peakDepth.store(depth, std::memory_order_relaxed);
+        TaskHandle_t waiting = pipeline->consumer.load(std::memory_order_acquire);
+        if (waiting)
+            xTaskNotifyGive(waiting);
+    }
+}
+
+bool ImuPipeline::pop(OrientationSample& sample, TickType_t timeout) {
+    consumer.store(xTaskGetCurrentTaskHandle(), std::memory_order_release);
+    // A notification given between a failed pop and the wait is kept, so
+    // a sample can't slip in unnoticed
+    while (!queue.pop(sample)) {
+        if (ulTaskNotifyTake(pdTRUE, timeout) == 0)
+            return false;
+    }
+    consumerLatency.add(esp_timer_get_time() - sample.sensorTime);
+    return true;
+}
+
+ImuPipeline::Stats ImuPipeline::stats() const {
+    return Stats{reads.load(), samples.load(), dropped.load(), peakDepth.load()};
+}
+
+void ImuPipeline::resetStats() {
+    reads = 0;
+    samples = 0;
+    dropped = 0;
+    peakDepth = 0;
+    consumerLatency.reset();
+}
+
+SyntheticSource::SyntheticSource(uint32_t rateHz)
+    : rateHz(rateHz)
+    , sampleIndex(0)
+    , wakeTime(0)
+{}
+
+bool SyntheticSource::begin() {
+    wakeTime = xTaskGetTickCount();
+    return true;
+}
+
+size_t SyntheticSource::read(OrientationSample *out, size_t capacity, TickType_t timeout) {
+    // Rates above the tick rate come out in bursts, one per tick
+    const TickType_t period = pdMS_TO_TICKS(1000 / rateHz) ? pdMS_TO_TICKS(1000 / rateHz) : 1;
+    const size_t perPeriod = std::max<size_t>(1, rateHz / configTICK_RATE_HZ);
+    xTaskDelayUntil(&wakeTime, period);
+    int64_t now = esp_timer_get_time();
+    size_t count = std::min(capacity, perPeriod);
+    for (size_t i = 0; i < count; ++i, ++sampleIndex) {
+        float phase = 2 * PI * sampleIndex / (4.f * rateHz);    // One turn every 4 s
+        out[i] = OrientationSample{Orientation{10.f * sinf(phase), 10.f * cosf(phase), 0.f}, now, 0};
+    }
+    return count;
+}
@@ -0,0 +1,105 @@
+#include "input.h"
+
+#include "capture.h"
+#include "touch.h"
+
+InputHub inputHub;
+
+InputHub::InputHub()
+    : buttonList{nullptr}
+    , buttons(0)
+    , subscriberList()
+    , subscribers(0)
+    , counters()
+    , gestures()
+{}
+
+bool InputHub::addButton(Button& button) {
+    if (buttons == INPUT_MAX_BUTTONS)
+        return false;
+    buttonList[buttons++] = &button;
+    return true;
+}
+
+bool InputHub::subscribe(Subscriber subscriber) {
+    if (subscribers == INPUT_MAX_SUBSCRIBERS)
+        return false;
+    subscriberList[subscribers++] = std::move(subscriber);
+    return true;
+}
+
+void InputHub::run() {
+    for (size_t i = 0; i < buttons; ++i)
+        buttonList[i]->attach();
+    InputEvent events[KEY_MAX_EVENTS];
+    GestureEvent gestureEvents[GESTURE_MAX_EVENTS];
+    while (true) {
+        for (size_t i = 0; i < buttons; ++i) {
+            Button::Edge edge;
+            while (buttonList[i]->take(edge)) {
+                size_t count = buttonList[i]->tracker().edge(edge.pressed, edge.timeUs, events);
+                for (size_t j = 0; j < count; ++j)
+                    publish(events[j]);
+            }
+        }
+        TouchPads::Edge touch;
+        while (TouchPads::take(touch)) {
+            publish(InputEvent{touch.pressed ? InputType::TOUCH_PRESS : InputType::TOUCH_RELEASE, touch.pad, touch.pressed, touch.timeUs});
+            size_t count = gestures.edge(touch.pad, touch.pressed, touch.timeUs, gestureEvents);
+            for (size_t j = 0; j < count; ++j)
+                publish(InputEvent{InputType::GESTURE, gestureEvents[j].pad, static_cast<uint8_t>(gestureEvents[j].gesture), gestureEvents[j].timeUs});
+        }
+
+        // Debounces settling, keys repeating and touches turning into drags
+        int64_t now = esp_timer_get_time();
+        int64_t deadline = INT64_MAX;
+        for (size_t i = 0; i < buttons; ++i) {
+            KeyTracker& key = buttonList[i]->tracker();
+            if (now >= key.nextDeadline()) {
+                size_t count = key.tick(buttonList[i]->level(), now, events);
+                for (size_t j = 0; j < count; ++j)
+                    publish(events[j]);
+            }
+            if (key.nextDeadline() < deadline)
+                deadline = key.nextDeadline();
+        }
+        size_t count;
+        while ((count = gestures.tick(now, gestureEvents)) > 0) {
+            for (size_t j = 0; j < count; ++j)
+                publish(InputEvent{InputType::GESTURE, gestureEvents[j].pad, static_cast<uint8_t>(gestureEvents[j].gesture), gestureEvents[j].timeUs});
+        }
+        if (gestures.nextDeadline() < deadline)
+            deadline = gestures.nextDeadline();
+
+        TickType_t timeout = portMAX_DELAY;
+        if (deadline != INT64_MAX)
+            timeout = pdMS_TO_TICKS((deadline - now) / 1000) + 1;
+        ulTaskNotifyTake(pdTRUE, timeout);
+    }
+}
+
+InputHub::Stats InputHub::stats() const {
+    Stats s;
+    for (size_t i = 0; i < static_cast<size_t>(InputType::COUNT); ++i)
+        s.events[i] = counters[i].load(std::memory_order_relaxed);
+    s.subscribers = subscribers;
+    return s;
+}
+
+void InputHub::publish(const InputEvent& event) {
+    counters[static_cast<size_t>(event.type)].fetch_add(1, std::memory_order_relaxed);
+    switch (event.type) {
+    case InputType::BUTTON_PRESS:
+    case InputType::BUTTON_RELEASE:
+        captureRecorder.addInput(CaptureRecordType::BUTTON, event.id, event.type == InputType::BUTTON_PRESS);
+        break;
+    case InputType::TOUCH_PRESS:
+    case InputType::TOUCH_RELEASE:
+        captureRecorder.addInput(CaptureRecordType::TOUCH, event.id, event.type == InputType::TOUCH_PRESS);
+        break;
+    default:
+        break;
+    }
+    for (size_t i = 0; i < subscribers; ++i)
+        subscriberList[i](event);
+}
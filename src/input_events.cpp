@@ -0,0 +1,92 @@
+#include "input_events.h"
+
+const char *inputTypeName(InputType type) {
+    switch (type) {
+    case InputType::BUTTON_PRESS: return "press";
+    case InputType::BUTTON_RELEASE: return "release";
+    case InputType::BUTTON_CLICK: return "click";
+    case InputType::BUTTON_HOLD: return "hold";
+    case InputType::BUTTON_REPEAT: return "repeat";
+    case InputType::TOUCH_PRESS: return "touch";
+    case InputType::TOUCH_RELEASE: return "untouch";
+    case InputType::GESTURE: return "gesture";
+    default: return "?";
+    }
+}
+
+KeyTracker::KeyTracker(uint8_t id, bool repeats)
+    : id(id)
+    , repeats(repeats)
+    , state(false)
+    , repeated(false)
+    , pressTimeUs(0)
+    , armedUntilUs(INT64_MIN)
+    , settleUs(INT64_MAX)
+    , nextRepeatUs(INT64_MAX)
+    , repeatGapUs(KEY_REPEAT_START_US)
+    , ignored(0)
+{}
+
+size_t KeyTracker::edge(bool pressed, int64_t timeUs, InputEvent *out) {
+    if (timeUs < settleUs) {
+        if (settleUs != INT64_MAX) {
+            ++ignored;
+            return 0;
+        }
+    } else
+        settleUs = INT64_MAX;
+    if (pressed == state)
+        return 0;
+    return change(pressed, timeUs, out);
+}
+
+size_t KeyTracker::tick(bool pressed, int64_t nowUs, InputEvent *out) {
+    size_t count = 0;
+    // Bounces were ignored, so the level is the only word on where they ended
+    if (nowUs >= settleUs) {
+        settleUs = INT64_MAX;
+        if (pressed != state)
+            count = change(pressed, nowUs, out);
+    }
+    if (nowUs >= nextRepeatUs) {
+        uint32_t steps = 0;
+        while (nextRepeatUs <= nowUs) {
+            ++steps;
+            nextRepeatUs += repeatGapUs;
+            repeatGapUs -= repeatGapUs / 4;
+            if (repeatGapUs < KEY_REPEAT_MIN_US)
+                repeatGapUs = KEY_REPEAT_MIN_US;
+        }
+        repeated = true;
+        out[count++] = InputEvent{InputType::BUTTON_REPEAT, id, static_cast<uint8_t>(steps > 255 ? 255 : steps), nowUs};
+    }
+    return count;
+}
+
+int64_t KeyTracker::nextDeadline() const {
+    return settleUs < nextRepeatUs ? settleUs : nextRepeatUs;
+}
+
+size_t KeyTracker::change(bool pressed, int64_t timeUs, InputEvent *out) {
+    state = pressed;
+    settleUs = timeUs + KEY_DEBOUNCE_US;
+    if (pressed) {
+        pressTimeUs = timeUs;
+        repeated = false;
+        repeatGapUs = KEY_REPEAT_START_US;
+        nextRepeatUs = repeats && timeUs <= armedUntilUs ? timeUs + KEY_REPEAT_DELAY_US : INT64_MAX;
+        out[0] = InputEvent{InputType::BUTTON_PRESS, id, 1, timeUs};
+        return 1;
+    }
+    nextRepeatUs = INT64_MAX;
+    armedUntilUs = INT64_MIN;
+    size_t count = 0;
+    if (!repeated) {
+        InputType kind = timeUs - pressTimeUs >= KEY_LONG_PRESS_US ? InputType::BUTTON_HOLD : InputType::BUTTON_CLICK;
+        if (kind == InputType::BUTTON_CLICK)
+            armedUntilUs = timeUs + KEY_REPEAT_ARM_US;
+        out[count++] = InputEvent{kind, id, 1, timeUs};
+    }
+    out[count++] = InputEvent{InputType::BUTTON_RELEASE, id, 0, timeUs};
+    return count;
+}
@@ -0,0 +1,59 @@
+#include "input_latency.h"
+
+#include "trace.h"
+
+InputLatency inputLatency;
+
+InputLatency::InputLatency()
+    : stages()
+    , reports(0)
+    , dropped(0)
+{}
+
+void InputLatency::record(const InputTimestamps& t) {
+    int64_t durations[] = {
+        t.read - t.sensor,
+        t.dequeued - t.read,
+        t.computed - t.dequeued,
+        t.submitted - t.computed,
+        t.submitted - t.sensor,
+    };
+    static_assert(sizeof(durations) / sizeof(durations[0]) == static_cast<size_t>(LatencyStage::COUNT), "A duration for every stage");
+    for (size_t i = 0; i < static_cast<size_t>(LatencyStage::COUNT); ++i)
+        stages[i].add(durations[i]);
+    reports.fetch_add(1, std::memory_order_relaxed);
+    TRACE("Report latency: read %lld us, queue %lld us, compute %lld us, submit %lld us, total %lld us\n",
+        durations[0], durations[1], durations[2], durations[3], durations[4]);
+}
+
+InputLatency::Counts InputLatency::counts() const {
+    return Counts{reports.load(), dropped.load()};
+}
+
+void InputLatency::print(Print& out) const {
+    Counts c = counts();
+    out.printf("Reports: %u timed, %u dropped (not connected)\n", c.reports, c.dropped);
+    for (size_t i = 0; i < static_cast<size_t>(LatencyStage::COUNT); ++i) {
+        const LatencyHistogram& h = stages[i];
+        out.printf("%-8s p50 %6u us, p90 %6u us, p99 %6u us, max %6u us\n",
+            stageName(static_cast<LatencyStage>(i)), h.percentile(50), h.percentile(90), h.percentile(99), h.max());
+    }
+}
+
+void InputLatency::reset() {
+    for (LatencyHistogram& h : stages)
+        h.reset();
+    reports = 0;
+    dropped = 0;
+}
+
+const char *InputLatency::stageName(LatencyStage stage) {
+    switch (stage) {
+    case LatencyStage::READ: return "read";
+    case LatencyStage::QUEUE: return "queue";
+    case LatencyStage::COMPUTE: return "compute";
+    case LatencyStage::SUBMIT: return "submit";
+    case LatencyStage::TOTAL: return "total";
+    default: return "?";
+    }
+}
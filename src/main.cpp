@@ -2,17 +2,29 @@
 #include <BleMouse.h>
 #include <FFat.h>
 #include "esp_core_dump.h"
+#include "esp_freertos_hooks.h"
 
 // #define PRO_FEATURES Only define this for MMPro (handled automatically by
 // platformio config when building project) wrap statements in #ifdef DEBUG
 // #endif to enable them only in debug builds
+#include "battery.h"
+#include "capture.h"
 #include "debug.h"
+#include "hid_transport.h"
+#include "input.h"
+#include "input_latency.h"
+#include "motion_checksum.h"
+#include "motion_engine.h"
+#include "mouse_output.h"
+#include "profiling.h"
 #include "sensor.h"
+#include "settings.h"
 #include "state.h"
 #include "taskwrapper.h"
+#include "timeline.h"
 #include "touch.h"
+#include "trace.h"
 #include "usb_classes.h"
-#include "button.h"
 #include "unit_testing.h"
 
 extern "C" {
@@ -23,7 +35,37 @@ extern "C" {
 
 BleMouse mouse("Mouseless Mouse " __TIME__, "The Mouseless Gang", 69U);
 
-Global<bool> mouseInitialized(false);
+BleTransport bleTransport(mouse);
+UsbTransport usbTransport;
+
+enum class TransportChoice : uint8_t { AUTO, BLE, USB };
+
+// Registered in setup; "auto" reports over USB while plugged in
+settings::Setting<std::string> mouseTransport;     // "auto", "ble" or "usb"
+std::atomic<TransportChoice> transportChoice(TransportChoice::AUTO);
+
+void applyTransportSetting() {
+    std::string choice = mouseTransport.get();
+    if (choice == "ble")
+        transportChoice = TransportChoice::BLE;
+    else if (choice == "usb")
+        transportChoice = TransportChoice::USB;
+    else {
+        if (choice != "auto")
+            Warn<TaskLog>().printf("Unknown mouse transport \"%s\", using auto\n", choice.c_str());
+        transportChoice = TransportChoice::AUTO;
+    }
+}
+
+MouseTransport& activeTransport() {
+    switch (transportChoice.load(std::memory_order_relaxed)) {
+    case TransportChoice::BLE: return bleTransport;
+    case TransportChoice::USB: return usbTransport;
+    default: return usbMounted ? static_cast<MouseTransport&>(usbTransport) : bleTransport;
+    }
+}
+
+MouseOutput mouseOutput(activeTransport);
 
 duk_context *duk;
 static duk_ret_t native_print(duk_context *ctx) {
@@ -32,6 +74,7 @@ static duk_ret_t native_print(duk_context *ctx) {
 }
 
 #ifdef PRO_FEATURES
+#include "3ml_jsalloc.h"
 #include "3ml_renderer.h"
 #include "display.h"
 
@@ -39,10 +82,19 @@ TFT_Parallel display(320, 170);
 
 threeml::Renderer renderer(&display);
 
+// Registered in setup; applied by a subscription whenever pages or the shell
+// change it.
+settings::Setting<double> backlight;
+
+void applyBacklight() {
+    display.set_backlight(constrain(backlight.get(), 0.0, 255.0));
+}
+
 auto drawTask = Task("Draw Task", 50000, 1, []() {
     uint32_t t = 0;
 
     display.init();
+    applyBacklight();
     display.setTextWrap(false);
 
     display.setTextColor(color_rgb(255, 255, 255));
@@ -84,51 +136,106 @@ auto drawTask = Task("Draw Task", 5000, 1, []() {
 
 #endif
 
-auto imuTask = Task("IMU Polling", 5000, 1, [](const uint16_t freq) {
-    const TickType_t delayTime = pdMS_TO_TICKS(1000 / freq);
-    Orientation cur;
-    if (!BNO086::init(false)) {
-        Error<TaskLog>().println("Failed to initialize BNO086");
+BNO086Source imuSource;
+ImuPipeline imuPipeline(imuSource);
+
+// Registered in setup. The engine is only touched by the IMU task, so
+// subscriptions just flag a change for it to pick up.
+settings::Setting<double> motionGain;           // Pixels per degree at low speed
+settings::Setting<double> motionAccel;          // Gain multiplier at and above accel_end_dps
+settings::Setting<double> motionAccelStart;
+settings::Setting<double> motionAccelEnd;
+settings::Setting<double> motionDeadZone;
+settings::Setting<bool> motionInvertX;
+settings::Setting<bool> motionInvertY;
+settings::Setting<std::string> motionFilter;    // "one_euro", "ema" or "none"
+settings::Setting<double> motionFilterMinCutoff;
+settings::Setting<double> motionFilterBeta;
+settings::Setting<double> motionFilterDerivativeCutoff;
+std::atomic<bool> motionSettingsChanged(true);
+
+void applyMotionSettings(MotionEngine& engine) {
+    const float gain = motionGain.get();
+    const CurvePoint curve[] = {
+        {0.f, gain},
+        {static_cast<float>(motionAccelStart.get()), gain},
+        {static_cast<float>(motionAccelEnd.get()), gain * static_cast<float>(motionAccel.get())},
+    };
+    if (!engine.setCurve(curve, sizeof(curve) / sizeof(curve[0])))
+        Warn<TaskLog>().println("Invalid acceleration curve");
+    engine.configure(MotionConfig{static_cast<float>(motionDeadZone.get()), motionInvertX.get(), motionInvertY.get()});
+
+    std::string filter = motionFilter.get();
+    FilterKind kind = FilterKind::ONE_EURO;
+    if (filter == "ema")
+        kind = FilterKind::EMA;
+    else if (filter == "none")
+        kind = FilterKind::NONE;
+    else if (filter != "one_euro")
+        Warn<TaskLog>().printf("Unknown motion filter \"%s\", using one_euro\n", filter.c_str());
+    engine.setFilter(FilterConfig{
+        kind,
+        static_cast<float>(motionFilterMinCutoff.get()),
+        static_cast<float>(motionFilterBeta.get()),
+        static_cast<float>(motionFilterDerivativeCutoff.get())
+    });
+}
+
+// Consumes samples as the reader task queues them
+auto imuTask = Task("IMU Samples", 5000, 1, []() {
+    if (!imuPipeline.start()) {
+        Error<TaskLog>().println("Failed to start the IMU reader");
         while (1) vTaskDelay(portMAX_DELAY);    // Keep the task alive so its log can be fetched
     }
-    // Error<TaskLog>().println("ughhhhh");
-    // vTaskDelay(portMAX_DELAY);
-    vTaskDelay(pdMS_TO_TICKS(100));
     uint32_t t = 0;
-    mouse.begin();
-    mouseInitialized = true;
+    bleTransport.begin();
+    usbTransport.begin();
+    if (!mouseOutput.start())
+        Error<TaskLog>().println("Failed to start the mouse output");
+    MotionEngine engine;
+    OrientationSample sample;
     while (1) {
-        TaskPrint().println("IMU Polling");
-        // cur = BNO086::poll();
-        // mouse.move(
-        //     clamp(-50, static_cast<int>(pow(cur.pitch, 3) / 60), 50),
-        //     clamp(-50, static_cast<int>(pow(cur.roll, 3) / 60), 50)
-        // );
+        if (!imuPipeline.pop(sample, portMAX_DELAY))
+            continue;
+        InputTimestamps timestamps{sample.sensorTime, sample.readTime, esp_timer_get_time(), 0, 0};
+        captureRecorder.addOrientation(sample);
+        if (motionSettingsChanged.exchange(false))
+            applyMotionSettings(engine);
+        TIMELINE_BEGIN("imu sample");
+        const Orientation& cur = sample.orientation;
+        TRACE("Roll: % 7.2f, Pitch: % 7.2f\n", cur.roll, cur.pitch);
+        MotionDelta delta = engine.update(cur.yaw, cur.pitch, sample.sensorTime);
+        timestamps.computed = esp_timer_get_time();
+        if (delta.dx || delta.dy)
+            mouseOutput.addMotion(delta.dx, delta.dy, timestamps);
+        TIMELINE_END("imu sample");
         // TaskPrint().println(mouse.isConnected() ? "Mouse connected" : "Mouse disconnected");
         if (++t % 32 == 0) {
             // TaskPrint().printf("Roll: % 7.2f, Pitch: % 7.2f, Yaw: % 7.2f\n", cur.roll, cur.pitch, cur.yaw);
         }
-        vTaskDelay(pdMS_TO_TICKS(10));
     }
 });
 
-auto touchTask = Task("Touch Reporting", 4000, 1, []() {
-    TouchPads::init<TOUCH_PAD_NUM1, TOUCH_PAD_NUM2>(60000);
-    while (1) {
-        static uint32_t result1;
-        touch_pad_read_raw_data(TOUCH_PAD_NUM1, &result1);
-        TaskPrint().printf("Touch State: %i %i\n",
-            TouchPads::status[TOUCH_PAD_NUM1],
-            TouchPads::status[TOUCH_PAD_NUM2]
-        );
-        if (mouseInitialized && TouchPads::status[TOUCH_PAD_NUM1]) {
-            mouse.press(MOUSE_LEFT);
-        }
-        else if (mouseInitialized) {
-            mouse.release(MOUSE_LEFT);
-        }
-        vTaskDelay(pdMS_TO_TICKS(500));
+#ifdef PRO_FEATURES
+Button upButton(UP_BUTTON_PIN, true);
+Button downButton(DOWN_BUTTON_PIN, true);
+#endif
+
+const char *gestureName(Gesture gesture) {
+    switch (gesture) {
+    case Gesture::CLICK: return "click";
+    case Gesture::DOUBLE_CLICK: return "double click";
+    case Gesture::DRAG_START: return "drag start";
+    case Gesture::DRAG_END: return "drag end";
+    default: return "?";
     }
+}
+
+// Turns button and touch pad edges into input events for the subscribers.
+// Sleeps until an interrupt queues an edge or something held comes due.
+auto inputTask = Task("Input", 4000, 3, []() {
+    TouchPads::init<TOUCH_PAD_NUM1, TOUCH_PAD_NUM2>(60000);
+    inputHub.run();
 });
 
 #ifdef PRO_FEATURES
@@ -172,8 +279,13 @@ void treeList(File &dir, int level = 0) {
 }
 
 void getTaskLog(const std::vector<const char*>& args) {
+    if (args.empty()) {
+        USBSerial.printf("Task logs (%u bytes each):\n", TASK_LOG_SIZE);
+        TaskLog::printSummary(USBSerial);
+        return;
+    }
     if (args.size() != 1) {
-        USBSerial.println("Expected 1 argument");
+        USBSerial.println("Expected 0 or 1 arguments");
         return;
     }
     const char *target = args.front();
@@ -181,18 +293,14 @@ void getTaskLog(const std::vector<const char*>& args) {
         USBSerial.printf("Error: Maximum task name length is %i characters\n", configMAX_TASK_NAME_LEN - 1);
         return;
     }
-    TaskHandle_t status = xTaskGetHandle(target);
-    if (!status) {
-        if (strcmp("timer", target) != 0) {
-            USBSerial.printf("Status '%s' not found\n", target);
-            return;
-        }
-        else {
-            status = xTimerGetTimerDaemonTaskHandle();
-        }
+    if (strcmp("timer", target) == 0) {
+        target = pcTaskGetName(xTimerGetTimerDaemonTaskHandle());
     }
+    // Logs outlive their tasks, so look them up by name alone
     USBSerial.println("Log entries:");
-    USBSerial.print(TaskLog(status).get().c_str()); // Log should end with newline
+    if (!TaskLog::dump(target, USBSerial)) {
+        USBSerial.printf("No log for task '%s'\n", target);
+    }
 }
 
 void toggleMonitor(const std::vector<const char*>& args) {
@@ -238,6 +346,9 @@ void systemStatus(const std::vector<const char *> &args) {
     USBSerial.printf("Free SPIRAM heam: %i\n", heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
     USBSerial.printf("Minium free SPIRAM heap reached: %i\n", heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
     USBSerial.printf("Largest free SPIRAM heap block: %i\n", heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
+#ifdef PRO_FEATURES
+    threeml::print_js_pool_stats(USBSerial);
+#endif
 }
 
 void treeCmd(const std::vector<const char *> &args) {
@@ -304,6 +415,470 @@ void getCrashReason(const std::vector<const char*>& args) {
     USBSerial.println();
 }
 
+#if configUSE_TRACE_FACILITY
+#define TOP_MAX_TASKS 40    // Tasks a core's tick samples can tell apart
+
+struct TaskSample {
+    std::vector<TaskStatus_t> tasks;
+    size_t freeHeap;
+};
+
+void sampleTasks(TaskSample& sample) {
+    sample.tasks.resize(uxTaskGetNumberOfTasks() + 4);
+    sample.tasks.resize(uxTaskGetSystemState(sample.tasks.data(), sample.tasks.size(), nullptr));
+    sample.freeHeap = xPortGetFreeHeapSize();
+}
+
+// CPU use, estimated from which task each core's tick interrupt finds
+// running. FreeRTOS run-time stats would be exact, but the Arduino core is
+// built without them. Each core's samples are written only by its own
+// tick hook, and a task keeps its slot until `top` starts over.
+struct TickSamples {
+    std::atomic<TaskHandle_t> tasks[TOP_MAX_TASKS];
+    std::atomic<uint32_t> ticks[TOP_MAX_TASKS];
+    std::atomic<uint32_t> total;
+};
+TickSamples tickSamples[portNUM_PROCESSORS];
+
+template <UBaseType_t core>
+void IRAM_ATTR sampleTick() {
+    TickSamples& samples = tickSamples[core];
+    TaskHandle_t running = xTaskGetCurrentTaskHandleForCPU(core);
+    samples.total.store(samples.total.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    for (size_t i = 0; i < TOP_MAX_TASKS; ++i) {
+        TaskHandle_t task = samples.tasks[i].load(std::memory_order_relaxed);
+        if (!task)
+            samples.tasks[i].store(running, std::memory_order_release);
+        if (!task || task == running) {
+            samples.ticks[i].store(samples.ticks[i].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+const esp_freertos_tick_cb_t tickHooks[] = {sampleTick<0>, sampleTick<1>};
+static_assert(sizeof(tickHooks) / sizeof(tickHooks[0]) >= portNUM_PROCESSORS, "A tick hook for every core");
+
+// A copy of the tick samples at the end of a window
+struct TickSnapshot {
+    TaskHandle_t tasks[portNUM_PROCESSORS][TOP_MAX_TASKS];
+    uint32_t ticks[portNUM_PROCESSORS][TOP_MAX_TASKS];
+    uint32_t total[portNUM_PROCESSORS];
+
+    void take() {
+        for (UBaseType_t core = 0; core < portNUM_PROCESSORS; ++core) {
+            const TickSamples& samples = tickSamples[core];
+            total[core] = samples.total.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < TOP_MAX_TASKS; ++i) {
+                tasks[core][i] = samples.tasks[i].load(std::memory_order_acquire);
+                ticks[core][i] = samples.ticks[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Ticks `task` was found running on `core` since `before`
+    uint32_t since(const TickSnapshot& before, UBaseType_t core, TaskHandle_t task) const {
+        for (size_t i = 0; i < TOP_MAX_TASKS && tasks[core][i]; ++i) {
+            if (tasks[core][i] == task)
+                return ticks[core][i] - (before.tasks[core][i] ? before.ticks[core][i] : 0);
+        }
+        return 0;
+    }
+
+    // The same, on any core
+    uint32_t since(const TickSnapshot& before, TaskHandle_t task) const {
+        uint32_t sum = 0;
+        for (UBaseType_t core = 0; core < portNUM_PROCESSORS; ++core)
+            sum += since(before, core, task);
+        return sum;
+    }
+};
+
+// Prints one line of a `top` frame, clearing whatever the last frame left there
+void topLine(size_t& lines, const char *fmt, ...) {
+    char line[128];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    USBSerial.printf("\e[2K%s\n", line);
+    ++lines;
+}
+#endif
+
+void topCmd(const std::vector<const char*>& args) {
+#if configUSE_TRACE_FACILITY
+    if (args.size() > 2) {
+        USBSerial.println("Expected [window in ms] [number of refreshes]; CPU use is sampled at every tick");
+        return;
+    }
+    uint32_t windowMs = args.size() > 0 ? strtoul(args[0], nullptr, 10) : 1000;
+    uint32_t refreshes = args.size() > 1 ? strtoul(args[1], nullptr, 10) : 5;
+    if (windowMs < 100 || refreshes == 0) {
+        USBSerial.println("The window must be at least 100 ms, with at least 1 refresh");
+        return;
+    }
+
+    for (TickSamples& samples : tickSamples) {
+        samples.total = 0;
+        for (size_t i = 0; i < TOP_MAX_TASKS; ++i) {
+            samples.tasks[i] = nullptr;
+            samples.ticks[i] = 0;
+        }
+    }
+    for (UBaseType_t core = 0; core < portNUM_PROCESSORS; ++core) {
+        if (esp_register_freertos_tick_hook_for_cpu(tickHooks[core], core) != ESP_OK) {
+            USBSerial.println("No room for another tick hook");
+            while (core--)
+                esp_deregister_freertos_tick_hook_for_cpu(tickHooks[core], core);
+            return;
+        }
+    }
+
+    static const char *states[] = {"run", "ready", "block", "susp", "del", "?"};
+    TaskSample before, after;
+    TickSnapshot ticksBefore, ticksAfter;
+    sampleTasks(before);
+    ticksBefore.take();
+    size_t lines = 0;
+    for (uint32_t refresh = 1; refresh <= refreshes; ++refresh) {
+        vTaskDelay(pdMS_TO_TICKS(windowMs));
+        sampleTasks(after);
+        ticksAfter.take();
+        // Percentages are of one core, as the ticks of one core add up to 100
+        uint32_t elapsed = ticksAfter.total[0] - ticksBefore.total[0];
+        if (elapsed == 0)
+            elapsed = 1;
+        std::sort(after.tasks.begin(), after.tasks.end(), [&](const TaskStatus_t& a, const TaskStatus_t& b) {
+            return ticksAfter.since(ticksBefore, a.xHandle) > ticksAfter.since(ticksBefore, b.xHandle);
+        });
+
+        // Redraw over the previous frame
+        if (lines)
+            USBSerial.printf("\e[%uA", lines);
+        lines = 0;
+        topLine(lines, "top - %u ms window, refresh %u of %u", windowMs, refresh, refreshes);
+        for (UBaseType_t core = 0; core < portNUM_PROCESSORS; ++core) {
+            uint32_t idle = ticksAfter.since(ticksBefore, core, xTaskGetIdleTaskHandleForCPU(core));
+            uint32_t ticks = ticksAfter.total[core] - ticksBefore.total[core];
+            topLine(lines, "Core %u: %5.1f%% busy", core, ticks ? 100.0 - 100.0 * idle / ticks : 0.0);
+        }
+        topLine(lines, "Heap: %u bytes free (%+d), internal %u free, minimum ever %u", after.freeHeap, (int)(after.freeHeap - before.freeHeap), heap_caps_get_free_size(MALLOC_CAP_INTERNAL), esp_get_minimum_free_heap_size());
+        topLine(lines, "");
+        topLine(lines, "%-16s %4s %3s %-5s %6s %13s", "Task", "Core", "Pri", "State", "CPU%", "Stack free");
+        for (const TaskStatus_t& task : after.tasks) {
+            BaseType_t affinity = xTaskGetAffinity(task.xHandle);
+            char core[4];
+            snprintf(core, sizeof(core), affinity == tskNO_AFFINITY ? "*" : "%d", affinity);
+            char stack[16];
+            configSTACK_DEPTH_TYPE depth = taskStackDepth(task.pcTaskName);
+            if (depth)
+                snprintf(stack, sizeof(stack), "%u/%u", task.usStackHighWaterMark, depth);
+            else
+                snprintf(stack, sizeof(stack), "%u/?", task.usStackHighWaterMark);
+            topLine(lines, "%-16s %4s %3u %-5s %6.1f %13s", task.pcTaskName, core, task.uxCurrentPriority, states[std::min<int>(task.eCurrentState, 5)],
+                100.0 * ticksAfter.since(ticksBefore, task.xHandle) / elapsed, stack);
+        }
+        // Erase what's left of a longer previous frame
+        USBSerial.print("\e[J");
+        std::swap(before, after);
+        std::swap(ticksBefore, ticksAfter);
+    }
+    for (UBaseType_t core = 0; core < portNUM_PROCESSORS; ++core)
+        esp_deregister_freertos_tick_hook_for_cpu(tickHooks[core], core);
+#else
+    USBSerial.println("FreeRTOS trace facility is disabled in this build");
+#endif
+}
+
+void shellStatus(const std::vector<const char*>& args) {
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments");
+        return;
+    }
+    Shell::Stats stats = Shell::stats();
+    USBSerial.printf("Commands run: %u, dropped: %u (queue depth %u)\n", stats.commands, stats.dropped, SHELL_QUEUE_DEPTH);
+    USBSerial.printf("Dispatch latency: %lld us (mean %lld us, max %lld us)\n", stats.lastLatencyUs, stats.commands ? stats.totalLatencyUs / stats.commands : 0, stats.maxLatencyUs);
+}
+
+void serialStatus(const std::vector<const char*>& args) {
+    if (args.size() == 1 && strcmp(args[0], "reset") == 0) {
+        USBSerial.resetStats();
+        return;
+    }
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments or \"reset\"");
+        return;
+    }
+    BufferedCDC::Stats stats = USBSerial.stats();
+    int64_t elapsed = esp_timer_get_time() - stats.since;
+    USBSerial.printf("Queued: %u bytes, sent: %u bytes in %u USB writes (%u bytes each)\n", stats.bytesQueued, stats.bytesSent, stats.usbWrites, stats.usbWrites ? stats.bytesSent / stats.usbWrites : 0);
+    USBSerial.printf("Dropped (queue full): %u bytes\n", stats.bytesDropped);
+    USBSerial.printf("Peak queue fill: %u of %u bytes\n", stats.peakFill, SERIAL_OUT_BUFFER_SIZE);
+    USBSerial.printf("Throughput: %.1f bytes/s over %.1f s\n", elapsed ? stats.bytesSent * 1e6 / elapsed : 0.0, elapsed / 1e6);
+}
+
+#ifdef BINARY_TRACE
+void traceCmd(const std::vector<const char*>& args) {
+    if (args.size() == 1 && strcmp(args[0], "dump") == 0) {
+        trace::dump(USBSerial);
+        return;
+    }
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments or \"dump\"");
+        return;
+    }
+    trace::print_stats(USBSerial);
+}
+#endif
+
+void printPipelineStats(const ImuPipeline& pipeline) {
+    ImuPipeline::Stats stats = pipeline.stats();
+    const LatencyHistogram& latency = pipeline.latency();
+    USBSerial.printf("Samples: %u queued, %u dropped (queue full), %u reads, peak queue depth %u of %u\n", stats.samples, stats.dropped, stats.reads, stats.peakDepth, IMU_QUEUE_LENGTH);
+    USBSerial.printf("Sensor to consumer: p50 %u us, p90 %u us, p99 %u us, max %u us over %u samples\n", latency.percentile(50), latency.percentile(90), latency.percentile(99), latency.max(), latency.samples());
+}
+
+void imuStatus(const std::vector<const char*>& args) {
+    if (args.size() == 1 && strcmp(args[0], "reset") == 0) {
+        imuPipeline.resetStats();
+        return;
+    }
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments or \"reset\"");
+        return;
+    }
+    printPipelineStats(imuPipeline);
+}
+
+void latencyCmd(const std::vector<const char*>& args) {
+    if (args.size() == 1 && strcmp(args[0], "reset") == 0) {
+        inputLatency.reset();
+        mouseOutput.resetStats();
+        return;
+    }
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments or \"reset\"");
+        return;
+    }
+    inputLatency.print(USBSerial);
+    ReportScheduler::Stats reports = mouseOutput.stats();
+    USBSerial.printf("Scheduler: %u reports sent over %s, %u updates merged, %u split, %u times a button change waited for a free segment\n",
+        reports.reports, activeTransport().name(), reports.merged, reports.splits, reports.buttonOverflows);
+}
+
+void touchStatus(const std::vector<const char*>& args) {
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments");
+        return;
+    }
+    TouchPads::Stats pads = TouchPads::stats();
+    GestureDetector::Stats gestures = inputHub.gestureStats();
+    USBSerial.printf("Pads: %u edges, %u lost to a full queue, touched now: 0x%x\n", pads.edges, pads.overflows, TouchPads::status.getBits());
+    USBSerial.printf("Gestures: %u clicks, %u double clicks, %u drags\n", gestures.clicks, gestures.doubleClicks, gestures.drags);
+}
+
+void inputStatus(const std::vector<const char*>& args) {
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments");
+        return;
+    }
+    InputHub::Stats stats = inputHub.stats();
+    USBSerial.printf("Events to %u subscribers:", stats.subscribers);
+    for (size_t i = 0; i < static_cast<size_t>(InputType::COUNT); ++i)
+        USBSerial.printf(" %u %s", stats.events[i], inputTypeName(static_cast<InputType>(i)));
+    USBSerial.println();
+    for (size_t i = 0; i < inputHub.buttonCount(); ++i) {
+        const Button& button = inputHub.button(i);
+        USBSerial.printf("Button %d: %s, %u bounces ignored, %u edges lost to a full queue\n",
+            button.getPin(), button.isPressed() ? "pressed" : "released", button.bounces(), button.lostEdges());
+    }
+}
+
+void batteryStatus(const std::vector<const char*>& args) {
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments");
+        return;
+    }
+    if (!battery::available()) {
+        USBSerial.println("No battery to measure on this board");
+        return;
+    }
+    battery::sampler_stats_t stats = battery::stats();
+    USBSerial.printf("Battery: %.3f V, %.1f%% (showing %u%%)\n", battery::get_voltage(), battery::get_level(), battery::get_percent());
+    USBSerial.printf("Sampler: %u readings from %u conversions, last burst %u us with %u mV spread, %u changes shown\n",
+        stats.readings, stats.conversions, stats.last_burst_us, stats.spread_mv, stats.notifications);
+}
+
+void recordCmd(const std::vector<const char*>& args) {
+    if (args.size() == 1 && strcmp(args[0], "stop") == 0) {
+        captureRecorder.stop();
+        return;
+    }
+    if (args.size() > 2) {
+        USBSerial.println("Expected no arguments, \"stop\" or <seconds> [path]");
+        return;
+    }
+    if (!args.empty()) {
+        uint32_t seconds = strtoul(args[0], nullptr, 10);
+        const char *path = args.size() == 2 ? args[1] : CAPTURE_DEFAULT_PATH;
+        if (seconds == 0 || seconds > CAPTURE_MAX_SECONDS)
+            USBSerial.printf("Expected between 1 and %u seconds\n", CAPTURE_MAX_SECONDS);
+        else if (!captureRecorder.start(path, seconds))
+            USBSerial.printf("Could not start recording to %s\n", path);
+        else
+            USBSerial.printf("Recording %u s to %s\n", seconds, path);
+        return;
+    }
+    CaptureRecorder::Stats stats = captureRecorder.stats();
+    if (stats.path.empty()) {
+        USBSerial.println("Nothing recorded yet");
+        return;
+    }
+    USBSerial.printf("%s %s: %u records, %u bytes in %.1f s, %u dropped%s\n", stats.recording ? "Recording" : "Recorded", stats.path.c_str(), stats.records, stats.bytesWritten, stats.elapsedUs / 1e6, stats.dropped, stats.writeFailed ? ", write failed" : "");
+}
+
+// Feeds a capture through a pipeline and motion engine of its own, using
+// the current motion settings, in real time
+void replayCmd(const std::vector<const char*>& args) {
+    if (args.size() > 1) {
+        USBSerial.println("Expected no arguments or a path");
+        return;
+    }
+    const char *path = args.empty() ? CAPTURE_DEFAULT_PATH : args[0];
+    std::vector<uint8_t> capture;
+    if (!loadCapture(path, capture)) {
+        USBSerial.printf("Could not read %s\n", path);
+        return;
+    }
+    if (!CaptureReader(capture.data(), capture.size()).valid()) {
+        USBSerial.printf("%s is not a capture\n", path);
+        return;
+    }
+    ReplaySource source(capture.data(), capture.size());
+    ImuPipeline pipeline(source);
+    MotionEngine engine;
+    applyMotionSettings(engine);
+    if (!pipeline.start()) {
+        USBSerial.println("Failed to start the reader");
+        return;
+    }
+
+    OrientationSample sample;
+    uint32_t samples = 0;
+    int32_t sumX = 0, sumY = 0, largest = 0;
+    uint32_t travel = 0;
+    uint32_t checksum = MOTION_CHECKSUM_SEED;   // Comparable with tools/motion/replay_test
+    while (true) {
+        if (!pipeline.pop(sample, pdMS_TO_TICKS(100))) {
+            if (source.finished())
+                break;
+            continue;
+        }
+        MotionDelta delta = engine.update(sample.orientation.yaw, sample.orientation.pitch, sample.sensorTime);
+        ++samples;
+        sumX += delta.dx;
+        sumY += delta.dy;
+        travel += std::abs(delta.dx) + std::abs(delta.dy);
+        largest = std::max(largest, std::max(std::abs(delta.dx), std::abs(delta.dy)));
+        checksum = motionChecksum(checksum, delta.dx, delta.dy);
+    }
+    pipeline.stop();
+    if (!samples) {
+        USBSerial.printf("%s has no samples\n", path);
+        return;
+    }
+    USBSerial.printf("%u samples: net (%i, %i) px, travel %u px, largest step %i px, checksum %08x\n", samples, sumX, sumY, travel, largest, checksum);
+    printPipelineStats(pipeline);
+}
+
+void timelineCmd(const std::vector<const char*>& args) {
+    if (args.size() == 1 && strcmp(args[0], "start") == 0) {
+        if (!timeline::start())
+            USBSerial.println("Not enough memory for the timeline");
+        return;
+    }
+    if (args.size() == 1 && strcmp(args[0], "stop") == 0) {
+        timeline::stop();
+        return;
+    }
+    // Save everything from the opening brace to the closing one as a .json
+    // file and open it in chrome://tracing or ui.perfetto.dev
+    if (args.size() == 1 && strcmp(args[0], "dump") == 0) {
+        timeline::dump(USBSerial);
+        return;
+    }
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments, \"start\", \"stop\" or \"dump\"");
+        return;
+    }
+    timeline::print_stats(USBSerial);
+}
+
+#ifdef PROFILING
+void profileCmd(const std::vector<const char*>& args) {
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments");
+        return;
+    }
+    Profiling::printAndReset(USBSerial);
+}
+#endif
+
+void settingsCmd(const std::vector<const char*>& args) {
+    if (args.size() == 1 && strcmp(args[0], "flush") == 0) {
+        settings::flush();
+        return;
+    }
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments or \"flush\"");
+        return;
+    }
+    settings::print(USBSerial);
+    settings::store_stats_t stats = settings::stats();
+    USBSerial.printf("Loaded %u records (%u bytes) in %lld us\n", stats.records_loaded, stats.load_bytes, stats.load_us);
+    USBSerial.printf("Log size: %u bytes (%u live)\n", stats.log_bytes, stats.live_bytes);
+    USBSerial.printf("Updates: %u (%u bytes if each were written)\n", stats.updates, stats.update_bytes);
+    USBSerial.printf("Flushes: %u, records written: %u, compactions: %u\n", stats.flushes, stats.records_written, stats.compactions);
+    USBSerial.printf("Bytes written: %u (write amplification %.2f)\n", stats.bytes_written, stats.update_bytes ? (double)stats.bytes_written / stats.update_bytes : 0.0);
+    USBSerial.printf("Changes delivered to subscribers: %u (%u coalesced)\n", stats.changes_delivered, stats.changes_coalesced);
+    if (stats.write_errors) {
+        USBSerial.printf("Write errors: %u\n", stats.write_errors);
+    }
+}
+
+#ifdef PRO_FEATURES
+void jsStatus(const std::vector<const char*>& args) {
+    if (args.size() == 1 && strcmp(args[0], "reset") == 0) {
+        renderer.reset_frame_stats();
+        return;
+    }
+    if (!args.empty()) {
+        USBSerial.println("Expected no arguments or \"reset\"");
+        return;
+    }
+    const threeml::JSExecutor &js = renderer.js_executor();
+    const threeml::js_stats_t &stats = js.stats();
+    USBSerial.printf("Events handled: %u\n", stats.events_handled);
+    USBSerial.printf("Events dropped (queue full): %u\n", stats.events_dropped.load());
+    USBSerial.printf("Events discarded (page unloaded): %u\n", stats.events_stale);
+    USBSerial.printf("Queue depth: %u (max %u of %u)\n", js.queue_depth(), stats.max_queue_depth, JS_EVENT_QUEUE_DEPTH);
+    USBSerial.printf("Mean event latency: %lld us\n", stats.events_handled ? stats.total_latency_us / stats.events_handled : 0);
+    USBSerial.printf("Max event latency: %lld us\n", stats.max_latency_us);
+    USBSerial.printf("DOM commits: %u\n", stats.commits);
+    USBSerial.printf("Page script load time: %lld us (max %lld us)\n", stats.last_load_us, stats.max_load_us);
+    USBSerial.printf("Heap creation: %lld us, %u bytes\n", stats.heap_create_us, stats.empty_heap_bytes);
+    uint32_t collections = stats.idle_collections + stats.forced_collections;
+    USBSerial.printf("Garbage collections: %u idle, %u forced\n", stats.idle_collections, stats.forced_collections);
+    USBSerial.printf("Mean GC time: %lld us (max %lld us)\n", collections ? stats.total_gc_us / collections : 0, stats.max_gc_us);
+    const threeml::frame_stats_t &frames = renderer.frame_stats();
+    USBSerial.printf("Frame time: %lld us (worst %lld us over %u frames)\n", frames.last_frame_us, frames.max_frame_us, frames.frames);
+    USBSerial.printf("Button events dropped: %u\n", frames.dropped_inputs.load());
+    USBSerial.println("Handlers by page:");
+    renderer.js_executor().print_page_stats(USBSerial);
+}
+#endif
+
 }   // namespace ShellCommands
 
 auto deferredPrinter = Task("Shell Greeter", 3000, 1, [](){
@@ -334,6 +909,281 @@ void setup() {
     });
 #endif
 
+#ifdef BINARY_TRACE
+    UnitTest::add("trace", []() {
+        const int iterations = 1000;
+        float roll = 12.5f, pitch = -3.25f;
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < iterations; ++i)
+            TaskLog().printf("Roll: % 7.2f, Pitch: % 7.2f, Sample: %i\n", roll, pitch, i);
+        int64_t text = esp_timer_get_time() - start;
+        start = esp_timer_get_time();
+        for (int i = 0; i < iterations; ++i)
+            TRACE("Roll: % 7.2f, Pitch: % 7.2f, Sample: %i\n", roll, pitch, i);
+        int64_t binary = esp_timer_get_time() - start;
+        USBSerial.printf("TaskLog: %.2f us per message, TRACE: %.2f us per record\n", (double)text / iterations, (double)binary / iterations);
+    });
+#endif
+
+    // Runs a second pipeline from a synthetic source at 200 Hz for two seconds
+    UnitTest::add("imu", []() {
+        SyntheticSource source(200);
+        ImuPipeline pipeline(source);
+        if (!pipeline.start()) {
+            USBSerial.println("Failed to start the reader");
+            return;
+        }
+        OrientationSample sample;
+        int64_t end = esp_timer_get_time() + 2000000;
+        while (esp_timer_get_time() < end)
+            pipeline.pop(sample, pdMS_TO_TICKS(100));
+        pipeline.stop();
+        ShellCommands::printPipelineStats(pipeline);
+    });
+
+    // Checks the motion engine against a generated trace, then times it
+    UnitTest::add("motion", []() {
+        const CurvePoint flat[] = {{0.f, 10.f}};
+        const int64_t period = 5000;    // 200 Hz
+        MotionEngine engine;
+        engine.setCurve(flat, 1);
+
+        // A slow turn of 0.002 degrees per sample is 0.02 pixels per sample,
+        // which rounding per sample would lose entirely
+        int32_t total = 0;
+        for (int i = 0; i <= 1000; ++i)
+            total += engine.update(-0.002f * i, 0.f, i * period).dx;
+        USBSerial.printf("Slow turn: %i pixels, expected 20: %s\n", total, total == 20 || total == 19 ? "pass" : "FAIL");
+
+        // Crossing the ±180 degree heading seam must not jump
+        engine.reset();
+        int32_t largest = 0;
+        for (int i = 0; i <= 100; ++i) {
+            float yaw = 179.f - 0.02f * i;
+            MotionDelta delta = engine.update(yaw > 180.f ? yaw - 360.f : yaw, 0.f, i * period);
+            largest = std::max(largest, std::abs(delta.dx));
+        }
+        engine.reset();
+        for (int i = 0; i <= 100; ++i) {
+            float yaw = 179.f + 0.02f * i;
+            MotionDelta delta = engine.update(yaw > 180.f ? yaw - 360.f : yaw, 0.f, i * period);
+            largest = std::max(largest, std::abs(delta.dx));
+        }
+        USBSerial.printf("Heading seam: largest step %i pixels: %s\n", largest, largest <= 1 ? "pass" : "FAIL");
+
+        // Tremor of ±0.005 degrees at 200 Hz is 2 deg/s, inside a 3 deg/s dead zone
+        engine.reset();
+        engine.configure(MotionConfig{3.f, false, false});
+        int32_t moved = 0;
+        for (int i = 0; i <= 1000; ++i) {
+            MotionDelta delta = engine.update(i % 2 ? 0.005f : -0.005f, 0.f, i * period);
+            moved += std::abs(delta.dx) + std::abs(delta.dy);
+        }
+        USBSerial.printf("Tremor in dead zone: %i pixels: %s\n", moved, moved == 0 ? "pass" : "FAIL");
+
+        // At rest the One-Euro filter should take out most of a ±0.02 degree
+        // tremor, and it must follow a turn across the heading seam
+        MotionFilter filter;
+        filter.configure(FilterConfig{FilterKind::ONE_EURO, 1.f, 0.2f, 1.f});
+        q16_t lowest = INT32_MAX, highest = INT32_MIN;
+        for (int i = 0; i <= 400; ++i) {
+            q16_t yaw = toQ16(i % 2 ? 10.02f : 9.98f), pitch = 0;
+            filter.update(yaw, pitch, i * period);
+            if (i >= 200) {
+                lowest = std::min(lowest, yaw);
+                highest = std::max(highest, yaw);
+            }
+        }
+        float spread = fromQ16(highest - lowest);
+        USBSerial.printf("Filtered tremor: %.4f degrees of 0.04: %s\n", spread, spread < 0.01f ? "pass" : "FAIL");
+        filter.reset();
+        q16_t previous = 0, steepest = 0;
+        for (int i = 0; i <= 200; ++i) {
+            float raw = 170.f + 0.1f * i;
+            q16_t yaw = toQ16(raw > 180.f ? raw - 360.f : raw), pitch = 0;
+            filter.update(yaw, pitch, i * period);
+            if (i > 0) {
+                q16_t step = yaw - previous;
+                if (step < -180 * Q16_ONE)
+                    step += 360 * Q16_ONE;
+                steepest = std::max(steepest, static_cast<q16_t>(std::abs(step)));
+            }
+            previous = yaw;
+        }
+        USBSerial.printf("Filtered heading seam: largest step %.3f degrees: %s\n", fromQ16(steepest), fromQ16(steepest) < 0.2f ? "pass" : "FAIL");
+
+        const int iterations = 10000;
+        engine.configure(MotionConfig{0.f, false, false});
+        for (FilterKind kind : {FilterKind::NONE, FilterKind::ONE_EURO}) {
+            engine.reset();
+            engine.setFilter(FilterConfig{kind, 1.f, 0.2f, 1.f});
+            volatile int32_t sink = 0;
+            int64_t start = esp_timer_get_time();
+            for (int i = 0; i < iterations; ++i)
+                sink += engine.update(0.37f * (i % 97), 0.11f * (i % 89), i * period).dx;
+            int64_t elapsed = esp_timer_get_time() - start;
+            USBSerial.printf("%.2f us per sample %s\n", (double)elapsed / iterations, kind == FilterKind::NONE ? "unfiltered" : "with One-Euro");
+        }
+    });
+
+    // Runs the report scheduler against a simulated transport clock
+    UnitTest::add("reports", []() {
+        // A delta too large for one report is split, not clamped
+        SimulatedTransport usb(1000);
+        ReportScheduler scheduler;
+        scheduler.addMotion(1000, -300);
+        for (int us = 0; us < 20000 && scheduler.pending(); us += 250, usb.advance(250))
+            scheduler.flush(usb);
+        int32_t sumX = 0, sumY = 0;
+        for (const SimulatedTransport::Sent& sent : usb.reports()) {
+            sumX += sent.report.x;
+            sumY += sent.report.y;
+        }
+        USBSerial.printf("Split: %u reports moving %i, %i: %s\n", usb.reports().size(), sumX, sumY,
+            usb.reports().size() == 8 && sumX == 1000 && sumY == -300 ? "pass" : "FAIL");
+
+        // A click shorter than a slot still gets a press and a release, each
+        // with the motion from while it lasted
+        SimulatedTransport link(1000);
+        scheduler = ReportScheduler();
+        scheduler.addMotion(5, 0);
+        scheduler.flush(link);
+        scheduler.addMotion(3, 0);
+        scheduler.setButtons(MOUSE_LEFT);
+        scheduler.addMotion(2, 0);
+        scheduler.setButtons(0);
+        scheduler.addMotion(1, 0);
+        for (int us = 0; us < 10000 && scheduler.pending(); us += 250, link.advance(250))
+            scheduler.flush(link);
+        const MouseReport expected[] = {{0, 5, 0, 0}, {0, 3, 0, 0}, {MOUSE_LEFT, 2, 0, 0}, {0, 1, 0, 0}};
+        bool ordered = link.reports().size() == 4;
+        for (size_t i = 0; ordered && i < 4; ++i)
+            ordered = link.reports()[i].report.buttons == expected[i].buttons && link.reports()[i].report.x == expected[i].x;
+        USBSerial.printf("Short click: %u reports: %s\n", link.reports().size(), ordered ? "pass" : "FAIL");
+
+        // 200 Hz of motion through 7.5 ms slots merges without losing any
+        SimulatedTransport ble(7500);
+        scheduler = ReportScheduler();
+        int32_t in = 0, out = 0;
+        for (int us = 0; us < 1000000; us += 250, ble.advance(250)) {
+            if (us % 5000 == 0) {
+                int32_t dx = static_cast<int32_t>(esp_random() % 81) - 40;
+                scheduler.addMotion(dx, 0);
+                in += dx;
+            }
+            scheduler.flush(ble);
+        }
+        for (int us = 0; us < 100000 && scheduler.pending(); us += 250, ble.advance(250))
+            scheduler.flush(ble);
+        for (const SimulatedTransport::Sent& sent : ble.reports())
+            out += sent.report.x;
+        USBSerial.printf("Merged: %i in, %i out in %u reports, %u updates merged: %s\n", in, out, ble.reports().size(),
+            scheduler.stats().merged, in == out && ble.reports().size() <= 135 ? "pass" : "FAIL");
+    });
+
+    // Feeds made up touch edges through a gesture detector
+    UnitTest::add("touch", []() {
+        GestureDetector detector;
+        GestureEvent events[GESTURE_MAX_EVENTS];
+        Gesture seen[8];
+        size_t total = 0;
+        auto feed = [&](bool pressed, int64_t timeUs) {
+            size_t count = detector.edge(1, pressed, timeUs, events);
+            for (size_t i = 0; i < count && total < 8; ++i)
+                seen[total++] = events[i].gesture;
+        };
+        feed(true, 0);              // Click
+        feed(false, 100000);
+        feed(true, 300000);         // Double click
+        feed(false, 350000);
+        feed(true, 2000000);        // Held into a drag
+        bool deadline = detector.nextDeadline() == 2000000 + GESTURE_CLICK_MAX_US;
+        size_t count = detector.tick(2400000, events);
+        for (size_t i = 0; i < count && total < 8; ++i)
+            seen[total++] = events[i].gesture;
+        feed(false, 3000000);
+        const Gesture expected[] = {Gesture::CLICK, Gesture::DOUBLE_CLICK, Gesture::DRAG_START, Gesture::DRAG_END};
+        bool match = deadline && total == 4;
+        for (size_t i = 0; match && i < 4; ++i)
+            match = seen[i] == expected[i];
+        USBSerial.printf("Click, double click, drag: %u gestures: %s\n", total, match ? "pass" : "FAIL");
+    });
+
+    // Feeds made up button edges through a key tracker
+    UnitTest::add("input", []() {
+        InputEvent events[KEY_MAX_EVENTS];
+        InputType seen[8];
+        size_t total = 0;
+        uint32_t steps = 0;
+        auto record = [&](size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                if (events[i].type == InputType::BUTTON_REPEAT)
+                    steps += events[i].value;
+                else if (total < 8)
+                    seen[total++] = events[i].type;
+            }
+        };
+        KeyTracker key(UP_BUTTON_PIN, true);
+        record(key.edge(true, 0, events));          // A bouncy click
+        record(key.edge(false, 2000, events));
+        record(key.edge(true, 4000, events));
+        record(key.tick(true, KEY_DEBOUNCE_US, events));
+        record(key.edge(false, 100000, events));
+        record(key.edge(true, 1000000, events));    // A hold
+        record(key.edge(false, 1600000, events));
+        const InputType expected[] = {
+            InputType::BUTTON_PRESS, InputType::BUTTON_CLICK, InputType::BUTTON_RELEASE,
+            InputType::BUTTON_PRESS, InputType::BUTTON_HOLD, InputType::BUTTON_RELEASE,
+        };
+        bool match = total == 6 && key.bounces() == 2;
+        for (size_t i = 0; match && i < 6; ++i)
+            match = seen[i] == expected[i];
+        USBSerial.printf("Bouncy click, hold: %u events: %s\n", total, match ? "pass" : "FAIL");
+
+        // Held for two seconds with no click before, so a hold however long
+        total = 0;
+        record(key.edge(true, 3000000, events));
+        bool idle = key.tick(true, 3000000 + KEY_DEBOUNCE_US, events) == 0 && key.nextDeadline() == INT64_MAX;
+        record(key.edge(false, 5000000, events));
+        match = idle && steps == 0 && total == 3 && seen[1] == InputType::BUTTON_HOLD;
+        USBSerial.printf("Long hold: %u events, %u steps: %s\n", total, steps, match ? "pass" : "FAIL");
+
+        // Clicked, then held for two seconds, with the input task ticking
+        // only once past the first repeat; the steps missed come as one event
+        total = 0;
+        record(key.edge(true, 6000000, events));
+        record(key.edge(false, 6100000, events));
+        int64_t pressed = 6100000 + KEY_REPEAT_ARM_US;
+        record(key.edge(true, pressed, events));
+        bool deadline = key.nextDeadline() == pressed + KEY_DEBOUNCE_US;
+        record(key.tick(true, pressed + KEY_DEBOUNCE_US, events));
+        deadline = deadline && key.nextDeadline() == pressed + KEY_REPEAT_DELAY_US;
+        record(key.tick(true, pressed + KEY_REPEAT_DELAY_US, events));
+        uint32_t first = steps;
+        size_t count = key.tick(true, pressed + 2000000, events);
+        bool coalesced = count == 1;
+        record(count);
+        record(key.edge(false, pressed + 2000000, events));
+        // Repeats speed up from 150 ms apart to 30 ms, so 1.2 s more is 29
+        match = deadline && coalesced && first == 1 && steps == 30 && total == 5 &&
+            seen[1] == InputType::BUTTON_CLICK && seen[4] == InputType::BUTTON_RELEASE;
+        USBSerial.printf("Clicked, held to repeat: %u steps in %u events: %s\n", steps, total, match ? "pass" : "FAIL");
+    });
+
+    // Checks the discharge curve at its ends and between two of its points
+    UnitTest::add("battery", []() {
+        bool ends = battery::level_for_voltage(3.0f) == 0.0f && battery::level_for_voltage(4.3f) == 100.0f;
+        bool between = fabsf(battery::level_for_voltage(3.845f) - 52.5f) < 0.01f;
+        bool rising = true;
+        float last = 0.0f;
+        for (int mv = 3000; mv <= 4300; mv += 5) {
+            float level = battery::level_for_voltage(mv / 1000.0f);
+            rising = rising && level >= last;
+            last = level;
+        }
+        USBSerial.printf("Discharge curve: %s\n", ends && between && rising ? "pass" : "FAIL");
+    });
+
     /*
         End of unit testing block
     */
@@ -348,6 +1198,23 @@ void setup() {
     Shell::registerCmd("log", ShellCommands::getTaskLog);
     Shell::registerCmd("monitor", ShellCommands::toggleMonitor);
     Shell::registerCmd("memory", ShellCommands::systemStatus);
+    Shell::registerCmd("serial", ShellCommands::serialStatus);
+    Shell::registerCmd("shell", ShellCommands::shellStatus);
+    Shell::registerCmd("top", ShellCommands::topCmd);
+    Shell::registerCmd("imu", ShellCommands::imuStatus);
+    Shell::registerCmd("latency", ShellCommands::latencyCmd);
+    Shell::registerCmd("touch", ShellCommands::touchStatus);
+    Shell::registerCmd("input", ShellCommands::inputStatus);
+    Shell::registerCmd("battery", ShellCommands::batteryStatus);
+    Shell::registerCmd("record", ShellCommands::recordCmd);
+    Shell::registerCmd("replay", ShellCommands::replayCmd);
+    Shell::registerCmd("timeline", ShellCommands::timelineCmd);
+#ifdef BINARY_TRACE
+    Shell::registerCmd("trace", ShellCommands::traceCmd);
+#endif
+#ifdef PROFILING
+    Shell::registerCmd("profile", ShellCommands::profileCmd);
+#endif
     Shell::registerCmd("test", UnitTest::run);
     Shell::registerCmd("mousesay", ShellCommands::mouseSay);
     Shell::registerCmd("crashdump", ShellCommands::getCrashReason);
@@ -356,21 +1223,84 @@ void setup() {
     initUSB();
     initSerial();
     initMSC();
+#if CFG_TUD_HID
+    initHID();
+#endif
+
+#ifdef PRO_FEATURES
+    Shell::registerCmd("js", ShellCommands::jsStatus);
+#endif
 
     if (FFat.begin(false)) {
         Shell::registerCmd("tree", ShellCommands::treeCmd);
+        settings::init();
+        Shell::registerCmd("settings", ShellCommands::settingsCmd);
     }
     else {
         USBSerial.println("Failed to initialize filesystem");
     }
 
 #ifdef PRO_FEATURES
+    backlight = settings::number("display.backlight", 255);
+    settings::subscribe("display.backlight", [](const std::string&) {
+        applyBacklight();
+    });
+    inputHub.addButton(upButton);
+    inputHub.addButton(downButton);
     renderer.init();
 #endif
 
+    // Pad 1 is the left mouse button. Each edge goes on its own, so a tap
+    // shorter than a report is still sent.
+    inputHub.subscribe([](const InputEvent& event) {
+        if (event.id != TOUCH_PAD_NUM1)
+            return;
+        if (event.type == InputType::TOUCH_PRESS)
+            mouseOutput.setButtons(MOUSE_LEFT);
+        else if (event.type == InputType::TOUCH_RELEASE)
+            mouseOutput.setButtons(0);
+    });
+    inputHub.subscribe([](const InputEvent& event) {
+        if (event.type == InputType::GESTURE)
+            TRACE("Touch pad %u: %s\n", event.id, gestureName(static_cast<Gesture>(event.value)));
+        else
+            TRACE("Input %u: %s\n", event.id, inputTypeName(event.type));
+    });
+
+    battery::subscribe([](uint8_t percent) {
+        TRACE("Battery: %u%%\n", percent);
+        if (percent <= BATTERY_LOW_PERCENT)
+            Warn<TaskLog>().printf("Battery low: %u%%\n", percent);
+    });
+    battery::start();
+
     drawTask();
-    touchTask();
-    imuTask(90);
+    inputTask();
+    motionGain = settings::number("motion.gain", 20);
+    motionAccel = settings::number("motion.accel", 3);
+    motionAccelStart = settings::number("motion.accel_start_dps", 30);
+    motionAccelEnd = settings::number("motion.accel_end_dps", 200);
+    motionDeadZone = settings::number("motion.dead_zone_dps", 2);
+    motionInvertX = settings::boolean("motion.invert_x", false);
+    motionInvertY = settings::boolean("motion.invert_y", false);
+    // Tuned with tools/motion/filter_eval.cpp
+    motionFilter = settings::string("motion.filter", "one_euro");
+    motionFilterMinCutoff = settings::number("motion.filter_min_cutoff_hz", 1);
+    motionFilterBeta = settings::number("motion.filter_beta", 0.2);
+    motionFilterDerivativeCutoff = settings::number("motion.filter_d_cutoff_hz", 1);
+    settings::subscribe("motion.*", [](const std::string&) {
+        motionSettingsChanged = true;
+    });
+
+    mouseTransport = settings::string("mouse.transport", "auto");
+    applyTransportSetting();
+    settings::subscribe("mouse.transport", [](const std::string&) {
+        applyTransportSetting();
+    });
+
+    // The GPIO the sensor's INT line is wired to, if any; read once at boot
+    imuSource.useIntPin(static_cast<int>(settings::number("imu.int_pin", -1).get()));
+    imuTask();
 }
 
 void loop() {
@@ -0,0 +1,200 @@
+#include "motion_engine.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const q16_t HALF_TURN = 180 * Q16_ONE;
+
+// Heading jumps by a full turn where it crosses ±180°
+q16_t wrapAngle(q16_t delta) {
+    if (delta > HALF_TURN)
+        return delta - 2 * HALF_TURN;
+    if (delta < -HALF_TURN)
+        return delta + 2 * HALF_TURN;
+    return delta;
+}
+
+// 2 pi / 1e6 in Q32, to turn microseconds into radians at 1 Hz
+const uint32_t TWO_PI_PER_US_Q32 = 26986;
+
+uint32_t magnitude(int32_t value) {
+    return value < 0 ? -static_cast<uint32_t>(value) : value;
+}
+
+// Floors `pixels` (Q16) to whole pixels and keeps the fraction in `remainder`
+int32_t takeWholePixels(int64_t pixels, q16_t& remainder) {
+    int32_t whole = static_cast<int32_t>(pixels >> 16);
+    remainder = static_cast<q16_t>(pixels - (static_cast<int64_t>(whole) << 16));
+    return whole;
+}
+
+}  // namespace
+
+MotionCurve::MotionCurve()
+    : shift(0)
+{
+    const CurvePoint flat{0.f, 1.f};
+    setPoints(&flat, 1);
+}
+
+bool MotionCurve::setPoints(const CurvePoint *points, size_t count) {
+    if (count == 0 || count > MOTION_CURVE_MAX_POINTS)
+        return false;
+    // Make the table reach the last point
+    uint32_t span = static_cast<uint32_t>(std::max(points[count - 1].speedDps, 1.f) * Q16_ONE) / MOTION_CURVE_SEGMENTS;
+    uint8_t newShift = 0;
+    while ((1u << newShift) < span)
+        ++newShift;
+    shift = newShift;
+
+    size_t segment = 0;
+    for (size_t i = 0; i <= MOTION_CURVE_SEGMENTS; ++i) {
+        float speed = static_cast<float>(static_cast<uint64_t>(i) << shift) / Q16_ONE;
+        while (segment + 1 < count && points[segment + 1].speedDps <= speed)
+            ++segment;
+        float gain;
+        if (speed <= points[0].speedDps || segment + 1 == count) {
+            gain = speed <= points[0].speedDps ? points[0].gain : points[count - 1].gain;
+        } else {
+            const CurvePoint& a = points[segment];
+            const CurvePoint& b = points[segment + 1];
+            gain = a.gain + (b.gain - a.gain) * (speed - a.speedDps) / (b.speedDps - a.speedDps);
+        }
+        gains[i] = toQ16(gain);
+    }
+    return true;
+}
+
+MotionFilter::MotionFilter()
+    : kind(FilterKind::NONE)
+    , minCutoff(0)
+    , beta(0)
+    , derivativeCutoff(0)
+{
+    for (size_t i = 0; i <= FILTER_SMOOTHING_STEPS; ++i)
+        smoothing[i] = toQ16(1.f - expf(-static_cast<float>(i) / 16));
+    reset();
+}
+
+void MotionFilter::configure(const FilterConfig& config) {
+    // State left from another kind of filter would be stale
+    if (config.kind != kind)
+        reset();
+    kind = config.kind;
+    minCutoff = toQ16(std::max(config.minCutoffHz, 0.f));
+    beta = toQ16(std::max(config.beta, 0.f));
+    derivativeCutoff = toQ16(std::max(config.derivativeCutoffHz, 0.f));
+}
+
+void MotionFilter::reset() {
+    primed = false;
+    lastTimeUs = 0;
+    yaw = Axis{0, 0, 0};
+    pitch = Axis{0, 0, 0};
+}
+
+void MotionFilter::filterAxis(Axis& axis, q16_t raw, uint32_t twoPiInterval, uint32_t rateQ8, q16_t derivativeAlpha) {
+    q16_t cutoff = minCutoff;
+    if (kind == FilterKind::ONE_EURO) {
+        int64_t speed = (static_cast<int64_t>(wrapAngle(raw - axis.raw)) * rateQ8) >> 8;
+        speed = std::max<int64_t>(std::min<int64_t>(speed, INT32_MAX), -INT32_MAX);
+        axis.speed += static_cast<q16_t>(((speed - axis.speed) * derivativeAlpha) >> 16);
+        int64_t adaptive = minCutoff + ((static_cast<int64_t>(magnitude(axis.speed)) * beta) >> 16);
+        cutoff = static_cast<q16_t>(std::min<int64_t>(adaptive, INT32_MAX));
+    }
+    axis.raw = raw;
+    q16_t alpha = smoothingFactor((static_cast<int64_t>(cutoff) * twoPiInterval) >> 16);
+    axis.value = wrapAngle(axis.value + static_cast<q16_t>((static_cast<int64_t>(wrapAngle(raw - axis.value)) * alpha) >> 16));
+}
+
+void MotionFilter::update(q16_t& yawQ16, q16_t& pitchQ16, int64_t timeUs) {
+    if (kind == FilterKind::NONE)
+        return;
+    int64_t interval = timeUs - lastTimeUs;
+    if (!primed || interval > MOTION_MAX_INTERVAL_US) {
+        primed = true;
+        lastTimeUs = timeUs;
+        yaw = Axis{yawQ16, yawQ16, 0};
+        pitch = Axis{pitchQ16, pitchQ16, 0};
+        return;
+    }
+    lastTimeUs = timeUs;
+    if (interval < MOTION_MIN_INTERVAL_US)
+        interval = MOTION_MIN_INTERVAL_US;
+
+    // Both in range of 32 bits thanks to the interval limits
+    uint32_t twoPiInterval = (static_cast<uint32_t>(interval) * TWO_PI_PER_US_Q32) >> 16;
+    uint32_t rateQ8 = 256000000u / static_cast<uint32_t>(interval);
+    q16_t derivativeAlpha = smoothingFactor((static_cast<int64_t>(derivativeCutoff) * twoPiInterval) >> 16);
+    filterAxis(yaw, yawQ16, twoPiInterval, rateQ8, derivativeAlpha);
+    filterAxis(pitch, pitchQ16, twoPiInterval, rateQ8, derivativeAlpha);
+    yawQ16 = yaw.value;
+    pitchQ16 = pitch.value;
+}
+
+MotionEngine::MotionEngine()
+    : curve()
+    , filter()
+    , deadZone(0)
+    , invertX(false)
+    , invertY(false)
+{
+    reset();
+}
+
+void MotionEngine::configure(const MotionConfig& config) {
+    deadZone = toQ16(config.deadZoneDps);
+    invertX = config.invertX;
+    invertY = config.invertY;
+}
+
+void MotionEngine::reset() {
+    filter.reset();
+    tracking = false;
+    lastYaw = 0;
+    lastPitch = 0;
+    lastTimeUs = 0;
+    remainderX = 0;
+    remainderY = 0;
+}
+
+MotionDelta MotionEngine::update(float yawDeg, float pitchDeg, int64_t timeUs) {
+    q16_t yaw = toQ16(yawDeg);
+    q16_t pitch = toQ16(pitchDeg);
+    filter.update(yaw, pitch, timeUs);
+    int64_t interval = timeUs - lastTimeUs;
+    if (!tracking || interval > MOTION_MAX_INTERVAL_US) {
+        tracking = true;
+        lastYaw = yaw;
+        lastPitch = pitch;
+        lastTimeUs = timeUs;
+        return MotionDelta{0, 0};
+    }
+    // Samples read in one batch share a timestamp
+    if (interval < MOTION_MIN_INTERVAL_US)
+        interval = MOTION_MIN_INTERVAL_US;
+
+    q16_t dYaw = wrapAngle(yaw - lastYaw);
+    q16_t dPitch = pitch - lastPitch;
+    lastYaw = yaw;
+    lastPitch = pitch;
+    lastTimeUs = timeUs;
+
+    // Octagonal approximation of the length of (dYaw, dPitch), within 12%
+    uint32_t longer = std::max(magnitude(dYaw), magnitude(dPitch));
+    uint32_t shorter = std::min(magnitude(dYaw), magnitude(dPitch));
+    int64_t speed = (static_cast<int64_t>(longer + shorter / 2) * 1000000) / interval;
+    if (speed > INT32_MAX)
+        speed = INT32_MAX;
+    if (speed < deadZone)
+        return MotionDelta{0, 0};
+
+    // Turning right lowers the heading and tilting up raises the pitch,
+    // while the screen's x grows to the right and its y grows downwards
+    int64_t gain = curve.gainAt(static_cast<q16_t>(speed));
+    int64_t pixelsX = ((-static_cast<int64_t>(dYaw) * gain) >> 16) * (invertX ? -1 : 1) + remainderX;
+    int64_t pixelsY = ((-static_cast<int64_t>(dPitch) * gain) >> 16) * (invertY ? -1 : 1) + remainderY;
+    return MotionDelta{takeWholePixels(pixelsX, remainderX), takeWholePixels(pixelsY, remainderY)};
+}
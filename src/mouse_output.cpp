@@ -0,0 +1,109 @@
+#include "mouse_output.h"
+
+#include "state.h"
+#include "taskwrapper.h"
+#include "timeline.h"
+
+MouseOutput::MouseOutput(TransportSelector select)
+    : select(select)
+    , scheduler()
+    , motion()
+    , buttons()
+    , sequence(0)
+    , carryX(0)
+    , carryY(0)
+    , resetRequested(false)
+    , task(nullptr)
+{}
+
+bool MouseOutput::start() {
+    if (task)
+        return true;
+    registerTaskStack("Mouse Output", MOUSE_OUTPUT_STACK_SIZE);
+    return xTaskCreate(taskEntry, "Mouse Output", MOUSE_OUTPUT_STACK_SIZE, this, MOUSE_OUTPUT_PRIORITY, &task) == pdPASS;
+}
+
+void MouseOutput::wake() {
+    if (task)
+        xTaskNotifyGive(task);
+}
+
+void MouseOutput::addMotion(int32_t dx, int32_t dy, const InputTimestamps& timestamps) {
+    uint32_t seq = sequence.fetch_add(1, std::memory_order_relaxed);
+    if (motion.push(Motion{dx + carryX, dy + carryY, timestamps, seq}))
+        carryX = carryY = 0;
+    else {
+        carryX += dx;
+        carryY += dy;
+    }
+    wake();
+}
+
+void MouseOutput::setButtons(uint8_t state) {
+    ButtonState change{state, sequence.fetch_add(1, std::memory_order_relaxed)};
+    // The output task frees a slot with every report, or all of them once
+    // it finds the host gone
+    while (!buttons.push(change)) {
+        wake();
+        vTaskDelay(1);
+    }
+    wake();
+}
+
+void MouseOutput::resetStats() {
+    resetRequested = true;
+    wake();
+}
+
+void MouseOutput::taskEntry(void *arg) {
+    MouseOutput *output = static_cast<MouseOutput*>(arg);
+    ReportScheduler& scheduler = output->scheduler;
+    // The newest motion not yet reported, to time its way to the host
+    InputTimestamps newest{};
+    bool unreported = false;
+    while (true) {
+        if (output->resetRequested.exchange(false))
+            scheduler.resetStats();
+        // Oldest first across both queues. A button state the scheduler has
+        // no segment for holds back everything after it until a report
+        // frees one.
+        Motion m;
+        ButtonState b;
+        bool hasMotion = output->motion.peek(m);
+        bool hasButtons = output->buttons.peek(b);
+        while (hasMotion || hasButtons) {
+            if (hasButtons && (!hasMotion || static_cast<int32_t>(b.seq - m.seq) < 0)) {
+                if (!scheduler.setButtons(b.buttons))
+                    break;
+                output->buttons.pop(b);
+                hasButtons = output->buttons.peek(b);
+            } else {
+                scheduler.addMotion(m.dx, m.dy);
+                newest = m.timestamps;
+                unreported = true;
+                output->motion.pop(m);
+                hasMotion = output->motion.peek(m);
+            }
+        }
+
+        MouseTransport& transport = output->select();
+        if (!transport.connected()) {
+            if (scheduler.pending()) {
+                scheduler.discard();
+                inputLatency.countDropped();
+            }
+            unreported = false;
+        } else {
+            TIMELINE_BEGIN("hid report");
+            bool sent = scheduler.flush(transport);
+            TIMELINE_END("hid report");
+            if (sent && unreported) {
+                newest.submitted = esp_timer_get_time();
+                inputLatency.record(newest);
+                unreported = false;
+            }
+        }
+        // While reports wait for a slot, check back every tick
+        ulTaskNotifyTake(pdTRUE, scheduler.pending() ? 1 : portMAX_DELAY);
+    }
+}
@@ -0,0 +1,104 @@
+#include "profiling.h"
+
+#include <xtensa/hal.h>
+
+namespace {
+
+Profiling::Accumulator *accumulators = nullptr;
+portMUX_TYPE accumulatorsLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Bucket i holds durations of [2^(i-1), 2^i) cycles; bucket 0 holds zero
+size_t bucketOf(uint32_t cycles) {
+    return cycles ? 32 - __builtin_clz(cycles) : 0;
+}
+
+}  // namespace
+
+Profiling::Accumulator::Accumulator(const char *label)
+    : label(label)
+    , next(nullptr)
+    , lock(portMUX_INITIALIZER_UNLOCKED)
+{
+    reset();
+    portENTER_CRITICAL(&accumulatorsLock);
+    next = accumulators;
+    accumulators = this;
+    portEXIT_CRITICAL(&accumulatorsLock);
+}
+
+void Profiling::Accumulator::reset() {
+    count = 0;
+    migrated = 0;
+    minCycles = UINT32_MAX;
+    maxCycles = 0;
+    totalCycles = 0;
+    memset(histogram, 0, sizeof(histogram));
+}
+
+void Profiling::Accumulator::add(uint32_t cycles) {
+    portENTER_CRITICAL(&lock);
+    ++count;
+    totalCycles += cycles;
+    minCycles = std::min(minCycles, cycles);
+    maxCycles = std::max(maxCycles, cycles);
+    ++histogram[bucketOf(cycles)];
+    portEXIT_CRITICAL(&lock);
+}
+
+void Profiling::Accumulator::addMigrated() {
+    portENTER_CRITICAL(&lock);
+    ++migrated;
+    portEXIT_CRITICAL(&lock);
+}
+
+Profiling::Scope::Scope(Accumulator& accumulator)
+    : accumulator(accumulator)
+    , core(xPortGetCoreID())
+    , start(xthal_get_ccount())
+{}
+
+Profiling::Scope::~Scope() {
+    uint32_t end = xthal_get_ccount();
+    // Each core has its own cycle counter
+    if (xPortGetCoreID() == core)
+        accumulator.add(end - start);
+    else
+        accumulator.addMigrated();
+}
+
+void Profiling::printAndReset(Print& out) {
+    const float cyclesPerUs = getCpuFrequencyMhz();
+
+    portENTER_CRITICAL(&accumulatorsLock);
+    Accumulator *first = accumulators;
+    portEXIT_CRITICAL(&accumulatorsLock);
+
+    out.printf("%-20s %8s %10s %10s %10s %8s\n", "Label", "Count", "Min us", "Mean us", "Max us", "Migrated");
+    for (Accumulator *acc = first; acc != nullptr; acc = acc->next) {
+        // Copy and clear under the lock, print without it
+        portENTER_CRITICAL(&acc->lock);
+        uint32_t count = acc->count;
+        uint32_t migrated = acc->migrated;
+        uint32_t minCycles = acc->minCycles;
+        uint32_t maxCycles = acc->maxCycles;
+        uint64_t totalCycles = acc->totalCycles;
+        uint32_t histogram[PROFILE_HISTOGRAM_BUCKETS];
+        memcpy(histogram, acc->histogram, sizeof(histogram));
+        acc->reset();
+        portEXIT_CRITICAL(&acc->lock);
+
+        if (count == 0) {
+            out.printf("%-20s %8u %10s %10s %10s %8u\n", acc->label, 0, "-", "-", "-", migrated);
+            continue;
+        }
+        out.printf("%-20s %8u %10.2f %10.2f %10.2f %8u\n", acc->label, count,
+                   minCycles / cyclesPerUs, totalCycles / count / cyclesPerUs, maxCycles / cyclesPerUs, migrated);
+        // Histogram buckets as "<upper bound in us>:<count>"
+        out.print("    ");
+        for (size_t i = 0; i < PROFILE_HISTOGRAM_BUCKETS; ++i) {
+            if (histogram[i])
+                out.printf(" <%.3g:%u", (i ? 2.0 * (1ULL << (i - 1)) : 1.0) / cyclesPerUs, histogram[i]);
+        }
+        out.println();
+    }
+}
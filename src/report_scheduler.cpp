@@ -0,0 +1,98 @@
+#include "report_scheduler.h"
+
+namespace {
+
+int8_t fitReport(int32_t value) {
+    return value > 127 ? 127 : value < -127 ? -127 : static_cast<int8_t>(value);
+}
+
+}  // namespace
+
+ReportScheduler::ReportScheduler()
+    : segments()
+    , head(0)
+    , count(1)
+    , reportedButtons(0)
+    , counters{0, 0, 0, 0}
+{}
+
+void ReportScheduler::addMotion(int32_t dx, int32_t dy) {
+    if (!dx && !dy)
+        return;
+    Segment& segment = back();
+    segment.dx += dx;
+    segment.dy += dy;
+    ++segment.updates;
+}
+
+void ReportScheduler::addWheel(int32_t steps) {
+    if (!steps)
+        return;
+    Segment& segment = back();
+    segment.wheel += steps;
+    ++segment.updates;
+}
+
+bool ReportScheduler::setButtons(uint8_t buttons) {
+    Segment& last = back();
+    if (buttons == last.buttons)
+        return true;
+    // A state nothing happened in since the host saw it can just be replaced
+    if (count == 1 && !moving(last) && last.buttons == reportedButtons) {
+        last.buttons = buttons;
+        return true;
+    }
+    if (count == REPORT_SEGMENTS) {
+        ++counters.buttonOverflows;
+        return false;
+    }
+    segments[(head + count) % REPORT_SEGMENTS] = Segment{buttons, 0, 0, 0, 0};
+    ++count;
+    return true;
+}
+
+bool ReportScheduler::pending() const {
+    return count > 1 || moving(front()) || front().buttons != reportedButtons;
+}
+
+MouseReport ReportScheduler::next() const {
+    const Segment& segment = front();
+    return MouseReport{segment.buttons, fitReport(segment.dx), fitReport(segment.dy), fitReport(segment.wheel)};
+}
+
+void ReportScheduler::sent(const MouseReport& report) {
+    Segment& segment = front();
+    segment.dx -= report.x;
+    segment.dy -= report.y;
+    segment.wheel -= report.wheel;
+    reportedButtons = report.buttons;
+    ++counters.reports;
+    if (segment.updates > 1)
+        counters.merged += segment.updates - 1;
+    segment.updates = 0;
+    if (moving(segment))
+        ++counters.splits;
+    else if (count > 1) {
+        ++head;
+        --count;
+    }
+}
+
+bool ReportScheduler::flush(MouseTransport& transport) {
+    if (!pending() || !transport.ready())
+        return false;
+    MouseReport report = next();
+    if (!transport.send(report))
+        return false;
+    sent(report);
+    return true;
+}
+
+void ReportScheduler::discard() {
+    uint8_t buttons = back().buttons;
+    head = 0;
+    count = 1;
+    segments[0] = Segment{buttons, 0, 0, 0, 0};
+    // With no host to tell, the latest state counts as reported
+    reportedButtons = buttons;
+}
@@ -2,6 +2,7 @@
 
 #include <Wire.h>
 
+#include "profiling.h"
 #include "state.h"
 #include "usb_classes.h"
 
@@ -22,6 +23,8 @@
 #define IMU_NRST 44
 #endif
 
+#define IMU_RESET_TIMEOUT_MS 500    // Reinitialize the sensor after this long without a report
+
 #define ROT_VECTOR_TYPE SENSOR_REPORTID_GEOMAGNETIC_ROTATION_VECTOR
 
 #define FLOAT_LIT_IMPL(d) d##f
@@ -64,29 +67,81 @@ bool BNO086::init(bool wireInitialized) {
     return true;
 }
 
-Orientation BNO086::poll() {
-    // Has a new event come in on the Sensor Hub Bus?
-    uint8_t eventId;
-    TickType_t lastReportTime = xTaskGetTickCount();
-    do {
-        while (!imu.getSensorEvent()) {
-            if (imu.wasReset()) {
-                imu.enableReport(ROT_VECTOR_TYPE);
-            } else if (xTaskGetTickCount() - lastReportTime >
-                       pdMS_TO_TICKS(500)) {
-                Error<TaskLog>().println("IMU crash detected! Resetting...");
-                lastReportTime = xTaskGetTickCount();
-                init(true);
-                vTaskDelay(pdMS_TO_TICKS(100));
-            } else
-                vTaskDelay(pdMS_TO_TICKS(20));
-        }
-        eventId = imu.getSensorEventID();
-    } while (eventId != ROT_VECTOR_TYPE);
-
-    return Orientation{
-        imu.getRoll() * 180.f / PI_FLOAT,  // Convert roll to degrees
-        imu.getPitch() * 180.f / PI_FLOAT, // Convert pitch to degrees
-        imu.getYaw() * 180.f / PI_FLOAT    // Convert yaw / heading to degrees
-    };
-}
\ No newline at end of file
+size_t BNO086::poll(OrientationSample *out, size_t capacity, int64_t sensorTime) {
+    PROFILE_SCOPE("BNO086::poll");
+    size_t count = 0;
+    // Each call services the sensor hub bus once and reports at most one event
+    while (count < capacity && imu.getSensorEvent()) {
+        if (imu.getSensorEventID() != ROT_VECTOR_TYPE)
+            continue;
+        out[count++] = OrientationSample{
+            Orientation{
+                imu.getRoll() * 180.f / PI_FLOAT,   // Convert roll to degrees
+                imu.getPitch() * 180.f / PI_FLOAT,  // Convert pitch to degrees
+                imu.getYaw() * 180.f / PI_FLOAT     // Convert yaw / heading to degrees
+            },
+            sensorTime,
+            0
+        };
+    }
+    return count;
+}
+
+BNO086Source::BNO086Source()
+    : intPin(-1)
+    , reader(nullptr)
+    , pollWakeTime(0)
+    , lastReportTime(0)
+    , morePending(false)
+{}
+
+void IRAM_ATTR BNO086Source::intISR(void *arg) {
+    BNO086Source *source = static_cast<BNO086Source*>(arg);
+    BaseType_t taskWoken = pdFALSE;
+    // The low 32 bits are enough to find the full time again in `read`
+    xTaskNotifyFromISR(source->reader, static_cast<uint32_t>(esp_timer_get_time()), eSetValueWithOverwrite, &taskWoken);
+    if (taskWoken == pdTRUE)
+        portYIELD_FROM_ISR();
+}
+
+bool BNO086Source::begin() {
+    reader = xTaskGetCurrentTaskHandle();
+    if (!BNO086::init(false))
+        return false;
+    lastReportTime = xTaskGetTickCount();
+    pollWakeTime = lastReportTime;
+    if (intPin >= 0) {
+        pinMode(intPin, INPUT_PULLUP);
+        attachInterruptArg(intPin, intISR, this, FALLING);  // INT is active low
+    }
+    return true;
+}
+
+size_t BNO086Source::read(OrientationSample *out, size_t capacity, TickType_t timeout) {
+    int64_t sensorTime;
+    uint32_t intTime;
+    if (intPin < 0) {
+        if (!morePending)
+            xTaskDelayUntil(&pollWakeTime, pdMS_TO_TICKS(IMU_POLL_INTERVAL_MS));
+        sensorTime = esp_timer_get_time();
+    } else if (!morePending && xTaskNotifyWait(0, 0, &intTime, timeout) == pdTRUE) {
+        int64_t now = esp_timer_get_time();
+        sensorTime = now - static_cast<uint32_t>(static_cast<uint32_t>(now) - intTime);
+    } else {
+        // No edge to go by, so latency measured from here is an underestimate
+        sensorTime = esp_timer_get_time();
+    }
+
+    size_t count = BNO086::poll(out, capacity, sensorTime);
+    morePending = count == capacity;
+    if (count) {
+        lastReportTime = xTaskGetTickCount();
+    } else if (BNO086::imu.wasReset()) {
+        BNO086::imu.enableReport(ROT_VECTOR_TYPE);
+    } else if (xTaskGetTickCount() - lastReportTime > pdMS_TO_TICKS(IMU_RESET_TIMEOUT_MS)) {
+        Error<TaskLog>().println("IMU crash detected! Resetting...");
+        lastReportTime = xTaskGetTickCount();
+        BNO086::init(true);
+    }
+    return count;
+}
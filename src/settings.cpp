@@ -1,92 +1,721 @@
 #include "settings.h"
 
 #include "duktape.h"
+#include "state.h"
+#include "taskwrapper.h"
+#include <FFat.h>
+#include <cstring>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
-void settings::create_js_hooks(duk_context *ctx) {
-    duk_push_global_object(ctx);
+namespace {
+
+// The log starts with a magic number, followed by one record per change:
+//   u8 type | u8 key length | u16 value length (LE) | key | value | u8 CRC-8
+// Numbers are stored as raw doubles and booleans as a single byte. Later
+// records override earlier ones, and a record with a bad checksum (e.g. torn
+// by a reset mid-write) ends the log.
+const char LOG_MAGIC[4] = {'M', 'L', 'S', '1'};
+constexpr std::size_t RECORD_OVERHEAD = 5;
+
+using settings::detail::entry_t;
+
+std::unordered_map<std::string, entry_t> _settings;
+std::vector<entry_t *> dirty; // Changed since the last flush
+SemaphoreHandle_t mutex = xSemaphoreCreateMutex();
+SemaphoreHandle_t io_mutex = xSemaphoreCreateMutex(); // Serializes file access
+TaskHandle_t writer = nullptr;
+
+struct subscription_t {
+    uint32_t id;
+    std::string pattern;
+    bool prefix;
+    settings::subscriber_t callback;
+};
+std::vector<subscription_t> subscriptions;
+std::vector<entry_t *> changed; // Waiting to be delivered to subscribers
+TimerHandle_t notify_timer = nullptr;
+uint32_t next_subscription_id = 1;
+bool persistent = false;
+settings::store_stats_t store_stats{};
+
+uint8_t crc8(const uint8_t *data, std::size_t len) {
+    uint8_t crc = 0;
+    while (len--) {
+        crc ^= *data++;
+        for (int i = 0; i < 8; ++i) {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+std::size_t value_size(const settings::SettingValue &setting) {
+    switch (setting.type) {
+    case settings::SettingType::STRING:
+        return setting.string->size();
+    case settings::SettingType::NUMBER:
+        return sizeof(double);
+    case settings::SettingType::BOOLEAN:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+std::size_t record_size(const std::string &key,
+                        const settings::SettingValue &setting) {
+    return RECORD_OVERHEAD + key.size() + value_size(setting);
+}
+
+bool persistable(const std::string &key, const settings::SettingValue &setting) {
+    return setting.type != settings::SettingType::UNSET && key.size() <= 0xFF &&
+           value_size(setting) <= 0xFFFF;
+}
+
+void encode(std::string &out, const std::string &key,
+            const settings::SettingValue &setting) {
+    std::size_t start = out.size();
+    std::size_t len = value_size(setting);
+    out.push_back(static_cast<char>(setting.type));
+    out.push_back(static_cast<char>(key.size()));
+    out.push_back(static_cast<char>(len & 0xFF));
+    out.push_back(static_cast<char>(len >> 8));
+    out.append(key);
+    switch (setting.type) {
+    case settings::SettingType::STRING:
+        out.append(*setting.string);
+        break;
+    case settings::SettingType::NUMBER:
+        out.append(reinterpret_cast<const char *>(&setting.number),
+                   sizeof(double));
+        break;
+    case settings::SettingType::BOOLEAN:
+        out.push_back(setting.boolean ? 1 : 0);
+        break;
+    }
+    out.push_back(static_cast<char>(crc8(
+        reinterpret_cast<const uint8_t *>(out.data()) + start,
+        out.size() - start)));
+}
+
+/// @brief Finds the entry for a key, creating an empty one if needed. Must
+/// be called with the mutex held.
+entry_t *find_or_create(const std::string &key) {
+    auto it = _settings.find(key);
+    if (it == _settings.end()) {
+        it = _settings
+                 .emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                          std::forward_as_tuple())
+                 .first;
+        it->second.key = &it->first;
+    }
+    return &it->second;
+}
+
+/// @brief Replaces an entry's value so that concurrent lock-free readers see
+/// either the old or the new value. Must be called with the mutex held.
+void assign(entry_t *entry, const settings::SettingValue &value) {
+    uint32_t version = entry->version.load(std::memory_order_relaxed);
+    entry->version.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    entry->value = value;
+    entry->version.store(version + 2, std::memory_order_release);
+}
+
+/// @brief Applies one record to the store. Must be called with the mutex held.
+/// Keys changed before the store was loaded keep their newer values.
+/// @return The size of the record, or 0 if it is truncated or corrupt.
+std::size_t decode(const uint8_t *data, std::size_t len) {
+    if (len < RECORD_OVERHEAD) {
+        return 0;
+    }
+    auto type = static_cast<settings::SettingType>(data[0]);
+    std::size_t key_len = data[1];
+    std::size_t value_len = data[2] | (data[3] << 8);
+    std::size_t size = RECORD_OVERHEAD + key_len + value_len;
+    if (size > len || crc8(data, size - 1) != data[size - 1]) {
+        return 0;
+    }
+    const uint8_t *value = data + 4 + key_len;
+    settings::SettingValue decoded;
+    switch (type) {
+    case settings::SettingType::STRING:
+        decoded = settings::SettingValue(new std::string(
+            reinterpret_cast<const char *>(value), value_len));
+        break;
+    case settings::SettingType::NUMBER: {
+        if (value_len != sizeof(double)) {
+            return 0;
+        }
+        double number;
+        memcpy(&number, value, sizeof(double));
+        decoded = settings::SettingValue(number);
+    } break;
+    case settings::SettingType::BOOLEAN:
+        if (value_len != 1) {
+            return 0;
+        }
+        decoded = settings::SettingValue(value[0] != 0);
+        break;
+    default:
+        return 0;
+    }
+    entry_t *entry = find_or_create(
+        std::string(reinterpret_cast<const char *>(data) + 4, key_len));
+    if (!entry->dirty && (entry->type == settings::SettingType::UNSET ||
+                          entry->type == type)) {
+        assign(entry, decoded);
+    }
+    return size;
+}
+
+/// @brief Reads the whole log in one go and applies it. Must be called with
+/// the I/O mutex held.
+/// @return Whether the log was read to the end without finding corruption.
+bool load() {
+    fs::File f = FFat.open(SETTINGS_LOG_PATH, FILE_READ);
+    if (!f) {
+        return false;
+    }
+    std::size_t size = f.size();
+    uint8_t *buffer = new uint8_t[size + 1];
+    std::size_t read = f.read(buffer, size);
+    f.close();
+    store_stats.load_bytes = size;
+    if (read != size || size < sizeof(LOG_MAGIC) ||
+        memcmp(buffer, LOG_MAGIC, sizeof(LOG_MAGIC)) != 0) {
+        delete[] buffer;
+        return false;
+    }
+    std::size_t offset = sizeof(LOG_MAGIC);
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    while (offset < size) {
+        std::size_t consumed = decode(buffer + offset, size - offset);
+        if (consumed == 0) {
+            break;
+        }
+        offset += consumed;
+        ++store_stats.records_loaded;
+    }
+    xSemaphoreGive(mutex);
+    delete[] buffer;
+    store_stats.log_bytes = offset;
+    return offset == size;
+}
+
+/// @brief Rewrites the log with only the current value of each setting. The
+/// new log is written beside the old one and renamed over it, so a reset
+/// midway loses nothing. Must be called with the I/O mutex held.
+bool compact() {
+    std::string buffer(LOG_MAGIC, sizeof(LOG_MAGIC));
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    for (const auto &entry : _settings) {
+        if (persistable(entry.first, entry.second.value)) {
+            encode(buffer, entry.first, entry.second.value);
+        }
+    }
+    xSemaphoreGive(mutex);
+
+    fs::File f = FFat.open(SETTINGS_TMP_PATH, FILE_WRITE);
+    if (!f) {
+        ++store_stats.write_errors;
+        return false;
+    }
+    std::size_t written =
+        f.write(reinterpret_cast<const uint8_t *>(buffer.data()),
+                buffer.size());
+    f.close();
+    store_stats.bytes_written += written;
+    if (written != buffer.size()) {
+        ++store_stats.write_errors;
+        FFat.remove(SETTINGS_TMP_PATH);
+        return false;
+    }
+    FFat.remove(SETTINGS_LOG_PATH);
+    if (!FFat.rename(SETTINGS_TMP_PATH, SETTINGS_LOG_PATH)) {
+        ++store_stats.write_errors;
+        return false;
+    }
+    ++store_stats.compactions;
+    store_stats.log_bytes = store_stats.live_bytes = buffer.size();
+    return true;
+}
+
+/// @brief Appends the latest value of every changed setting to the log,
+/// compacting it once it is mostly overwritten records. Must be called with
+/// the I/O mutex held.
+void flush_pending() {
+    std::string buffer;
+    uint32_t records = 0;
+    std::size_t live_bytes = sizeof(LOG_MAGIC);
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    for (auto entry : dirty) {
+        entry->dirty = false;
+        if (persistable(*entry->key, entry->value)) {
+            encode(buffer, *entry->key, entry->value);
+            ++records;
+        }
+    }
+    dirty.clear();
+    for (const auto &entry : _settings) {
+        if (persistable(entry.first, entry.second.value)) {
+            live_bytes += record_size(entry.first, entry.second.value);
+        }
+    }
+    xSemaphoreGive(mutex);
+    store_stats.live_bytes = live_bytes;
+    if (buffer.empty()) {
+        return;
+    }
+
+    fs::File f = FFat.open(SETTINGS_LOG_PATH, FILE_APPEND);
+    std::size_t written =
+        f ? f.write(reinterpret_cast<const uint8_t *>(buffer.data()),
+                    buffer.size())
+          : 0;
+    if (f) {
+        f.close();
+    }
+    ++store_stats.flushes;
+    store_stats.records_written += records;
+    store_stats.bytes_written += written;
+    store_stats.log_bytes += written;
+    if (written != buffer.size()) {
+        // A partial record fails its checksum; the compaction below (or the
+        // next boot) drops it.
+        ++store_stats.write_errors;
+    }
+    if (written != buffer.size() ||
+        (store_stats.log_bytes >= SETTINGS_COMPACT_MIN_BYTES &&
+         store_stats.log_bytes > 2 * live_bytes)) {
+        compact();
+    }
+}
+
+bool matches(const subscription_t &subscription, const std::string &key) {
+    if (subscription.prefix) {
+        return key.compare(0, subscription.pattern.size(),
+                           subscription.pattern) == 0;
+    }
+    return key == subscription.pattern;
+}
+
+/// @brief Delivers every change made since the last delivery. Runs on the
+/// timer service task, without the mutex held so callbacks can read settings.
+void deliver_changes(TimerHandle_t) {
+    std::vector<entry_t *> entries;
+    std::vector<subscription_t> targets;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    entries.swap(changed);
+    for (auto entry : entries) {
+        entry->notify = false;
+    }
+    targets = subscriptions;
+    store_stats.changes_delivered += entries.size();
+    xSemaphoreGive(mutex);
+    for (auto entry : entries) {
+        for (const auto &subscription : targets) {
+            if (matches(subscription, *entry->key)) {
+                subscription.callback(*entry->key);
+            }
+        }
+    }
+}
+
+/// @brief Flushes changes once they stop arriving, so that dragging a slider
+/// costs a bounded number of writes rather than one per step.
+void writer_task(void *) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        TickType_t first_change = xTaskGetTickCount();
+        while (xTaskGetTickCount() - first_change <
+                   pdMS_TO_TICKS(SETTINGS_MAX_DELAY_MS) &&
+               ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SETTINGS_QUIET_MS)) !=
+                   0) {
+        }
+        settings::flush();
+    }
+}
+
+/// @brief Stores a value under a key and schedules it to be persisted.
+void store(const std::string &key, const settings::SettingValue &value) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    entry_t *entry = find_or_create(key);
+    xSemaphoreGive(mutex);
+    settings::detail::write(entry, value);
+}
+
+/// @brief Pushes an entry's value, or undefined if it has none.
+void push_value(duk_context *ctx, const entry_t *entry) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    switch (entry ? entry->value.type : settings::SettingType::UNSET) {
+    case settings::SettingType::STRING:
+        duk_push_string(ctx, entry->value.string->c_str());
+        break;
+    case settings::SettingType::NUMBER:
+        duk_push_number(ctx, entry->value.number);
+        break;
+    case settings::SettingType::BOOLEAN:
+        duk_push_boolean(ctx, entry->value.boolean);
+        break;
+    default:
+        duk_push_undefined(ctx);
+        break;
+    }
+    xSemaphoreGive(mutex);
+}
+
+/// @brief Stores the JS value at `index` in an entry.
+/// @return 0, or a duktape error code if the value has the wrong type.
+duk_ret_t write_value(duk_context *ctx, entry_t *entry, duk_idx_t index) {
+    using settings::SettingValue;
+    bool written = false;
+    if (entry == nullptr) {
+        written = false;
+    } else if (duk_is_string(ctx, index)) {
+        written = settings::detail::write(
+            entry, SettingValue(new std::string(duk_get_string(ctx, index))));
+    } else if (duk_is_number(ctx, index)) {
+        written = settings::detail::write(
+            entry, SettingValue(duk_get_number(ctx, index)));
+    } else if (duk_is_boolean(ctx, index)) {
+        written = settings::detail::write(
+            entry, SettingValue((bool)duk_get_boolean(ctx, index)));
+    }
+    return written ? 0 : DUK_RET_TYPE_ERROR;
+}
+
+entry_t *find_entry(const char *key) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    auto it = _settings.find(key);
+    entry_t *entry = it == _settings.end() ? nullptr : &it->second;
+    xSemaphoreGive(mutex);
+    return entry;
+}
+
+entry_t *this_entry(duk_context *ctx) {
+    duk_push_this(ctx);
+    duk_get_prop_string(ctx, -1, DUK_HIDDEN_SYMBOL("entry"));
+    entry_t *entry = static_cast<entry_t *>(duk_get_pointer(ctx, -1));
+    duk_pop_2(ctx);
+    return entry;
+}
+
+duk_ret_t _change_setting(duk_context *ctx) {
+    const char *key = duk_require_string(ctx, 0);
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    entry_t *entry = find_or_create(key);
+    xSemaphoreGive(mutex);
+    return write_value(ctx, entry, 1);
+}
+
+duk_ret_t _get_setting(duk_context *ctx) {
+    push_value(ctx, find_entry(duk_require_string(ctx, 0)));
+    return 1;
+}
+
+duk_ret_t _handle_get(duk_context *ctx) {
+    push_value(ctx, this_entry(ctx));
+    return 1;
+}
+
+duk_ret_t _handle_set(duk_context *ctx) {
+    return write_value(ctx, this_entry(ctx), 0);
+}
+
+duk_ret_t _get_handle(duk_context *ctx) {
+    const char *key = duk_require_string(ctx, 0);
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    entry_t *entry = find_or_create(key);
+    xSemaphoreGive(mutex);
     duk_push_object(ctx);
-    duk_push_c_function(ctx, _change_setting, 2);
-    duk_put_prop_string(ctx, -2, "set");
-    duk_push_c_function(ctx, _get_setting, 1);
+    duk_push_pointer(ctx, entry);
+    duk_put_prop_string(ctx, -2, DUK_HIDDEN_SYMBOL("entry"));
+    duk_push_string(ctx, key);
+    duk_put_prop_string(ctx, -2, "key");
+    duk_push_c_function(ctx, _handle_get, 0);
     duk_put_prop_string(ctx, -2, "get");
-    duk_put_prop_string(ctx, -2, "settings");
+    duk_push_c_function(ctx, _handle_set, 1);
+    duk_put_prop_string(ctx, -2, "set");
+    return 1;
 }
 
-duk_ret_t settings::_change_setting(duk_context *ctx) {
-    const char *key = duk_get_string(ctx, 0);
-    if (duk_is_string(ctx, 1)) {
-        const char *value = duk_get_string(ctx, 1);
-        _settings[key] = Setting(new std::string(value));
-        return DUK_ERR_NONE;
-    } else if (duk_is_number(ctx, 1)) {
-        double value = duk_get_number(ctx, 1);
-        _settings[key] = Setting(value);
-        return DUK_ERR_NONE;
-    } else if (duk_is_boolean(ctx, 1)) {
-        bool value = duk_get_boolean(ctx, 1);
-        _settings[key] = Setting(value);
-        return DUK_ERR_NONE;
+/// @brief Finds or creates a key and fixes its type, falling back to the
+/// default if the stored value has another type.
+entry_t *register_key(const std::string &key,
+                      const settings::SettingValue &default_value) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    entry_t *entry = find_or_create(key);
+    if (entry->value.type != default_value.type) {
+        if (entry->value.type != settings::SettingType::UNSET) {
+            Warn<TaskLog>().printf("Setting %s has the wrong type, using the "
+                                   "default\n",
+                                   key.c_str());
+        }
+        assign(entry, default_value);
     }
-    return DUK_ERR_RANGE_ERROR;
+    entry->type = default_value.type;
+    xSemaphoreGive(mutex);
+    return entry;
 }
 
-duk_ret_t settings::_get_setting(duk_context *ctx) {
-    const char *key = duk_get_string(ctx, 0);
-    if (_settings.find(key) == _settings.end()) {
-        duk_push_undefined(ctx);
+} // namespace
+
+settings::SettingValue::SettingValue(const SettingValue &other)
+    : type(other.type) {
+    if (type == SettingType::STRING) {
+        string = new std::string(*other.string);
     } else {
-        switch (_settings[key].type) {
-        case SettingType::STRING:
-            duk_push_string(ctx, _settings[key].string->c_str());
-            break;
-        case SettingType::NUMBER:
-            duk_push_number(ctx, _settings[key].number);
-            break;
-        case SettingType::BOOLEAN:
-            duk_push_boolean(ctx, _settings[key].boolean);
+        number = other.number;
+    }
+}
+
+settings::SettingValue &
+settings::SettingValue::operator=(const SettingValue &other) {
+    if (this == &other) {
+        return *this;
+    }
+    if (type == SettingType::STRING && other.type == SettingType::STRING) {
+        *string = *other.string;
+        return *this;
+    }
+    if (type == SettingType::STRING) {
+        delete string;
+    }
+    type = other.type;
+    if (type == SettingType::STRING) {
+        string = new std::string(*other.string);
+    } else {
+        number = other.number;
+    }
+    return *this;
+}
+
+bool settings::detail::write(entry_t *entry, const SettingValue &value) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (entry->type != SettingType::UNSET && entry->type != value.type) {
+        xSemaphoreGive(mutex);
+        return false;
+    }
+    assign(entry, value);
+    if (!entry->dirty) {
+        entry->dirty = true;
+        dirty.push_back(entry);
+    }
+    ++store_stats.updates;
+    store_stats.update_bytes += record_size(*entry->key, value);
+    bool start_timer = false;
+    if (entry->notify) {
+        ++store_stats.changes_coalesced;
+    } else if (!subscriptions.empty()) {
+        entry->notify = true;
+        changed.push_back(entry);
+        start_timer = changed.size() == 1;
+    }
+    xSemaphoreGive(mutex);
+    if (start_timer) {
+        xTimerStart(notify_timer, portMAX_DELAY);
+    }
+    if (writer != nullptr) {
+        xTaskNotifyGive(writer);
+    }
+    return true;
+}
+
+std::string settings::detail::read_string(const entry_t *entry) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    std::string value = *entry->value.string;
+    xSemaphoreGive(mutex);
+    return value;
+}
+
+settings::Setting<double> settings::number(const std::string &key,
+                                           double default_value) {
+    return Setting<double>(register_key(key, SettingValue(default_value)));
+}
+
+settings::Setting<bool> settings::boolean(const std::string &key,
+                                          bool default_value) {
+    return Setting<bool>(register_key(key, SettingValue(default_value)));
+}
+
+settings::Setting<std::string>
+settings::string(const std::string &key, const std::string &default_value) {
+    return Setting<std::string>(
+        register_key(key, SettingValue(new std::string(default_value))));
+}
+
+uint32_t settings::subscribe(const std::string &pattern,
+                             subscriber_t callback) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (notify_timer == nullptr) {
+        notify_timer = xTimerCreate("Settings Notify",
+                                    pdMS_TO_TICKS(SETTINGS_NOTIFY_DELAY_MS),
+                                    pdFALSE, nullptr, deliver_changes);
+    }
+    bool prefix = !pattern.empty() && pattern.back() == '*';
+    uint32_t id = next_subscription_id++;
+    subscriptions.push_back(subscription_t{
+        id, prefix ? pattern.substr(0, pattern.size() - 1) : pattern, prefix,
+        std::move(callback)});
+    xSemaphoreGive(mutex);
+    return id;
+}
+
+void settings::unsubscribe(uint32_t id) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    for (auto it = subscriptions.begin(); it != subscriptions.end(); ++it) {
+        if (it->id == id) {
+            subscriptions.erase(it);
             break;
         }
     }
-    return 1;
+    xSemaphoreGive(mutex);
+}
+
+void settings::push_js_value(duk_context *ctx, const std::string &key) {
+    push_value(ctx, find_entry(key.c_str()));
+}
+
+bool settings::init() {
+    xSemaphoreTake(io_mutex, portMAX_DELAY);
+    if (!FFat.exists(SETTINGS_LOG_PATH) && FFat.exists(SETTINGS_TMP_PATH)) {
+        // A compaction was interrupted after removing the old log.
+        FFat.rename(SETTINGS_TMP_PATH, SETTINGS_LOG_PATH);
+    }
+    int64_t start = esp_timer_get_time();
+    bool clean = load();
+    store_stats.load_us = esp_timer_get_time() - start;
+    // A missing, foreign or torn log is rewritten from what could be read.
+    persistent = clean || compact();
+    xSemaphoreGive(io_mutex);
+    if (!persistent) {
+        Error<TaskLog>().println("Settings will not be saved: could not "
+                                 "write " SETTINGS_LOG_PATH);
+        return false;
+    }
+    if (writer == nullptr) {
+        registerTaskStack("Settings Writer", SETTINGS_WRITER_STACK_SIZE);
+        xTaskCreate(writer_task, "Settings Writer", SETTINGS_WRITER_STACK_SIZE,
+                    nullptr, SETTINGS_WRITER_PRIORITY, &writer);
+    }
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    bool pending = !dirty.empty();
+    xSemaphoreGive(mutex);
+    if (pending && writer != nullptr) {
+        xTaskNotifyGive(writer);
+    }
+    return true;
+}
+
+void settings::flush() {
+    xSemaphoreTake(io_mutex, portMAX_DELAY);
+    if (persistent) {
+        flush_pending();
+    }
+    xSemaphoreGive(io_mutex);
+}
+
+void settings::create_js_hooks(duk_context *ctx) {
+    duk_push_global_object(ctx);
+    duk_push_object(ctx);
+    duk_push_c_function(ctx, _change_setting, 2);
+    duk_put_prop_string(ctx, -2, "set");
+    duk_push_c_function(ctx, _get_setting, 1);
+    duk_put_prop_string(ctx, -2, "get");
+    duk_push_c_function(ctx, _get_handle, 1);
+    duk_put_prop_string(ctx, -2, "handle");
+    duk_put_prop_string(ctx, -2, "settings");
+    duk_pop(ctx);
 }
 
-void settings::set(std::string key, std::string value) {
-    _settings[key] = Setting(new std::string(value));
+void settings::set(const std::string &key, const std::string &value) {
+    store(key, SettingValue(new std::string(value)));
 }
 
-void settings::set(std::string key, double value) {
-    _settings[key] = Setting(value);
+void settings::set(const std::string &key, double value) {
+    store(key, SettingValue(value));
 }
 
-void settings::set(std::string key, bool value) {
-    _settings[key] = Setting(value);
+void settings::set(const std::string &key, bool value) {
+    store(key, SettingValue(value));
 }
 
 meta::result_t<std::string *, settings::SettingError>
-settings::get_string(std::string key) {
-    if (_settings.find(key) != _settings.end() &&
-        _settings[key].type == SettingType::STRING) {
-        return _settings[key].string;
+settings::get_string(const std::string &key) {
+    meta::result_t<std::string *, SettingError> result =
+        SettingError::NOT_FOUND;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    auto entry = _settings.find(key);
+    if (entry != _settings.end() &&
+        entry->second.value.type == SettingType::STRING) {
+        result = entry->second.value.string;
     }
-    return settings::SettingError::NOT_FOUND;
+    xSemaphoreGive(mutex);
+    return result;
 }
 
 meta::result_t<double, settings::SettingError>
-settings::get_number(std::string key) {
-    if (_settings.find(key) != _settings.end() &&
-        _settings[key].type == SettingType::NUMBER) {
-        return _settings[key].number;
+settings::get_number(const std::string &key) {
+    meta::result_t<double, SettingError> result = SettingError::NOT_FOUND;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    auto entry = _settings.find(key);
+    if (entry != _settings.end() &&
+        entry->second.value.type == SettingType::NUMBER) {
+        result = entry->second.value.number;
     }
-    return settings::SettingError::NOT_FOUND;
+    xSemaphoreGive(mutex);
+    return result;
 }
 
 meta::result_t<bool, settings::SettingError>
-settings::get_boolean(std::string key) {
-    if (_settings.find(key) != _settings.end() &&
-        _settings[key].type == SettingType::BOOLEAN) {
-        return _settings[key].boolean;
+settings::get_boolean(const std::string &key) {
+    meta::result_t<bool, SettingError> result = SettingError::NOT_FOUND;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    auto entry = _settings.find(key);
+    if (entry != _settings.end() &&
+        entry->second.value.type == SettingType::BOOLEAN) {
+        result = entry->second.value.boolean;
     }
-    return settings::SettingError::NOT_FOUND;
-}
\ No newline at end of file
+    xSemaphoreGive(mutex);
+    return result;
+}
+
+settings::store_stats_t settings::stats() {
+    xSemaphoreTake(io_mutex, portMAX_DELAY);
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    store_stats_t result = store_stats;
+    xSemaphoreGive(mutex);
+    xSemaphoreGive(io_mutex);
+    return result;
+}
+
+void settings::print(Print &out) {
+    std::string listing;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    for (const auto &entry : _settings) {
+        const SettingValue &value = entry.second.value;
+        listing += "  " + entry.first + " = ";
+        switch (value.type) {
+        case SettingType::STRING:
+            listing += "\"" + *value.string + "\"";
+            break;
+        case SettingType::NUMBER: {
+            char number[32];
+            snprintf(number, sizeof(number), "%g", value.number);
+            listing += number;
+        } break;
+        case SettingType::BOOLEAN:
+            listing += value.boolean ? "true" : "false";
+            break;
+        default:
+            listing += "unset";
+            break;
+        }
+        listing += "\n";
+    }
+    xSemaphoreGive(mutex);
+    out.print(listing.c_str());
+}
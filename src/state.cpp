@@ -2,6 +2,9 @@
 #include "usb_classes.h"
 #include "taskwrapper.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <stack>
 
 #define CMD_BUF_SIZE 1024
@@ -86,9 +89,64 @@ bool baseSerialParser(char c) {
     return true;
 }
 
+// A parsed command line. Arguments are copied into the arena because the
+// line buffer is reused as soon as the command is queued.
+struct QueuedCmd {
+    Shell::Command cmd;
+    int64_t queuedAt;
+    uint8_t argc;
+    uint16_t argOffsets[SHELL_MAX_ARGS];
+    char arena[SHELL_ARG_ARENA_SIZE];
+};
+
+static QueueHandle_t cmdQueue = nullptr;
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+static Shell::Stats shellStats = {};
+
+auto evaluator = Task("Shell Evaluator", SHELL_EVAL_STACK_SIZE, 1, []() {
+    static QueuedCmd queued;
+    std::vector<const char*> args;
+    args.reserve(SHELL_MAX_ARGS);
+    while (true) {
+        xQueueReceive(cmdQueue, &queued, portMAX_DELAY);
+        int64_t latency = esp_timer_get_time() - queued.queuedAt;
+        portENTER_CRITICAL(&statsLock);
+        ++shellStats.commands;
+        shellStats.lastLatencyUs = latency;
+        shellStats.totalLatencyUs += latency;
+        if (latency > shellStats.maxLatencyUs)
+            shellStats.maxLatencyUs = latency;
+        portEXIT_CRITICAL(&statsLock);
+
+        args.clear();
+        for (size_t i = 0; i < queued.argc; ++i)
+            args.push_back(&queued.arena[queued.argOffsets[i]]);
+        queued.cmd(args);
+        USBSerial.print("\e[92mdev@mouseless\e[0m:\e[36m/\e[0m$ ");
+    }
+});
+
 void Shell::init() {
     if (serialParserStack.empty())
         serialParserStack.push(baseSerialParser);
+    if (!cmdQueue) {
+        cmdQueue = xQueueCreate(SHELL_QUEUE_DEPTH, sizeof(QueuedCmd));
+        evaluator();
+    }
+}
+
+Shell::Stats Shell::stats() {
+    portENTER_CRITICAL(&statsLock);
+    Stats result = shellStats;
+    portEXIT_CRITICAL(&statsLock);
+    return result;
+}
+
+static void dropCmd(const char *reason) {
+    portENTER_CRITICAL(&statsLock);
+    ++shellStats.dropped;
+    portEXIT_CRITICAL(&statsLock);
+    USBSerial.printf("\e[31m%s; command dropped\e[0m\n\e[92mdev@mouseless\e[0m:\e[36m/\e[0m$ ", reason);
 }
 
 void Shell::registerCmd(const char* name, Command cmd) {
@@ -100,11 +158,6 @@ const std::unordered_map<std::string, Shell::Command>& Shell::registry() {
     return cmdRegistry;
 }
 
-auto eval = Task("Shell Evaluator", 10000, 1, [](decltype(std::bind(std::declval<Shell::Command>(), std::declval<std::vector<const char*>&>())) boundCmd){
-    boundCmd();
-    USBSerial.print("\e[92mdev@mouseless\e[0m:\e[36m/\e[0m$ ");
-});
-
 void parseCmd(char *cmd) {
     char* word = cmd;
     std::string name;
@@ -140,12 +193,26 @@ void parseCmd(char *cmd) {
         word = &(cmd[i+1]);
     }
 
-    // Lookup and execute the command
+    // Lookup and queue the command
     auto cmdEntry = cmdRegistry.find(name);
     if (cmdEntry != cmdRegistry.end()) {
-        if(!eval(std::bind(cmdEntry->second, args))) {
-            USBSerial.println("\e[31mCould not launch Shell Evaluator\e[0m");
+        static QueuedCmd queued;
+        queued.cmd = cmdEntry->second;
+        queued.argc = 0;
+        size_t used = 0;
+        for (const char *arg : args) {
+            size_t size = strlen(arg) + 1;
+            if (queued.argc == SHELL_MAX_ARGS || used + size > SHELL_ARG_ARENA_SIZE) {
+                dropCmd("Too many arguments");
+                return;
+            }
+            memcpy(&queued.arena[used], arg, size);
+            queued.argOffsets[queued.argc++] = used;
+            used += size;
         }
+        queued.queuedAt = esp_timer_get_time();
+        if (xQueueSend(cmdQueue, &queued, 0) != pdTRUE)
+            dropCmd("Shell busy");
     }
     else {
         // For some reason, using `name.c_str()` here causes a system crash with names longer than ~4 characters
@@ -166,101 +233,248 @@ BaseCallback *Shell::serialConnectCB = nullptr;
 
 
 
-std::unordered_map<TaskHandle_t, std::string> TaskLog::taskLogRegistry;
+// A record starts with this byte followed by a timestamp in milliseconds,
+// seven bits per byte with the high bit set, so neither can be mistaken for
+// the other when resynchronizing after the oldest bytes were overwritten.
+#define LOG_RECORD_MARK '\x1e'
+#define LOG_STAMP_BYTES 5
+
+struct TaskLog::Ring {
+    enum State : uint8_t { FREE, CLAIMING, READY };
+
+    std::atomic<uint8_t> state;
+    char name[configMAX_TASK_NAME_LEN];
+    // Total bytes written. The writer raises `reserved` before overwriting a
+    // byte and `head` once it is written, so a reader can tell which of the
+    // bytes it copied may have changed underneath it.
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> reserved;
+    // Only touched by the writer
+    bool lineStart;
+    bool inEscape;
+    uint8_t data[TASK_LOG_SIZE];
+
+    void put(uint8_t c) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        reserved.store(h + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        data[h & (TASK_LOG_SIZE - 1)] = c;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    void append(uint8_t c) {
+        // Escape sequences at the start of a line (such as the colour reset
+        // after an error) are not worth a timestamp of their own
+        if (lineStart && !inEscape && c != '\e') {
+            uint32_t now = millis();
+            put(LOG_RECORD_MARK);
+            for (size_t i = 0; i < LOG_STAMP_BYTES; ++i)
+                put(0x80 | ((now >> (7 * i)) & 0x7f));
+            lineStart = false;
+        }
+        if (c == '\e')
+            inEscape = true;
+        else if (inEscape && c >= '@' && c != '[')
+            inEscape = false;
+        put(c);
+        if (c == '\n')
+            lineStart = true;
+    }
+};
+
+static TaskLog::Ring logRings[TASK_LOG_MAX_TASKS];
+static std::atomic<uint32_t> unloggedBytes(0);
+
+static TaskLog::Ring *findRing(const char *name) {
+    for (TaskLog::Ring &ring : logRings) {
+        if (ring.state.load(std::memory_order_acquire) == TaskLog::Ring::READY &&
+            strncmp(ring.name, name, configMAX_TASK_NAME_LEN) == 0)
+            return &ring;
+    }
+    return nullptr;
+}
+
+static TaskLog::Ring *claimRing(const char *name) {
+    for (TaskLog::Ring &ring : logRings) {
+        uint8_t expected = TaskLog::Ring::FREE;
+        if (ring.state.compare_exchange_strong(expected, TaskLog::Ring::CLAIMING,
+                                               std::memory_order_acquire)) {
+            strncpy(ring.name, name, configMAX_TASK_NAME_LEN - 1);
+            ring.name[configMAX_TASK_NAME_LEN - 1] = '\0';
+            ring.lineStart = true;
+            ring.inEscape = false;
+            ring.state.store(TaskLog::Ring::READY, std::memory_order_release);
+            return &ring;
+        }
+    }
+    return nullptr;
+}
+
+TaskLog::TaskLog() {
+    const char *name = pcTaskGetName(nullptr);
+    ring = findRing(name);
+    if (!ring)
+        ring = claimRing(name);
+}
 
 size_t TaskLog::write(uint8_t c) {
-    taskLogRegistry[task] += c;
-    return 1;
+    return write(&c, 1);
 }
 
 size_t TaskLog::write(const uint8_t *buffer, size_t size) {
-    taskLogRegistry[task].append((const char*)buffer, size);
+    if (!ring) {
+        unloggedBytes.fetch_add(size, std::memory_order_relaxed);
+        return size;
+    }
+    for (size_t i = 0; i < size; ++i)
+        ring->append(buffer[i]);
     return size;
 }
 
-const std::string& TaskLog::get() {
-    return taskLogRegistry[task];
-}
+bool TaskLog::dump(const char *taskName, Print &out) {
+    Ring *ring = findRing(taskName);
+    if (!ring)
+        return false;
 
-TaskLog::TaskLog() : task(xTaskGetCurrentTaskHandle())
-{}
+    std::vector<uint8_t> copy(TASK_LOG_SIZE);
+    uint32_t head = ring->head.load(std::memory_order_acquire);
+    uint32_t start = head > TASK_LOG_SIZE ? head - TASK_LOG_SIZE : 0;
+    for (uint32_t i = start; i < head; ++i)
+        copy[i - start] = ring->data[i & (TASK_LOG_SIZE - 1)];
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint32_t reserved = ring->reserved.load(std::memory_order_relaxed);
+
+    // Skip whatever the writer may have overwritten while we copied, then
+    // resynchronize on the next record if the oldest one was cut short
+    uint32_t valid = reserved > TASK_LOG_SIZE ? reserved - TASK_LOG_SIZE : 0;
+    valid = std::max(valid, start);
+    size_t i = valid - start;
+    size_t end = head - start;
+    if (valid > 0) {
+        while (i < end && copy[i] != LOG_RECORD_MARK)
+            ++i;
+        out.printf("(%u earlier bytes overwritten)\n", start + i);
+    }
+    while (i < end) {
+        if (copy[i] == LOG_RECORD_MARK) {
+            if (i + LOG_STAMP_BYTES >= end)
+                break; // The writer is midway through a timestamp
+            uint32_t stamp = 0;
+            for (size_t b = 0; b < LOG_STAMP_BYTES; ++b)
+                stamp |= (uint32_t)(copy[i + 1 + b] & 0x7f) << (7 * b);
+            out.printf("[%6u.%03u] ", stamp / 1000, stamp % 1000);
+            i += 1 + LOG_STAMP_BYTES;
+            continue;
+        }
+        size_t run = i;
+        while (run < end && copy[run] != LOG_RECORD_MARK)
+            ++run;
+        out.write(&copy[i], run - i);
+        i = run;
+    }
+    return true;
+}
 
-TaskLog::TaskLog(TaskHandle_t task) : task(task)
-{}
+void TaskLog::printSummary(Print &out) {
+    for (Ring &ring : logRings) {
+        if (ring.state.load(std::memory_order_acquire) != Ring::READY)
+            continue;
+        uint32_t head = ring.head.load(std::memory_order_relaxed);
+        out.printf(" - %-16s %8u bytes written, %8u overwritten\n", ring.name,
+                   head, head > TASK_LOG_SIZE ? head - TASK_LOG_SIZE : 0);
+    }
+    uint32_t unlogged = unloggedBytes.load(std::memory_order_relaxed);
+    if (unlogged)
+        out.printf("%u bytes from other tasks were dropped (no free log)\n", unlogged);
+}
 
 
 
 std::unordered_map<TaskHandle_t, bool> TaskPrint::taskMonitorRegistry;
+static SemaphoreHandle_t monitorMutex = xSemaphoreCreateMutex();
+
+static const char monitorPrefix[] = "\e7\e[2K\e[1G";
+static const char monitorPrompt[] = "\e[92mdev@mouseless\e[0m:\e[36m/\e[0m$ ";
 
 TaskPrint::TaskPrint()
+    : enabled(isEnabled(xTaskGetCurrentTaskHandle()))
+    , length(0)
 {
-    auto task = taskMonitorRegistry.find(xTaskGetCurrentTaskHandle());
-    if (task == taskMonitorRegistry.end()) {
-        taskMonitorRegistry.insert(std::pair<TaskHandle_t, bool>(xTaskGetCurrentTaskHandle(), false));
-    }
-    else if (task->second) {
-        USBSerial.print("\e7\e[2K\e[1G");
+    if (enabled) {
+        memcpy(buffer, monitorPrefix, sizeof(monitorPrefix) - 1);
+        length = sizeof(monitorPrefix) - 1;
     }
 }
 
+TaskPrint::TaskPrint(TaskPrint &&other)
+    : enabled(other.enabled)
+    , length(other.length)
+{
+    memcpy(buffer, other.buffer, length);
+    other.enabled = false;
+}
+
 TaskPrint::~TaskPrint() {
-    auto task = taskMonitorRegistry.find(xTaskGetCurrentTaskHandle());
-    if (task == taskMonitorRegistry.end()) {
-        taskMonitorRegistry.insert(std::pair<TaskHandle_t, bool>(xTaskGetCurrentTaskHandle(), false));
-    }
-    else if (task->second) {
-        USBSerial.printf("\e[92mdev@mouseless\e[0m:\e[36m/\e[0m$ %s\e8", serialCmd);
-    }
+    if (!enabled)
+        return;
+    // Monitoring output is dropped rather than stalling the task when the
+    // queue is full
+    USBSerial.enqueue({
+        {buffer, length},
+        {monitorPrompt, sizeof(monitorPrompt) - 1},
+        {serialCmd, strnlen(serialCmd, CMD_BUF_SIZE)},
+        {"\e8", 2}
+    }, false);
+}
+
+void TaskPrint::flushBuffer() {
+    USBSerial.enqueue({{buffer, length}}, false);
+    length = 0;
 }
 
 bool TaskPrint::isEnabled() const {
-    auto taskLog = taskMonitorRegistry.find(xTaskGetCurrentTaskHandle());
-    if (taskLog == taskMonitorRegistry.end())
-        return false;
-    else
-        return taskLog->second;
+    return enabled;
 }
 
 size_t TaskPrint::write(const uint8_t c) {
-    if (taskMonitorRegistry.find(xTaskGetCurrentTaskHandle())->second)
-        return USBSerial.write(c);
-    return 0;
+    return write(&c, 1);
 }
 
-size_t TaskPrint::write(const uint8_t *buffer, size_t size) {
-    if (taskMonitorRegistry.find(xTaskGetCurrentTaskHandle())->second == false)
+size_t TaskPrint::write(const uint8_t *data, size_t size) {
+    if (!enabled)
         return 0;
-    size_t n = 0;
-    while (size--) {
-        if (write(*buffer++)) n++;
-        else break;
+    for (size_t i = 0; i < size; ++i) {
+        if (length == TASK_PRINT_BUFFER_SIZE)
+            flushBuffer();
+        buffer[length++] = data[i];
     }
-    return n;
+    return size;
 }
 
 void TaskPrint::call(void (*if_monitoring)(void)) {
-    if (taskMonitorRegistry.find(xTaskGetCurrentTaskHandle())->second == false)
-        return;
-    if_monitoring();
+    if (enabled)
+        if_monitoring();
 }
 
 bool TaskPrint::enable(TaskHandle_t task) {
+    xSemaphoreTake(monitorMutex, portMAX_DELAY);
     taskMonitorRegistry[task] = true;
+    xSemaphoreGive(monitorMutex);
     return true;
 }
 
 void TaskPrint::disable(TaskHandle_t task) {
+    xSemaphoreTake(monitorMutex, portMAX_DELAY);
     auto taskLog = taskMonitorRegistry.find(task);
-    if (taskLog == taskMonitorRegistry.end())
-        return;
-    else
+    if (taskLog != taskMonitorRegistry.end())
         taskLog->second = false;
+    xSemaphoreGive(monitorMutex);
 }
 
 bool TaskPrint::isEnabled(TaskHandle_t task) {
+    xSemaphoreTake(monitorMutex, portMAX_DELAY);
     auto taskLog = taskMonitorRegistry.find(task);
-    if (taskLog == taskMonitorRegistry.end())
-        return false;
-    else
-        return taskLog->second;
-}
\ No newline at end of file
+    bool enabled = taskLog != taskMonitorRegistry.end() && taskLog->second;
+    xSemaphoreGive(monitorMutex);
+    return enabled;
+}
@@ -0,0 +1,230 @@
+#include "timeline.h"
+#include <algorithm>
+#include <new>
+#include <vector>
+#include <xtensa/hal.h>
+
+namespace {
+
+enum anchor_state_t : uint8_t { UNANCHORED, ANCHORING, ANCHORED };
+
+// `seq` is the event's index plus one once it is complete and zero while it
+// is being written, so `dump` can skip events overwritten under it.
+struct event_t {
+    std::atomic<uint32_t> seq;
+    uint32_t cycles;
+    uint32_t ticks;
+    const char *name;
+    TaskHandle_t task; // nullptr in interrupt handlers
+    char phase;
+};
+
+// Cycle counters are per core and wrap every few seconds, so each ring keeps
+// the counter value at a known esp_timer time; the tick count of each event
+// tells `dump` how many times the counter wrapped since.
+struct ring_t {
+    std::atomic<uint32_t> next; // Events ever reserved
+    std::atomic<uint8_t> anchor_state;
+    int64_t anchor_us;
+    uint32_t anchor_cycles;
+    uint32_t anchor_ticks;
+    event_t events[TIMELINE_EVENTS_PER_CORE];
+};
+
+ring_t *rings[portNUM_PROCESSORS] = {nullptr};
+
+TickType_t IRAM_ATTR current_ticks() {
+    return xPortInIsrContext() ? xTaskGetTickCountFromISR()
+                               : xTaskGetTickCount();
+}
+
+void reset(ring_t &ring) {
+    ring.next.store(0, std::memory_order_relaxed);
+    ring.anchor_state.store(UNANCHORED, std::memory_order_relaxed);
+    for (event_t &event : ring.events) {
+        event.seq.store(0, std::memory_order_relaxed);
+    }
+}
+
+// Microseconds since boot, with nanoseconds as a fraction
+void print_timestamp(Print &out, const ring_t &ring, const event_t &event,
+                     uint32_t cycles_per_us) {
+    int64_t cycles_per_tick =
+        static_cast<int64_t>(cycles_per_us) * 1000000 / configTICK_RATE_HZ;
+    int64_t expected =
+        static_cast<int64_t>(event.ticks - ring.anchor_ticks) * cycles_per_tick;
+    int64_t low = static_cast<uint32_t>(event.cycles - ring.anchor_cycles);
+    int64_t wraps = (expected - low + (1LL << 31)) >> 32;
+    int64_t elapsed_ns = std::max<int64_t>(
+        0, (low + (wraps << 32)) * 1000 / cycles_per_us);
+    int64_t ns = ring.anchor_us * 1000 + elapsed_ns;
+    out.printf("%lld.%03lld", ns / 1000, ns % 1000);
+}
+
+} // namespace
+
+std::atomic<bool> timeline::detail::recording(false);
+
+void IRAM_ATTR timeline::detail::write(const char *name, char phase) {
+    // A task can move to the other core between reading the core ID and the
+    // cycle counter; retry until both come from the same core
+    BaseType_t core;
+    uint32_t cycles;
+    do {
+        core = xPortGetCoreID();
+        cycles = xthal_get_ccount();
+    } while (core != xPortGetCoreID());
+    TickType_t ticks = current_ticks();
+
+    ring_t *ring = rings[core];
+    if (ring->anchor_state.load(std::memory_order_acquire) != ANCHORED) {
+        uint8_t expected = UNANCHORED;
+        if (!ring->anchor_state.compare_exchange_strong(expected, ANCHORING)) {
+            return; // Interrupted the context anchoring this ring
+        }
+        ring->anchor_us = esp_timer_get_time();
+        ring->anchor_cycles = cycles;
+        ring->anchor_ticks = ticks;
+        ring->anchor_state.store(ANCHORED, std::memory_order_release);
+    }
+
+    uint32_t index = ring->next.fetch_add(1, std::memory_order_relaxed);
+    event_t &event = ring->events[index & (TIMELINE_EVENTS_PER_CORE - 1)];
+    event.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.cycles = cycles;
+    event.ticks = ticks;
+    event.name = name;
+    event.task = xPortInIsrContext() ? nullptr : xTaskGetCurrentTaskHandle();
+    event.phase = phase;
+    event.seq.store(index + 1, std::memory_order_release);
+}
+
+bool timeline::start() {
+    detail::recording.store(false, std::memory_order_relaxed);
+    if (rings[0] == nullptr) {
+        // Every ring or none: the readers only check the first. Internal RAM,
+        // since interrupt handlers write to it.
+        void *memory[portNUM_PROCESSORS];
+        for (std::size_t core = 0; core < portNUM_PROCESSORS; ++core) {
+            memory[core] =
+                heap_caps_malloc(sizeof(ring_t), MALLOC_CAP_INTERNAL);
+            if (memory[core] == nullptr) {
+                while (core > 0) {
+                    heap_caps_free(memory[--core]);
+                }
+                return false;
+            }
+        }
+        // The first ring last, so a reader that sees it sees them all
+        for (std::size_t core = portNUM_PROCESSORS; core-- > 0;) {
+            rings[core] = new (memory[core]) ring_t();
+        }
+    }
+    for (ring_t *ring : rings) {
+        reset(*ring);
+    }
+    detail::recording.store(true, std::memory_order_release);
+    return true;
+}
+
+void timeline::stop() {
+    detail::recording.store(false, std::memory_order_relaxed);
+}
+
+bool timeline::is_recording() {
+    return detail::recording.load(std::memory_order_relaxed);
+}
+
+void timeline::print_stats(Print &out) {
+    out.printf("Timeline: %s, %u events per core\n",
+               is_recording() ? "recording" : "stopped",
+               TIMELINE_EVENTS_PER_CORE);
+    if (rings[0] == nullptr) {
+        return;
+    }
+    for (std::size_t core = 0; core < portNUM_PROCESSORS; ++core) {
+        uint32_t written = rings[core]->next.load(std::memory_order_relaxed);
+        out.printf(" - core %u: %8u events, %8u overwritten\n", core, written,
+                   written > TIMELINE_EVENTS_PER_CORE
+                       ? written - TIMELINE_EVENTS_PER_CORE
+                       : 0);
+    }
+}
+
+void timeline::dump(Print &out) {
+    uint32_t cycles_per_us = getCpuFrequencyMhz();
+    std::vector<TaskHandle_t> tasks;
+    bool first = true;
+    out.println("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (std::size_t core = 0; core < portNUM_PROCESSORS && rings[0]; ++core) {
+        const ring_t &ring = *rings[core];
+        if (ring.anchor_state.load(std::memory_order_acquire) != ANCHORED) {
+            continue;
+        }
+        uint32_t next = ring.next.load(std::memory_order_acquire);
+        uint32_t index = next > TIMELINE_EVENTS_PER_CORE
+                             ? next - TIMELINE_EVENTS_PER_CORE
+                             : 0;
+        for (; index != next; ++index) {
+            const event_t &slot =
+                ring.events[index & (TIMELINE_EVENTS_PER_CORE - 1)];
+            if (slot.seq.load(std::memory_order_acquire) != index + 1) {
+                continue;
+            }
+            event_t event;
+            event.cycles = slot.cycles;
+            event.ticks = slot.ticks;
+            event.name = slot.name;
+            event.task = slot.task;
+            event.phase = slot.phase;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != index + 1) {
+                continue; // Overwritten while we copied it
+            }
+            // Interrupt handlers get a track per core, numbered by core
+            uint32_t tid = event.task
+                               ? reinterpret_cast<uintptr_t>(event.task)
+                               : core;
+            if (std::find(tasks.begin(), tasks.end(), event.task) ==
+                tasks.end()) {
+                tasks.push_back(event.task);
+            }
+            out.printf("%s{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":0,\"tid\":%u,"
+                       "\"ts\":",
+                       first ? "" : ",\n", event.name, event.phase, tid);
+            print_timestamp(out, ring, event, cycles_per_us);
+            out.printf(",%s\"args\":{\"core\":%u}}",
+                       event.phase == 'i' ? "\"s\":\"t\"," : "", core);
+            first = false;
+        }
+    }
+
+    // Name the tracks; tasks that have since exited are left unnamed
+#if configUSE_TRACE_FACILITY
+    std::vector<TaskStatus_t> status(uxTaskGetNumberOfTasks() + 4);
+    status.resize(uxTaskGetSystemState(status.data(), status.size(), nullptr));
+#endif
+    for (std::size_t core = 0; core < portNUM_PROCESSORS; ++core) {
+        out.printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                   "\"tid\":%u,\"args\":{\"name\":\"Interrupts (core %u)\"}}",
+                   first ? "" : ",\n", core, core);
+        first = false;
+    }
+    for (TaskHandle_t task : tasks) {
+        const char *name = nullptr;
+#if configUSE_TRACE_FACILITY
+        for (const TaskStatus_t &info : status) {
+            if (info.xHandle == task) {
+                name = info.pcTaskName;
+            }
+        }
+#endif
+        if (task != nullptr && name != nullptr) {
+            out.printf(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                       "\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                       reinterpret_cast<uintptr_t>(task), name);
+        }
+    }
+    out.println("\n]}");
+}
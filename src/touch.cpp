@@ -1,14 +1,85 @@
 #include "touch.h"
 
-uint32_t TouchPads::Status::getBits() const {
+namespace TouchPads {
+
+Status status;
+
+namespace detail {
+
+TaskHandle_t consumer = nullptr;
+SpscQueue<Edge, TOUCH_EDGE_QUEUE_LENGTH> edges;
+std::atomic<uint32_t> edgeCount(0);
+std::atomic<uint32_t> overflows(0);
+std::atomic<bool> overflowed(false);
+uint32_t reported = 0;      // Pad states as the consumer last saw them
+
+}  // namespace detail
+
+void IRAM_ATTR ISR(void *arg) {
+    (void) arg;
+    const int64_t now = esp_timer_get_time();
+    uint32_t bits = touch_pad_get_status();
+    uint32_t changed = bits ^ status.bits;
+    status.bits = bits;
+    while (changed) {
+        uint8_t pad = __builtin_ctz(changed);
+        changed &= changed - 1;
+        if (detail::edges.push(Edge{pad, static_cast<bool>(bits >> pad & 1), now}))
+            detail::edgeCount.fetch_add(1, std::memory_order_relaxed);
+        else {
+            detail::overflows.fetch_add(1, std::memory_order_relaxed);
+            detail::overflowed.store(true, std::memory_order_relaxed);
+        }
+    }
+    if (detail::consumer) {
+        BaseType_t taskWoken = pdFALSE;
+        vTaskNotifyGiveFromISR(detail::consumer, &taskWoken);
+        if (taskWoken == pdTRUE)
+            portYIELD_FROM_ISR();
+    }
+}
+
+uint32_t Status::getBits() const {
     return bits;
 }
 
-bool TouchPads::Status::operator[] (size_t i) const {
+bool Status::operator[] (size_t i) const {
     return bits >> i & 1;
 }
 
-void TouchPads::deinit() {
+bool take(Edge& edge) {
+    // Edges that don't change what the consumer knows are repeats of one
+    // made up below
+    while (detail::edges.pop(edge)) {
+        uint32_t bit = 1u << edge.pad;
+        if (static_cast<bool>(detail::reported & bit) != edge.pressed) {
+            detail::reported ^= bit;
+            return true;
+        }
+    }
+    // With edges lost, the ones taken may not add up to where the pads are
+    if (detail::overflowed.exchange(false, std::memory_order_relaxed)) {
+        uint32_t bits = status.getBits();
+        uint32_t changed = bits ^ detail::reported;
+        if (changed) {
+            uint8_t pad = __builtin_ctz(changed);
+            edge = Edge{pad, static_cast<bool>(bits >> pad & 1), esp_timer_get_time()};
+            detail::reported ^= 1u << pad;
+            // Check the other pads on the next call
+            detail::overflowed.store(true, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+Stats stats() {
+    return Stats{detail::edgeCount.load(), detail::overflows.load()};
+}
+
+void deinit() {
     touch_pad_isr_deregister(ISR, NULL);
     touch_pad_deinit();
-}
\ No newline at end of file
+}
+
+}  // namespace TouchPads
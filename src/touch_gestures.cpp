@@ -0,0 +1,67 @@
+#include "touch_gestures.h"
+
+GestureDetector::GestureDetector()
+    : counters{0, 0, 0}
+{
+    for (Pad& pad : pads)
+        pad = Pad{false, false, 0, -1};
+}
+
+size_t GestureDetector::edge(uint8_t index, bool pressed, int64_t timeUs, GestureEvent *out) {
+    if (index >= GESTURE_MAX_PADS)
+        return 0;
+    Pad& pad = pads[index];
+    if (pressed == pad.pressed)
+        return 0;
+    pad.pressed = pressed;
+    if (pressed) {
+        pad.pressTimeUs = timeUs;
+        return 0;
+    }
+
+    size_t count = 0;
+    // Releasing past the click time may beat the tick that starts the drag
+    if (!pad.dragging && timeUs - pad.pressTimeUs > GESTURE_CLICK_MAX_US) {
+        pad.dragging = true;
+        ++counters.drags;
+        out[count++] = GestureEvent{Gesture::DRAG_START, index, pad.pressTimeUs + GESTURE_CLICK_MAX_US};
+    }
+    if (pad.dragging) {
+        pad.dragging = false;
+        pad.lastClickUs = -1;
+        out[count++] = GestureEvent{Gesture::DRAG_END, index, timeUs};
+        return count;
+    }
+    if (pad.lastClickUs >= 0 && pad.pressTimeUs - pad.lastClickUs <= GESTURE_DOUBLE_CLICK_US) {
+        pad.lastClickUs = -1;
+        ++counters.doubleClicks;
+        out[count++] = GestureEvent{Gesture::DOUBLE_CLICK, index, timeUs};
+    } else {
+        pad.lastClickUs = timeUs;
+        ++counters.clicks;
+        out[count++] = GestureEvent{Gesture::CLICK, index, timeUs};
+    }
+    return count;
+}
+
+size_t GestureDetector::tick(int64_t nowUs, GestureEvent *out) {
+    size_t count = 0;
+    for (uint8_t i = 0; i < GESTURE_MAX_PADS && count < GESTURE_MAX_EVENTS; ++i) {
+        Pad& pad = pads[i];
+        if (pad.pressed && !pad.dragging && nowUs - pad.pressTimeUs > GESTURE_CLICK_MAX_US) {
+            pad.dragging = true;
+            ++counters.drags;
+            out[count++] = GestureEvent{Gesture::DRAG_START, i, pad.pressTimeUs + GESTURE_CLICK_MAX_US};
+        }
+    }
+    return count;
+}
+
+int64_t GestureDetector::nextDeadline() const {
+    int64_t deadline = INT64_MAX;
+    for (const Pad& pad : pads) {
+        if (pad.pressed && !pad.dragging && pad.pressTimeUs + GESTURE_CLICK_MAX_US < deadline)
+            deadline = pad.pressTimeUs + GESTURE_CLICK_MAX_US;
+    }
+    return deadline;
+}
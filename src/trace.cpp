@@ -0,0 +1,140 @@
+#include "trace.h"
+
+#ifdef BINARY_TRACE
+
+namespace {
+
+// One ring per task name, written only by that task and drained by `dump`.
+// Unlike the text logs, a full ring drops new records: records can't be
+// resynchronized once their start is overwritten.
+struct ring_t {
+    std::atomic<TaskHandle_t> owner;
+    char name[configMAX_TASK_NAME_LEN];
+    std::atomic<uint32_t> head; // Bytes ever written
+    std::atomic<uint32_t> tail; // Bytes ever drained
+    std::atomic<uint32_t> records;
+    std::atomic<uint32_t> dropped;
+    uint8_t data[TRACE_RING_SIZE];
+};
+
+ring_t rings[TRACE_MAX_TASKS];
+std::atomic<uint32_t> untraced(0);
+
+ring_t *find_ring(TaskHandle_t task) {
+    for (ring_t &ring : rings) {
+        if (ring.owner.load(std::memory_order_acquire) == task) {
+            return &ring;
+        }
+    }
+    // A task restarted under the same name (like the shell evaluator) takes
+    // over the ring of its predecessor
+    const char *name = pcTaskGetName(task);
+    for (ring_t &ring : rings) {
+        TaskHandle_t owner = ring.owner.load(std::memory_order_acquire);
+        if (owner == nullptr) {
+            TaskHandle_t expected = nullptr;
+            if (ring.owner.compare_exchange_strong(expected, task)) {
+                strncpy(ring.name, name, configMAX_TASK_NAME_LEN - 1);
+                return &ring;
+            }
+        }
+        if (strncmp(ring.name, name, configMAX_TASK_NAME_LEN) == 0) {
+            ring.owner.store(task, std::memory_order_release);
+            return &ring;
+        }
+    }
+    return nullptr;
+}
+
+const char base64_digits[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#define DUMP_CHUNK_SIZE 48 // Bytes per base64 line
+
+void print_base64(Print &out, const uint8_t *data, std::size_t size) {
+    char line[2 + DUMP_CHUNK_SIZE / 3 * 4 + 1];
+    std::size_t length = 0;
+    line[length++] = 'D';
+    line[length++] = ' ';
+    for (std::size_t i = 0; i < size; i += 3) {
+        uint32_t bits = data[i] << 16;
+        if (i + 1 < size) {
+            bits |= data[i + 1] << 8;
+        }
+        if (i + 2 < size) {
+            bits |= data[i + 2];
+        }
+        line[length++] = base64_digits[(bits >> 18) & 0x3f];
+        line[length++] = base64_digits[(bits >> 12) & 0x3f];
+        line[length++] = i + 1 < size ? base64_digits[(bits >> 6) & 0x3f] : '=';
+        line[length++] = i + 2 < size ? base64_digits[bits & 0x3f] : '=';
+    }
+    line[length++] = '\n';
+    out.write(reinterpret_cast<const uint8_t *>(line), length);
+}
+
+} // namespace
+
+void trace::detail::commit(const uint8_t *record, std::size_t size) {
+    ring_t *ring = find_ring(xTaskGetCurrentTaskHandle());
+    if (ring == nullptr) {
+        untraced.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    uint32_t head = ring->head.load(std::memory_order_relaxed);
+    uint32_t tail = ring->tail.load(std::memory_order_acquire);
+    if (record == nullptr || TRACE_RING_SIZE - (head - tail) < size) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    std::size_t offset = head & (TRACE_RING_SIZE - 1);
+    std::size_t first = std::min(size, TRACE_RING_SIZE - offset);
+    memcpy(ring->data + offset, record, first);
+    memcpy(ring->data, record + first, size - first);
+    ring->head.store(head + size, std::memory_order_release);
+    ring->records.fetch_add(1, std::memory_order_relaxed);
+}
+
+void trace::print_stats(Print &out) {
+    out.printf("Trace rings (%u bytes each):\n", TRACE_RING_SIZE);
+    for (ring_t &ring : rings) {
+        if (ring.owner.load(std::memory_order_acquire) == nullptr) {
+            break;
+        }
+        uint32_t pending = ring.head.load(std::memory_order_relaxed) -
+                           ring.tail.load(std::memory_order_relaxed);
+        out.printf(" - %-16s %8u records, %8u dropped, %5u bytes pending\n",
+                   ring.name, ring.records.load(), ring.dropped.load(),
+                   pending);
+    }
+    if (untraced.load()) {
+        out.printf("%u records from other tasks were dropped (no free ring)\n",
+                   untraced.load());
+    }
+}
+
+void trace::dump(Print &out) {
+    uint8_t chunk[DUMP_CHUNK_SIZE];
+    out.println("--- trace begin ---");
+    for (ring_t &ring : rings) {
+        if (ring.owner.load(std::memory_order_acquire) == nullptr) {
+            break;
+        }
+        out.printf("T %u %s\n", ring.dropped.load(), ring.name);
+        uint32_t tail = ring.tail.load(std::memory_order_relaxed);
+        uint32_t head = ring.head.load(std::memory_order_acquire);
+        // Stop at the head seen on entry so a busy task can't keep us here
+        while (tail != head) {
+            std::size_t size = std::min<std::size_t>(head - tail, sizeof(chunk));
+            for (std::size_t i = 0; i < size; ++i) {
+                chunk[i] = ring.data[(tail + i) & (TRACE_RING_SIZE - 1)];
+            }
+            tail += size;
+            ring.tail.store(tail, std::memory_order_release);
+            print_base64(out, chunk, size);
+        }
+    }
+    out.println("--- trace end ---");
+}
+
+#endif
@@ -1,11 +1,13 @@
 #include "usb_classes.h"
 
+#include <algorithm>
 #include <unordered_map>
 #include <vector>
 
 #include "flashdisk.h"
 #include "cdcusb.h"
 #include "state.h"
+#include "taskwrapper.h"
 
 #if CFG_TUD_MSC
 
@@ -35,7 +37,120 @@ bool initMSC()
 
 #if CFG_TUD_CDC
 
-CDCusb USBSerial;
+static TaskHandle_t serialWriter = nullptr;
+
+BufferedCDC::BufferedCDC()
+    : lock(portMUX_INITIALIZER_UNLOCKED)
+    , head(0)
+    , tail(0)
+    , counters()
+{}
+
+size_t BufferedCDC::write(uint8_t c) {
+    return enqueue({{&c, 1}}, true) ? 1 : 0;
+}
+
+size_t BufferedCDC::write(const uint8_t *buffer, size_t size) {
+    // Long outputs (such as `tree`) are queued in pieces as the writer drains
+    size_t written = 0;
+    while (written < size) {
+        size_t n = std::min(size - written, (size_t)SERIAL_OUT_CHUNK_SIZE);
+        if (!enqueue({{buffer + written, n}}, true))
+            break;
+        written += n;
+    }
+    return written;
+}
+
+bool BufferedCDC::enqueue(std::initializer_list<Chunk> chunks, bool wait) {
+    size_t total = 0;
+    for (const Chunk &chunk : chunks)
+        total += chunk.size;
+
+    TickType_t start = xTaskGetTickCount();
+    while (true) {
+        bool queued = false;
+        bool wasEmpty = false;
+        portENTER_CRITICAL(&lock);
+        if (total <= SERIAL_OUT_BUFFER_SIZE - (head - tail)) {
+            wasEmpty = head == tail;
+            for (const Chunk &chunk : chunks) {
+                const uint8_t *data = static_cast<const uint8_t *>(chunk.data);
+                for (size_t i = 0; i < chunk.size; ++i)
+                    ring[head++ % SERIAL_OUT_BUFFER_SIZE] = data[i];
+            }
+            counters.bytesQueued += total;
+            if (head - tail > counters.peakFill)
+                counters.peakFill = head - tail;
+            queued = true;
+        }
+        else if (!wait || xTaskGetTickCount() - start >= pdMS_TO_TICKS(SERIAL_OUT_WAIT_MS)) {
+            counters.bytesDropped += total;
+            portEXIT_CRITICAL(&lock);
+            return false;
+        }
+        portEXIT_CRITICAL(&lock);
+
+        if (queued) {
+            if (wasEmpty && serialWriter)
+                xTaskNotifyGive(serialWriter);
+            return true;
+        }
+        vTaskDelay(1);
+    }
+}
+
+size_t BufferedCDC::take(uint8_t *out, size_t max) {
+    portENTER_CRITICAL(&lock);
+    size_t n = std::min((size_t)(head - tail), max);
+    for (size_t i = 0; i < n; ++i)
+        out[i] = ring[tail++ % SERIAL_OUT_BUFFER_SIZE];
+    portEXIT_CRITICAL(&lock);
+    return n;
+}
+
+void BufferedCDC::writerTask(void *arg) {
+    BufferedCDC *serial = static_cast<BufferedCDC *>(arg);
+    static uint8_t chunk[SERIAL_OUT_CHUNK_SIZE];
+    while (true) {
+        size_t n;
+        while ((n = serial->take(chunk, sizeof(chunk))) > 0) {
+            // Output is discarded while no terminal is connected
+            size_t sent = serial->CDCusb::write(chunk, n);
+            portENTER_CRITICAL(&serial->lock);
+            serial->counters.bytesSent += sent;
+            ++serial->counters.usbWrites;
+            portEXIT_CRITICAL(&serial->lock);
+        }
+        // Producers notify us when the queue stops being empty
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+bool BufferedCDC::startWriter() {
+    if (serialWriter)
+        return true;
+    resetStats();
+    registerTaskStack("Serial Writer", SERIAL_WRITER_STACK_SIZE);
+    return pdPASS == xTaskCreate(writerTask, "Serial Writer", SERIAL_WRITER_STACK_SIZE,
+                                 this, SERIAL_WRITER_PRIORITY, &serialWriter);
+}
+
+BufferedCDC::Stats BufferedCDC::stats() {
+    portENTER_CRITICAL(&lock);
+    Stats result = counters;
+    portEXIT_CRITICAL(&lock);
+    return result;
+}
+
+void BufferedCDC::resetStats() {
+    portENTER_CRITICAL(&lock);
+    counters = Stats();
+    counters.since = esp_timer_get_time();
+    portEXIT_CRITICAL(&lock);
+}
+
+BufferedCDC USBSerial;
 
 class MyCDCCallbacks : public CDCCallbacks {
     void onCodingChange(cdc_line_coding_t const* p_line_coding)
@@ -72,7 +187,52 @@ bool initSerial()
     // USBSerial.setWantedChar('x');
 
     memcpy(lblBuf2, l2, len(l2));
-    return USBSerial.begin(lblBuf2);
+    return USBSerial.startWriter() && USBSerial.begin(lblBuf2);
+}
+
+#endif
+
+#if CFG_TUD_HID
+
+#define EPNUM_HID 0x03
+
+FastHIDMouse USBMouse;
+
+FastHIDMouse::FastHIDMouse() {
+    report_id = USB_MOUSE_REPORT_ID;
+    enableHID = true;
+    _EPNUM_HID = EPNUM_HID;
+}
+
+bool FastHIDMouse::begin(char *str) {
+    // As HIDmouse::begin, apart from the polling interval
+    uint8_t const desc_hid_report[] = {TUD_HID_REPORT_DESC_MOUSE(HID_REPORT_ID(report_id))};
+    uint8_t hid[] = {TUD_HID_DESCRIPTOR(ifIdx++, 6, HID_ITF_PROTOCOL_MOUSE, sizeof(desc_hid_report), (uint8_t)(_EPNUM_HID | 0x80), CFG_TUD_HID_BUFSIZE, USB_MOUSE_POLL_MS)};
+    memcpy(&desc_configuration[total], hid, sizeof(hid));
+    total += sizeof(hid);
+    count++;
+
+    memcpy(&hid_report_desc[EspTinyUSB::hid_report_desc_len], desc_hid_report, sizeof(desc_hid_report));
+    // The configuration descriptor counts this as the interface's length
+    EspTinyUSB::hid_report_desc_len += TUD_HID_DESC_LEN;
+    return EspTinyUSB::begin(str, 6);
+}
+
+bool FastHIDMouse::ready() const {
+    return usbMounted && tud_hid_ready();
+}
+
+bool FastHIDMouse::report(uint8_t buttons, int8_t x, int8_t y, int8_t wheel) {
+    return ready() && tud_hid_mouse_report(report_id, buttons, x, y, wheel, 0);
+}
+
+const char l3[] = "Mouseless Mouse";
+char lblBuf3[len(l3)];
+
+bool initHID()
+{
+    memcpy(lblBuf3, l3, len(l3));
+    return USBMouse.begin(lblBuf3);
 }
 
 #endif
@@ -0,0 +1,27 @@
+#!/bin/sh
+# Regenerates lib/duktape-2.7.0/src from the vendored Duktape distribution
+# using mouseless.yaml and duk_config_fixup.h. Needs Python 2 with PyYAML,
+# as required by Duktape's tools/configure.py. Run from anywhere:
+#
+#     tools/duktape/configure.sh
+#
+# The output is deterministic; commit the regenerated sources along with
+# any change to the configuration.
+set -e
+
+here="$(cd "$(dirname "$0")" && pwd)"
+duktape="$here/../../lib/duktape-2.7.0"
+python="${PYTHON2:-python2}"
+
+"$python" "$duktape/tools/configure.py" \
+    --source-directory "$duktape/src-input" \
+    --config-metadata "$duktape/config" \
+    --duk-dist-meta "$duktape/duk_dist_meta.json" \
+    --output-directory "$duktape/src" \
+    --line-directives \
+    --emit-legacy-feature-check \
+    --emit-config-sanity-check \
+    --rom-support \
+    --option-file "$here/mouseless.yaml" \
+    --fixup-file "$here/duk_config_fixup.h" \
+    --quiet
@@ -0,0 +1,9 @@
+/* Mouseless: abort scripts that overrun their time budget, see
+ * threeml::JSExecutor.  Implemented in src/3ml_jsexecutor.cpp.
+ */
+#if defined(__cplusplus)
+extern "C"
+#endif
+int duk_exec_timeout_check(void *udata);
+#undef DUK_USE_EXEC_TIMEOUT_CHECK
+#define DUK_USE_EXEC_TIMEOUT_CHECK(udata) duk_exec_timeout_check((udata))
@@ -0,0 +1,188 @@
+// Drives the report scheduler through a simulated transport, as the mouse
+// output task does on the device, and checks what the host would see.
+// Builds on any host, since neither depends on the device:
+//
+//   g++ -std=c++11 -O2 -Iinclude tools/hid/report_test.cpp src/report_scheduler.cpp -o report_test
+//   ./report_test
+//
+// Each case prints pass or FAIL; any failure exits with 1.
+
+#include <cstdio>
+#include <vector>
+#include "mouse_transport.h"
+#include "report_scheduler.h"
+
+// As BleMouse defines them
+#define MOUSE_LEFT 1
+#define MOUSE_RIGHT 2
+
+#define STEP_US 250     // How far the clock moves between flushes
+
+namespace {
+
+int failures = 0;
+
+void check(const char *name, bool ok) {
+    printf("%s: %s\n", name, ok ? "pass" : "FAIL");
+    if (!ok)
+        ++failures;
+}
+
+// Flushes on a clock that moves STEP_US at a time, until nothing is
+// pending or `limitUs` has passed
+void drain(ReportScheduler& scheduler, SimulatedTransport& transport, int64_t limitUs) {
+    for (int64_t us = 0; us < limitUs && scheduler.pending(); us += STEP_US, transport.advance(STEP_US))
+        scheduler.flush(transport);
+}
+
+bool matches(const SimulatedTransport& transport, const std::vector<MouseReport>& expected) {
+    if (transport.reports().size() != expected.size())
+        return false;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const MouseReport& got = transport.reports()[i].report;
+        if (got.buttons != expected[i].buttons || got.x != expected[i].x || got.y != expected[i].y || got.wheel != expected[i].wheel)
+            return false;
+    }
+    return true;
+}
+
+void print(const SimulatedTransport& transport) {
+    for (const SimulatedTransport::Sent& sent : transport.reports())
+        printf("  %6lld us: buttons %u, x %d, y %d, wheel %d\n", static_cast<long long>(sent.timeUs),
+            sent.report.buttons, sent.report.x, sent.report.y, sent.report.wheel);
+}
+
+// A delta too large for one report is split, not clamped
+void split() {
+    SimulatedTransport usb(1000);
+    ReportScheduler scheduler;
+    scheduler.addMotion(1000, -300);
+    drain(scheduler, usb, 20000);
+    int32_t sumX = 0, sumY = 0;
+    for (const SimulatedTransport::Sent& sent : usb.reports()) {
+        sumX += sent.report.x;
+        sumY += sent.report.y;
+    }
+    bool ok = usb.reports().size() == 8 && sumX == 1000 && sumY == -300 && scheduler.stats().splits == 7;
+    check("Split", ok);
+    if (!ok)
+        print(usb);
+}
+
+// A click shorter than a slot still gets a press and a release, each with
+// the motion from while it lasted
+void shortClick() {
+    SimulatedTransport usb(1000);
+    ReportScheduler scheduler;
+    scheduler.addMotion(5, 0);
+    scheduler.flush(usb);
+    scheduler.addMotion(3, 0);
+    scheduler.setButtons(MOUSE_LEFT);
+    scheduler.addMotion(2, 0);
+    scheduler.setButtons(0);
+    scheduler.addMotion(1, 0);
+    drain(scheduler, usb, 10000);
+    bool ok = matches(usb, {{0, 5, 0, 0}, {0, 3, 0, 0}, {MOUSE_LEFT, 2, 0, 0}, {0, 1, 0, 0}});
+    check("Short click", ok);
+    if (!ok)
+        print(usb);
+}
+
+// Overlapping presses of two buttons come out in the order they happened
+void overlappingClicks() {
+    SimulatedTransport usb(1000);
+    ReportScheduler scheduler;
+    scheduler.setButtons(MOUSE_LEFT);
+    scheduler.setButtons(MOUSE_LEFT | MOUSE_RIGHT);
+    scheduler.setButtons(MOUSE_RIGHT);
+    scheduler.setButtons(0);
+    drain(scheduler, usb, 10000);
+    bool ok = matches(usb, {{MOUSE_LEFT, 0, 0, 0}, {MOUSE_LEFT | MOUSE_RIGHT, 0, 0, 0}, {MOUSE_RIGHT, 0, 0, 0}, {0, 0, 0, 0}});
+    check("Overlapping clicks", ok);
+    if (!ok)
+        print(usb);
+}
+
+// Changes past the segments waiting are turned away, not merged, and are
+// taken again once a report frees a segment
+void buttonOverflow() {
+    SimulatedTransport usb(1000);
+    ReportScheduler scheduler;
+    scheduler.addMotion(1, 0);
+    uint8_t buttons = 0;
+    int accepted = 0;
+    while (scheduler.setButtons(buttons ^ MOUSE_LEFT)) {
+        buttons ^= MOUSE_LEFT;
+        ++accepted;
+    }
+    bool full = accepted == REPORT_SEGMENTS - 1 && scheduler.stats().buttonOverflows == 1;
+    scheduler.flush(usb);
+    bool freed = scheduler.setButtons(buttons ^ MOUSE_LEFT);
+    check("Button overflow", full && freed);
+}
+
+// 200 Hz of motion through 7.5 ms slots merges without losing any
+void merge() {
+    SimulatedTransport ble(7500);
+    ReportScheduler scheduler;
+    uint32_t random = 42;
+    int32_t in = 0, out = 0;
+    for (int us = 0; us < 1000000; us += STEP_US, ble.advance(STEP_US)) {
+        if (us % 5000 == 0) {
+            random = random * 1664525u + 1013904223u;
+            int32_t dx = static_cast<int32_t>((random >> 16) % 81) - 40;
+            scheduler.addMotion(dx, 0);
+            in += dx;
+        }
+        scheduler.flush(ble);
+    }
+    drain(scheduler, ble, 100000);
+    for (const SimulatedTransport::Sent& sent : ble.reports())
+        out += sent.report.x;
+    printf("  %d in, %d out in %zu reports, %u updates merged\n", in, out, ble.reports().size(), scheduler.stats().merged);
+    check("Merge", in == out && ble.reports().size() <= 135 && scheduler.stats().merged > 0);
+}
+
+// What the output task does while the host is gone: anything pending is
+// discarded, after which nothing is, so the task can sleep. Nothing from
+// while the host was gone is sent once it is back.
+void disconnect() {
+    SimulatedTransport usb(1000);
+    ReportScheduler scheduler;
+    usb.setConnected(false);
+    scheduler.addMotion(10, 10);
+    scheduler.setButtons(MOUSE_LEFT);
+    scheduler.addMotion(5, 0);
+    int discards = 0;
+    for (int wake = 0; wake < 1000; ++wake, usb.advance(1000)) {
+        if (!scheduler.pending())
+            break;
+        scheduler.discard();
+        ++discards;
+    }
+    bool settled = discards == 1 && !scheduler.pending();
+
+    usb.setConnected(true);
+    drain(scheduler, usb, 10000);
+    bool quiet = usb.reports().empty();
+
+    // And once back, a release from while it was gone still goes out
+    scheduler.setButtons(0);
+    drain(scheduler, usb, 10000);
+    bool released = matches(usb, {{0, 0, 0, 0}});
+    check("Disconnect", settled && quiet && released);
+    if (!(settled && quiet && released))
+        printf("  %d discards, pending %d\n", discards, scheduler.pending());
+}
+
+}  // namespace
+
+int main() {
+    split();
+    shortClick();
+    overlappingClicks();
+    buttonOverflow();
+    merge();
+    disconnect();
+    return failures ? 1 : 0;
+}
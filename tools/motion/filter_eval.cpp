@@ -0,0 +1,174 @@
+// Compares motion filter settings on captures recorded with the `record`
+// shell command, which can be copied off the device's USB drive. Builds on
+// any host, since the motion engine and capture format don't depend on the
+// device:
+//
+//   g++ -std=c++11 -O2 -Iinclude tools/motion/filter_eval.cpp src/motion_engine.cpp -o filter_eval
+//   ./filter_eval capture.mlc [none | ema:<cutoff> | one_euro:<min cutoff>:<beta>:<derivative cutoff>]...
+//
+// Without filter arguments a few representative ones are compared. For each
+// axis it reports
+//   jitter  RMS change per sample while the hand is at rest, in millidegrees
+//   lag     how far the output trails the input while moving, in milliseconds
+// Rest and movement are told apart by the unfiltered speed over the last
+// 50 ms; samples in between count towards neither.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "capture_format.h"
+#include "motion_engine.h"
+
+#define SPEED_WINDOW_US 50000
+#define REST_MAX_DPS 5.0
+#define MOVING_MIN_DPS 30.0
+
+namespace {
+
+struct Sample {
+    int64_t timeUs;
+    double yaw;
+    double pitch;
+};
+
+struct Axis {
+    double jitterSquares = 0;
+    size_t restSamples = 0;
+    double trailing = 0;        // Degrees the output was behind, summed
+    double speeds = 0;          // Degrees per second, summed over the same samples
+    size_t movingSamples = 0;
+};
+
+double wrap(double delta) {
+    return delta > 180 ? delta - 360 : delta < -180 ? delta + 360 : delta;
+}
+
+bool loadSamples(const char *path, std::vector<Sample>& samples) {
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return false;
+    std::vector<uint8_t> data;
+    uint8_t chunk[4096];
+    size_t length;
+    while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        data.insert(data.end(), chunk, chunk + length);
+    fclose(file);
+
+    CaptureReader reader(data.data(), data.size());
+    if (!reader.valid())
+        return false;
+    CaptureRecord record;
+    while (reader.next(record)) {
+        if (record.type == CaptureRecordType::ORIENTATION)
+            samples.push_back(Sample{record.timeUs, record.orientation.yaw, record.orientation.pitch});
+    }
+    return true;
+}
+
+bool parseFilter(const char *text, FilterConfig& config) {
+    config = FilterConfig{FilterKind::NONE, 1.f, 0.f, 1.f};
+    if (strcmp(text, "none") == 0)
+        return true;
+    if (sscanf(text, "ema:%f", &config.minCutoffHz) == 1) {
+        config.kind = FilterKind::EMA;
+        return true;
+    }
+    if (sscanf(text, "one_euro:%f:%f:%f", &config.minCutoffHz, &config.beta, &config.derivativeCutoffHz) == 3) {
+        config.kind = FilterKind::ONE_EURO;
+        return true;
+    }
+    return false;
+}
+
+// Runs the samples through a filter and scores both axes
+void evaluate(const std::vector<Sample>& samples, const FilterConfig& config, Axis& yaw, Axis& pitch) {
+    MotionFilter filter;
+    filter.configure(config);
+    double lastYaw = 0, lastPitch = 0;
+    size_t windowStart = 0;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        const Sample& s = samples[i];
+        q16_t y = toQ16(static_cast<float>(s.yaw));
+        q16_t p = toQ16(static_cast<float>(s.pitch));
+        filter.update(y, p, s.timeUs);
+        double outYaw = fromQ16(y), outPitch = fromQ16(p);
+
+        while (s.timeUs - samples[windowStart].timeUs > SPEED_WINDOW_US)
+            ++windowStart;
+        const Sample& first = samples[windowStart];
+        if (i > 0 && s.timeUs > first.timeUs) {
+            double seconds = (s.timeUs - first.timeUs) / 1e6;
+            double yawSpeed = std::fabs(wrap(s.yaw - first.yaw)) / seconds;
+            double pitchSpeed = std::fabs(s.pitch - first.pitch) / seconds;
+            double speed = std::hypot(yawSpeed, pitchSpeed);
+            if (speed < REST_MAX_DPS) {
+                double dy = wrap(outYaw - lastYaw), dp = outPitch - lastPitch;
+                yaw.jitterSquares += dy * dy;
+                pitch.jitterSquares += dp * dp;
+                ++yaw.restSamples;
+                ++pitch.restSamples;
+            } else if (speed > MOVING_MIN_DPS) {
+                yaw.trailing += std::fabs(wrap(s.yaw - outYaw));
+                yaw.speeds += yawSpeed;
+                ++yaw.movingSamples;
+                pitch.trailing += std::fabs(s.pitch - outPitch);
+                pitch.speeds += pitchSpeed;
+                ++pitch.movingSamples;
+            }
+        }
+        lastYaw = outYaw;
+        lastPitch = outPitch;
+    }
+}
+
+double jitterMdeg(const Axis& axis) {
+    return axis.restSamples ? 1000 * std::sqrt(axis.jitterSquares / axis.restSamples) : NAN;
+}
+
+double lagMs(const Axis& axis) {
+    return axis.speeds > 0 ? 1000 * axis.trailing / axis.speeds : NAN;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <capture> [filter]...\n", argv[0]);
+        return 2;
+    }
+    std::vector<Sample> samples;
+    if (!loadSamples(argv[1], samples)) {
+        fprintf(stderr, "%s is not a readable capture\n", argv[1]);
+        return 1;
+    }
+    if (samples.size() < 2) {
+        fprintf(stderr, "%s has no orientation samples\n", argv[1]);
+        return 1;
+    }
+
+    std::vector<std::string> filters(argv + 2, argv + argc);
+    if (filters.empty())
+        filters = {"none", "ema:5", "ema:15", "one_euro:1:0.05:1", "one_euro:1:0.2:1", "one_euro:3:0.1:1"};
+
+    double seconds = (samples.back().timeUs - samples.front().timeUs) / 1e6;
+    printf("%zu samples over %.1f s (%.0f Hz)\n", samples.size(), seconds, samples.size() / seconds);
+    printf("%-24s %12s %12s %10s %10s\n", "filter", "yaw jitter", "pitch jitter", "yaw lag", "pitch lag");
+    size_t rest = 0, moving = 0;
+    for (const std::string& text : filters) {
+        FilterConfig config;
+        if (!parseFilter(text.c_str(), config)) {
+            fprintf(stderr, "Can't parse filter \"%s\"\n", text.c_str());
+            return 2;
+        }
+        Axis yaw, pitch;
+        evaluate(samples, config, yaw, pitch);
+        printf("%-24s %7.2f mdeg %7.2f mdeg %7.1f ms %7.1f ms\n", text.c_str(), jitterMdeg(yaw), jitterMdeg(pitch), lagMs(yaw), lagMs(pitch));
+        rest = yaw.restSamples;
+        moving = yaw.movingSamples;
+    }
+    printf("Jitter over %zu samples at rest, lag over %zu moving\n", rest, moving);
+    return 0;
+}
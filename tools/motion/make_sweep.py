@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Writes captures/sweep.mlc, the capture replay_test.cpp checks the motion
+engine against. It is made up rather than recorded, so that it is small and
+the same on every machine, but it is in the format the `record` shell command
+writes and covers what a hand does: holding still with tremor, quick and slow
+sweeps on both axes, and turning across the ±180° heading seam. Sample
+intervals wander around 5 ms like the IMU's, and one gap is long enough to
+make the engine restart tracking.
+
+    python3 tools/motion/make_sweep.py
+
+Regenerating it changes the expected motion; run replay_test with --update
+afterwards and commit both files.
+"""
+
+import math
+import os
+import random
+import struct
+
+RATE_US = 5000
+MAGIC = b"MLCP"
+VERSION = 1
+ORIENTATION = 1
+TOUCH = 2
+
+
+def ease(t):
+    """0 to 1 with zero speed at both ends, like a hand's reach"""
+    t = min(max(t, 0.0), 1.0)
+    return 0.5 - 0.5 * math.cos(math.pi * t)
+
+
+def pose(t):
+    """Heading and pitch in degrees at `t` seconds"""
+    yaw = 170.0
+    pitch = 0.0
+    yaw += 15.0 * ease((t - 0.5) / 0.25)    # Quick flick across the seam
+    yaw -= 25.0 * ease((t - 1.2) / 0.8)     # Slow sweep back
+    pitch -= 12.0 * ease((t - 2.2) / 0.3)   # Quick nod down
+    pitch += 4.0 * (t - 2.8) if t > 2.8 else 0.0   # Slow drift, near the dead zone
+    return yaw, pitch
+
+
+def wrap(angle):
+    return (angle + 180.0) % 360.0 - 180.0
+
+
+def main():
+    rng = random.Random(42)
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "captures", "sweep.mlc")
+    out = bytearray(struct.pack("<4sHHq", MAGIC, VERSION, 0, 0))
+    time_us = 0
+    while time_us < 3500000:
+        yaw, pitch = pose(time_us / 1e6)
+        # Tremor and sensor noise, around a twentieth of a degree
+        yaw += rng.gauss(0.0, 0.03) + 0.02 * math.sin(2 * math.pi * 9 * time_us / 1e6)
+        pitch += rng.gauss(0.0, 0.03)
+        out += struct.pack("<BIfff", ORIENTATION, time_us, 0.0, pitch, wrap(yaw))
+        if time_us == 1000000:
+            out += struct.pack("<BIBB", TOUCH, time_us, 1, 1)
+        if time_us == 1100000:
+            out += struct.pack("<BIBB", TOUCH, time_us, 1, 0)
+        time_us += RATE_US + rng.randint(-300, 300)
+        if 2000000 <= time_us < 2000000 + RATE_US + 300:
+            time_us += 150000   # A stall past MOTION_MAX_INTERVAL_US
+    with open(path, "wb") as f:
+        f.write(out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,192 @@
+// Replays captures through the motion engine, the same way the IMU task
+// feeds it, and checks the pointer motion against what was recorded for
+// the capture before. Also times the engine. Builds on any host, since the
+// motion engine and capture format don't depend on the device:
+//
+//   g++ -std=c++11 -O2 -Iinclude tools/motion/replay_test.cpp src/motion_engine.cpp -o replay_test
+//   ./replay_test tools/motion/captures/sweep.mlc
+//
+// Each capture <name>.mlc has a <name>.expected next to it with the number
+// of samples, the total motion on each axis and a checksum of every delta in
+// order. A mismatch exits with 1, so this serves as a regression test for
+// changes to the engine that should not move the pointer. After a change
+// that is meant to, review the new totals and rewrite the file with
+//
+//   ./replay_test --update tools/motion/captures/sweep.mlc
+//
+// The engine is set up as the default settings set it up on the device.
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "capture_format.h"
+#include "motion_checksum.h"
+#include "motion_engine.h"
+
+#define BENCHMARK_MIN_SAMPLES 2000000   // Replays are repeated to reach this
+
+namespace {
+
+struct Sample {
+    int64_t timeUs;
+    float yaw;
+    float pitch;
+};
+
+struct Result {
+    size_t samples;
+    int64_t totalX;
+    int64_t totalY;
+    uint32_t checksum;      // motionChecksum of every delta, as `replay` prints it
+};
+
+bool loadSamples(const char *path, std::vector<Sample>& samples) {
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return false;
+    std::vector<uint8_t> data;
+    uint8_t chunk[4096];
+    size_t length;
+    while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        data.insert(data.end(), chunk, chunk + length);
+    fclose(file);
+
+    CaptureReader reader(data.data(), data.size());
+    if (!reader.valid())
+        return false;
+    CaptureRecord record;
+    while (reader.next(record)) {
+        if (record.type == CaptureRecordType::ORIENTATION)
+            samples.push_back(Sample{record.timeUs, record.orientation.yaw, record.orientation.pitch});
+    }
+    return true;
+}
+
+// The defaults of the motion.* settings, as applyMotionSettings uses them
+void configureDefaults(MotionEngine& engine) {
+    const CurvePoint curve[] = {
+        {0.f, 20.f},
+        {30.f, 20.f},
+        {200.f, 60.f},
+    };
+    engine.setCurve(curve, sizeof(curve) / sizeof(curve[0]));
+    engine.configure(MotionConfig{2.f, false, false});
+    engine.setFilter(FilterConfig{FilterKind::ONE_EURO, 1.f, 0.2f, 1.f});
+}
+
+Result replay(const std::vector<Sample>& samples) {
+    MotionEngine engine;
+    configureDefaults(engine);
+    Result result{samples.size(), 0, 0, MOTION_CHECKSUM_SEED};
+    for (const Sample& s : samples) {
+        MotionDelta delta = engine.update(s.yaw, s.pitch, s.timeUs);
+        result.totalX += delta.dx;
+        result.totalY += delta.dy;
+        result.checksum = motionChecksum(result.checksum, delta.dx, delta.dy);
+    }
+    return result;
+}
+
+double nsPerSample(const std::vector<Sample>& samples) {
+    MotionEngine engine;
+    configureDefaults(engine);
+    size_t rounds = BENCHMARK_MIN_SAMPLES / samples.size() + 1;
+    int64_t offsetUs = 0;
+    int64_t span = samples.back().timeUs - samples.front().timeUs + 5000;
+    volatile int32_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round) {
+        // Later rounds carry on in time, so the engine keeps tracking
+        for (const Sample& s : samples) {
+            MotionDelta delta = engine.update(s.yaw, s.pitch, s.timeUs + offsetUs);
+            sink = sink + delta.dx + delta.dy;
+        }
+        offsetUs += span;
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (rounds * samples.size());
+}
+
+std::string expectedPath(const char *capture) {
+    std::string path(capture);
+    size_t dot = path.rfind('.');
+    if (dot != std::string::npos && path.find('/', dot) == std::string::npos)
+        path.erase(dot);
+    return path + ".expected";
+}
+
+bool readExpected(const std::string& path, Result& expected) {
+    FILE *file = fopen(path.c_str(), "r");
+    if (!file)
+        return false;
+    bool ok = fscanf(file, "samples %zu x %" SCNd64 " y %" SCNd64 " checksum %" SCNx32,
+        &expected.samples, &expected.totalX, &expected.totalY, &expected.checksum) == 4;
+    fclose(file);
+    return ok;
+}
+
+bool writeExpected(const std::string& path, const Result& result) {
+    FILE *file = fopen(path.c_str(), "w");
+    if (!file)
+        return false;
+    fprintf(file, "samples %zu x %" PRId64 " y %" PRId64 " checksum %08" PRIx32 "\n",
+        result.samples, result.totalX, result.totalY, result.checksum);
+    return fclose(file) == 0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+    int first = update ? 2 : 1;
+    if (argc <= first) {
+        fprintf(stderr, "Usage: %s [--update] <capture>...\n", argv[0]);
+        return 2;
+    }
+
+    int failures = 0;
+    for (int i = first; i < argc; ++i) {
+        std::vector<Sample> samples;
+        if (!loadSamples(argv[i], samples) || samples.empty()) {
+            fprintf(stderr, "%s: not a capture with orientation samples\n", argv[i]);
+            return 2;
+        }
+        Result result = replay(samples);
+        // Replaying twice must give the same motion
+        Result again = replay(samples);
+        bool repeatable = again.checksum == result.checksum && again.totalX == result.totalX && again.totalY == result.totalY;
+        printf("%s: %zu samples, x %" PRId64 ", y %" PRId64 ", checksum %08" PRIx32 ", %.1f ns per sample\n",
+            argv[i], result.samples, result.totalX, result.totalY, result.checksum, nsPerSample(samples));
+        if (!repeatable) {
+            printf("  FAIL: a second replay gave different motion\n");
+            ++failures;
+            continue;
+        }
+
+        std::string path = expectedPath(argv[i]);
+        if (update) {
+            if (!writeExpected(path, result)) {
+                fprintf(stderr, "Can't write %s\n", path.c_str());
+                return 2;
+            }
+            printf("  wrote %s\n", path.c_str());
+            continue;
+        }
+        Result expected;
+        if (!readExpected(path, expected)) {
+            fprintf(stderr, "Can't read %s; create it with --update\n", path.c_str());
+            return 2;
+        }
+        if (expected.samples != result.samples || expected.totalX != result.totalX ||
+                expected.totalY != result.totalY || expected.checksum != result.checksum) {
+            printf("  FAIL: expected %zu samples, x %" PRId64 ", y %" PRId64 ", checksum %08" PRIx32 "\n",
+                expected.samples, expected.totalX, expected.totalY, expected.checksum);
+            ++failures;
+        } else
+            printf("  pass\n");
+    }
+    return failures ? 1 : 0;
+}
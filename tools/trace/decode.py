@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""Decodes binary trace dumps printed by the `trace dump` shell command.
+
+Firmware built with BINARY_TRACE (e.g. the pro_trace environment) records the
+address of each TRACE format string instead of formatting it, so the ELF of
+the same build doubles as the table of format strings:
+
+    tools/trace/decode.py .pio/build/pro_trace/firmware.elf capture.txt
+
+The capture is any text containing one or more dumps, such as a saved
+terminal session. Records of all tasks are merged in timestamp order.
+"""
+
+import argparse
+import base64
+import re
+import struct
+import sys
+
+SHT_PROGBITS = 1
+SHF_ALLOC = 0x2
+
+HEADER = struct.Struct('<IIB')
+
+# printf conversions, split into flags/width/precision, length and type
+CONVERSION = re.compile(
+    r'%([-+ #0]*(?:\*|\d+)?(?:\.(?:\*|\d+))?)(hh|h|ll|l|j|z|t|L)?([diouxXeEfFgGaAcspn%])')
+
+
+class FormatTable:
+    """Reads format strings out of the allocated sections of an ELF32 file."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.image = f.read()
+        if self.image[:4] != b'\x7fELF' or self.image[4] != 1:
+            sys.exit('%s is not a 32-bit ELF file' % path)
+        shoff, = struct.unpack_from('<I', self.image, 0x20)
+        shentsize, shnum = struct.unpack_from('<HH', self.image, 0x2e)
+        self.sections = []
+        for i in range(shnum):
+            (_, kind, flags, addr, offset, size) = struct.unpack_from(
+                '<IIIIII', self.image, shoff + i * shentsize)
+            if kind == SHT_PROGBITS and flags & SHF_ALLOC and size:
+                self.sections.append((addr, offset, size))
+        self.cache = {}
+
+    def lookup(self, address):
+        if address not in self.cache:
+            self.cache[address] = None
+            for addr, offset, size in self.sections:
+                if addr <= address < addr + size:
+                    start = offset + address - addr
+                    end = self.image.index(b'\0', start)
+                    self.cache[address] = self.image[start:end].decode(
+                        'utf-8', 'replace')
+                    break
+        return self.cache[address]
+
+
+def render(fmt, payload):
+    """Formats a record's payload the way printf would have on the device."""
+    pos = 0
+    out = []
+    last = 0
+    for match in CONVERSION.finditer(fmt):
+        out.append(fmt[last:match.start()])
+        last = match.end()
+        spec, length, kind = match.groups()
+        if kind == '%':
+            out.append('%')
+            continue
+        if '*' in spec:
+            raise ValueError('`*` widths are not supported')
+        if kind == 's':
+            size = payload[pos]
+            value = payload[pos + 1:pos + 1 + size].decode('utf-8', 'replace')
+            pos += 1 + size
+        elif kind in 'eEfFgGaA':
+            value, = struct.unpack_from('<f', payload, pos)
+            pos += 4
+            kind = 'f' if kind in 'aA' else kind
+        elif length in ('ll', 'j'):
+            value, = struct.unpack_from('<q' if kind in 'di' else '<Q',
+                                        payload, pos)
+            pos += 8
+        else:
+            value, = struct.unpack_from('<i' if kind in 'di' else '<I',
+                                        payload, pos)
+            pos += 4
+            if kind == 'p':
+                spec, kind = '#', 'x'
+            elif kind == 'c':
+                value = chr(value & 0xff)
+        if kind in 'iu':
+            kind = 'd'
+        out.append(('%' + spec + kind) % value)
+    out.append(fmt[last:])
+    if pos != len(payload):
+        raise ValueError('payload does not match the format')
+    return ''.join(out)
+
+
+def parse_records(data):
+    """Splits a task's bytes into (format address, timestamp, payload)."""
+    pos = 0
+    while pos + HEADER.size <= len(data):
+        address, timestamp, length = HEADER.unpack_from(data, pos)
+        pos += HEADER.size
+        yield address, timestamp, data[pos:pos + length]
+        pos += length
+
+
+def read_dumps(lines):
+    """Yields each dump in the capture as a list of (task, dropped, bytes)."""
+    tasks = None
+    for line in lines:
+        line = line.strip()
+        if line == '--- trace begin ---':
+            tasks = []
+        elif line == '--- trace end ---' and tasks is not None:
+            yield tasks
+            tasks = None
+        elif tasks is not None and line.startswith('T '):
+            _, dropped, name = line.split(' ', 2)
+            tasks.append([name, int(dropped), bytearray()])
+        elif tasks is not None and line.startswith('D ') and tasks:
+            tasks[-1][2] += base64.b64decode(line[2:])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('elf', help='firmware.elf of the traced build')
+    parser.add_argument('capture', nargs='?', type=argparse.FileType('r'),
+                        default=sys.stdin,
+                        help='text containing trace dumps (default: stdin)')
+    args = parser.parse_args()
+
+    formats = FormatTable(args.elf)
+    # Timestamps are the low 32 bits of a microsecond clock, so they wrap
+    # every 71 minutes; track the high bits per task across dumps
+    epochs = {}
+    for tasks in read_dumps(args.capture):
+        records = []
+        for name, dropped, data in tasks:
+            last, high = epochs.get(name, (0, 0))
+            for address, timestamp, payload in parse_records(bytes(data)):
+                if timestamp < last:
+                    high += 1 << 32
+                last = timestamp
+                records.append((high + timestamp, name, address, payload))
+            epochs[name] = (last, high)
+            if dropped:
+                print('%s: %u records dropped so far' % (name, dropped))
+        records.sort(key=lambda record: record[0])
+        for timestamp, name, address, payload in records:
+            fmt = formats.lookup(address)
+            if fmt is None:
+                text = '<unknown format %#010x>' % address
+            else:
+                try:
+                    text = render(fmt, payload).rstrip('\n')
+                except (ValueError, struct.error, IndexError) as error:
+                    text = '<bad record for %r: %s>' % (fmt, error)
+            print('[%12.6f] %-16s %s' % (timestamp / 1e6, name, text))
+
+
+if __name__ == '__main__':
+    main()